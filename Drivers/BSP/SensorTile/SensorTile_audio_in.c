@@ -39,6 +39,7 @@
 /* Includes ------------------------------------------------------------------*/
 #include "stm32l4xx_hal.h"
 #include "SensorTile_audio_in.h"
+#include "SensorTile_audio_in_pcm.h"
 
 /** @addtogroup BSP
 * @{
@@ -73,8 +74,6 @@
 * @{
 */
 
-#define SaturaLH(N, L, H) (((N)<(L))?(L):(((N)>(H))?(H):(N)))
-
 #define OverSampling(__FREQUENCY__) \
 ((__FREQUENCY__ == AUDIO_FREQUENCY_8K)  ? 256 \
   : (__FREQUENCY__ == AUDIO_FREQUENCY_11K) ? 256 \
@@ -109,6 +108,9 @@ DFSDM_Filter_HandleTypeDef haudio_in_dfsdmfilter[MAX_CH_NUMBER];
 DMA_HandleTypeDef hdma_dfsdmReg_FLT[MAX_CH_NUMBER];
 int32_t RecBuff[MAX_CH_NUMBER][MAX_SAMPLES_PER_CH];
 static uint16_t AudioInVolume = DEFAULT_AUDIO_IN_VOLUME;
+static uint32_t AudioInProcessCycles = 0;
+static uint32_t AudioInProcessMaxCycles = 0;
+static SENSORTILE_AudioIn_LevelTypeDef AudioInLevels[MAX_CH_NUMBER];
 
 /**
 * @}
@@ -119,10 +121,12 @@ static uint16_t AudioInVolume = DEFAULT_AUDIO_IN_VOLUME;
 */ 
 
 static void DFSDMx_FilterMspInit(DFSDM_Filter_HandleTypeDef *hdfsdm_filter);
-static uint8_t DFSDMx_Init(uint32_t AudioFreq, uint32_t ChnlNbr);
+static uint8_t DFSDMx_Init(uint32_t ChnlNbr, const SENSORTILE_AudioIn_DecimationTypeDef *Decimation);
+static void DFSDMx_DefaultDecimation(uint32_t AudioFreq, SENSORTILE_AudioIn_DecimationTypeDef *Decimation);
 static uint8_t DFSDMx_DeInit(void);
 static void DFSDMx_ChannelMspDeInit(DFSDM_Channel_HandleTypeDef *hdfsdm_channel);
 static void DFSDMx_FilterMspDeInit(DFSDM_Filter_HandleTypeDef *hdfsdm_filter);
+static void DFSDMx_ProcessBlock(uint32_t Offset);
 
 /**
 * @}
@@ -145,16 +149,52 @@ static void DFSDMx_FilterMspDeInit(DFSDM_Filter_HandleTypeDef *hdfsdm_filter);
 */
 uint8_t BSP_AUDIO_IN_Init(uint32_t AudioFreq, uint32_t BitRes, uint32_t ChnlNbr) 
 {
+  SENSORTILE_AudioIn_DecimationTypeDef Decimation;
+  
+  DFSDMx_DefaultDecimation(AudioFreq, &Decimation);
+  return BSP_AUDIO_IN_InitEx(AudioFreq, ChnlNbr, &Decimation);
+}
+
+/**
+* @brief  Initializes audio acquisition with an explicit decimation setup.
+* @param  AudioFreq: Audio frequency obtained with the given decimation.
+* @param  ChnlNbr: Number of channel to be configured, see BSP_AUDIO_IN_Init().
+* @param  Decimation: DFSDM clock divider, sinc filter and output shift, it is
+*         also handed to BSP_AUDIO_IN_ClockConfig() as its Params argument.
+* @note   The audio clock feeding the DFSDM is divided by ClockDivider to get
+*         the microphone clock, which is then decimated by Oversampling, so
+*         AudioFreq must match that ratio. Call BSP_AUDIO_IN_DeInit() before
+*         initializing again with another setup.
+* @retval AUDIO_OK if correct communication, else wrong communication
+*/
+uint8_t BSP_AUDIO_IN_InitEx(uint32_t AudioFreq, uint32_t ChnlNbr,
+                            const SENSORTILE_AudioIn_DecimationTypeDef *Decimation) 
+{
+  uint32_t counter = 0;
+  
+  if ((Decimation == NULL) || (AudioFreq > MAX_FS))
+  {
+    return AUDIO_ERROR;
+  }
   
   /*Set Structure for internal state*/
   SENSORTILE_AudioIn_Handler.MicChannels = ChnlNbr;
   SENSORTILE_AudioIn_Handler.Sampling_Freq = AudioFreq;
+  for (counter = 0; counter < MAX_CH_NUMBER; counter++)
+  {
+    SENSORTILE_AudioIn_Handler.HP_Filters[counter].Z = 0;
+    SENSORTILE_AudioIn_Handler.HP_Filters[counter].oldIn = 0;
+    SENSORTILE_AudioIn_Handler.HP_Filters[counter].oldOut = 0;
+  }
   
   /*PLL and Clocks config*/
-  BSP_AUDIO_IN_ClockConfig(SENSORTILE_AudioIn_Handler.Sampling_Freq, NULL);
+  if (BSP_AUDIO_IN_ClockConfig(SENSORTILE_AudioIn_Handler.Sampling_Freq, (void *)Decimation) != AUDIO_OK)
+  {
+    return AUDIO_ERROR;
+  }
   
   /*DFSDM configuration*/
-  return DFSDMx_Init(AudioFreq, ChnlNbr);
+  return DFSDMx_Init(ChnlNbr, Decimation);
 }
 
 /**
@@ -210,6 +250,7 @@ uint8_t BSP_AUDIO_IN_Record(uint16_t* pbuf, uint32_t size)
 {  
   int32_t counter = 0;
   SENSORTILE_AudioIn_Handler.PCM_Data = pbuf;
+  SENSORTILE_AudioIn_Handler.PCM_ChannelStride = 0;
   
   for (counter = SENSORTILE_AudioIn_Handler.MicChannels; counter > 0; counter --)
   {
@@ -223,6 +264,46 @@ uint8_t BSP_AUDIO_IN_Record(uint16_t* pbuf, uint32_t size)
   return AUDIO_OK;
 }
 
+/**
+* @brief  Redirects the PCM output of the next converted block.
+* @param  * pbuf: Buffer that will contain the next 1 ms of PCM for each microphone,
+same dimension as the one passed to BSP_AUDIO_IN_Record().
+* @note   Meant to be called from the transfer callbacks, so the application
+*         can chain its own buffers instead of copying each block out
+* @retval AUDIO_OK in case of success, AUDIO_ERROR otherwise 
+*/
+uint8_t BSP_AUDIO_IN_SetBuffer(uint16_t* pbuf) 
+{
+  if (pbuf == NULL)
+  {
+    return AUDIO_ERROR;
+  }
+  
+  SENSORTILE_AudioIn_Handler.PCM_Data = pbuf;
+  return AUDIO_OK;
+}
+
+/**
+* @brief  Redirects the PCM output of the next converted block to planar buffers.
+* @param  * pbuf: Buffer that will contain the next 1 ms of PCM of the first
+microphone, microphone n is written at pbuf + n * ChannelStride.
+* @param  ChannelStride: distance in samples between two channel planes,
+0 selects the interleaved layout of BSP_AUDIO_IN_Record().
+* @note   Each plane receives (PCM sampling frequency)/1000 contiguous samples
+* @retval AUDIO_OK in case of success, AUDIO_ERROR otherwise 
+*/
+uint8_t BSP_AUDIO_IN_SetPlanarBuffer(uint16_t* pbuf, uint32_t ChannelStride) 
+{
+  if (pbuf == NULL)
+  {
+    return AUDIO_ERROR;
+  }
+  
+  SENSORTILE_AudioIn_Handler.PCM_Data = pbuf;
+  SENSORTILE_AudioIn_Handler.PCM_ChannelStride = ChannelStride;
+  return AUDIO_OK;
+}
+
 /**
 * @brief  Stops audio recording.
 * @param  None
@@ -298,6 +379,47 @@ uint8_t BSP_AUDIO_IN_SetVolume(uint8_t Volume)
   return AUDIO_OK;
 }
 
+/**
+* @brief  Gets the cost of the PCM conversion done in the DMA callbacks.
+* @param  Last: cycles spent converting the most recent half buffer
+* @param  Max: worst case since the last call, reset on read
+* @note   Cycles are read from DWT->CYCCNT, the counter must be enabled
+*         by the application otherwise both values stay at zero
+* @retval AUDIO_OK in case of success, AUDIO_ERROR otherwise 
+*/
+uint8_t BSP_AUDIO_IN_GetProcessCycles(uint32_t *Last, uint32_t *Max)
+{
+  if ((Last == NULL) || (Max == NULL))
+  {
+    return AUDIO_ERROR;
+  }
+  
+  *Last = AudioInProcessCycles;
+  *Max = AudioInProcessMaxCycles;
+  AudioInProcessMaxCycles = 0;
+  return AUDIO_OK;
+}
+
+/**
+* @brief  Gets the level of the block last converted on a channel.
+* @param  Channel: microphone channel, 0 up to the number of channels - 1
+* @param  Level: energy and peak of the block, in PCM units
+* @note   Level is computed by the DMA callbacks while converting, it is
+*         meant to be read from BSP_AUDIO_IN_HalfTransfer_CallBack() and
+*         BSP_AUDIO_IN_TransferComplete_CallBack()
+* @retval AUDIO_OK in case of success, AUDIO_ERROR otherwise 
+*/
+uint8_t BSP_AUDIO_IN_GetLevel(uint32_t Channel, SENSORTILE_AudioIn_LevelTypeDef *Level)
+{
+  if ((Level == NULL) || (Channel >= SENSORTILE_AudioIn_Handler.MicChannels))
+  {
+    return AUDIO_ERROR;
+  }
+  
+  *Level = AudioInLevels[Channel];
+  return AUDIO_OK;
+}
+
 /**
 * @brief  Audio IN Error callback function
 * @param  None
@@ -318,34 +440,48 @@ __weak void BSP_AUDIO_IN_Error_Callback(void)
 */ 
 
 /**
-* @brief  Initializes the Digital Filter for Sigma-Delta Modulators interface (DFSDM).
+* @brief  Fills the decimation setup historically used for a given frequency.
 * @param  AudioFreq: Audio frequency to be used to set correctly the DFSDM peripheral.
-* @retval AUDIO_OK if correct communication, else wrong communication
+* @param  Decimation: setup to fill.
+* @retval None
 */
-static uint8_t DFSDMx_Init(uint32_t AudioFreq, uint32_t ChnlNbr) 
-{  
-  uint16_t shift_amount = 0;
-  uint32_t SincOrder = 0;
-  if(OverSampling(AudioFreq) == 32)
+static void DFSDMx_DefaultDecimation(uint32_t AudioFreq, SENSORTILE_AudioIn_DecimationTypeDef *Decimation)
+{
+  Decimation->Oversampling = OverSampling(AudioFreq);
+  Decimation->ClockDivider = ClockDivider(AudioFreq);
+  
+  if(Decimation->Oversampling == 32)
   {
-    shift_amount = 5;
-    SincOrder = DFSDM_FILTER_SINC5_ORDER;
+    Decimation->RightBitShift = 5;
+    Decimation->SincOrder = DFSDM_FILTER_SINC5_ORDER;
   }
-  else if(OverSampling(AudioFreq) == 128)
+  else if(Decimation->Oversampling == 128)
   {
-    shift_amount = 8;
-    SincOrder = DFSDM_FILTER_SINC4_ORDER;
+    Decimation->RightBitShift = 8;
+    Decimation->SincOrder = DFSDM_FILTER_SINC4_ORDER;
   }
-  else if(OverSampling(AudioFreq) == 64)
+  else if(Decimation->Oversampling == 64)
   {
-    shift_amount = 10;
-    SincOrder = DFSDM_FILTER_SINC5_ORDER;
+    Decimation->RightBitShift = 10;
+    Decimation->SincOrder = DFSDM_FILTER_SINC5_ORDER;
   }
-  else if(OverSampling(AudioFreq) == 256)
+  else
   {
-    shift_amount = 4;
-    SincOrder = DFSDM_FILTER_SINC3_ORDER;
+    Decimation->RightBitShift = 4;
+    Decimation->SincOrder = DFSDM_FILTER_SINC3_ORDER;
   } 
+}
+
+/**
+* @brief  Initializes the Digital Filter for Sigma-Delta Modulators interface (DFSDM).
+* @param  ChnlNbr: Number of channel to be configured.
+* @param  Decimation: clock divider, sinc filter and output shift to apply.
+* @retval AUDIO_OK if correct communication, else wrong communication
+*/
+static uint8_t DFSDMx_Init(uint32_t ChnlNbr, const SENSORTILE_AudioIn_DecimationTypeDef *Decimation) 
+{  
+  uint16_t shift_amount = Decimation->RightBitShift;
+  uint32_t SincOrder = Decimation->SincOrder;
   
   if (ChnlNbr == 1)
   {
@@ -353,7 +489,7 @@ static uint8_t DFSDMx_Init(uint32_t AudioFreq, uint32_t ChnlNbr)
     haudio_in_dfsdmchannel[0].Init.OutputClock.Activation   = ENABLE;
     haudio_in_dfsdmchannel[0].Init.OutputClock.Selection    = DFSDM_CHANNEL_OUTPUT_CLOCK_AUDIO;
     /* Set the DFSDM clock OUT audio frequency configuration */
-    haudio_in_dfsdmchannel[0].Init.OutputClock.Divider      = ClockDivider(AudioFreq);
+    haudio_in_dfsdmchannel[0].Init.OutputClock.Divider      = Decimation->ClockDivider;
     haudio_in_dfsdmchannel[0].Init.Input.Multiplexer        = DFSDM_CHANNEL_EXTERNAL_INPUTS;
     haudio_in_dfsdmchannel[0].Init.Input.DataPacking        = DFSDM_CHANNEL_STANDARD_MODE;
     haudio_in_dfsdmchannel[0].Init.Input.Pins               = DFSDM_CHANNEL_SAME_CHANNEL_PINS;
@@ -408,7 +544,7 @@ static uint8_t DFSDMx_Init(uint32_t AudioFreq, uint32_t ChnlNbr)
     haudio_in_dfsdmfilter[0].Init.InjectedParam.ExtTriggerEdge = DFSDM_FILTER_EXT_TRIG_BOTH_EDGES;
     haudio_in_dfsdmfilter[0].Init.FilterParam.SincOrder        = SincOrder;
     /* Set the DFSDM Filters Oversampling to have correct sample rate */
-    haudio_in_dfsdmfilter[0].Init.FilterParam.Oversampling     = OverSampling(AudioFreq);
+    haudio_in_dfsdmfilter[0].Init.FilterParam.Oversampling     = Decimation->Oversampling;
     haudio_in_dfsdmfilter[0].Init.FilterParam.IntOversampling  = 1;  
     haudio_in_dfsdmfilter[0].Instance                          = AUDIO_IN_DFSDM_1st_FILTER;
     
@@ -438,7 +574,7 @@ static uint8_t DFSDMx_Init(uint32_t AudioFreq, uint32_t ChnlNbr)
       haudio_in_dfsdmchannel[0].Init.OutputClock.Activation   = ENABLE;
       haudio_in_dfsdmchannel[0].Init.OutputClock.Selection    = DFSDM_CHANNEL_OUTPUT_CLOCK_AUDIO;
       /* Set the DFSDM clock OUT audio frequency configuration */
-      haudio_in_dfsdmchannel[0].Init.OutputClock.Divider      = ClockDivider(AudioFreq);
+      haudio_in_dfsdmchannel[0].Init.OutputClock.Divider      = Decimation->ClockDivider;
       haudio_in_dfsdmchannel[0].Init.Input.Multiplexer        = DFSDM_CHANNEL_EXTERNAL_INPUTS;
       haudio_in_dfsdmchannel[0].Init.Input.DataPacking        = DFSDM_CHANNEL_STANDARD_MODE;
       haudio_in_dfsdmchannel[0].Init.Input.Pins               = DFSDM_CHANNEL_SAME_CHANNEL_PINS;
@@ -493,7 +629,7 @@ static uint8_t DFSDMx_Init(uint32_t AudioFreq, uint32_t ChnlNbr)
       haudio_in_dfsdmfilter[0].Init.InjectedParam.ExtTriggerEdge = DFSDM_FILTER_EXT_TRIG_BOTH_EDGES;
       haudio_in_dfsdmfilter[0].Init.FilterParam.SincOrder        = SincOrder;
       /* Set the DFSDM Filters Oversampling to have correct sample rate */
-      haudio_in_dfsdmfilter[0].Init.FilterParam.Oversampling     = OverSampling(AudioFreq);
+      haudio_in_dfsdmfilter[0].Init.FilterParam.Oversampling     = Decimation->Oversampling;
       haudio_in_dfsdmfilter[0].Init.FilterParam.IntOversampling  = 1;  
       haudio_in_dfsdmfilter[0].Instance                          = AUDIO_IN_DFSDM_1st_FILTER;
       
@@ -518,7 +654,7 @@ static uint8_t DFSDMx_Init(uint32_t AudioFreq, uint32_t ChnlNbr)
       haudio_in_dfsdmchannel[1].Init.OutputClock.Activation   = ENABLE;
       haudio_in_dfsdmchannel[1].Init.OutputClock.Selection    = DFSDM_CHANNEL_OUTPUT_CLOCK_AUDIO;
       /* Set the DFSDM clock OUT audio frequency configuration */
-      haudio_in_dfsdmchannel[1].Init.OutputClock.Divider      = ClockDivider(AudioFreq);
+      haudio_in_dfsdmchannel[1].Init.OutputClock.Divider      = Decimation->ClockDivider;
       haudio_in_dfsdmchannel[1].Init.Input.Multiplexer        = DFSDM_CHANNEL_EXTERNAL_INPUTS;
       haudio_in_dfsdmchannel[1].Init.Input.DataPacking        = DFSDM_CHANNEL_STANDARD_MODE;
       haudio_in_dfsdmchannel[1].Init.Input.Pins               = DFSDM_CHANNEL_FOLLOWING_CHANNEL_PINS;
@@ -553,7 +689,7 @@ static uint8_t DFSDMx_Init(uint32_t AudioFreq, uint32_t ChnlNbr)
       }    
       haudio_in_dfsdmfilter[1].Init.FilterParam.SincOrder        = SincOrder;
       /* Set the DFSDM Filters Oversampling to have correct sample rate */
-      haudio_in_dfsdmfilter[1].Init.FilterParam.Oversampling     = OverSampling(AudioFreq);
+      haudio_in_dfsdmfilter[1].Init.FilterParam.Oversampling     = Decimation->Oversampling;
       haudio_in_dfsdmfilter[1].Init.FilterParam.IntOversampling  = 1;    
       haudio_in_dfsdmfilter[1].Instance                          = AUDIO_IN_DFSDM_2st_FILTER;    
       
@@ -581,7 +717,7 @@ static uint8_t DFSDMx_Init(uint32_t AudioFreq, uint32_t ChnlNbr)
       haudio_in_dfsdmchannel[2].Init.OutputClock.Activation   = ENABLE;
       haudio_in_dfsdmchannel[2].Init.OutputClock.Selection    = DFSDM_CHANNEL_OUTPUT_CLOCK_AUDIO;
       /* Set the DFSDM clock OUT audio frequency configuration */
-      haudio_in_dfsdmchannel[2].Init.OutputClock.Divider      = ClockDivider(AudioFreq);
+      haudio_in_dfsdmchannel[2].Init.OutputClock.Divider      = Decimation->ClockDivider;
       haudio_in_dfsdmchannel[2].Init.Input.Multiplexer        = DFSDM_CHANNEL_EXTERNAL_INPUTS;
       haudio_in_dfsdmchannel[2].Init.Input.DataPacking        = DFSDM_CHANNEL_STANDARD_MODE;
       haudio_in_dfsdmchannel[2].Init.Input.Pins               = DFSDM_CHANNEL_SAME_CHANNEL_PINS;
@@ -626,7 +762,7 @@ static uint8_t DFSDMx_Init(uint32_t AudioFreq, uint32_t ChnlNbr)
       haudio_in_dfsdmfilter[2].Init.InjectedParam.ExtTriggerEdge = DFSDM_FILTER_EXT_TRIG_BOTH_EDGES;
       haudio_in_dfsdmfilter[2].Init.FilterParam.SincOrder        = SincOrder;
       /* Set the DFSDM Filters Oversampling to have correct sample rate */
-      haudio_in_dfsdmfilter[2].Init.FilterParam.Oversampling     = OverSampling(AudioFreq);
+      haudio_in_dfsdmfilter[2].Init.FilterParam.Oversampling     = Decimation->Oversampling;
       haudio_in_dfsdmfilter[2].Init.FilterParam.IntOversampling  = 1;    
       haudio_in_dfsdmfilter[2].Instance                          = AUDIO_IN_DFSDM_3rd_FILTER;
       
@@ -651,7 +787,7 @@ static uint8_t DFSDMx_Init(uint32_t AudioFreq, uint32_t ChnlNbr)
       haudio_in_dfsdmchannel[3].Init.OutputClock.Activation   = ENABLE;
       haudio_in_dfsdmchannel[3].Init.OutputClock.Selection    = DFSDM_CHANNEL_OUTPUT_CLOCK_AUDIO;
       /* Set the DFSDM clock OUT audio frequency configuration */
-      haudio_in_dfsdmchannel[3].Init.OutputClock.Divider      = ClockDivider(AudioFreq);
+      haudio_in_dfsdmchannel[3].Init.OutputClock.Divider      = Decimation->ClockDivider;
       haudio_in_dfsdmchannel[3].Init.Input.Multiplexer        = DFSDM_CHANNEL_EXTERNAL_INPUTS;
       haudio_in_dfsdmchannel[3].Init.Input.DataPacking        = DFSDM_CHANNEL_STANDARD_MODE;
       haudio_in_dfsdmchannel[3].Init.Input.Pins               = DFSDM_CHANNEL_FOLLOWING_CHANNEL_PINS;
@@ -679,7 +815,7 @@ static uint8_t DFSDMx_Init(uint32_t AudioFreq, uint32_t ChnlNbr)
       haudio_in_dfsdmfilter[3].Init.InjectedParam.ExtTriggerEdge = DFSDM_FILTER_EXT_TRIG_BOTH_EDGES;
       haudio_in_dfsdmfilter[3].Init.FilterParam.SincOrder        = SincOrder;
       /* Set the DFSDM Filters Oversampling to have correct sample rate */
-      haudio_in_dfsdmfilter[3].Init.FilterParam.Oversampling     = OverSampling(AudioFreq);
+      haudio_in_dfsdmfilter[3].Init.FilterParam.Oversampling     = Decimation->Oversampling;
       haudio_in_dfsdmfilter[3].Init.FilterParam.IntOversampling  = 1;    
       haudio_in_dfsdmfilter[3].Instance                          = AUDIO_IN_DFSDM_4th_FILTER;
       
@@ -857,52 +993,81 @@ static void DFSDMx_FilterMspDeInit(DFSDM_Filter_HandleTypeDef *hdfsdm_filter)
   HAL_DMA_DeInit(hdma_dfsdmReg);
 }
 
+/**
+* @brief  Converts one half of the DFSDM record buffers to PCM.
+* @note   Performs an HP filter in order to remove DC offset and arranges PCM
+*         data following the standard PCM format. Interleaved channels are
+*         handled in pairs (2 or 4 microphones) or alone (onboard microphone),
+*         planar channels one after the other.
+* @param  Offset: first sample of the half to convert in each record buffer
+* @retval None
+*/
+static void DFSDMx_ProcessBlock(uint32_t Offset)
+{
+  uint32_t start = DWT->CYCCNT;
+  uint32_t channels = SENSORTILE_AudioIn_Handler.MicChannels;
+  uint32_t samples = SENSORTILE_AudioIn_Handler.Sampling_Freq / 1000;
+  uint32_t stride = SENSORTILE_AudioIn_Handler.PCM_ChannelStride;
+  uint16_t *pcm = SENSORTILE_AudioIn_Handler.PCM_Data;
+  uint32_t j;
+  
+  if (stride != 0)
+  {
+    /* planar layout, every channel is a contiguous run of samples */
+    for (j = 0; j < channels; j++)
+    {
+      PCM_HPFilterMono(&RecBuff[j][Offset], pcm + (j * stride), samples, AudioInVolume,
+                       &SENSORTILE_AudioIn_Handler.HP_Filters[j], &AudioInLevels[j]);
+    }
+  }
+  else if (channels == 1)
+  {
+    PCM_HPFilterMono(&RecBuff[0][Offset], pcm, samples, AudioInVolume,
+                     &SENSORTILE_AudioIn_Handler.HP_Filters[0], &AudioInLevels[0]);
+  }
+  else
+  {
+    for (j = 0; j < channels; j += 2)
+    {
+      PCM_HPFilterPair(&RecBuff[j][Offset], &RecBuff[j + 1][Offset], pcm + j, channels,
+                       samples, AudioInVolume, &SENSORTILE_AudioIn_Handler.HP_Filters[j],
+                       &AudioInLevels[j]);
+    }
+  }
+  
+  AudioInProcessCycles = DWT->CYCCNT - start;
+  if (AudioInProcessCycles > AudioInProcessMaxCycles)
+  {
+    AudioInProcessMaxCycles = AudioInProcessCycles;
+  }
+}
+
 /**
 * @brief  Regular conversion complete callback.
-* @note   This function performs an HP filter in order to remove DC offset and arranges PCM data following the standard PCM format.
+* @note   Converts the second half of the record buffers.
 * @param  hdfsdm_filter : DFSDM filter handle.
 * @retval None
 */
 void HAL_DFSDM_FilterRegConvCpltCallback(DFSDM_Filter_HandleTypeDef *hdfsdm_filter)
 {  
-  uint32_t i, j = 0;
-  
   if (hdfsdm_filter == &haudio_in_dfsdmfilter[0]) 
   {
-    for(j=0; j < SENSORTILE_AudioIn_Handler.MicChannels; j ++)
-    {
-      for (i = 0; i < SENSORTILE_AudioIn_Handler.Sampling_Freq / 1000; i++)
-      {
-        SENSORTILE_AudioIn_Handler.HP_Filters[j].Z = ((RecBuff[j][i + SENSORTILE_AudioIn_Handler.Sampling_Freq / 1000] >> 8) * AudioInVolume) >> 7;
-        SENSORTILE_AudioIn_Handler.HP_Filters[j].oldOut = (0xFC * (SENSORTILE_AudioIn_Handler.HP_Filters[j].oldOut + SENSORTILE_AudioIn_Handler.HP_Filters[j].Z - SENSORTILE_AudioIn_Handler.HP_Filters[j].oldIn)) / 256;
-        SENSORTILE_AudioIn_Handler.HP_Filters[j].oldIn = SENSORTILE_AudioIn_Handler.HP_Filters[j].Z;
-        SENSORTILE_AudioIn_Handler.PCM_Data[i * SENSORTILE_AudioIn_Handler.MicChannels + j] = SaturaLH(SENSORTILE_AudioIn_Handler.HP_Filters[j].oldOut, -32760, 32760);
-      }		
-    }
+    DFSDMx_ProcessBlock(SENSORTILE_AudioIn_Handler.Sampling_Freq / 1000);
     BSP_AUDIO_IN_TransferComplete_CallBack();
   }  
 }
 
 /**
 * @brief  Half regular conversion complete callback.
+* @note   Converts the first half of the record buffers.
 * @param  hdfsdm_filter : DFSDM filter handle.
 * @retval None
 */
 void HAL_DFSDM_FilterRegConvHalfCpltCallback(DFSDM_Filter_HandleTypeDef *hdfsdm_filter) 
 {  
-  uint32_t i, j = 0;  
   if (hdfsdm_filter == &haudio_in_dfsdmfilter[0]) 
   {
-    for(j=0; j < SENSORTILE_AudioIn_Handler.MicChannels; j ++)
-    {
-      for (i = 0; i < SENSORTILE_AudioIn_Handler.Sampling_Freq / 1000; i++)
-      {
-        SENSORTILE_AudioIn_Handler.HP_Filters[j].Z = ((RecBuff[j][i] >> 8) * AudioInVolume) >> 7;
-        SENSORTILE_AudioIn_Handler.HP_Filters[j].oldOut = (0xFC * (SENSORTILE_AudioIn_Handler.HP_Filters[j].oldOut + SENSORTILE_AudioIn_Handler.HP_Filters[j].Z - SENSORTILE_AudioIn_Handler.HP_Filters[j].oldIn)) / 256;
-        SENSORTILE_AudioIn_Handler.HP_Filters[j].oldIn = SENSORTILE_AudioIn_Handler.HP_Filters[j].Z;
-        SENSORTILE_AudioIn_Handler.PCM_Data[i * SENSORTILE_AudioIn_Handler.MicChannels + j] = SaturaLH(SENSORTILE_AudioIn_Handler.HP_Filters[j].oldOut, -32760, 32760);        
-      }		
-    }
+    DFSDMx_ProcessBlock(0);
     BSP_AUDIO_IN_HalfTransfer_CallBack();
   }
 }
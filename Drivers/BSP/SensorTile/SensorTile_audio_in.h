@@ -83,9 +83,36 @@ extern "C" {
     uint16_t * PCM_Data;                        /*!< Takes track of the external PCM data buffer
     as passed by the user in the start function*/
     
+    uint32_t PCM_ChannelStride;                 /*!< Distance in samples between channel planes,
+    0 when the PCM data is interleaved*/
+    
   } 
   SENSORTILE_AudioIn_HandlerTypeDef;
   
+  /**
+  * @brief   DFSDM decimation setup of one capture rate
+  */
+  typedef struct {
+    uint32_t ClockDivider;                      /*!< Audio clock divider giving the microphone clock */
+    
+    uint32_t Oversampling;                      /*!< Sinc filter decimation ratio */
+    
+    uint32_t SincOrder;                         /*!< Sinc filter order, DFSDM_FILTER_SINCx_ORDER */
+    
+    uint32_t RightBitShift;                     /*!< Channel output shift keeping the result in 24 bits */
+  }
+  SENSORTILE_AudioIn_DecimationTypeDef;
+  
+  /**
+  * @brief   Level of one converted block of a channel
+  */
+  typedef struct {
+    uint64_t Energy;                            /*!< Sum of the squared PCM samples */
+    
+    uint32_t Peak;                              /*!< Largest absolute PCM sample */
+  }
+  SENSORTILE_AudioIn_LevelTypeDef;
+  
   /**
   * @}
   */
@@ -245,12 +272,18 @@ extern "C" {
   */  
   uint8_t BSP_AUDIO_IN_SetVolume(uint8_t Volume);
   uint8_t BSP_AUDIO_IN_Init(uint32_t AudioFreq, uint32_t BitRes, uint32_t ChnlNbr);
+  uint8_t BSP_AUDIO_IN_InitEx(uint32_t AudioFreq, uint32_t ChnlNbr,
+                              const SENSORTILE_AudioIn_DecimationTypeDef *Decimation);
   uint8_t BSP_AUDIO_IN_DeInit(void);
   uint8_t BSP_AUDIO_IN_ClockConfig(uint32_t AudioFreq, void *Params);
   uint8_t BSP_AUDIO_IN_Record(uint16_t* pbuf, uint32_t size);
+  uint8_t BSP_AUDIO_IN_SetBuffer(uint16_t* pbuf);
+  uint8_t BSP_AUDIO_IN_SetPlanarBuffer(uint16_t* pbuf, uint32_t ChannelStride);
   uint8_t BSP_AUDIO_IN_Stop(void);
   uint8_t BSP_AUDIO_IN_Pause(void);
   uint8_t BSP_AUDIO_IN_Resume(void);
+  uint8_t BSP_AUDIO_IN_GetProcessCycles(uint32_t *Last, uint32_t *Max);
+  uint8_t BSP_AUDIO_IN_GetLevel(uint32_t Channel, SENSORTILE_AudioIn_LevelTypeDef *Level);
   
   /* User Callbacks: user has to implement these functions in his code if they are needed. */
   /* These functions should be implemented by the user application.*/
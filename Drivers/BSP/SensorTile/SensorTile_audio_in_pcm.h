@@ -0,0 +1,272 @@
+/**
+******************************************************************************
+* @file    SensorTile_audio_in_pcm.h
+* @author  Central Labs
+* @version V1.3.2
+* @date    11-Jul-2017
+* @brief   DFSDM to PCM conversion kernel of SensorTile_audio_in.c, kept in a
+*          header so the host tools build and time the same code. Output is
+*          clamped to +/-32760 as the original per sample loop did.
+******************************************************************************
+* @attention
+*
+* <h2><center>&copy; COPYRIGHT(c) 2014 STMicroelectronics</center></h2>
+*
+* Redistribution and use in source and binary forms, with or without modification,
+* are permitted provided that the following conditions are met:
+*   1. Redistributions of source code must retain the above copyright notice,
+*      this list of conditions and the following disclaimer.
+*   2. Redistributions in binary form must reproduce the above copyright notice,
+*      this list of conditions and the following disclaimer in the documentation
+*      and/or other materials provided with the distribution.
+*   3. Neither the name of STMicroelectronics nor the names of its contributors
+*      may be used to endorse or promote products derived from this software
+*      without specific prior written permission.
+*
+* THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+* AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+* IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+* DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+* FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+* DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+* SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+* CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+* OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+* OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*
+******************************************************************************
+*/
+
+/* Define to prevent recursive inclusion -------------------------------------*/
+#ifndef __SENSORTILE_AUDIO_IN_PCM_H
+#define __SENSORTILE_AUDIO_IN_PCM_H
+
+/* Included after SensorTile_audio_in.h, or the host stand in of its types */
+
+#define SaturaLH(N, L, H) (((N)<(L))?(L):(((N)>(H))?(H):(N)))
+
+/* Output limit of the original per sample loop, SSAT only clamps to a
+   power of two so the limit is kept with a compare */
+#define PCM_SAT_LIMIT           32760
+
+/**
+* @brief  Clamps a filtered sample to the PCM output range.
+* @param  N: filtered sample, evaluated once
+* @retval Sample in +/-PCM_SAT_LIMIT
+*/
+static inline int32_t PCM_Sat16(int32_t N)
+{
+  return SaturaLH(N, -PCM_SAT_LIMIT, PCM_SAT_LIMIT);
+}
+
+/* Packing of two PCM samples in a word and sum of their squares, the DSP
+   extension does each in a single instruction (PKHBT, SMLALD), the plain
+   C variant is the host reference */
+#if defined(ARM_MATH_CM4)
+#define PCM_Pack16(LO, HI)      __PKHBT((LO), (HI), 16)
+#define PCM_Energy2(P, E)       __SMLALD((P), (P), (E))
+#else
+#define PCM_Pack16(LO, HI)      (((uint32_t)(LO) & 0xFFFFU) | ((uint32_t)(HI) << 16))
+
+static inline uint64_t PCM_Energy2(uint32_t P, uint64_t E)
+{
+  int32_t lo = (int16_t)(P & 0xFFFFU);
+  int32_t hi = (int16_t)(P >> 16);
+  
+  return E + (uint64_t)(lo * lo) + (uint64_t)(hi * hi);
+}
+#endif
+
+/**
+* @brief  One step of the DC removal high pass filter.
+* @param  In: raw DFSDM sample
+* @param  Volume: volume gain, same range as BSP_AUDIO_IN_SetVolume()
+* @param  OldIn: previous filter input, updated
+* @param  OldOut: previous filter output, updated
+* @retval Filtered sample, not yet saturated
+*/
+static inline int32_t PCM_HPFilterStep(int32_t In, int32_t Volume, int32_t *OldIn, int32_t *OldOut)
+{
+  int32_t z = ((In >> 8) * Volume) >> 7;
+  
+  *OldOut = (0xFC * (*OldOut + z - *OldIn)) / 256;
+  *OldIn = z;
+  return *OldOut;
+}
+
+/**
+* @brief  Tracks the peak of one PCM sample.
+* @param  Sample: saturated PCM sample
+* @param  Peak: largest absolute sample, updated
+* @retval None
+*/
+static inline void PCM_PeakStep(int32_t Sample, int32_t *Peak)
+{
+  int32_t mag = (Sample < 0) ? -Sample : Sample;
+  
+  if (mag > *Peak)
+  {
+    *Peak = mag;
+  }
+}
+
+/**
+* @brief  Converts a block of a single channel to PCM.
+* @note   Filter state is kept in registers for the whole block and two
+*         samples are saturated, packed, stored per word and squared into
+*         the block energy by a single dual MAC.
+* @param  pIn: DFSDM samples of the channel
+* @param  pOut: PCM destination
+* @param  Samples: number of samples to convert
+* @param  Volume: volume gain
+* @param  pState: filter state of the channel
+* @param  pLevel: level of the converted block
+* @retval None
+*/
+static inline void PCM_HPFilterMono(const int32_t *pIn, uint16_t *pOut, uint32_t Samples,
+                                    int32_t Volume, HP_FilterState_TypeDef *pState,
+                                    SENSORTILE_AudioIn_LevelTypeDef *pLevel)
+{
+  int32_t oldIn = pState->oldIn;
+  int32_t oldOut = pState->oldOut;
+  uint64_t energy = 0;
+  int32_t peak = 0;
+  int32_t a, b;
+  uint32_t p;
+  uint32_t i = 0;
+  
+  if (((uintptr_t)pOut & 0x3U) == 0U)
+  {
+    uint32_t *pOutW = (uint32_t *)pOut;
+    
+    for (; (i + 1U) < Samples; i += 2U)
+    {
+      a = PCM_Sat16(PCM_HPFilterStep(pIn[i], Volume, &oldIn, &oldOut));
+      b = PCM_Sat16(PCM_HPFilterStep(pIn[i + 1U], Volume, &oldIn, &oldOut));
+      p = PCM_Pack16(a, b);
+      *pOutW++ = p;
+      energy = PCM_Energy2(p, energy);
+      PCM_PeakStep(a, &peak);
+      PCM_PeakStep(b, &peak);
+    }
+  }
+  
+  for (; i < Samples; i++)
+  {
+    a = PCM_Sat16(PCM_HPFilterStep(pIn[i], Volume, &oldIn, &oldOut));
+    pOut[i] = a;
+    energy = PCM_Energy2(PCM_Pack16(a, 0), energy);
+    PCM_PeakStep(a, &peak);
+  }
+  
+  pState->oldIn = oldIn;
+  pState->oldOut = oldOut;
+  pState->Z = oldIn;
+  pLevel->Energy = energy;
+  pLevel->Peak = (uint32_t)peak;
+}
+
+/**
+* @brief  Converts a block of two adjacent channels to interleaved PCM.
+* @note   Both filter recursions run side by side, which hides the latency
+*         of each one, two frames are converted per iteration, the energy
+*         of each channel takes one dual MAC per two samples and each output
+*         pair is stored as one word when the destination allows it.
+* @param  pInA: DFSDM samples of the first channel
+* @param  pInB: DFSDM samples of the second channel
+* @param  pOut: PCM destination of the first channel
+* @param  Stride: PCM samples between two frames (number of channels)
+* @param  Samples: number of samples to convert per channel
+* @param  Volume: volume gain
+* @param  pState: filter states of both channels
+* @param  pLevel: levels of both converted blocks
+* @retval None
+*/
+static inline void PCM_HPFilterPair(const int32_t *pInA, const int32_t *pInB, uint16_t *pOut,
+                                    uint32_t Stride, uint32_t Samples, int32_t Volume,
+                                    HP_FilterState_TypeDef *pState,
+                                    SENSORTILE_AudioIn_LevelTypeDef *pLevel)
+{
+  int32_t oldInA = pState[0].oldIn;
+  int32_t oldOutA = pState[0].oldOut;
+  int32_t oldInB = pState[1].oldIn;
+  int32_t oldOutB = pState[1].oldOut;
+  uint64_t energyA = 0, energyB = 0;
+  int32_t peakA = 0, peakB = 0;
+  int32_t a0, b0, a1, b1;
+  uint32_t i = 0;
+  
+  /* the stride is fixed, so every pair is word aligned or none is */
+  if ((((uintptr_t)pOut | (Stride << 1)) & 0x3U) == 0U)
+  {
+    for (; (i + 1U) < Samples; i += 2U)
+    {
+      a0 = PCM_Sat16(PCM_HPFilterStep(pInA[i], Volume, &oldInA, &oldOutA));
+      b0 = PCM_Sat16(PCM_HPFilterStep(pInB[i], Volume, &oldInB, &oldOutB));
+      a1 = PCM_Sat16(PCM_HPFilterStep(pInA[i + 1U], Volume, &oldInA, &oldOutA));
+      b1 = PCM_Sat16(PCM_HPFilterStep(pInB[i + 1U], Volume, &oldInB, &oldOutB));
+      
+      *(uint32_t *)pOut = PCM_Pack16(a0, b0);
+      *(uint32_t *)(pOut + Stride) = PCM_Pack16(a1, b1);
+      pOut += Stride << 1;
+      
+      energyA = PCM_Energy2(PCM_Pack16(a0, a1), energyA);
+      energyB = PCM_Energy2(PCM_Pack16(b0, b1), energyB);
+      PCM_PeakStep(a0, &peakA);
+      PCM_PeakStep(a1, &peakA);
+      PCM_PeakStep(b0, &peakB);
+      PCM_PeakStep(b1, &peakB);
+    }
+  }
+  else
+  {
+    for (; (i + 1U) < Samples; i += 2U)
+    {
+      a0 = PCM_Sat16(PCM_HPFilterStep(pInA[i], Volume, &oldInA, &oldOutA));
+      b0 = PCM_Sat16(PCM_HPFilterStep(pInB[i], Volume, &oldInB, &oldOutB));
+      a1 = PCM_Sat16(PCM_HPFilterStep(pInA[i + 1U], Volume, &oldInA, &oldOutA));
+      b1 = PCM_Sat16(PCM_HPFilterStep(pInB[i + 1U], Volume, &oldInB, &oldOutB));
+      
+      pOut[0] = a0;
+      pOut[1] = b0;
+      pOut[Stride] = a1;
+      pOut[Stride + 1U] = b1;
+      pOut += Stride << 1;
+      
+      energyA = PCM_Energy2(PCM_Pack16(a0, a1), energyA);
+      energyB = PCM_Energy2(PCM_Pack16(b0, b1), energyB);
+      PCM_PeakStep(a0, &peakA);
+      PCM_PeakStep(a1, &peakA);
+      PCM_PeakStep(b0, &peakB);
+      PCM_PeakStep(b1, &peakB);
+    }
+  }
+  
+  /* odd block lengths end on a single frame */
+  if (i < Samples)
+  {
+    a0 = PCM_Sat16(PCM_HPFilterStep(pInA[i], Volume, &oldInA, &oldOutA));
+    b0 = PCM_Sat16(PCM_HPFilterStep(pInB[i], Volume, &oldInB, &oldOutB));
+    pOut[0] = a0;
+    pOut[1] = b0;
+    energyA = PCM_Energy2(PCM_Pack16(a0, 0), energyA);
+    energyB = PCM_Energy2(PCM_Pack16(b0, 0), energyB);
+    PCM_PeakStep(a0, &peakA);
+    PCM_PeakStep(b0, &peakB);
+  }
+  
+  pState[0].oldIn = oldInA;
+  pState[0].oldOut = oldOutA;
+  pState[0].Z = oldInA;
+  pState[1].oldIn = oldInB;
+  pState[1].oldOut = oldOutB;
+  pState[1].Z = oldInB;
+  pLevel[0].Energy = energyA;
+  pLevel[0].Peak = (uint32_t)peakA;
+  pLevel[1].Energy = energyB;
+  pLevel[1].Peak = (uint32_t)peakB;
+}
+
+#endif /* __SENSORTILE_AUDIO_IN_PCM_H */
+
+/************************ (C) COPYRIGHT STMicroelectronics *****END OF FILE****/
@@ -8,39 +8,223 @@
 
 
 
+/** capture profiles, decimation follows the ST defaults for each rate
+ * with a 49.14 MHz audio clock from PLLSAI1
+ */
+static const audio_profile_t audio_profiles[k_audio_max_profiles] = {
+	[k_audio_profile_8k] = {
+		.name = "8k",
+		.sample_rate = AUDIO_FREQUENCY_8K,
+		.frame_size = 512,
+		.decimation = { 24, 256, DFSDM_FILTER_SINC3_ORDER, 4 },
+	},
+	[k_audio_profile_16k] = {
+		.name = "16k",
+		.sample_rate = AUDIO_FREQUENCY_16K,
+		.frame_size = 512,
+		.decimation = { 24, 128, DFSDM_FILTER_SINC4_ORDER, 8 },
+	},
+	[k_audio_profile_32k] = {
+		.name = "32k",
+		.sample_rate = AUDIO_FREQUENCY_32K,
+		.frame_size = 1024,
+		.decimation = { 24, 64, DFSDM_FILTER_SINC5_ORDER, 10 },
+	},
+	[k_audio_profile_48k] = {
+		.name = "48k",
+		.sample_rate = AUDIO_FREQUENCY_48K,
+		.frame_size = 1056,
+		.decimation = { 16, 64, DFSDM_FILTER_SINC5_ORDER, 10 },
+	},
+};
+
 /** internal variables */
-static uint16_t audio_ping_pong_buffer [(AUDIO_SAMPLE_FREQ * AUDIO_CHANNELS)/AUDIO_WINDOW_LEN] = {0};
-static uint16_t audio_frame_ping_pong_buffer[AUDIO_FRAME_SIZE] = {0};
+static uint16_t audio_frame_pool[AUDIO_FRAME_RING_LEN][AUDIO_CHANNELS * AUDIO_FRAME_SIZE] = {{0}};
+static audio_frame_t framebuffer[AUDIO_FRAME_RING_LEN];
+static const audio_profile_t *profile = &audio_profiles[AUDIO_DEFAULT_PROFILE];
+static uint32_t block_size = 0;
 static bool audio_active = false;
 static bool audio_started = false;
-static audio_frame_t framebuffer;
+static bool audio_capturing = false;
+
+/* fill index belongs to the ISR, read index to the main loop */
+static volatile uint32_t fill_index = 0;
+static volatile uint32_t read_index = 0;
 static uint32_t frame_index = 0;
 
+static uint64_t sample_counter = 0;
+static uint32_t frame_sequence = 0;
+
+static volatile uint32_t captured_frames = 0;
+static volatile uint32_t overruns = 0;
+
+/* profile switch waiting for the dsp to give its frame back */
+static const audio_profile_t *pending_profile = NULL;
+static bool pending_restart = false;
+
 /** internal functions */
 
+/**
+ * 	@fn audio_frame_clear_level()
+ *  @brief resets the level accumulated on a frame before it gets filled
+ *
+ *  @param
+ *  @return
+ */
+static void audio_frame_clear_level(audio_frame_t *frame)
+{
+	for(uint32_t ch = 0; ch < AUDIO_CHANNELS; ch++) {
+		frame->energy[ch] = 0;
+		frame->peak[ch] = 0;
+	}
+}
+
 /**
  * 	@fn on_audio_block()
- *  @brief handles new audio incoming block
+ *  @brief handles new audio incoming block, called from DMA IRQ context,
+ *  the BSP already wrote the block of each channel in place into its plane
+ *  so only the DMA target moves
  *
  *  @param
  *  @return
  */
 static void on_audio_block(void)
 {
-	/* fills the audio frame buffer */
-	memcpy(&audio_frame_ping_pong_buffer[frame_index / (sizeof(uint16_t))],
-			&audio_ping_pong_buffer, sizeof(audio_ping_pong_buffer));
+	audio_frame_t *frame = &framebuffer[fill_index];
+	SENSORTILE_AudioIn_LevelTypeDef level;
+	uint32_t next;
+
+	/* level comes for free from the block kernel, the dsp uses it to
+	 * skip silent frames
+	 */
+	for(uint32_t ch = 0; ch < AUDIO_CHANNELS; ch++) {
+		if(BSP_AUDIO_IN_GetLevel(ch, &level) == AUDIO_OK) {
+			frame->energy[ch] += level.Energy;
+			if(level.Peak > frame->peak[ch])
+				frame->peak[ch] = level.Peak;
+		}
+	}
+
+	/* rolling history of the watched mic, the block was just converted */
+	bee_trigger_on_block((const int16_t *)audio_frame_channel(frame,
+			bee_trigger_get_channel()) + frame_index, block_size,
+			sample_counter, profile->sample_rate);
 
-	frame_index += sizeof(audio_ping_pong_buffer);
-	if(frame_index >= AUDIO_FRAME_SIZE) {
-		/* broadcast frame available event and reset environment */
-		BSP_AUDIO_IN_Stop();
-		audio_active = true;
+	frame_index += block_size;
+	sample_counter += block_size;
+	if(frame_index >= frame->size) {
 		frame_index = 0;
-		event_queue_put(k_dsp_incoming_audio_available);
+		frame->timestamp = DWT->CYCCNT;
+		frame->sequence = frame_sequence++;
+		next = (fill_index + 1) % AUDIO_FRAME_RING_LEN;
+
+		if(framebuffer[next].state == k_audio_frame_free) {
+			/* publish the frame and broadcast it is available */
+			frame->state = k_audio_frame_ready;
+			framebuffer[next].state = k_audio_frame_filling;
+			fill_index = next;
+			frame = &framebuffer[next];
+			frame->flags = 0;
+
+			captured_frames++;
+			event_queue_put(k_dsp_incoming_audio_available);
+		} else {
+			/* consumer fell behind, refill the same frame and
+			 * let the ready ones be processed first
+			 */
+			overruns++;
+			frame->flags |= AUDIO_FRAME_GAP;
+		}
+
+		frame->sample_index = sample_counter;
+		audio_frame_clear_level(frame);
+	}
+
+	BSP_AUDIO_IN_SetPlanarBuffer(&frame->audio_buffer[frame_index], frame->size);
+}
+
+
+/**
+ * 	@fn audio_apply_profile()
+ *  @brief sizes the frame pool and setups the BSP for a capture profile
+ *
+ *  @param
+ *  @return
+ */
+static bee_retcode_t audio_apply_profile(const audio_profile_t *p)
+{
+	for(uint32_t i = 0; i < AUDIO_FRAME_RING_LEN; i++) {
+		framebuffer[i].sample_rate = p->sample_rate;
+		framebuffer[i].size = p->frame_size;
+	}
+
+	profile = p;
+	block_size = p->sample_rate / AUDIO_WINDOW_LEN;
+
+	if(BSP_AUDIO_IN_InitEx(p->sample_rate, AUDIO_CHANNELS, &p->decimation) != AUDIO_OK)
+		return(k_bee_err);
+
+	return(k_bee_ret_ok);
+}
+
+/**
+ * 	@fn audio_frame_held()
+ *  @brief tells if a consumer still holds a frame of the pool
+ *
+ *  @param
+ *  @return
+ */
+static bool audio_frame_held(void)
+{
+	for(uint32_t i = 0; i < AUDIO_FRAME_RING_LEN; i++) {
+		if(framebuffer[i].state == k_audio_frame_processing)
+			return(true);
 	}
+
+	return(false);
+}
+
+/**
+ * 	@fn audio_switch_profile()
+ *  @brief reconfigures the BSP for a profile, capture must be stopped
+ *  and the pool not held
+ *
+ *  @param
+ *  @return
+ */
+static bee_retcode_t audio_switch_profile(const audio_profile_t *p, bool restart)
+{
+	bee_retcode_t ret;
+
+	/* DFSDM channels must be released before taking another setup */
+	BSP_AUDIO_IN_DeInit();
+	ret = audio_apply_profile(p);
+
+	if(restart && ret == k_bee_ret_ok)
+		audio_start_capture();
+
+	return(ret);
 }
 
+/**
+ * 	@fn on_audio_released()
+ *  @brief the dsp finished a frame, runs a profile switch that waited
+ *  for it
+ *
+ *  @param
+ *  @return
+ */
+static void on_audio_released(void)
+{
+	const audio_profile_t *p = pending_profile;
+
+	if(p == NULL || audio_frame_held())
+		return;
+
+	pending_profile = NULL;
+	audio_switch_profile(p, pending_restart);
+	pending_restart = false;
+}
 
 /**
  * 	@fn on_audio_start()
@@ -72,13 +256,36 @@ static void on_audio_stop(void)
 
 void audio_acq_init(void)
 {
-	BSP_AUDIO_IN_Init(AUDIO_SAMPLE_FREQ, AUDIO_BIT_RES, AUDIO_CHANNELS);
+	for(uint32_t i = 0; i < AUDIO_FRAME_RING_LEN; i++) {
+		framebuffer[i].audio_buffer = &audio_frame_pool[i][0];
+		framebuffer[i].channels = AUDIO_CHANNELS;
+		framebuffer[i].handle = i;
+		framebuffer[i].state = k_audio_frame_free;
+	}
+
+	audio_apply_profile(&audio_profiles[AUDIO_DEFAULT_PROFILE]);
 	audio_started = true;
 }
 
 void audio_start_capture(void)
 {
-	BSP_AUDIO_IN_Record(&audio_ping_pong_buffer[0], 0);
+	/* capture starts from an empty pool */
+	for(uint32_t i = 0; i < AUDIO_FRAME_RING_LEN; i++)
+		framebuffer[i].state = k_audio_frame_free;
+
+	fill_index = 0;
+	read_index = 0;
+	frame_index = 0;
+	framebuffer[0].state = k_audio_frame_filling;
+	audio_frame_clear_level(&framebuffer[0]);
+
+	/* counters keep running across restarts, the stream is not */
+	framebuffer[0].sample_index = sample_counter;
+	framebuffer[0].flags = (sample_counter != 0) ? AUDIO_FRAME_GAP : 0;
+
+	BSP_AUDIO_IN_Record(framebuffer[0].audio_buffer, 0);
+	BSP_AUDIO_IN_SetPlanarBuffer(framebuffer[0].audio_buffer, framebuffer[0].size);
+	audio_capturing = true;
 
 	/* broadcast the event */
 	event_queue_put(k_audiostartedcapture);
@@ -87,11 +294,55 @@ void audio_start_capture(void)
 void audio_stop_capture(void)
 {
 	BSP_AUDIO_IN_Stop();
+	audio_capturing = false;
 
 	/* broadcast the stopping action */
 	event_queue_put(k_audiostoppedcapture);
 }
 
+bee_retcode_t audio_set_profile(audio_profile_id_t id)
+{
+	bee_retcode_t ret = k_bee_ret_ok;
+	bool capturing = audio_capturing;
+
+	if(id >= k_audio_max_profiles)
+		return(k_bee_ret_invalid_param);
+
+	if(profile == &audio_profiles[id] && pending_profile == NULL)
+		return(k_bee_ret_ok);
+
+	if(capturing)
+		audio_stop_capture();
+
+	/* the dsp still reads a frame of the pool, restarting would hand it
+	 * back to the DMA under it, so the switch waits for its release
+	 */
+	if(audio_frame_held()) {
+		pending_profile = &audio_profiles[id];
+		pending_restart |= capturing;
+		return(k_bee_ret_ok);
+	}
+
+	capturing |= pending_restart;
+	pending_profile = NULL;
+	pending_restart = false;
+	ret = audio_switch_profile(&audio_profiles[id], capturing);
+
+	return(ret);
+}
+
+const audio_profile_t *audio_get_profile(void)
+{
+	return(profile);
+}
+
+audio_profile_id_t audio_get_profile_id(void)
+{
+	const audio_profile_t *p = (pending_profile) ? pending_profile : profile;
+
+	return((audio_profile_id_t)(p - audio_profiles));
+}
+
 audio_frame_t *audio_get_current_frame(void)
 {
 	audio_frame_t *ret = NULL;
@@ -99,33 +350,60 @@ audio_frame_t *audio_get_current_frame(void)
 	if(!audio_active)
 		goto exit_no_audio;
 
-	/* prevent multiple access */
-	audio_active = false;
-	__disable_irq();
-
-	/* take the always the buffer is not being useed to acquire audio */
-	ret = &framebuffer;
-	ret->sample_rate = AUDIO_SAMPLE_FREQ;
-	ret->size = sizeof(audio_frame_ping_pong_buffer)/2;
-	ret->audio_buffer=&audio_frame_ping_pong_buffer[0];
+	/* frames are published in pool order, so the oldest is at read index */
+	if(framebuffer[read_index].state != k_audio_frame_ready)
+		goto exit_no_audio;
 
-	__enable_irq();
-	audio_active = true;
+	ret = &framebuffer[read_index];
+	ret->state = k_audio_frame_processing;
 
 exit_no_audio:
 	return(ret);
 }
 
+uint16_t *audio_frame_channel(audio_frame_t *frame, uint32_t channel)
+{
+	if(frame == NULL || channel >= frame->channels)
+		return(NULL);
+
+	return(&frame->audio_buffer[channel * frame->size]);
+}
+
+void audio_release_frame(audio_frame_t *frame)
+{
+	if(frame == NULL || frame->state != k_audio_frame_processing)
+		return;
+
+	frame->state = k_audio_frame_free;
+	read_index = (frame->handle + 1) % AUDIO_FRAME_RING_LEN;
+}
+
+bee_retcode_t audio_get_stats(audio_stats_t *stats)
+{
+	bee_retcode_t ret = k_bee_ret_invalid_param;
+
+	if(stats) {
+		stats->captured_frames = captured_frames;
+		stats->overruns = overruns;
+		stats->pending_frames = 0;
+
+		for(uint32_t i = 0; i < AUDIO_FRAME_RING_LEN; i++) {
+			if(framebuffer[i].state == k_audio_frame_ready)
+				stats->pending_frames++;
+		}
+
+		ret = k_bee_ret_ok;
+	}
+
+	return(ret);
+}
+
 void audio_handler(system_event_t ev)
 {
 	if(!audio_started)
 		return;
 
 	switch(ev) {
-	case k_audioblockevent:
-		on_audio_block();
-		break;
-
 	case k_audiostartedcapture:
 		on_audio_start();
 		break;
@@ -133,20 +411,36 @@ void audio_handler(system_event_t ev)
 	case k_audiostoppedcapture:
 		on_audio_stop();
 		break;
+
+	case k_dsp_endprocess:
+		on_audio_released();
+		break;
 	}
 }
 
 
+/**
+ * 	@fn BSP_AUDIO_IN_HalfTransfer_CallBack()
+ *  @brief IRQ called by audio internals when the first DMA half is converted
+ *
+ *  @param
+ *  @return
+ */
+void BSP_AUDIO_IN_HalfTransfer_CallBack(void)
+{
+	on_audio_block();
+}
+
 /**
  * 	@fn BSP_AUDIO_IN_TransferComplete_CallBack()
- *  @brief IRQ called by audio internals, defers the audio block event
+ *  @brief IRQ called by audio internals when the second DMA half is converted
  *
  *  @param
  *  @return
  */
 void BSP_AUDIO_IN_TransferComplete_CallBack(void)
 {
-	event_queue_put(k_audioblockevent);
+	on_audio_block();
 }
 
 
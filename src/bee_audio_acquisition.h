@@ -6,29 +6,101 @@
 #ifndef __BEE_AUDIO_ACQUISITION_H
 #define __BEE_AUDIO_ACQUISITION_H
 
-/* define audio sample frequency Hz*/
+/* define the highest audio sample frequency Hz, buffers are sized for it */
 #define AUDIO_SAMPLE_FREQ 	AUDIO_FREQUENCY_48K
 
+/* define the capture profile selected at boot */
+#ifndef AUDIO_DEFAULT_PROFILE
+#define AUDIO_DEFAULT_PROFILE	k_audio_profile_48k
+#endif
+
 /* define audio bit resolution */
 #define AUDIO_BIT_RES		16
 
-/* define the audio nbr of channels */
+/* define the audio nbr of channels, 1 (onboard mic), 2 or 4 (external mics) */
+#ifndef AUDIO_CHANNELS
 #define AUDIO_CHANNELS		1
+#endif
 
 /* define the audio window length s/ms  */
 #define AUDIO_WINDOW_LEN	1000
 
 
-/* define the audio frame size  MUST BE A MULTIPLE of 48*/
+/* define the largest audio block size per channel delivered by each DMA half transfer */
+#define AUDIO_BLOCK_SIZE	(AUDIO_SAMPLE_FREQ/AUDIO_WINDOW_LEN)
+
+/* define the largest audio frame size per channel, each profile frame size
+ * MUST BE A MULTIPLE of its block size and fit in it
+ */
 #define AUDIO_FRAME_SIZE	1056
 
-/** audio frame data structure */
+/* define the number of frames in the capture pool */
+#define AUDIO_FRAME_RING_LEN	4
+
+/* capture pool memory cost of each channel in bytes */
+#define AUDIO_CHANNEL_POOL_BYTES	(AUDIO_FRAME_RING_LEN * AUDIO_FRAME_SIZE * sizeof(uint16_t))
+
+#if (AUDIO_CHANNELS != 1) && (AUDIO_CHANNELS != 2) && (AUDIO_CHANNELS != 4)
+#error "AUDIO_CHANNELS must be 1, 2 or 4"
+#endif
+
+/** audio capture profiles */
+typedef enum {
+	k_audio_profile_8k = 0,
+	k_audio_profile_16k,
+	k_audio_profile_32k,
+	k_audio_profile_48k,
+	k_audio_max_profiles,
+}audio_profile_id_t;
+
+/** audio capture profile, everything that changes with the sample rate */
+typedef struct audio_profile {
+	const char *name;
+	uint32_t sample_rate;
+	uint32_t frame_size;
+	SENSORTILE_AudioIn_DecimationTypeDef decimation;
+}audio_profile_t;
+
+/* frame flags, samples were lost right before the frame */
+#define AUDIO_FRAME_GAP		0x01
+
+/** audio frame ownership states */
+typedef enum {
+	k_audio_frame_free = 0,
+	k_audio_frame_filling,
+	k_audio_frame_ready,
+	k_audio_frame_processing,
+}audio_frame_state_t;
+
+/** audio frame data structure, channels are stored in planes of
+ * size samples, channel n starts at audio_buffer + n * size, energy
+ * and peak of each plane are accumulated by the capture while filling,
+ * sample_index counts the samples captured before the frame since boot,
+ * timestamp is the DWT cycle counter when its last block was converted
+ * and sequence counts every filled frame, dropped ones included
+ */
 typedef struct audio_frame {
 	uint16_t *audio_buffer;
 	uint32_t sample_rate;
 	uint32_t size;
+	uint32_t channels;
+	uint32_t handle;
+	uint64_t sample_index;
+	uint32_t timestamp;
+	uint32_t sequence;
+	uint32_t flags;
+	uint64_t energy[AUDIO_CHANNELS];
+	uint32_t peak[AUDIO_CHANNELS];
+	volatile audio_frame_state_t state;
 }audio_frame_t;
 
+/** audio capture statistics */
+typedef struct audio_stats {
+	uint32_t captured_frames;
+	uint32_t overruns;
+	uint32_t pending_frames;
+}audio_stats_t;
+
 
 /**
  * 	@fn audio_acq_init()
@@ -57,14 +129,75 @@ void audio_start_capture(void);
 void audio_stop_capture(void);
 
 /**
- * 	@fn audio_get_current_frame()
- *  @brief gets the current and most recent available frame
+ * 	@fn audio_set_profile()
+ *  @brief switches the capture to another sample rate profile, DFSDM
+ *         decimation, clocks and frame size are reconfigured together and
+ *         a running capture is restarted, frames not yet processed are lost,
+ *         while the dsp holds a frame capture stops and the switch waits
+ *         for the frame to be released (k_dsp_endprocess)
+ *
+ *  @param
+ *  @return
+ */
+bee_retcode_t audio_set_profile(audio_profile_id_t profile);
+
+/**
+ * 	@fn audio_get_profile()
+ *  @brief gets the capture profile in use
+ *
+ *  @param
+ *  @return
+ */
+const audio_profile_t *audio_get_profile(void);
+
+/**
+ * 	@fn audio_get_profile_id()
+ *  @brief gets the id of the capture profile in use, or of the one a
+ *         pending switch goes to
  *
  *  @param
  *  @return
  */
+audio_profile_id_t audio_get_profile_id(void);
+
+/**
+ * 	@fn audio_get_current_frame()
+ *  @brief gets the oldest ready frame and moves it to processing state,
+ *         the frame stays owned by the caller until audio_release_frame()
+ *
+ *  @param
+ *  @return NULL if no frame is ready
+ */
 audio_frame_t *audio_get_current_frame(void);
 
+/**
+ * 	@fn audio_frame_channel()
+ *  @brief gets the sample plane of one channel of a frame
+ *
+ *  @param
+ *  @return NULL if the channel does not exist
+ */
+uint16_t *audio_frame_channel(audio_frame_t *frame, uint32_t channel);
+
+/**
+ * 	@fn audio_release_frame()
+ *  @brief gives a processed frame back to the capture pool
+ *
+ *  @param
+ *  @return
+ */
+void audio_release_frame(audio_frame_t *frame);
+
+/**
+ * 	@fn audio_get_stats()
+ *  @brief gets the capture counters, overruns are incremented each time
+ *         a frame is completed while the next one in the pool is not free
+ *
+ *  @param
+ *  @return
+ */
+bee_retcode_t audio_get_stats(audio_stats_t *stats);
+
 /**
  * 	@fn audio_handler()
  *  @brief audio appliation event handler
@@ -0,0 +1,232 @@
+/*
+ *  @file bee_baseline.c
+ *  @brief long horizon baseline of the published features of the first
+ *  mic, scores each report against it and raises an event only when a
+ *  feature enters or leaves the anomalous state
+ */
+
+#include "lilbee.h"
+
+
+/** internal types */
+typedef struct bee_baseline_state {
+	uint32_t magic;
+	uint32_t version;
+	bee_baseline_cfg_t config;
+	bee_baseline_report_t report;
+	bee_baseline_stat_t stat[k_baseline_max_features];
+	uint32_t checksum;
+}bee_baseline_state_t;
+
+/** internal variables */
+static bee_baseline_state_t state BEE_RAM2_BSS;
+static const float horizon_tau[k_baseline_max_horizons] = BASELINE_TAU_S;
+
+/** internal functions */
+
+/**
+ * 	@fn baseline_checksum()
+ *  @brief rotating xor of the state words before the checksum
+ *
+ *  @param
+ *  @return
+ */
+static uint32_t baseline_checksum(void)
+{
+	const uint32_t *w = (const uint32_t *)&state;
+	uint32_t words = offsetof(bee_baseline_state_t, checksum) / sizeof(uint32_t);
+	uint32_t ret = BASELINE_MAGIC;
+
+	for(uint32_t i = 0; i < words; i++)
+		ret = ((ret << 5) | (ret >> 27)) ^ w[i];
+
+	return(ret);
+}
+
+/**
+ * 	@fn baseline_score()
+ *  @brief z-score of a value against the reference horizon
+ *
+ *  @param
+ *  @return
+ */
+static float baseline_score(const bee_baseline_stat_t *s, float value)
+{
+	baseline_horizon_t h = state.config.reference;
+	float mean = s->ewma[h];
+
+	/* a flat feature would score infinite on the smallest move */
+	float var = s->ewvar[h] + 1e-6f * mean * mean + 1e-12f;
+
+	return((value - mean) / sqrtf(var));
+}
+
+/**
+ * 	@fn baseline_add()
+ *  @brief adds a value to the statistics of one feature
+ *
+ *  @param
+ *  @return
+ */
+static void baseline_add(bee_baseline_stat_t *s, float value, float dt_s)
+{
+	double delta;
+	float diff;
+	float incr;
+	float alpha;
+
+	s->count++;
+	delta = (double)value - s->mean;
+	s->mean += delta / (double)s->count;
+	s->m2 += delta * ((double)value - s->mean);
+
+	for(uint32_t h = 0; h < k_baseline_max_horizons; h++) {
+		/* a young average is the plain mean, no start up bias */
+		alpha = dt_s / horizon_tau[h];
+		if(alpha < 1.0f / (float)s->count)
+			alpha = 1.0f / (float)s->count;
+
+		diff = value - s->ewma[h];
+		incr = alpha * diff;
+		s->ewma[h] += incr;
+		s->ewvar[h] = (1.0f - alpha) * (s->ewvar[h] + diff * incr);
+	}
+}
+
+/**
+ * 	@fn on_baseline_report()
+ *  @brief collects the features of the first mic after each report
+ *
+ *  @param
+ *  @return
+ */
+static void on_baseline_report(void)
+{
+	static bee_features_t features;
+	float values[k_baseline_max_features];
+	bee_psd_cfg_t psd;
+	float rms;
+	float peak;
+
+	/* the tone bank publishes no spectral features */
+	if(bee_dsp_get_mode() != k_dsp_mode_spectrum)
+		return;
+
+	if(bee_dsp_get_features(0, &features) != k_bee_ret_ok ||
+			bee_dsp_get_channel_level(0, &rms, &peak) != k_bee_ret_ok)
+		return;
+
+	values[k_baseline_aggro] = bee_dsp_get_channel_aggro_level(0);
+	values[k_baseline_rms_db] = 20.0f * log10f(rms + 1e-6f);
+	values[k_baseline_centroid] = features.shape.centroid_hz;
+	values[k_baseline_rolloff] = features.shape.rolloff_hz;
+	values[k_baseline_flatness] = features.shape.flatness;
+	values[k_baseline_flux] = features.shape.flux;
+
+	for(uint32_t b = 0; b < FEATURES_MAX_BANDS; b++) {
+		values[k_baseline_band0 + b] = (b < features.bands) ?
+				features.band[b].ratio : 0.0f;
+	}
+
+	bee_psd_get_config(&psd);
+	if(bee_baseline_update(values, (float)psd.report_ms / 1000.0f))
+		event_queue_put(k_anomaly_changed);
+}
+
+/** public functions */
+
+bool bee_baseline_init(void)
+{
+	/* SRAM2 is not cleared by the startup, a warm reset keeps it */
+	if(state.magic == BASELINE_MAGIC && state.version == BASELINE_VERSION &&
+			state.checksum == baseline_checksum())
+		return(true);
+
+	bee_baseline_reset();
+	return(false);
+}
+
+void bee_baseline_reset(void)
+{
+	memset(&state, 0, sizeof(state));
+	state.magic = BASELINE_MAGIC;
+	state.version = BASELINE_VERSION;
+	state.config.reference = BASELINE_DEFAULT_REFERENCE;
+	state.config.enter_z = BASELINE_DEFAULT_ENTER_Z;
+	state.config.exit_z = BASELINE_DEFAULT_EXIT_Z;
+	state.config.warmup = BASELINE_DEFAULT_WARMUP;
+	state.checksum = baseline_checksum();
+}
+
+bee_retcode_t bee_baseline_config(const bee_baseline_cfg_t *cfg)
+{
+	if(cfg == NULL || cfg->reference >= k_baseline_max_horizons ||
+			cfg->exit_z < 0.0f || cfg->enter_z < cfg->exit_z)
+		return(k_bee_ret_invalid_param);
+
+	state.config = *cfg;
+	state.checksum = baseline_checksum();
+	return(k_bee_ret_ok);
+}
+
+uint32_t bee_baseline_update(const float *values, float dt_s)
+{
+	bee_baseline_report_t *r = &state.report;
+	uint32_t active = r->active;
+	uint32_t bit;
+	float z;
+
+	if(values == NULL || dt_s <= 0.0f)
+		return(0);
+
+	for(uint32_t f = 0; f < k_baseline_max_features; f++) {
+		bit = 1UL << f;
+
+		/* scored before it joins the baseline */
+		z = (state.stat[f].count) ? baseline_score(&state.stat[f], values[f]) : 0.0f;
+		r->z[f] = z;
+
+		if(state.stat[f].count < state.config.warmup)
+			active &= ~bit;
+		else if(fabsf(z) >= state.config.enter_z)
+			active |= bit;
+		else if(fabsf(z) < state.config.exit_z)
+			active &= ~bit;
+
+		baseline_add(&state.stat[f], values[f], dt_s);
+	}
+
+	r->changed = active ^ r->active;
+	r->active = active;
+	r->reports++;
+	state.checksum = baseline_checksum();
+
+	return(r->changed);
+}
+
+bee_retcode_t bee_baseline_get_report(bee_baseline_report_t *report)
+{
+	if(report == NULL)
+		return(k_bee_ret_invalid_param);
+
+	*report = state.report;
+	return(k_bee_ret_ok);
+}
+
+bee_retcode_t bee_baseline_get_stat(baseline_feature_t feature, bee_baseline_stat_t *stat)
+{
+	if(feature >= k_baseline_max_features || stat == NULL)
+		return(k_bee_ret_invalid_param);
+
+	*stat = state.stat[feature];
+	return(k_bee_ret_ok);
+}
+
+void bee_baseline_handler(system_event_t ev)
+{
+	switch(ev) {
+	case k_aggresivity_available:
+		on_baseline_report();
+		break;
+	}
+}
@@ -0,0 +1,144 @@
+/*
+ *  @file bee_baseline.h
+ *  @brief long horizon baseline of the published features of the first
+ *  mic, scores each report against it and raises an event only when a
+ *  feature enters or leaves the anomalous state
+ */
+
+#ifndef __BEE_BASELINE_H
+#define __BEE_BASELINE_H
+
+/* state identification on SRAM2, kept across warm resets */
+#define BASELINE_MAGIC			0x4C534142
+#define BASELINE_VERSION		1
+
+/* EWMA time constants in seconds, minutes, hours and days */
+#define BASELINE_TAU_S			{ 60.0f, 3600.0f, 86400.0f }
+
+/* defaults, hours are the reference and 5 min of reports are needed
+ * before any anomaly is raised
+ */
+#define BASELINE_DEFAULT_REFERENCE	k_baseline_hours
+#define BASELINE_DEFAULT_ENTER_Z	3.0f
+#define BASELINE_DEFAULT_EXIT_Z		2.0f
+#define BASELINE_DEFAULT_WARMUP		300
+
+/** tracked features */
+typedef enum {
+	k_baseline_aggro = 0,
+	k_baseline_rms_db,
+	k_baseline_centroid,
+	k_baseline_rolloff,
+	k_baseline_flatness,
+	k_baseline_flux,
+	k_baseline_band0,
+	k_baseline_band1,
+	k_baseline_band2,
+	k_baseline_band3,
+	k_baseline_max_features,
+}baseline_feature_t;
+
+/** EWMA horizons */
+typedef enum {
+	k_baseline_minutes = 0,
+	k_baseline_hours,
+	k_baseline_days,
+	k_baseline_max_horizons,
+}baseline_horizon_t;
+
+/** statistics of one feature, welford over the whole life and an
+ * exponentially weighted mean and variance per horizon
+ */
+typedef struct bee_baseline_stat {
+	uint32_t count;
+	double mean;
+	double m2;
+	float ewma[k_baseline_max_horizons];
+	float ewvar[k_baseline_max_horizons];
+}bee_baseline_stat_t;
+
+/** anomaly scoring setup, a feature turns anomalous above enter_z and
+ * back to normal below exit_z
+ */
+typedef struct bee_baseline_cfg {
+	baseline_horizon_t reference;
+	float enter_z;
+	float exit_z;
+	uint32_t warmup;
+}bee_baseline_cfg_t;
+
+/** last report scores, bit n of the masks stands for feature n */
+typedef struct bee_baseline_report {
+	uint32_t reports;
+	uint32_t active;
+	uint32_t changed;
+	float z[k_baseline_max_features];
+}bee_baseline_report_t;
+
+
+/**
+ * 	@fn bee_baseline_init()
+ *  @brief keeps the baseline left on SRAM2 by a warm reset when it is
+ *         intact, otherwise starts a new one
+ *
+ *  @param
+ *  @return true when the baseline was kept
+ */
+bool bee_baseline_init(void);
+
+/**
+ * 	@fn bee_baseline_reset()
+ *  @brief starts a new baseline
+ *
+ *  @param
+ *  @return
+ */
+void bee_baseline_reset(void);
+
+/**
+ * 	@fn bee_baseline_config()
+ *  @brief changes the anomaly scoring, the baseline is kept
+ *
+ *  @param
+ *  @return
+ */
+bee_retcode_t bee_baseline_config(const bee_baseline_cfg_t *cfg);
+
+/**
+ * 	@fn bee_baseline_update()
+ *  @brief scores a feature vector against the baseline then adds it
+ *
+ *  @param values - k_baseline_max_features values
+ *  @param dt_s - time since the previous vector
+ *  @return mask of the features that entered or left the anomalous state
+ */
+uint32_t bee_baseline_update(const float *values, float dt_s);
+
+/**
+ * 	@fn bee_baseline_get_report()
+ *  @brief gets the scores of the last vector
+ *
+ *  @param
+ *  @return
+ */
+bee_retcode_t bee_baseline_get_report(bee_baseline_report_t *report);
+
+/**
+ * 	@fn bee_baseline_get_stat()
+ *  @brief gets the statistics of one feature
+ *
+ *  @param
+ *  @return
+ */
+bee_retcode_t bee_baseline_get_stat(baseline_feature_t feature, bee_baseline_stat_t *stat);
+
+/**
+ * 	@fn bee_baseline_handler()
+ *  @brief baseline application handler
+ *
+ *  @param
+ *  @return
+ */
+void bee_baseline_handler(system_event_t ev);
+
+#endif
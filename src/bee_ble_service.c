@@ -7,7 +7,36 @@
 static bee_service_status_t state = k_bee_disconnected;
 static uint16_t bee_service_handle;
 static uint16_t bee_char_aggro_handle;
+static uint16_t bee_char_bands_handle;
+static uint16_t bee_char_table_handle;
+static uint16_t bee_char_anomaly_handle;
+static uint16_t bee_char_spectrogram_handle;
+static uint16_t bee_char_profile_handle;
+static uint16_t bee_char_trigger_handle;
+static uint16_t bee_char_latency_handle;
+static uint8_t bee_hw_version;
 static bee_spectra_t bee_spectra;
+static bee_features_t bee_features;
+
+/* first HCI IRQ not yet served by the main loop */
+static volatile bool hci_pending = false;
+static volatile uint32_t hci_stamp = 0;
+static bee_ble_latency_t hci_latency;
+
+/* spectrogram export, rows row up to end - 1, the current one is copied
+ * out so an overwrite cannot tear it
+ */
+static bool export_active = false;
+static bool export_waiting = false;
+static uint32_t export_row;
+static uint32_t export_end;
+static uint32_t export_offset;
+static bee_spectrogram_row_t export_buf;
+
+/* trigger snapshot export, samples from trigger_offset on */
+static bool trigger_active = false;
+static bool trigger_waiting = false;
+static uint32_t trigger_offset;
 
 /** internal functions */
 
@@ -38,6 +67,7 @@ static void ble_stack_init(void)
 
 	/* get the BlueNRG HW and FW versions */
 	getBlueNRGVersion(&hwVersion, &fwVersion);
+	bee_hw_version = hwVersion;
 
 
 	/*
@@ -93,19 +123,86 @@ static void ble_service_add(void)
 
 	/* creates the service  and add it to database */
 	COPY_CONFIG_SERVICE_UUID(uuid);
-	ret = aci_gatt_add_serv(UUID_TYPE_128, uuid, PRIMARY_SERVICE, 1 + 3,
+	ret = aci_gatt_add_serv(UUID_TYPE_128, uuid, PRIMARY_SERVICE, 1 + 3 + 3 + 2 + 3 + 3 + 2 + 3 + 2,
 			&bee_service_handle);
 
 
 	/* creates the characteristic and adds it to database*/
 	COPY_CONFIG_W2ST_CHAR_UUID(uuid);
 	ret = aci_gatt_add_char(bee_service_handle, UUID_TYPE_128, uuid,
-			4 /* Max Dimension */,
+			sizeof(bee_ble_aggro_payload_t) /* Max Dimension */,
 			CHAR_PROP_NOTIFY,
 			ATTR_PERMISSION_NONE,
 			GATT_DONT_NOTIFY_EVENTS, 16, 0,
 			&bee_char_aggro_handle);
 
+	/* band features, notified with the aggro level */
+	COPY_BEE_BANDS_CHAR_UUID(uuid);
+	ret = aci_gatt_add_char(bee_service_handle, UUID_TYPE_128, uuid,
+			sizeof(bee_ble_bands_payload_t) /* Max Dimension */,
+			CHAR_PROP_NOTIFY,
+			ATTR_PERMISSION_NONE,
+			GATT_DONT_NOTIFY_EVENTS, 16, 0,
+			&bee_char_bands_handle);
+
+	/* band table, written by the peer one band at a time */
+	COPY_BEE_BAND_TABLE_CHAR_UUID(uuid);
+	ret = aci_gatt_add_char(bee_service_handle, UUID_TYPE_128, uuid,
+			sizeof(bee_ble_band_write_t) /* Max Dimension */,
+			CHAR_PROP_WRITE | CHAR_PROP_WRITE_WITHOUT_RESP,
+			ATTR_PERMISSION_NONE,
+			GATT_NOTIFY_ATTRIBUTE_WRITE, 16, 0,
+			&bee_char_table_handle);
+
+	/* anomaly transitions against the colony baseline */
+	COPY_BEE_ANOMALY_CHAR_UUID(uuid);
+	ret = aci_gatt_add_char(bee_service_handle, UUID_TYPE_128, uuid,
+			sizeof(bee_ble_anomaly_payload_t) /* Max Dimension */,
+			CHAR_PROP_NOTIFY,
+			ATTR_PERMISSION_NONE,
+			GATT_DONT_NOTIFY_EVENTS, 16, 0,
+			&bee_char_anomaly_handle);
+
+	/* spectrogram history, the peer writes the rows it wants and gets
+	 * them notified in chunks
+	 */
+	COPY_BEE_SPECTROGRAM_CHAR_UUID(uuid);
+	ret = aci_gatt_add_char(bee_service_handle, UUID_TYPE_128, uuid,
+			sizeof(bee_ble_spectrogram_chunk_t) /* Max Dimension */,
+			CHAR_PROP_NOTIFY | CHAR_PROP_WRITE | CHAR_PROP_WRITE_WITHOUT_RESP,
+			ATTR_PERMISSION_NONE,
+			GATT_NOTIFY_ATTRIBUTE_WRITE, 16, 0,
+			&bee_char_spectrogram_handle);
+
+	/* capture profile, read back by the peer after a switch */
+	COPY_BEE_PROFILE_CHAR_UUID(uuid);
+	ret = aci_gatt_add_char(bee_service_handle, UUID_TYPE_128, uuid,
+			sizeof(bee_ble_profile_payload_t) /* Max Dimension */,
+			CHAR_PROP_READ | CHAR_PROP_WRITE | CHAR_PROP_WRITE_WITHOUT_RESP,
+			ATTR_PERMISSION_NONE,
+			GATT_NOTIFY_ATTRIBUTE_WRITE, 16, 0,
+			&bee_char_profile_handle);
+
+	/* trigger snapshot, announced once frozen, the peer writes the offset
+	 * it wants and gets the samples notified in chunks
+	 */
+	COPY_BEE_TRIGGER_CHAR_UUID(uuid);
+	ret = aci_gatt_add_char(bee_service_handle, UUID_TYPE_128, uuid,
+			sizeof(bee_ble_trigger_chunk_t) /* Max Dimension */,
+			CHAR_PROP_NOTIFY | CHAR_PROP_WRITE | CHAR_PROP_WRITE_WITHOUT_RESP,
+			ATTR_PERMISSION_NONE,
+			GATT_NOTIFY_ATTRIBUTE_WRITE, 16, 0,
+			&bee_char_trigger_handle);
+
+	/* HCI latency, refreshed with the aggro level */
+	COPY_BEE_LATENCY_CHAR_UUID(uuid);
+	ret = aci_gatt_add_char(bee_service_handle, UUID_TYPE_128, uuid,
+			sizeof(bee_ble_latency_payload_t) /* Max Dimension */,
+			CHAR_PROP_READ | CHAR_PROP_WRITE | CHAR_PROP_WRITE_WITHOUT_RESP,
+			ATTR_PERMISSION_NONE,
+			GATT_NOTIFY_ATTRIBUTE_WRITE, 16, 0,
+			&bee_char_latency_handle);
+
 	(void)ret;
 }
 
@@ -141,17 +238,402 @@ static void ble_start_advertisement(void)
  *  @brief ACI level bee service characteristic update
  *
  *  @param
- *  @return
+ *  @return BLE_STATUS_INSUFFICIENT_RESOURCES when the TX buffers are full
  */
-static void bee_char_update(void *val, uint8_t size)
+static tBleStatus bee_char_update(uint16_t char_handle, void *val, uint8_t size)
 {
+	tBleStatus ret = BLE_STATUS_INVALID_PARAMS;
+
 	/* value and size must be valid */
 	if(val && size) {
 
 		/* send the new value through the gatt layer */
-		aci_gatt_update_char_value(bee_service_handle, bee_char_aggro_handle,
+		ret = aci_gatt_update_char_value(bee_service_handle, char_handle,
 				0,size,val);
 	}
+
+	return(ret);
+}
+
+/**
+ * 	@fn bee_bands_update()
+ *  @brief packs the band features of the first mic and reports via BLE
+ *
+ *  @param
+ *  @return
+ */
+static void bee_bands_update(void)
+{
+	bee_ble_bands_payload_t payload;
+	bee_band_result_t *res;
+	float level;
+
+	if(bee_dsp_get_features(0, &bee_features) != k_bee_ret_ok)
+		return;
+
+	memset(&payload, 0, sizeof(payload));
+	payload.count = bee_features.bands;
+	payload.flags = bee_spectra.stale ? BEE_BLE_FLAG_STALE : 0;
+	payload.bin_width_chz = (uint16_t)(bee_features.bin_width *
+			(float)(1 << BEE_BLE_PEAK_BIN_SHIFT) * 100.0f + 0.5f);
+
+	for(uint32_t b = 0; b < bee_features.bands; b++) {
+		res = &bee_features.band[b];
+
+		/* silent bands sit at the bottom of the int16 range */
+		level = (res->energy > 0.0f) ? 1000.0f * log10f(res->energy) : -32768.0f;
+		if(level < -32768.0f)
+			level = -32768.0f;
+		if(level > 32767.0f)
+			level = 32767.0f;
+
+		payload.band[b].level_cdb = (int16_t)level;
+		payload.band[b].peak_bin = res->peak_bin >> BEE_BLE_PEAK_BIN_SHIFT;
+		payload.band[b].ratio = (uint8_t)(res->ratio * 255.0f + 0.5f);
+	}
+
+	bee_char_update(bee_char_bands_handle, (uint8_t *)&payload, sizeof(payload));
+}
+
+/**
+ * 	@fn bee_table_on_write()
+ *  @brief applies a band written by the peer on the band table
+ *
+ *  @param
+ *  @return
+ */
+static void bee_table_on_write(const uint8_t *data, uint8_t size)
+{
+	bee_ble_band_write_t req;
+	bee_band_t band;
+
+	if(size != sizeof(req))
+		return;
+
+	memcpy(&req, data, sizeof(req));
+	memcpy(band.name, req.name, sizeof(band.name));
+	band.low_hz = req.low_hz;
+	band.high_hz = req.high_hz;
+
+	bee_dsp_set_band(req.index, &band);
+}
+
+/**
+ * 	@fn bee_profile_update()
+ *  @brief sets the capture profile value read by the peer
+ *
+ *  @param
+ *  @return
+ */
+static void bee_profile_update(void)
+{
+	bee_ble_profile_payload_t payload = (bee_ble_profile_payload_t)audio_get_profile_id();
+
+	bee_char_update(bee_char_profile_handle, (uint8_t *)&payload, sizeof(payload));
+}
+
+/**
+ * 	@fn bee_profile_on_write()
+ *  @brief switches the capture to the profile written by the peer, the
+ *  switch waits for the dsp to release its frame, see audio_set_profile()
+ *
+ *  @param
+ *  @return
+ */
+static void bee_profile_on_write(const uint8_t *data, uint8_t size)
+{
+	if(size != sizeof(bee_ble_profile_payload_t))
+		return;
+
+	audio_set_profile((audio_profile_id_t)data[0]);
+
+	/* an invalid id leaves the value back on the profile in use */
+	bee_profile_update();
+}
+
+/**
+ * 	@fn bee_latency_cycles_to_us()
+ *  @brief converts a worst case to the latency payload, saturated
+ *
+ *  @param
+ *  @return
+ */
+static uint16_t bee_latency_cycles_to_us(uint32_t cycles)
+{
+	uint32_t us = cycles / (SystemCoreClock / 1000000);
+
+	return((us > 0xFFFF) ? 0xFFFF : (uint16_t)us);
+}
+
+/**
+ * 	@fn bee_latency_update()
+ *  @brief sets the HCI latency value read by the peer
+ *
+ *  @param
+ *  @return
+ */
+static void bee_latency_update(void)
+{
+	bee_ble_latency_payload_t payload;
+	bee_ble_latency_t lat;
+	uint32_t budget = bee_dsp_get_budget();
+
+	bee_ble_get_latency(&lat);
+
+	payload.budget_us = (budget > 0xFFFF) ? 0xFFFF : (uint16_t)budget;
+	payload.staged_max_us = bee_latency_cycles_to_us(lat.staged_max_cycles);
+	payload.unstaged_max_us = bee_latency_cycles_to_us(lat.unstaged_max_cycles);
+	payload.staged_events = lat.staged_events;
+	payload.unstaged_events = lat.unstaged_events;
+
+	bee_char_update(bee_char_latency_handle, (uint8_t *)&payload, sizeof(payload));
+}
+
+/**
+ * 	@fn bee_latency_on_write()
+ *  @brief sets the dsp budget written by the peer, the worst cases are
+ *  measured again from then on
+ *
+ *  @param
+ *  @return
+ */
+static void bee_latency_on_write(const uint8_t *data, uint8_t size)
+{
+	uint16_t budget_us;
+
+	if(size != sizeof(budget_us))
+		return;
+
+	memcpy(&budget_us, data, sizeof(budget_us));
+	if(bee_dsp_set_budget(budget_us) == k_bee_ret_ok) {
+		hci_latency.staged_max_cycles = 0;
+		hci_latency.unstaged_max_cycles = 0;
+	}
+
+	bee_latency_update();
+}
+
+/**
+ * 	@fn bee_spectrogram_on_write()
+ *  @brief starts exporting the spectrogram rows asked by the peer, an
+ *  export running is restarted
+ *
+ *  @param
+ *  @return
+ */
+static void bee_spectrogram_on_write(const uint8_t *data, uint8_t size)
+{
+	bee_ble_spectrogram_req_t req;
+	bee_spectrogram_info_t info;
+
+	if(size != sizeof(req) || bee_spectrogram_get_info(&info) != k_bee_ret_ok)
+		return;
+
+	memcpy(&req, data, sizeof(req));
+
+	/* rows pushed after the request are left for the next one */
+	export_row = (req.first < info.first) ? info.first : req.first;
+	export_end = info.next;
+	if(req.rows && req.first < info.next && info.next - req.first > req.rows)
+		export_end = req.first + req.rows;
+	export_offset = 0;
+
+	if(!export_active) {
+		export_active = true;
+		export_waiting = false;
+		event_queue_put(k_spectrogram_export);
+	}
+}
+
+/**
+ * 	@fn bee_ble_on_export()
+ *  @brief notifies the next chunks of the spectrogram export, acquisition
+ *  keeps pushing rows meanwhile, a full TX pool parks the export until the
+ *  stack frees a buffer
+ *
+ *  @param
+ *  @return
+ */
+static void bee_ble_on_export(void)
+{
+	bee_ble_spectrogram_chunk_t chunk;
+	bee_spectrogram_info_t info;
+	uint32_t size;
+
+	if(!export_active || export_waiting)
+		return;
+
+	for(uint32_t n = 0; n < BEE_BLE_SPECTROGRAM_BURST; n++) {
+		memset(&chunk, 0, sizeof(chunk));
+
+		if(export_offset == 0) {
+			/* rows overwritten since the request are skipped */
+			bee_spectrogram_get_info(&info);
+			if(export_row < info.first)
+				export_row = info.first;
+
+			if(export_row >= export_end ||
+					bee_spectrogram_read(export_row, &export_buf) != k_bee_ret_ok) {
+				chunk.row = info.next;
+				chunk.offset = BEE_BLE_SPECTROGRAM_END;
+				if(bee_char_update(bee_char_spectrogram_handle, (uint8_t *)&chunk,
+						sizeof(chunk)) == BLE_STATUS_INSUFFICIENT_RESOURCES) {
+					export_waiting = true;
+					return;
+				}
+
+				export_active = false;
+				return;
+			}
+		}
+
+		size = SPECTROGRAM_ROW_BYTES - export_offset;
+		if(size > sizeof(chunk.data))
+			size = sizeof(chunk.data);
+
+		chunk.row = export_row;
+		chunk.offset = (uint16_t)export_offset;
+		memcpy(chunk.data, (const uint8_t *)&export_buf + export_offset, size);
+
+		if(bee_char_update(bee_char_spectrogram_handle, (uint8_t *)&chunk,
+				sizeof(chunk)) == BLE_STATUS_INSUFFICIENT_RESOURCES) {
+			export_waiting = true;
+			return;
+		}
+
+		export_offset += size;
+		if(export_offset >= SPECTROGRAM_ROW_BYTES) {
+			export_offset = 0;
+			export_row++;
+		}
+	}
+
+	/* the other events get served before the next burst */
+	event_queue_put(k_spectrogram_export);
+}
+
+/**
+ * 	@fn bee_trigger_describe()
+ *  @brief notifies the description of the frozen snapshot
+ *
+ *  @param
+ *  @return BLE_STATUS_INSUFFICIENT_RESOURCES when the TX buffers are full
+ */
+static tBleStatus bee_trigger_describe(void)
+{
+	bee_ble_trigger_end_t end;
+	bee_trigger_info_t info;
+
+	bee_trigger_get_info(&info);
+
+	memset(&end, 0, sizeof(end));
+	end.offset = BEE_BLE_TRIGGER_END;
+	if(info.state == k_trigger_frozen) {
+		end.sample_rate = info.sample_rate;
+		end.length = info.length;
+		end.trigger_offset = (uint32_t)(info.trigger_sample_index - info.first_sample_index);
+		end.trigger_value = info.trigger_value;
+		end.channel = (uint8_t)info.channel;
+	}
+
+	return(bee_char_update(bee_char_trigger_handle, (uint8_t *)&end, sizeof(end)));
+}
+
+/**
+ * 	@fn bee_trigger_on_write()
+ *  @brief starts exporting the frozen snapshot from the offset asked by
+ *  the peer, an export running is restarted
+ *
+ *  @param
+ *  @return
+ */
+static void bee_trigger_on_write(const uint8_t *data, uint8_t size)
+{
+	bee_ble_trigger_req_t req;
+
+	if(size != sizeof(req))
+		return;
+
+	memcpy(&req, data, sizeof(req));
+	trigger_offset = req.offset;
+
+	if(!trigger_active) {
+		trigger_active = true;
+		trigger_waiting = false;
+		event_queue_put(k_trigger_export);
+	}
+}
+
+/**
+ * 	@fn bee_ble_on_snapshot()
+ *  @brief announces a frozen snapshot to the peer, or that it was released,
+ *  while disconnected it is kept up to its hold time
+ *
+ *  @param
+ *  @return
+ */
+static void bee_ble_on_snapshot(void)
+{
+	if(state != k_bee_connected)
+		return;
+
+	bee_trigger_describe();
+}
+
+/**
+ * 	@fn bee_ble_on_trigger_export()
+ *  @brief notifies the next chunks of the snapshot export, a full TX pool
+ *  parks the export until the stack frees a buffer, the trigger is rearmed
+ *  once the closing description is sent
+ *
+ *  @param
+ *  @return
+ */
+static void bee_ble_on_trigger_export(void)
+{
+	bee_ble_trigger_chunk_t chunk;
+	bee_trigger_info_t info;
+	int16_t samples[sizeof(chunk.samples) / sizeof(chunk.samples[0])];
+	uint32_t n;
+
+	if(!trigger_active || trigger_waiting)
+		return;
+
+	/* the snapshot is not released by its hold time while being read */
+	bee_trigger_hold();
+
+	for(uint32_t b = 0; b < BEE_BLE_TRIGGER_BURST; b++) {
+		memset(&chunk, 0, sizeof(chunk));
+
+		/* past the snapshot end, or nothing frozen, closes the export */
+		n = bee_trigger_read(trigger_offset, samples, sizeof(samples) / sizeof(samples[0]));
+		if(n == 0) {
+			if(bee_trigger_describe() == BLE_STATUS_INSUFFICIENT_RESOURCES) {
+				trigger_waiting = true;
+				return;
+			}
+
+			/* a snapshot collecting or none at all is left running */
+			trigger_active = false;
+			bee_trigger_get_info(&info);
+			if(info.state == k_trigger_frozen)
+				bee_trigger_rearm();
+			return;
+		}
+
+		chunk.offset = (uint16_t)trigger_offset;
+		memcpy(chunk.samples, samples, n * sizeof(samples[0]));
+		if(bee_char_update(bee_char_trigger_handle, (uint8_t *)&chunk,
+				sizeof(chunk)) == BLE_STATUS_INSUFFICIENT_RESOURCES) {
+			trigger_waiting = true;
+			return;
+		}
+
+		trigger_offset += n;
+	}
+
+	/* the other events get served before the next burst */
+	event_queue_put(k_trigger_export);
 }
 
 
@@ -164,6 +646,23 @@ static void bee_char_update(void *val, uint8_t size)
  */
 static void bee_ble_on_hci(void)
 {
+	uint32_t cycles;
+
+	if(hci_pending) {
+		cycles = DWT->CYCCNT - hci_stamp;
+		hci_pending = false;
+
+		if(bee_dsp_get_budget() != 0) {
+			hci_latency.staged_events++;
+			if(cycles > hci_latency.staged_max_cycles)
+				hci_latency.staged_max_cycles = cycles;
+		} else {
+			hci_latency.unstaged_events++;
+			if(cycles > hci_latency.unstaged_max_cycles)
+				hci_latency.unstaged_max_cycles = cycles;
+		}
+	}
+
 	HCI_Process();
 }
 
@@ -177,10 +676,68 @@ static void bee_ble_on_hci(void)
  */
 static void bee_ble_on_aggro(void)
 {
-	if(state == k_bee_connected) {
-		float aggro_value = bee_dsp_get_aggro_level();
-		bee_char_update((uint8_t *)&aggro_value, sizeof(aggro_value));
+	bee_ble_aggro_payload_t payload;
+	uint32_t latency;
+
+	if(state != k_bee_connected)
+		return;
+
+	if(bee_dsp_get_spectra(0, &bee_spectra) != k_bee_ret_ok)
+		return;
+
+	/* latency from the capture of the newest sample up to now */
+	latency = (DWT->CYCCNT - bee_spectra.timestamp) / (SystemCoreClock / 1000);
+
+	payload.aggro = bee_dsp_get_aggro_level();
+	payload.sequence = bee_spectra.sequence;
+	payload.sample_index = bee_spectra.sample_index;
+	payload.latency_ms = (latency > 0xFFFF) ? 0xFFFF : latency;
+	payload.flags = 0;
+
+	if(bee_spectra.flags & AUDIO_FRAME_GAP)
+		payload.flags |= BEE_BLE_FLAG_GAP;
+	if(bee_spectra.stale)
+		payload.flags |= BEE_BLE_FLAG_STALE;
+
+	bee_char_update(bee_char_aggro_handle, (uint8_t *)&payload, sizeof(payload));
+	bee_bands_update();
+	bee_latency_update();
+}
+
+/**
+ * 	@fn bee_ble_on_anomaly()
+ *  @brief reports the features that entered or left the anomalous state
+ *
+ *  @param
+ *  @return
+ */
+static void bee_ble_on_anomaly(void)
+{
+	bee_ble_anomaly_payload_t payload;
+	bee_baseline_report_t report;
+	float z;
+
+	if(state != k_bee_connected)
+		return;
+
+	if(bee_baseline_get_report(&report) != k_bee_ret_ok)
+		return;
+
+	payload.reports = report.reports;
+	payload.active = (uint16_t)report.active;
+	payload.changed = (uint16_t)report.changed;
+
+	for(uint32_t f = 0; f < k_baseline_max_features; f++) {
+		z = report.z[f] * 10.0f;
+		if(z > 127.0f)
+			z = 127.0f;
+		if(z < -128.0f)
+			z = -128.0f;
+
+		payload.z[f] = (int8_t)z;
 	}
+
+	bee_char_update(bee_char_anomaly_handle, (uint8_t *)&payload, sizeof(payload));
 }
 
 /**
@@ -193,6 +750,8 @@ static void bee_ble_on_aggro(void)
 static void bee_ble_on_disconnected(void)
 {
    state = k_bee_disconnected;
+   export_active = false;
+   trigger_active = false;
    bee_ble_start_advertisement();
 }
 
@@ -206,6 +765,9 @@ static void bee_ble_on_disconnected(void)
 static void bee_ble_on_connected(void)
 {
 	state = k_bee_connected;
+
+	/* a snapshot frozen while nobody was connected is announced again */
+	bee_ble_on_snapshot();
 }
 
 /**
@@ -235,6 +797,8 @@ void bee_ble_init(void)
 	 */
 	ble_stack_init();
 	ble_service_add();
+	bee_profile_update();
+	bee_latency_update();
 	ble_start_advertisement();
 }
 
@@ -263,6 +827,15 @@ bee_service_status_t bee_ble_get_state(void)
 	return(state);
 }
 
+bee_ble_retcode_t bee_ble_get_latency(bee_ble_latency_t *lat)
+{
+	if(lat == NULL)
+		return(k_bee_invalid_param);
+
+	*lat = hci_latency;
+	return(k_bee_ok);
+}
+
 void bee_ble_handler(system_event_t ev)
 {
 	switch(ev) {
@@ -274,6 +847,10 @@ void bee_ble_handler(system_event_t ev)
 		bee_ble_on_aggro();
 		break;
 
+	case k_anomaly_changed:
+		bee_ble_on_anomaly();
+		break;
+
 	case k_bleadvertising:
 		bee_ble_on_advertising();
 		break;
@@ -285,6 +862,18 @@ void bee_ble_handler(system_event_t ev)
 	case k_bledisconnected:
 		bee_ble_on_disconnected();
 		break;
+
+	case k_spectrogram_export:
+		bee_ble_on_export();
+		break;
+
+	case k_trigger_snapshot:
+		bee_ble_on_snapshot();
+		break;
+
+	case k_trigger_export:
+		bee_ble_on_trigger_export();
+		break;
 	}
 }
 
@@ -303,6 +892,12 @@ void HAL_GPIO_EXTI_Callback(uint16_t GPIO_Pin)
 {
 	switch (GPIO_Pin) {
 	case BNRG_SPI_EXTI_PIN:
+		/* latency runs from the oldest IRQ the main loop did not serve */
+		if(!hci_pending) {
+			hci_stamp = DWT->CYCCNT;
+			hci_pending = true;
+		}
+
 		HCI_Isr();
 		event_queue_put(k_blehcievent);
 		break;
@@ -329,6 +924,8 @@ void HCI_Event_CB(void *pckt)
 	evt_le_meta_event *evt = NULL;
 	evt_le_connection_complete *cc = NULL;
 	evt_blue_aci *blue_evt = NULL;
+	evt_gatt_attr_modified_IDB05A1 *mod = NULL;
+	evt_gatt_attr_modified_IDB04A1 *mod_old = NULL;
 
 	(void)cc;
 	(void)blue_evt;
@@ -363,6 +960,51 @@ void HCI_Event_CB(void *pckt)
 
 			break;
 		case EVT_BLUE_GATT_ATTRIBUTE_MODIFIED:
+			/* value handle follows the characteristic declaration, the
+			 * notification enable descriptor follows the value
+			 */
+			if (bee_hw_version > 0x30) {
+				mod = (void *) blue_evt->data;
+				if (mod->attr_handle == bee_char_table_handle + 1)
+					bee_table_on_write(mod->att_data, mod->data_length);
+				else if (mod->attr_handle == bee_char_spectrogram_handle + 1)
+					bee_spectrogram_on_write(mod->att_data, mod->data_length);
+				else if (mod->attr_handle == bee_char_profile_handle + 1)
+					bee_profile_on_write(mod->att_data, mod->data_length);
+				else if (mod->attr_handle == bee_char_trigger_handle + 1)
+					bee_trigger_on_write(mod->att_data, mod->data_length);
+				else if (mod->attr_handle == bee_char_trigger_handle + 2 &&
+						(mod->att_data[0] & 0x01))
+					event_queue_put(k_trigger_snapshot);
+				else if (mod->attr_handle == bee_char_latency_handle + 1)
+					bee_latency_on_write(mod->att_data, mod->data_length);
+			} else {
+				mod_old = (void *) blue_evt->data;
+				if (mod_old->attr_handle == bee_char_table_handle + 1)
+					bee_table_on_write(mod_old->att_data, mod_old->data_length);
+				else if (mod_old->attr_handle == bee_char_spectrogram_handle + 1)
+					bee_spectrogram_on_write(mod_old->att_data, mod_old->data_length);
+				else if (mod_old->attr_handle == bee_char_profile_handle + 1)
+					bee_profile_on_write(mod_old->att_data, mod_old->data_length);
+				else if (mod_old->attr_handle == bee_char_trigger_handle + 1)
+					bee_trigger_on_write(mod_old->att_data, mod_old->data_length);
+				else if (mod_old->attr_handle == bee_char_trigger_handle + 2 &&
+						(mod_old->att_data[0] & 0x01))
+					event_queue_put(k_trigger_snapshot);
+				else if (mod_old->attr_handle == bee_char_latency_handle + 1)
+					bee_latency_on_write(mod_old->att_data, mod_old->data_length);
+			}
+			break;
+		case EVT_BLUE_GATT_TX_POOL_AVAILABLE:
+			/* resumes the exports parked on a full TX pool */
+			if(export_waiting) {
+				export_waiting = false;
+				event_queue_put(k_spectrogram_export);
+			}
+			if(trigger_waiting) {
+				trigger_waiting = false;
+				event_queue_put(k_trigger_export);
+			}
 			break;
 		}
 
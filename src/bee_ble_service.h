@@ -12,12 +12,159 @@ typedef enum {
 	k_bee_error,
 }bee_ble_retcode_t;
 
+/* aggro payload flags */
+#define BEE_BLE_FLAG_GAP	0x01
+#define BEE_BLE_FLAG_STALE	0x02
+
+/** aggro characteristic payload, little endian, the level comes first so
+ * 4 byte readers keep working
+ */
+typedef struct bee_ble_aggro_payload {
+	float aggro;
+	uint32_t sequence;
+	uint64_t sample_index;
+	uint16_t latency_ms;
+	uint8_t flags;
+} PACKED bee_ble_aggro_payload_t;
+
+/* peak bins are sent on 8 bits, spectra of larger FFTs in wider bins */
+#define BEE_BLE_PEAK_BIN_SHIFT	((DSP_SPECTRAL_BINS > 512) ? 2 : (DSP_SPECTRAL_BINS > 256) ? 1 : 0)
+
+#if (DSP_SPECTRAL_BINS >> BEE_BLE_PEAK_BIN_SHIFT) > 256
+#error "band peak bins no longer fit the bands payload"
+#endif
+
+/** band features of one band, level in 0.01 dB of the band energy and
+ * ratio of the spectrum energy in 1/255
+ */
+typedef struct bee_ble_band {
+	int16_t level_cdb;
+	uint8_t peak_bin;
+	uint8_t ratio;
+} PACKED bee_ble_band_t;
+
+/** bands characteristic payload, peak bins are bin_width_chz 0.01 Hz wide */
+typedef struct bee_ble_bands_payload {
+	uint8_t count;
+	uint8_t flags;
+	uint16_t bin_width_chz;
+	bee_ble_band_t band[FEATURES_MAX_BANDS];
+} PACKED bee_ble_bands_payload_t;
+
+/** anomaly characteristic payload, sent only when the anomalous features
+ * change, z-scores in 0.1 units saturated to int8
+ */
+typedef struct bee_ble_anomaly_payload {
+	uint32_t reports;
+	uint16_t active;
+	uint16_t changed;
+	int8_t z[k_baseline_max_features];
+} PACKED bee_ble_anomaly_payload_t;
+
+/** spectrogram characteristic write, asks for rows first up to
+ * first + rows - 1 of the history, 0 rows stands for every row held
+ */
+typedef struct bee_ble_spectrogram_req {
+	uint32_t first;
+	uint16_t rows;
+} PACKED bee_ble_spectrogram_req_t;
+
+/* spectrogram chunk offset closing an export, row is the next to be written */
+#define BEE_BLE_SPECTROGRAM_END		0xFFFF
+
+/* chunks sent per export event before the other events are served */
+#define BEE_BLE_SPECTROGRAM_BURST	4
+
+/** spectrogram characteristic payload, a piece of an exported row, data
+ * holds the row bytes from offset on, see bee_spectrogram_row_t, rows
+ * overwritten while exporting are skipped
+ */
+typedef struct bee_ble_spectrogram_chunk {
+	uint32_t row;
+	uint16_t offset;
+	uint8_t data[14];
+} PACKED bee_ble_spectrogram_chunk_t;
+
+/** trigger characteristic write, asks for the frozen snapshot samples
+ * from offset on
+ */
+typedef struct bee_ble_trigger_req {
+	uint16_t offset;
+} PACKED bee_ble_trigger_req_t;
+
+/* trigger chunk offset of a snapshot description */
+#define BEE_BLE_TRIGGER_END			0xFFFF
+
+/* chunks sent per export event before the other events are served */
+#define BEE_BLE_TRIGGER_BURST		4
+
+#if TRIGGER_HISTORY_LEN >= BEE_BLE_TRIGGER_END
+#error "trigger history no longer fits the chunk offsets"
+#endif
+
+/** trigger characteristic payload, a piece of the frozen snapshot, samples
+ * from offset on, the last chunk may be partly filled
+ */
+typedef struct bee_ble_trigger_chunk {
+	uint16_t offset;
+	int16_t samples[9];
+} PACKED bee_ble_trigger_chunk_t;
+
+/** trigger characteristic payload at offset BEE_BLE_TRIGGER_END, describes
+ * the snapshot, notified once it is frozen, when a peer connects or enables
+ * the notifications and closing its export, the trigger is rearmed after the
+ * closing one or once the hold time runs out, 0 length when nothing is frozen
+ */
+typedef struct bee_ble_trigger_end {
+	uint16_t offset;
+	uint32_t sample_rate;
+	uint32_t length;
+	uint32_t trigger_offset;
+	float trigger_value;
+	uint8_t channel;
+} PACKED bee_ble_trigger_end_t;
+
+/** capture profile characteristic, one byte holding the audio_profile_id_t
+ * in use, written by the peer to switch the capture rate
+ */
+typedef uint8_t bee_ble_profile_payload_t;
+
+/** band table characteristic write, see bee_features_set_band() */
+typedef struct bee_ble_band_write {
+	uint8_t index;
+	uint16_t low_hz;
+	uint16_t high_hz;
+	char name[FEATURES_NAME_LEN];
+} PACKED bee_ble_band_write_t;
+
+/** HCI latency characteristic payload, worst cases in us since the budget
+ * was last set, read by the peer, written with a new budget_us to compare
+ * the dsp staged against a single dispatch, 0 turns staging off
+ */
+typedef struct bee_ble_latency_payload {
+	uint16_t budget_us;
+	uint16_t staged_max_us;
+	uint16_t unstaged_max_us;
+	uint32_t staged_events;
+	uint32_t unstaged_events;
+} PACKED bee_ble_latency_payload_t;
+
 typedef enum {
 	k_bee_advertising,
 	k_bee_disconnected,
 	k_bee_connected,
 }bee_service_status_t;
 
+/** HCI event latency, cycles from the transport IRQ up to HCI_Process,
+ * split by the dsp analyzing frames staged or in a single dispatch
+ */
+typedef struct bee_ble_latency {
+	uint32_t staged_events;
+	uint32_t staged_max_cycles;
+	uint32_t unstaged_events;
+	uint32_t unstaged_max_cycles;
+}bee_ble_latency_t;
+
 
 /**
  * 	@fn bee_ble_init()
@@ -47,6 +194,16 @@ bee_ble_retcode_t bee_ble_start_advertisement(void);
  */
 bee_service_status_t bee_ble_get_state(void);
 
+/**
+ * 	@fn bee_ble_get_latency()
+ *  @brief gets the HCI event latency, the worst cases are kept until the
+ *         peer sets a new dsp budget
+ *
+ *  @param
+ *  @return
+ */
+bee_ble_retcode_t bee_ble_get_latency(bee_ble_latency_t *lat);
+
 /**
  * 	@fn bee_ble_handler()
  *  @brief bee service application loop
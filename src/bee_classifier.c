@@ -0,0 +1,222 @@
+/*
+ *  @file bee_classifier.c
+ *  @brief fixed point hive state classifier, runs an int8 linear model or
+ *  a small MLP loaded from a flash blob over a feature vector
+ */
+
+#include "lilbee.h"
+
+
+/** internal types */
+typedef struct bee_model_layer {
+	uint32_t inputs;
+	uint32_t outputs;
+	int32_t multiplier;
+	int32_t shift;
+	const int32_t *bias;
+	const int8_t *weights;
+}bee_model_layer_t;
+
+/** internal variables */
+static const bee_model_header_t *model = NULL;
+static const float *input_offset;
+static const float *input_scale;
+static bee_model_layer_t layer[CLASSIFIER_MAX_LAYERS];
+
+/** internal functions */
+
+/**
+ * 	@fn classifier_sat8()
+ *  @brief saturates to int8
+ *
+ *  @param
+ *  @return
+ */
+static int8_t classifier_sat8(int32_t v)
+{
+	if(v > 127)
+		return(127);
+	if(v < -128)
+		return(-128);
+
+	return((int8_t)v);
+}
+
+/**
+ * 	@fn classifier_requant()
+ *  @brief scales a relu accumulator to the int8 input of the next layer
+ *
+ *  @param
+ *  @return
+ */
+static int8_t classifier_requant(int32_t acc, int32_t multiplier, int32_t shift)
+{
+	int64_t v;
+	uint32_t s = 31 + shift;
+
+	if(acc <= 0)
+		return(0);
+
+	v = (int64_t)acc * multiplier;
+	v = (v + ((int64_t)1 << (s - 1))) >> s;
+	return(classifier_sat8((int32_t)v));
+}
+
+/**
+ * 	@fn classifier_layer()
+ *  @brief int8 dense layer, int32 accumulators
+ *
+ *  @param
+ *  @return
+ */
+static void classifier_layer(const bee_model_layer_t *l, const int8_t *in, int32_t *acc)
+{
+	const int8_t *w = l->weights;
+	int32_t sum;
+
+	for(uint32_t o = 0; o < l->outputs; o++) {
+		sum = l->bias[o];
+		for(uint32_t i = 0; i < l->inputs; i++)
+			sum += (int32_t)w[i] * (int32_t)in[i];
+
+		acc[o] = sum;
+		w += l->inputs;
+	}
+}
+
+/**
+ * 	@fn classifier_parse_layer()
+ *  @brief maps one layer of the blob, returns the offset after it
+ *
+ *  @param
+ *  @return 0 when the layer runs past the blob
+ */
+static uint32_t classifier_parse_layer(const uint8_t *blob, uint32_t offset, uint32_t size,
+		bee_model_layer_t *l)
+{
+	uint32_t weights = (l->inputs * l->outputs + 3) & ~3UL;
+	uint32_t end = offset + 2 * sizeof(int32_t) + l->outputs * sizeof(int32_t) + weights;
+	const int32_t *words = (const int32_t *)(blob + offset);
+
+	if(end > size)
+		return(0);
+
+	l->multiplier = words[0];
+	l->shift = words[1];
+	l->bias = &words[2];
+	l->weights = (const int8_t *)&words[2 + l->outputs];
+
+	if(l->shift < -30 || l->shift > 31)
+		return(0);
+
+	return(end);
+}
+
+/** public functions */
+
+bee_retcode_t bee_classifier_init(void)
+{
+	return(bee_classifier_load(bee_model_default, bee_model_default_size));
+}
+
+bee_retcode_t bee_classifier_load(const void *blob, uint32_t size)
+{
+	const bee_model_header_t *h = (const bee_model_header_t *)blob;
+	const uint8_t *bytes = (const uint8_t *)blob;
+	bee_model_layer_t parsed[CLASSIFIER_MAX_LAYERS];
+	uint32_t offset;
+	uint32_t sum = 0;
+
+	if(blob == NULL || ((uintptr_t)blob & 3) || size < sizeof(*h))
+		return(k_bee_ret_invalid_param);
+
+	if(h->magic != CLASSIFIER_MAGIC || h->version != CLASSIFIER_VERSION ||
+			h->size != size || h->layers == 0 || h->layers > CLASSIFIER_MAX_LAYERS ||
+			h->inputs == 0 || h->inputs > CLASSIFIER_MAX_INPUTS ||
+			h->classes != k_hive_max_states ||
+			(h->layers > 1 && (h->hidden == 0 || h->hidden > CLASSIFIER_MAX_HIDDEN)))
+		return(k_bee_ret_invalid_param);
+
+	for(uint32_t i = sizeof(*h); i < size; i++)
+		sum += bytes[i];
+
+	if(sum != h->checksum)
+		return(k_bee_ret_invalid_param);
+
+	/* input quantization first, then the layers */
+	offset = sizeof(*h) + 2 * h->inputs * sizeof(float);
+	if(offset > size)
+		return(k_bee_ret_invalid_param);
+
+	for(uint32_t n = 0; n < h->layers; n++) {
+		parsed[n].inputs = (n == 0) ? h->inputs : h->hidden;
+		parsed[n].outputs = (n + 1 == h->layers) ? h->classes : h->hidden;
+
+		offset = classifier_parse_layer(bytes, offset, size, &parsed[n]);
+		if(offset == 0)
+			return(k_bee_ret_invalid_param);
+	}
+
+	input_offset = (const float *)(bytes + sizeof(*h));
+	input_scale = input_offset + h->inputs;
+	memcpy(layer, parsed, sizeof(parsed));
+	model = h;
+	return(k_bee_ret_ok);
+}
+
+uint32_t bee_classifier_inputs(void)
+{
+	return((model) ? model->inputs : 0);
+}
+
+bee_retcode_t bee_classifier_run(const float *features, uint32_t n, bee_hive_result_t *out)
+{
+	int8_t in[CLASSIFIER_MAX_INPUTS];
+	int8_t hidden[CLASSIFIER_MAX_HIDDEN];
+	int32_t acc[CLASSIFIER_MAX_HIDDEN];
+	const int8_t *x = in;
+	float max;
+	float total = 0.0f;
+	uint32_t l;
+
+	if(features == NULL || out == NULL)
+		return(k_bee_ret_invalid_param);
+
+	out->valid = false;
+	if(model == NULL || n != model->inputs)
+		return(k_bee_err);
+
+	for(uint32_t i = 0; i < n; i++)
+		in[i] = classifier_sat8((int32_t)lrintf((features[i] - input_offset[i]) * input_scale[i]));
+
+	/* hidden layers requantized to int8, the last one keeps its accumulators */
+	for(l = 0; l + 1 < model->layers; l++) {
+		classifier_layer(&layer[l], x, acc);
+		for(uint32_t o = 0; o < layer[l].outputs; o++)
+			hidden[o] = classifier_requant(acc[o], layer[l].multiplier, layer[l].shift);
+
+		x = hidden;
+	}
+
+	classifier_layer(&layer[l], x, acc);
+
+	/* softmax over the logits gives the confidence */
+	out->state = k_hive_normal;
+	for(uint32_t c = 1; c < k_hive_max_states; c++) {
+		if(acc[c] > acc[out->state])
+			out->state = (hive_state_t)c;
+	}
+
+	max = (float)acc[out->state] * model->output_scale;
+	for(uint32_t c = 0; c < k_hive_max_states; c++) {
+		out->prob[c] = expf((float)acc[c] * model->output_scale - max);
+		total += out->prob[c];
+	}
+
+	for(uint32_t c = 0; c < k_hive_max_states; c++)
+		out->prob[c] /= total;
+
+	out->confidence = out->prob[out->state];
+	out->valid = true;
+	return(k_bee_ret_ok);
+}
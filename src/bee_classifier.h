@@ -0,0 +1,101 @@
+/*
+ *  @file bee_classifier.h
+ *  @brief fixed point hive state classifier, runs an int8 linear model or
+ *  a small MLP loaded from a flash blob over a feature vector
+ */
+
+#ifndef __BEE_CLASSIFIER_H
+#define __BEE_CLASSIFIER_H
+
+/* blob identification, "BEEM" */
+#define CLASSIFIER_MAGIC		0x4D454542
+#define CLASSIFIER_VERSION		1
+
+/* model limits, a blob beyond them is refused */
+#define CLASSIFIER_MAX_LAYERS	2
+#define CLASSIFIER_MAX_INPUTS	32
+#define CLASSIFIER_MAX_HIDDEN	32
+
+/** hive states, model outputs follow this order */
+typedef enum {
+	k_hive_normal = 0,
+	k_hive_queenless,
+	k_hive_preswarm,
+	k_hive_agitated,
+	k_hive_max_states,
+}hive_state_t;
+
+/** blob header, little endian and followed by:
+ *  float offset[inputs], float scale[inputs], the input quantization
+ *  q = (x - offset) * scale, then for each layer:
+ *  int32 multiplier, int32 shift, int32 bias[outputs] and
+ *  int8 weights[outputs][inputs] padded to 4 bytes
+ *
+ *  hidden layers are requantized as relu(acc) * multiplier / 2^(31 + shift),
+ *  the last one gives the logits as acc * output_scale, checksum is the
+ *  sum of the bytes following the header
+ */
+typedef struct bee_model_header {
+	uint32_t magic;
+	uint16_t version;
+	uint16_t layers;
+	uint16_t inputs;
+	uint16_t hidden;
+	uint16_t classes;
+	uint16_t reserved;
+	float output_scale;
+	uint32_t size;
+	uint32_t checksum;
+}bee_model_header_t;
+
+/** classifier output */
+typedef struct bee_hive_result {
+	bool valid;
+	hive_state_t state;
+	float confidence;
+	float prob[k_hive_max_states];
+}bee_hive_result_t;
+
+/* default model, see tools/gen_model_blob.py */
+extern const uint8_t bee_model_default[];
+extern const uint32_t bee_model_default_size;
+
+
+/**
+ * 	@fn bee_classifier_init()
+ *  @brief loads the default model
+ *
+ *  @param
+ *  @return
+ */
+bee_retcode_t bee_classifier_init(void);
+
+/**
+ * 	@fn bee_classifier_load()
+ *  @brief checks a model blob and uses it in place, the blob must stay
+ *         valid and 4 bytes aligned while in use
+ *
+ *  @param
+ *  @return
+ */
+bee_retcode_t bee_classifier_load(const void *blob, uint32_t size);
+
+/**
+ * 	@fn bee_classifier_inputs()
+ *  @brief gets the feature vector length expected by the model
+ *
+ *  @param
+ *  @return 0 when no model is loaded
+ */
+uint32_t bee_classifier_inputs(void);
+
+/**
+ * 	@fn bee_classifier_run()
+ *  @brief classifies a feature vector
+ *
+ *  @param
+ *  @return
+ */
+bee_retcode_t bee_classifier_run(const float *features, uint32_t n, bee_hive_result_t *out);
+
+#endif
@@ -6,74 +6,803 @@
 #include "lilbee.h"
 
 
+/** stages of the analysis of a frame, a dispatch runs stages until its
+ * budget is spent and posts itself to resume the frame later
+ */
+typedef enum {
+	k_dsp_stage_idle = 0,
+	k_dsp_stage_channels,
+	k_dsp_stage_publish,
+}dsp_stage_t;
+
 /** internal variables */
 static uint32_t sample = 0;
-static bee_spectra_t spectra = {0};
-static float aggro_level = 0;
+static bee_spectra_t spectra[AUDIO_CHANNELS] = {{0}};
+static float aggro_level[AUDIO_CHANNELS] = {0};
+static uint32_t channel_cycles[AUDIO_CHANNELS] = {0};
+static uint32_t channel_max_cycles[AUDIO_CHANNELS] = {0};
+static uint32_t stft_frames[AUDIO_CHANNELS] = {0};
+static bee_stft_t stft[AUDIO_CHANNELS];
+static bee_psd_t psd[AUDIO_CHANNELS];
+static bee_features_t features[AUDIO_CHANNELS];
+static bee_features_history_t feature_history[AUDIO_CHANNELS];
+static uint32_t features_cycles = 0;
+static bee_mel_t mel[AUDIO_CHANNELS];
+static const bee_mel_table_t *mel_table = NULL;
+static bee_hive_result_t hive[AUDIO_CHANNELS];
+static uint32_t classifier_cycles = 0;
+static uint32_t pitch_cycles = 0;
+static bee_goertzel_t bank[AUDIO_CHANNELS];
+static bee_dsp_tones_t tones[AUDIO_CHANNELS];
+static dsp_mode_t mode = k_dsp_mode_spectrum;
+static uint32_t report_elapsed = 0;
+static bool report_ready = false;
+
+/* energy gate state */
+static bee_dsp_gate_t gate = {
+	.enabled = true,
+	.min_rms = DSP_GATE_MIN_RMS,
+	.floor_ratio = DSP_GATE_FLOOR_RATIO,
+	.stable_ratio = DSP_GATE_STABLE_RATIO,
+	.max_skips = DSP_GATE_MAX_SKIPS,
+};
+static float noise_floor[AUDIO_CHANNELS];
+static float gate_level[AUDIO_CHANNELS] = {0};
+static uint32_t gate_skips[AUDIO_CHANNELS] = {0};
+static uint32_t processed_frames[AUDIO_CHANNELS] = {0};
+static uint32_t skipped_frames[AUDIO_CHANNELS] = {0};
 
 static bool dsp_lock = false;
-static float dsp_float_buffer[1056];
-extern const arm_rfft_fast_instance_f32 arm_rfft_fast_sR_f32_len512;
+
+/* settings written while a frame holds the lock, applied once it ends */
+#define DSP_PENDING_FRAMING		0x01
+#define DSP_PENDING_MODE		0x02
+#define DSP_PENDING_TONES		0x04
+#define DSP_PENDING_ZOOM		0x08
+#define DSP_PENDING_PITCH		0x10
+#define DSP_PENDING_NOISE		0x20
+#define DSP_PENDING_GATE		0x40
+
+static uint32_t pending = 0;
+static uint32_t pending_frame_len = 0;
+static uint32_t pending_hop = 0;
+static stft_window_t pending_window = k_stft_window_hann;
+static dsp_mode_t pending_mode = k_dsp_mode_spectrum;
+static uint16_t pending_tone_hz[GOERTZEL_MAX_TONES];
+static uint32_t pending_tone_count = 0;
+static uint32_t pending_zoom_center = 0;
+static uint32_t pending_zoom_span = 0;
+static uint32_t pending_pitch_min = 0;
+static uint32_t pending_pitch_max = 0;
+static float pending_pitch_threshold = 0.0f;
+static bee_noise_cfg_t pending_noise;
+static bee_dsp_gate_t pending_gate;
+
+/* band table writes, applied in the order they were written */
+static uint8_t pending_band_index[FEATURES_MAX_BANDS];
+static bee_band_t pending_band[FEATURES_MAX_BANDS];
+static uint32_t pending_bands = 0;
+
+/* frame being analyzed and where its analysis stopped */
+static dsp_stage_t stage = k_dsp_stage_idle;
+static audio_frame_t *stage_block = NULL;
+static uint32_t stage_channel = 0;
+static uint32_t stage_offset = 0;
+static uint32_t stage_start = 0;
+static uint32_t stage_budget_us = DSP_STAGE_BUDGET_US;
+static uint32_t stage_budget = 0;
+static uint32_t frames_waiting = 0;
+static uint32_t dispatches = 0;
+static uint32_t dispatch_max_cycles = 0;
+
+/* plan and scratch area are shared by all channels */
+#if DSP_USE_Q15
+static bee_fft_t fft_plan;
+static q15_t dsp_q15_buffer[STFT_MAX_FRAME_LEN];
+static q15_t dsp_fft_buffer[2 * DSP_FFT_POINTS];
+#else
+static bee_fft_t fft_plan;
+static float dsp_float_buffer[STFT_MAX_FRAME_LEN];
+static float dsp_fft_buffer[DSP_FFT_POINTS];
+#endif
+static float dsp_power_buffer[DSP_SPECTRAL_BINS];
+
+/* tone bank coefficients, planned again on every rate change */
+static uint16_t tone_hz[GOERTZEL_MAX_TONES] = DSP_DEFAULT_TONES;
+static uint32_t tone_count = DSP_DEFAULT_TONE_COUNT;
+static bee_goertzel_plan_t tone_plan;
+
+/* zoom band, planned again on every rate change */
+static uint32_t zoom_center = DSP_DEFAULT_ZOOM_CENTER;
+static uint32_t zoom_span = DSP_DEFAULT_ZOOM_SPAN;
+static bee_zoom_plan_t zoom_plan;
+static bee_zoom_t zoom[AUDIO_CHANNELS];
+
+/* pitch range, planned again on every rate change */
+static uint32_t pitch_min = PITCH_DEFAULT_MIN_HZ;
+static uint32_t pitch_max = PITCH_DEFAULT_MAX_HZ;
+static float pitch_threshold = PITCH_DEFAULT_THRESHOLD;
+static bee_pitch_plan_t pitch_plan;
+static bee_pitch_t pitch[AUDIO_CHANNELS];
+static bee_pitch_result_t pitch_result[AUDIO_CHANNELS];
+
+/* noise floor tracker, fed by the reports of the spectrum mode */
+static bee_noise_cfg_t noise_cfg = {
+	.mode = NOISE_DEFAULT_MODE,
+	.reports = NOISE_DEFAULT_REPORTS,
+	.bias = NOISE_DEFAULT_BIAS,
+	.over = NOISE_DEFAULT_OVER,
+	.floor = NOISE_DEFAULT_FLOOR,
+};
+static bee_noise_t noise[AUDIO_CHANNELS];
+static bee_noise_report_t noise_report[AUDIO_CHANNELS];
 
 /** internal functions */
 
+/**
+ * 	@fn dsp_reset_streams()
+ *  @brief discards the samples and averages of the old framing or rate
+ *
+ *  @param
+ *  @return
+ */
+static void dsp_reset_streams(void)
+{
+	for(uint32_t ch = 0; ch < AUDIO_CHANNELS; ch++) {
+		bee_stft_reset(&stft[ch]);
+		bee_psd_reset(&psd[ch]);
+		bee_goertzel_reset(&bank[ch]);
+		bee_zoom_reset(&zoom[ch], &zoom_plan);
+		bee_pitch_reset(&pitch[ch], &pitch_plan);
+		bee_noise_reset(&noise[ch]);
+		bee_features_reset_history(&feature_history[ch]);
+	}
+
+	report_elapsed = 0;
+}
+
+/**
+ * 	@fn dsp_plan_pitch()
+ *  @brief designs the pitch decimation for the current rate, a range that
+ *  does not fit the rate or a 0 Hz one leaves the tracker off
+ *
+ *  @param
+ *  @return
+ */
+static bee_retcode_t dsp_plan_pitch(void)
+{
+	bee_retcode_t ret = k_bee_ret_invalid_param;
+
+	if(pitch_max != 0)
+		ret = bee_pitch_plan(&pitch_plan, pitch_min, pitch_max, pitch_threshold, sample);
+	if(ret != k_bee_ret_ok)
+		pitch_plan.decimation = 0;
+
+	return(ret);
+}
+
+/**
+ * 	@fn on_dsp_pitch()
+ *  @brief tracks the fundamental over the samples the STFT just took
+ *
+ *  @param
+ *  @return
+ */
+static void on_dsp_pitch(uint32_t ch, const int16_t *samples, uint32_t n)
+{
+	uint32_t used;
+	uint32_t start;
+
+	while(n && pitch_plan.decimation) {
+		used = bee_pitch_feed(&pitch[ch], &pitch_plan, samples, n);
+		samples += used;
+		n -= used;
+
+		if(!bee_pitch_frame_ready(&pitch[ch]))
+			break;
+
+		start = DWT->CYCCNT;
+		bee_pitch_estimate(&pitch[ch], &pitch_plan, NULL);
+		pitch_cycles = DWT->CYCCNT - start;
+	}
+}
+
+/**
+ * 	@fn on_dsp_gate()
+ *  @brief checks the level of one channel plane before any spectral work,
+ *  the energy comes accumulated by the capture block kernel, a plane that
+ *  completes an open analysis frame is always taken
+ *
+ *  @param
+ *  @return true when the plane should skip the spectral pipeline
+ */
+static bool on_dsp_gate(uint32_t ch, const audio_frame_t *frame, bool open)
+{
+	float rms = sqrtf((float)frame->energy[ch] / (float)frame->size) / 32768.0f;
+	float threshold;
+	bool quiet;
+	bool stable;
+
+	spectra[ch].rms = rms;
+	spectra[ch].peak = (float)frame->peak[ch] / 32768.0f;
+
+	/* the floor drops at once with quiet frames and rises slowly */
+	if(rms < noise_floor[ch])
+		noise_floor[ch] = rms;
+	else
+		noise_floor[ch] += (rms - noise_floor[ch]) * DSP_GATE_FLOOR_ALPHA;
+
+	if(!gate.enabled || open || gate_skips[ch] >= gate.max_skips)
+		goto on_dsp_gate_process;
+
+	threshold = noise_floor[ch] * gate.floor_ratio;
+	if(threshold < gate.min_rms)
+		threshold = gate.min_rms;
+
+	quiet = (rms < threshold);
+	stable = (fabsf(rms - gate_level[ch]) <= gate.stable_ratio * gate_level[ch]);
+
+	if(quiet || stable) {
+		gate_skips[ch]++;
+		skipped_frames[ch]++;
+		return(true);
+	}
+
+on_dsp_gate_process:
+	/* skips are counted up to the next analysis frame, see on_dsp_channel() */
+	gate_level[ch] = rms;
+	processed_frames[ch]++;
+	return(false);
+}
+
+/**
+ * 	@fn on_dsp_spectrum()
+ *  @brief computes the power spectrum of the next frame of a stream,
+ *  both pipelines give the same float scale as a float FFT of the
+ *  normalized samples, roots are only taken when a report is published
+ *
+ *  @param
+ *  @return
+ */
+static void on_dsp_spectrum(bee_stft_t *st, float *power)
+{
+#if DSP_USE_Q15
+	const int32_t *bins = (const int32_t *)dsp_fft_buffer;
+	uint32_t shift;
+	float scale;
+
+	/* windowed frame, normalized and zero padded up to the FFT size */
+	bee_stft_get_frame_q15(st, dsp_q15_buffer, &shift);
+
+	/* output holds the N complex bins, scaled down by the FFT stages */
+	arm_rfft_q15(&fft_plan, dsp_q15_buffer, dsp_fft_buffer);
+
+	/* arm_cmplx_mag_squared_q15 squares in Q15 and flattens the quiet
+	 * bins, so the exact power of each packed bin is taken with SMUAD,
+	 * then the FFT scaling and the block exponent are undone
+	 */
+	scale = DSP_Q15_MAG_SCALE / (float)(1UL << shift);
+	scale *= scale;
+	for(uint32_t i = 0; i < DSP_SPECTRAL_BINS; i++) {
+		power[i] = (float)(uint32_t)__SMUAD(bins[i], bins[i]) * scale;
+	}
+#else
+	/* signed samples windowed and converted to float, zero padded
+	 * up to the FFT size
+	 */
+	bee_stft_get_frame(st, dsp_float_buffer);
+
+	/* prepare to compute the FFT, output holds N/2 complex bins with the
+	 * nyquist real part packed on the DC imaginary slot
+	 */
+	arm_rfft_fast_f32(&fft_plan, dsp_float_buffer, dsp_fft_buffer, 0);
+	arm_cmplx_mag_squared_f32(dsp_fft_buffer, power, DSP_SPECTRAL_BINS);
+	power[0] = dsp_fft_buffer[0] * dsp_fft_buffer[0];
+#endif
+}
+
+/**
+ * 	@fn dsp_plan_tones()
+ *  @brief computes the tone bank coefficients for the current rate, tones
+ *  past the nyquist frequency leave the bank empty
+ *
+ *  @param
+ *  @return
+ */
+static bee_retcode_t dsp_plan_tones(void)
+{
+	bee_retcode_t ret;
+
+	ret = bee_goertzel_plan(&tone_plan, tone_hz, tone_count, DSP_TONE_BLOCK_LEN, sample);
+	if(ret != k_bee_ret_ok)
+		tone_plan.tones = 0;
+
+	return(ret);
+}
+
+/**
+ * 	@fn dsp_plan_zoom()
+ *  @brief designs the zoom filters for the current rate, a band that does
+ *  not fit the rate leaves the zoom without output
+ *
+ *  @param
+ *  @return
+ */
+static bee_retcode_t dsp_plan_zoom(void)
+{
+	bee_retcode_t ret;
+
+	ret = bee_zoom_plan(&zoom_plan, zoom_center, zoom_span, sample);
+	if(ret != k_bee_ret_ok)
+		zoom_plan.decimation = 0;
+
+	return(ret);
+}
+
+/**
+ * 	@fn dsp_over_budget()
+ *  @brief checks whether the running dispatch spent its budget
+ *
+ *  @param
+ *  @return
+ */
+static bool dsp_over_budget(void)
+{
+	return(stage_budget != 0 && DWT->CYCCNT - stage_start >= stage_budget);
+}
+
+/**
+ * 	@fn dsp_frame_open()
+ *  @brief checks whether a stream holds part of a tone block or zoom frame,
+ *  a skip would throw the samples already filtered away
+ *
+ *  @param
+ *  @return
+ */
+static bool dsp_frame_open(uint32_t ch)
+{
+	if(mode == k_dsp_mode_tones)
+		return(bank[ch].count != 0);
+
+	if(mode == k_dsp_mode_zoom)
+		return(zoom[ch].count != 0 || zoom[ch].pending != 0);
+
+	return(false);
+}
+
+/**
+ * 	@fn on_dsp_skip()
+ *  @brief keeps the streams of a gated channel plane, the STFT ring is still
+ *  fed so the frames taken next stay contiguous and the frames it completes
+ *  are dropped untransformed, the filtered streams restart
+ *
+ *  @param
+ *  @return
+ */
+static void on_dsp_skip(uint32_t ch, const int16_t *samples, uint32_t size)
+{
+	uint32_t used;
+
+	bee_goertzel_restart(&bank[ch]);
+	bee_zoom_reset(&zoom[ch], &zoom_plan);
+	bee_pitch_restart(&pitch[ch], &pitch_plan);
+
+	if(mode != k_dsp_mode_spectrum)
+		return;
+
+	while(size) {
+		used = bee_stft_feed(&stft[ch], samples, size);
+		samples += used;
+		size -= used;
+
+		if(bee_stft_frame_ready(&stft[ch]))
+			bee_stft_drop_frame(&stft[ch]);
+	}
+}
+
+/**
+ * 	@fn on_dsp_channel()
+ *  @brief averages the spectra or tones of one channel plane, stops at the
+ *  first spectrum taken past the dispatch budget
+ *
+ *  @param
+ *  @return samples consumed
+ */
+static uint32_t on_dsp_channel(uint32_t ch, const int16_t *samples, uint32_t size)
+{
+	uint32_t start = DWT->CYCCNT;
+	uint32_t frames = stft_frames[ch];
+	uint32_t left = size;
+	uint32_t used;
+
+	/* filters run straight on the plane, no frame is buffered */
+	if(mode == k_dsp_mode_tones) {
+		stft_frames[ch] += bee_goertzel_feed(&bank[ch], &tone_plan, samples, left);
+		left = 0;
+	}
+
+	/* decimated samples fill the zoom frames */
+	while(mode == k_dsp_mode_zoom && left && zoom_plan.decimation) {
+		used = bee_zoom_feed(&zoom[ch], &zoom_plan, samples, left);
+		samples += used;
+		left -= used;
+
+		if(!bee_zoom_frame_ready(&zoom[ch]))
+			break;
+
+		bee_zoom_get_power(&zoom[ch], dsp_power_buffer);
+		bee_psd_accumulate(&psd[ch], dsp_power_buffer);
+		stft_frames[ch]++;
+
+		if(dsp_over_budget())
+			goto on_dsp_channel_exit;
+	}
+
+	if(mode == k_dsp_mode_zoom)
+		left = 0;
+
+	/* every sample goes through the ring, a spectrum is taken at each hop */
+	while(left) {
+		used = bee_stft_feed(&stft[ch], samples, left);
+		on_dsp_pitch(ch, samples, used);
+		samples += used;
+		left -= used;
+
+		if(!bee_stft_frame_ready(&stft[ch]))
+			break;
+
+		on_dsp_spectrum(&stft[ch], dsp_power_buffer);
+		bee_psd_accumulate(&psd[ch], dsp_power_buffer);
+		stft_frames[ch]++;
+
+		if(dsp_over_budget())
+			break;
+	}
+
+on_dsp_channel_exit:
+	/* the gate may skip again once an analysis frame was taken */
+	if(stft_frames[ch] != frames)
+		gate_skips[ch] = 0;
+
+	channel_cycles[ch] += DWT->CYCCNT - start;
+	return(size - left);
+}
+
+/**
+ * 	@fn on_dsp_classify()
+ *  @brief classifies the hive state over the features of one channel
+ *
+ *  @param
+ *  @return
+ */
+static void on_dsp_classify(uint32_t ch)
+{
+	float vector[DSP_CLASSIFIER_INPUTS];
+	float *v = vector;
+	uint32_t start;
+
+	hive[ch].valid = false;
+	if(!mel[ch].valid || bee_classifier_inputs() != DSP_CLASSIFIER_INPUTS)
+		return;
+
+	memcpy(v, mel[ch].mfcc, sizeof(mel[ch].mfcc));
+	v += MFCC_COEFFS;
+
+	for(uint32_t b = 0; b < FEATURES_MAX_BANDS; b++)
+		*v++ = (b < features[ch].bands) ? features[ch].band[b].ratio : 0.0f;
+
+	*v = 20.0f * log10f(spectra[ch].rms + 1e-6f);
+
+	start = DWT->CYCCNT;
+	bee_classifier_run(vector, DSP_CLASSIFIER_INPUTS, &hive[ch]);
+	classifier_cycles = DWT->CYCCNT - start;
+}
+
+/**
+ * 	@fn on_dsp_publish()
+ *  @brief publishes the averaged spectrum and features of one channel, a
+ *  channel gated during the whole report keeps the last ones flagged stale
+ *
+ *  @param
+ *  @return
+ */
+static void on_dsp_publish(uint32_t ch)
+{
+	uint32_t start;
+
+	if(mode == k_dsp_mode_tones) {
+		/* the spectrum and band features are left untouched */
+		tones[ch].stale = !bee_goertzel_publish(&bank[ch], &tone_plan, tones[ch].mag);
+		spectra[ch].stale = tones[ch].stale;
+		if(tones[ch].stale)
+			return;
+
+		tones[ch].tones = tone_plan.tones;
+		memcpy(tones[ch].hz, tone_hz, sizeof(tone_hz));
+		aggro_level[ch] = (tone_plan.tones) ? tones[ch].mag[0] : 0.0f;
+		return;
+	}
+
+	/* the scratch power buffer is free once every frame was analyzed */
+	if(!bee_psd_publish(&psd[ch], dsp_power_buffer)) {
+		spectra[ch].stale = true;
+		return;
+	}
+
+#if DSP_LOG_SPECTRUM
+	bee_power_to_cdb(dsp_power_buffer, spectra[ch].level_cdb, DSP_SPECTRAL_BINS,
+			DSP_LOG_FLOOR);
+#else
+	for(uint32_t i = 0; i < DSP_SPECTRAL_BINS; i++)
+		arm_sqrt_f32(dsp_power_buffer[i], &spectra[ch].raw[i]);
+#endif
+
+	spectra[ch].stale = false;
+	spectra[ch].spectral_points = DSP_SPECTRAL_BINS;
+	spectra[ch].spectral_sample_rate = sample;
+
+	/* band features and mel filters are laid on the wideband bins */
+	if(mode == k_dsp_mode_zoom) {
+		spectra[ch].start_hz = zoom_plan.start_hz;
+		spectra[ch].bin_hz = zoom_plan.bin_hz;
+		return;
+	}
+
+	spectra[ch].start_hz = 0.0f;
+	spectra[ch].bin_hz = (float)sample / (float)DSP_FFT_POINTS;
+	pitch_result[ch].stale = !bee_pitch_publish(&pitch[ch], &pitch_result[ch]);
+
+	/* the filterbank is left on the raw power, as its model was trained */
+	bee_mel_compute(mel_table, dsp_power_buffer, &mel[ch]);
+
+	/* wind and rain are taken off before the band features */
+	bee_noise_update(&noise[ch], &noise_cfg, dsp_power_buffer, &noise_report[ch]);
+
+	/* band features and shape, the aggro level is the rms of the first band */
+	start = DWT->CYCCNT;
+	bee_features_compute(dsp_power_buffer, &feature_history[ch], &features[ch]);
+	features_cycles = DWT->CYCCNT - start;
+	aggro_level[ch] = (features[ch].bands) ? sqrtf(features[ch].band[0].energy) : 0.0f;
+
+	on_dsp_classify(ch);
+}
+
+/**
+ * 	@fn on_dsp_step()
+ *  @brief runs the next stage of the frame, a channel plane or part of it
+ *  or the report of one channel
+ *
+ *  @param
+ *  @return
+ */
+static void on_dsp_step(void)
+{
+	audio_frame_t *audio_block = stage_block;
+	uint32_t ch = stage_channel;
+	const int16_t *samples;
+
+	if(stage == k_dsp_stage_publish) {
+		on_dsp_publish(ch);
+		if(++stage_channel >= audio_block->channels)
+			stage = k_dsp_stage_idle;
+		return;
+	}
+
+	if(ch >= audio_block->channels) {
+		stage = k_dsp_stage_idle;
+
+		/* publish at the reporting interval only */
+		report_elapsed += audio_block->size;
+		if(report_elapsed >= bee_psd_report_samples(sample)) {
+			report_elapsed = 0;
+			report_ready = true;
+			stage = k_dsp_stage_publish;
+			stage_channel = 0;
+		}
+		return;
+	}
+
+	samples = (const int16_t *)audio_frame_channel(audio_block, ch);
+
+	if(stage_offset == 0) {
+		channel_cycles[ch] = 0;
+
+		if(on_dsp_gate(ch, audio_block, dsp_frame_open(ch))) {
+			/* nothing is averaged */
+			on_dsp_skip(ch, samples, audio_block->size);
+			stage_channel++;
+			return;
+		}
+
+		spectra[ch].sample_index = audio_block->sample_index;
+		spectra[ch].timestamp = audio_block->timestamp;
+		spectra[ch].sequence = audio_block->sequence;
+		spectra[ch].flags = audio_block->flags;
+	}
+
+	stage_offset += on_dsp_channel(ch, samples + stage_offset,
+			audio_block->size - stage_offset);
+
+	if(stage_offset >= audio_block->size) {
+		if(channel_cycles[ch] > channel_max_cycles[ch])
+			channel_max_cycles[ch] = channel_cycles[ch];
+
+		stage_offset = 0;
+		stage_channel++;
+	}
+}
+
+/**
+ * 	@fn on_dsp_stage()
+ *  @brief runs stages of the frame until it is done or the budget is spent,
+ *  the events posted meanwhile, HCI ones included, are served before the
+ *  frame is resumed
+ *
+ *  @param
+ *  @return
+ */
+static void on_dsp_stage(void)
+{
+	uint32_t elapsed;
+
+	if(stage == k_dsp_stage_idle)
+		return;
+
+	stage_start = DWT->CYCCNT;
+	do {
+		on_dsp_step();
+	} while(stage != k_dsp_stage_idle && !dsp_over_budget());
+
+	elapsed = DWT->CYCCNT - stage_start;
+	if(elapsed > dispatch_max_cycles)
+		dispatch_max_cycles = elapsed;
+	dispatches++;
+
+	if(stage != k_dsp_stage_idle) {
+		event_queue_put(k_dsp_stage_continue);
+		return;
+	}
+
+	/* every plane was analyzed, give the frame back to capture */
+	audio_release_frame(stage_block);
+	stage_block = NULL;
+
+	/* broadcast the dsp end of processing */
+	event_queue_put(k_dsp_endprocess);
+}
+
 /**
  * 	@fn on_dsp_audio()
- *  @brief
+ *  @brief starts the analysis of the next captured frame
  *
  *  @param
  *  @return
  */
 static void on_dsp_audio(void)
 {
+	/* a frame is still being analyzed, this one waits for it */
+	if(stage != k_dsp_stage_idle) {
+		frames_waiting++;
+		return;
+	}
+
 	dsp_lock = true;
 
 	/* gets the audio frame we will about to process */
-	audio_frame_t *audio_block = audio_get_current_frame();
+	stage_block = audio_get_current_frame();
 
 	/* no audio available or corrupted */
-	if(audio_block == NULL)
-		goto on_dsp_audio_exit;
+	if(stage_block == NULL) {
+		event_queue_put(k_dsp_endprocess);
+		return;
+	}
+
+	/* capture profile changed, remap the bins to the new rate */
+	if(stage_block->sample_rate != sample)
+		bee_dsp_init(stage_block->sample_rate);
 
+	stage = k_dsp_stage_channels;
+	stage_channel = 0;
+	stage_offset = 0;
+	on_dsp_stage();
+}
+
+
+/**
+ * 	@fn dsp_apply_pending()
+ *  @brief applies the settings written while a frame held the lock, the
+ *  rate may have changed since they were checked so the plans are made
+ *  again for it
+ *
+ *  @param
+ *  @return
+ */
+static void dsp_apply_pending(void)
+{
+	bool relearn;
 
-	/* convert audio samples to float value */
-	for(uint32_t i = 0; i < audio_block->size; i+=16) {
-		/* unroll loop for performance */
-		dsp_float_buffer[i] = (float)audio_block->audio_buffer[i]/32768.0f - 1.0f;
-		dsp_float_buffer[i+1] = (float)audio_block->audio_buffer[i+1]/32768.0f - 1.0f;
-		dsp_float_buffer[i+2] = (float)audio_block->audio_buffer[i+2]/32768.0f - 1.0f;
-		dsp_float_buffer[i+3] = (float)audio_block->audio_buffer[i+3]/32768.0f - 1.0f;
-		dsp_float_buffer[i+4] = (float)audio_block->audio_buffer[i+4]/32768.0f - 1.0f;
-		dsp_float_buffer[i+5] = (float)audio_block->audio_buffer[i+5]/32768.0f - 1.0f;
-		dsp_float_buffer[i+6] = (float)audio_block->audio_buffer[i+6]/32768.0f - 1.0f;
-		dsp_float_buffer[i+7] = (float)audio_block->audio_buffer[i+7]/32768.0f- 1.0f;
-		dsp_float_buffer[i+8] = (float)audio_block->audio_buffer[i+8]/32768.0f - 1.0f;
-		dsp_float_buffer[i+9] = (float)audio_block->audio_buffer[i+9]/32768.0f - 1.0f;
-		dsp_float_buffer[i+10] = (float)audio_block->audio_buffer[i+10]/32768.0f - 1.0f ;
-		dsp_float_buffer[i+11] = (float)audio_block->audio_buffer[i+11]/32768.0f - 1.0f;
-		dsp_float_buffer[i+12] = (float)audio_block->audio_buffer[i+12]/32768.0f - 1.0f;
-		dsp_float_buffer[i+13] = (float)audio_block->audio_buffer[i+13]/32768.0f - 1.0f;
-		dsp_float_buffer[i+14] = (float)audio_block->audio_buffer[i+14]/32768.0f - 1.0f;
-		dsp_float_buffer[i+15] = (float)audio_block->audio_buffer[i+15]/32768.0f - 1.0f;
+	if(pending & DSP_PENDING_FRAMING) {
+		if(bee_stft_init(pending_frame_len, pending_hop, pending_window) == k_bee_ret_ok)
+			dsp_reset_streams();
 	}
 
+	if(pending & DSP_PENDING_MODE) {
+		mode = pending_mode;
+		dsp_reset_streams();
+	}
 
+	if(pending & DSP_PENDING_TONES) {
+		memset(tone_hz, 0, sizeof(tone_hz));
+		memcpy(tone_hz, pending_tone_hz, pending_tone_count * sizeof(tone_hz[0]));
+		tone_count = pending_tone_count;
 
-	/* prepare to compute the FFT */
-	arm_rfft_fast_f32(&arm_rfft_fast_sR_f32_len512, dsp_float_buffer, &spectra.raw[0], 0);
-	arm_cmplx_mag_f32(&spectra.raw[0], &spectra.raw[0], DSP_FFT_POINTS);
+		if(sample != 0)
+			dsp_plan_tones();
 
+		for(uint32_t ch = 0; ch < AUDIO_CHANNELS; ch++)
+			bee_goertzel_reset(&bank[ch]);
+	}
 
-	spectra.spectral_points = DSP_FFT_POINTS;
-	spectra.spectral_sample_rate = AUDIO_SAMPLE_FREQ;
-	/* estimente the aggro level searching the hissing frequency interval */
-	aggro_level = spectra.raw[32];
+	if(pending & DSP_PENDING_ZOOM) {
+		zoom_center = pending_zoom_center;
+		zoom_span = pending_zoom_span;
 
-on_dsp_audio_exit:
-	/* broadcast the dsp end of processing */
-	event_queue_put(k_dsp_endprocess);
+		if(sample != 0)
+			dsp_plan_zoom();
+
+		for(uint32_t ch = 0; ch < AUDIO_CHANNELS; ch++)
+			bee_zoom_reset(&zoom[ch], &zoom_plan);
+	}
+
+	if(pending & DSP_PENDING_PITCH) {
+		pitch_min = pending_pitch_min;
+		pitch_max = pending_pitch_max;
+		pitch_threshold = pending_pitch_threshold;
+
+		if(sample != 0)
+			dsp_plan_pitch();
+
+		for(uint32_t ch = 0; ch < AUDIO_CHANNELS; ch++)
+			bee_pitch_reset(&pitch[ch], &pitch_plan);
+	}
+
+	if(pending & DSP_PENDING_NOISE) {
+		relearn = (pending_noise.reports != noise_cfg.reports ||
+				noise_cfg.mode == k_noise_off);
+		noise_cfg = pending_noise;
+
+		for(uint32_t ch = 0; relearn && ch < AUDIO_CHANNELS; ch++)
+			bee_noise_reset(&noise[ch]);
+	}
+
+	if(pending & DSP_PENDING_GATE) {
+		gate = pending_gate;
+		for(uint32_t ch = 0; ch < AUDIO_CHANNELS; ch++)
+			gate_skips[ch] = 0;
+	}
+
+	for(uint32_t i = 0; i < pending_bands; i++)
+		bee_features_set_band(pending_band_index[i], &pending_band[i]);
+
+	pending = 0;
+	pending_bands = 0;
 }
 
+/**
+ * 	@fn dsp_defer()
+ *  @brief applies a setting at once when no frame is being analyzed,
+ *  otherwise keeps it for the end of the frame
+ *
+ *  @param
+ *  @return
+ */
+static void dsp_defer(uint32_t setting)
+{
+	pending |= setting;
+
+	if(!dsp_lock)
+		dsp_apply_pending();
+}
 
 /**
  * 	@fn on_dsp_endproc()
@@ -84,11 +813,24 @@ on_dsp_audio_exit:
  */
 static void on_dsp_endproc(void)
 {
-	dsp_lock = false;
+	/* a frame started before this event was served keeps the lock */
+	dsp_lock = (stage != k_dsp_stage_idle);
+
+	if(!dsp_lock)
+		dsp_apply_pending();
 
-	/* broadcast a new processed aggro level */
-	audio_start_capture();
-	event_queue_put(k_aggresivity_available);
+	if(frames_waiting && stage == k_dsp_stage_idle) {
+		frames_waiting--;
+		event_queue_put(k_dsp_incoming_audio_available);
+	}
+
+	/* broadcast a new averaged aggro level, capture never stops
+	 * so the next frame is already on its way
+	 */
+	if(report_ready) {
+		report_ready = false;
+		event_queue_put(k_aggresivity_available);
+	}
 }
 
 
@@ -98,8 +840,156 @@ static void on_dsp_endproc(void)
 void bee_dsp_init(uint32_t dsp_sample)
 {
 	sample = dsp_sample;
+	bee_features_init(dsp_sample);
+	mel_table = bee_mel_find(dsp_sample);
+	dsp_plan_tones();
+	dsp_plan_zoom();
+	dsp_plan_pitch();
+
+	bee_fft_init(&fft_plan, DSP_FFT_POINTS);
+	bee_dsp_set_budget(stage_budget_us);
+
+	/* noise floor is learnt again from full scale */
+	for(uint32_t ch = 0; ch < AUDIO_CHANNELS; ch++) {
+		noise_floor[ch] = 1.0f;
+		gate_skips[ch] = 0;
+	}
+
+	bee_stft_init(bee_stft_get_frame_len(), bee_stft_get_hop(), bee_stft_get_window());
+	dsp_reset_streams();
+}
+
+bee_retcode_t bee_dsp_set_framing(uint32_t frame_len, uint32_t hop, stft_window_t window)
+{
+	/* the same limits bee_stft_init() applies */
+	if(frame_len < STFT_MIN_FRAME_LEN || frame_len > STFT_MAX_FRAME_LEN)
+		return(k_bee_ret_invalid_param);
+
+	if(hop == 0 || hop > frame_len || window >= k_stft_max_windows)
+		return(k_bee_ret_invalid_param);
+
+	pending_frame_len = frame_len;
+	pending_hop = hop;
+	pending_window = window;
+	dsp_defer(DSP_PENDING_FRAMING);
+	return(k_bee_ret_ok);
 }
 
+bee_retcode_t bee_dsp_set_mode(dsp_mode_t new_mode)
+{
+	if(new_mode >= k_dsp_max_modes)
+		return(k_bee_ret_invalid_param);
+
+	pending_mode = new_mode;
+	dsp_defer(DSP_PENDING_MODE);
+	return(k_bee_ret_ok);
+}
+
+dsp_mode_t bee_dsp_get_mode(void)
+{
+	return(mode);
+}
+
+bee_retcode_t bee_dsp_set_tones(const uint16_t *tones_hz, uint32_t count)
+{
+	bee_goertzel_plan_t plan;
+
+	if(tones_hz == NULL || count == 0 || count > GOERTZEL_MAX_TONES)
+		return(k_bee_ret_invalid_param);
+
+	/* checked against the current rate before anything changes */
+	if(sample != 0 && bee_goertzel_plan(&plan, tones_hz, count,
+			DSP_TONE_BLOCK_LEN, sample) != k_bee_ret_ok)
+		return(k_bee_ret_invalid_param);
+
+	memcpy(pending_tone_hz, tones_hz, count * sizeof(pending_tone_hz[0]));
+	pending_tone_count = count;
+	dsp_defer(DSP_PENDING_TONES);
+	return(k_bee_ret_ok);
+}
+
+bee_retcode_t bee_dsp_set_zoom(uint32_t center_hz, uint32_t span_hz)
+{
+	bee_zoom_plan_t plan;
+
+	/* checked against the current rate before anything changes */
+	if(sample != 0 && bee_zoom_plan(&plan, center_hz, span_hz, sample) != k_bee_ret_ok)
+		return(k_bee_ret_invalid_param);
+
+	pending_zoom_center = center_hz;
+	pending_zoom_span = span_hz;
+	dsp_defer(DSP_PENDING_ZOOM);
+	return(k_bee_ret_ok);
+}
+
+bee_retcode_t bee_dsp_set_pitch(uint32_t min_hz, uint32_t max_hz, float threshold)
+{
+	bee_pitch_plan_t plan;
+
+	/* checked against the current rate before anything changes */
+	if((min_hz || max_hz) && sample != 0 &&
+			bee_pitch_plan(&plan, min_hz, max_hz, threshold, sample) != k_bee_ret_ok)
+		return(k_bee_ret_invalid_param);
+
+	pending_pitch_min = min_hz;
+	pending_pitch_max = max_hz;
+	pending_pitch_threshold = threshold;
+	dsp_defer(DSP_PENDING_PITCH);
+	return(k_bee_ret_ok);
+}
+
+bee_retcode_t bee_dsp_set_noise(const bee_noise_cfg_t *cfg)
+{
+	if(bee_noise_check(cfg) != k_bee_ret_ok)
+		return(k_bee_ret_invalid_param);
+
+	pending_noise = *cfg;
+	dsp_defer(DSP_PENDING_NOISE);
+	return(k_bee_ret_ok);
+}
+
+bee_retcode_t bee_dsp_set_gate(const bee_dsp_gate_t *cfg)
+{
+	if(cfg == NULL || cfg->min_rms < 0.0f || cfg->floor_ratio < 1.0f ||
+			cfg->stable_ratio < 0.0f)
+		return(k_bee_ret_invalid_param);
+
+	pending_gate = *cfg;
+	dsp_defer(DSP_PENDING_GATE);
+	return(k_bee_ret_ok);
+}
+
+bee_retcode_t bee_dsp_set_band(uint32_t index, const bee_band_t *band)
+{
+	if(band == NULL || index >= FEATURES_MAX_BANDS || band->low_hz > band->high_hz)
+		return(k_bee_ret_invalid_param);
+
+	/* every slot holds a write already, the peer writes again later */
+	if(pending_bands >= FEATURES_MAX_BANDS)
+		return(k_bee_err);
+
+	pending_band_index[pending_bands] = (uint8_t)index;
+	pending_band[pending_bands] = *band;
+	pending_bands++;
+	dsp_defer(0);
+	return(k_bee_ret_ok);
+}
+
+bee_retcode_t bee_dsp_set_budget(uint32_t budget_us)
+{
+	/* cycles are counted on a 32 bit DWT counter */
+	if(budget_us > UINT32_MAX / (SystemCoreClock / 1000000))
+		return(k_bee_ret_invalid_param);
+
+	stage_budget_us = budget_us;
+	stage_budget = budget_us * (SystemCoreClock / 1000000);
+	return(k_bee_ret_ok);
+}
+
+uint32_t bee_dsp_get_budget(void)
+{
+	return(stage_budget_us);
+}
 
 uint32_t bee_dsp_get_sample_rate(void)
 {
@@ -109,20 +999,102 @@ uint32_t bee_dsp_get_sample_rate(void)
 float bee_dsp_get_aggro_level(void)
 {
 
-	return(aggro_level);
+	return(aggro_level[0]);
+}
+
+float bee_dsp_get_channel_aggro_level(uint32_t channel)
+{
+	if(channel >= AUDIO_CHANNELS)
+		return(0.0f);
+
+	return(aggro_level[channel]);
+}
+
+bee_retcode_t bee_dsp_get_channel_level(uint32_t channel, float *rms, float *peak)
+{
+	if(channel >= AUDIO_CHANNELS || rms == NULL || peak == NULL)
+		return(k_bee_ret_invalid_param);
+
+	*rms = spectra[channel].rms;
+	*peak = spectra[channel].peak;
+	return(k_bee_ret_ok);
+}
+
+bee_retcode_t bee_dsp_get_features(uint32_t channel, struct bee_features *out)
+{
+	if(channel >= AUDIO_CHANNELS || out == NULL)
+		return(k_bee_ret_invalid_param);
+
+	*out = features[channel];
+	return(k_bee_ret_ok);
 }
 
-bee_retcode_t bee_dsp_get_spectra(bee_spectra_t *raw)
+bee_retcode_t bee_dsp_get_mel(uint32_t channel, struct bee_mel *out)
 {
-	bee_ble_retcode_t ret = k_bee_err;
+	if(channel >= AUDIO_CHANNELS || out == NULL)
+		return(k_bee_ret_invalid_param);
 
-	if(!dsp_lock && raw) {
+	*out = mel[channel];
+	return(k_bee_ret_ok);
+}
+
+bee_retcode_t bee_dsp_get_hive_state(uint32_t channel, struct bee_hive_result *out)
+{
+	if(channel >= AUDIO_CHANNELS || out == NULL)
+		return(k_bee_ret_invalid_param);
 
-		dsp_lock = true;
+	*out = hive[channel];
+	return(k_bee_ret_ok);
+}
+
+bee_retcode_t bee_dsp_get_tones(uint32_t channel, bee_dsp_tones_t *out)
+{
+	if(channel >= AUDIO_CHANNELS || out == NULL)
+		return(k_bee_ret_invalid_param);
+
+	*out = tones[channel];
+	return(k_bee_ret_ok);
+}
+
+bee_retcode_t bee_dsp_get_pitch(uint32_t channel, bee_pitch_result_t *out)
+{
+	if(channel >= AUDIO_CHANNELS || out == NULL)
+		return(k_bee_ret_invalid_param);
+
+	*out = pitch_result[channel];
+	return(k_bee_ret_ok);
+}
+
+bee_retcode_t bee_dsp_get_noise(uint32_t channel, bee_noise_report_t *out)
+{
+	if(channel >= AUDIO_CHANNELS || out == NULL)
+		return(k_bee_ret_invalid_param);
+
+	*out = noise_report[channel];
+	return(k_bee_ret_ok);
+}
+
+bee_retcode_t bee_dsp_get_noise_floor(uint32_t channel, float *floor)
+{
+	if(channel >= AUDIO_CHANNELS || floor == NULL)
+		return(k_bee_ret_invalid_param);
+
+	return(bee_noise_get_floor(&noise[channel], &noise_cfg, floor) ? k_bee_ret_ok : k_bee_err);
+}
+
+bee_retcode_t bee_dsp_get_spectra(uint32_t channel, bee_spectra_t *raw)
+{
+	bee_retcode_t ret = k_bee_err;
+
+	if(channel >= AUDIO_CHANNELS) {
+		ret = k_bee_ret_invalid_param;
+	} else if(stage != k_dsp_stage_publish && raw) {
+		/* a report published on some channels only is not handed out,
+		 * the lock is left alone as a staged frame may hold it
+		 */
 		__disable_irq();
-		memcpy(raw, &spectra, sizeof(spectra));
+		memcpy(raw, &spectra[channel], sizeof(spectra[channel]));
 		__enable_irq();
-		dsp_lock = false;
 
 		ret = k_bee_ret_ok;
 	}
@@ -130,6 +1102,89 @@ bee_retcode_t bee_dsp_get_spectra(bee_spectra_t *raw)
 	return(ret);
 }
 
+bee_retcode_t bee_dsp_get_stats(bee_dsp_stats_t *stats)
+{
+	bee_retcode_t ret = k_bee_ret_invalid_param;
+
+	if(stats) {
+		stats->channels = AUDIO_CHANNELS;
+		stats->channel_bytes = DSP_CHANNEL_BYTES + AUDIO_CHANNEL_POOL_BYTES;
+		stats->shared_bytes = DSP_SHARED_BYTES;
+		stats->features_cycles = features_cycles;
+		stats->classifier_cycles = classifier_cycles;
+		stats->pitch_cycles = pitch_cycles;
+		stats->dispatches = dispatches;
+		stats->dispatch_max_cycles = dispatch_max_cycles;
+		dispatch_max_cycles = 0;
+
+		for(uint32_t ch = 0; ch < AUDIO_CHANNELS; ch++) {
+			stats->channel_cycles[ch] = channel_cycles[ch];
+			stats->channel_max_cycles[ch] = channel_max_cycles[ch];
+			stats->channel_frames[ch] = stft_frames[ch];
+			stats->channel_processed[ch] = processed_frames[ch];
+			stats->channel_skipped[ch] = skipped_frames[ch];
+			channel_max_cycles[ch] = 0;
+		}
+
+		ret = k_bee_ret_ok;
+	}
+
+	return(ret);
+}
+
+bee_retcode_t bee_dsp_benchmark(bee_dsp_bench_t *bench)
+{
+	static const uint32_t tone_sets[DSP_BENCH_TONE_SETS] = { 4, 8, 16, 32 };
+	bee_goertzel_plan_t plan;
+	bee_goertzel_t test_bank;
+	uint16_t hz[GOERTZEL_MAX_TONES];
+	int16_t chunk[STFT_MIN_FRAME_LEN];
+	uint32_t start;
+	uint32_t n;
+
+	if(bench == NULL)
+		return(k_bee_ret_invalid_param);
+
+	if(dsp_lock || sample == 0)
+		return(k_bee_err);
+
+	dsp_lock = true;
+
+	/* half scale tone, 16 samples per period, fed as capture would */
+	for(uint32_t i = 0; i < STFT_MIN_FRAME_LEN; i++)
+		chunk[i] = (int16_t)(16384.0f * sinf(2.0f * PI * (float)i / 16.0f));
+
+	/* one spectrum of a full frame on the first stream */
+	bee_stft_reset(&stft[0]);
+	while(!bee_stft_frame_ready(&stft[0]))
+		bee_stft_feed(&stft[0], chunk, STFT_MIN_FRAME_LEN);
+
+	start = DWT->CYCCNT;
+	on_dsp_spectrum(&stft[0], dsp_power_buffer);
+	bench->spectrum_cycles = DWT->CYCCNT - start;
+	bench->samples = DSP_FFT_POINTS;
+
+	/* the same amount of samples through banks of spread tones */
+	for(uint32_t set = 0; set < DSP_BENCH_TONE_SETS; set++) {
+		n = tone_sets[set];
+		for(uint32_t k = 0; k < n; k++)
+			hz[k] = (uint16_t)(((k + 1) * sample) / (2 * (n + 1)));
+
+		bee_goertzel_plan(&plan, hz, n, DSP_FFT_POINTS, sample);
+		bee_goertzel_reset(&test_bank);
+
+		start = DWT->CYCCNT;
+		for(uint32_t i = 0; i < DSP_FFT_POINTS; i += STFT_MIN_FRAME_LEN)
+			bee_goertzel_feed(&test_bank, &plan, chunk, STFT_MIN_FRAME_LEN);
+		bench->tone_cycles[set] = DWT->CYCCNT - start;
+		bench->tones[set] = n;
+	}
+
+	dsp_reset_streams();
+	dsp_lock = false;
+	return(k_bee_ret_ok);
+}
+
 void bee_dsp_handler(system_event_t ev)
 {
 	switch(ev) {
@@ -137,10 +1192,12 @@ void bee_dsp_handler(system_event_t ev)
 		on_dsp_audio();
 		break;
 
+	case k_dsp_stage_continue:
+		on_dsp_stage();
+		break;
+
 	case k_dsp_endprocess:
 		on_dsp_endproc();
 		break;
 	}
 }
-
-
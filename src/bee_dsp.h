@@ -6,17 +6,169 @@
 #ifndef __BEE_DSP_H
 #define __BEE_DSP_H
 
-/* number of points computed by the FFT */
-#define DSP_FFT_POINTS	512
+/* number of points computed by the FFT, chosen at build time */
+#define DSP_FFT_POINTS	FFT_POINTS
 
+#if STFT_MAX_FRAME_LEN > DSP_FFT_POINTS
+#error "STFT frames must fit on the FFT"
+#endif
+
+/* publishes the spectrum as int16 levels in 0.01 dB rather than float
+ * magnitudes, no root is taken and the spectrum takes half the memory
+ */
+#ifndef DSP_LOG_SPECTRUM
+#define DSP_LOG_SPECTRUM	0
+#endif
+
+/* lowest bin power of the log spectrum, -120 dB */
+#define DSP_LOG_FLOOR		1e-12f
+
+/* Q15 FFT output to float magnitude scale, the real FFT scales its
+ * output down by its size
+ */
+#define DSP_Q15_MAG_SCALE	((float)DSP_FFT_POINTS / 32768.0f)
+
+/* number of magnitude bins produced by a real FFT */
+#define DSP_SPECTRAL_BINS	(DSP_FFT_POINTS / 2)
+
+/* energy gate defaults, levels are relative to the full scale */
+#define DSP_GATE_MIN_RMS		0.001f
+#define DSP_GATE_FLOOR_RATIO	2.0f
+#define DSP_GATE_STABLE_RATIO	0.1f
+#define DSP_GATE_MAX_SKIPS		3
+
+/* noise floor rising speed, falls are followed at once */
+#define DSP_GATE_FLOOR_ALPHA	(1.0f / 64.0f)
+
+/* tone bank defaults, the hissing tone first as it drives the aggro
+ * level, each tone is measured over blocks as long as the FFT
+ */
+#define DSP_DEFAULT_TONES		{ 3000, 250, 450 }
+#define DSP_DEFAULT_TONE_COUNT	3
+#define DSP_TONE_BLOCK_LEN		DSP_FFT_POINTS
+
+/* classifier feature vector, MFCCs, band ratios and rms in dBFS */
+#define DSP_CLASSIFIER_INPUTS	(MFCC_COEFFS + FEATURES_MAX_BANDS + 1)
+
+/* zoom band defaults, 100 Hz to 1.1 kHz */
+#define DSP_DEFAULT_ZOOM_CENTER	600
+#define DSP_DEFAULT_ZOOM_SPAN	1000
+
+#if ZOOM_FFT_POINTS != DSP_SPECTRAL_BINS
+#error "zoom spectra must have as many bins as the wideband ones"
+#endif
+
+/* main loop time a dispatch may take before the dsp yields to the pending
+ * events, 0 analyzes each frame in a single dispatch
+ */
+#define DSP_STAGE_BUDGET_US		1000
+
+/* tone counts timed by bee_dsp_benchmark() */
+#define DSP_BENCH_TONE_SETS		4
+
+/** processing modes, the tone bank runs goertzel filters on the samples
+ * instead of the STFT, no spectrum nor band features are produced, the
+ * zoom publishes the spectrum of a narrow band only
+ */
+typedef enum {
+	k_dsp_mode_spectrum = 0,
+	k_dsp_mode_tones,
+	k_dsp_mode_zoom,
+	k_dsp_max_modes,
+}dsp_mode_t;
 
-/* Bee audio RAW spectra */
+/** energy gate setup, a frame skips the spectral pipeline when its rms is
+ * below min_rms or floor_ratio times the noise floor, or when it moved
+ * less than stable_ratio from the last analyzed frame, at most max_skips
+ * frames are skipped between two analysis frames and a frame holding the
+ * rest of a started tone block or zoom frame is never skipped
+ */
+typedef struct bee_dsp_gate {
+	bool enabled;
+	float min_rms;
+	float floor_ratio;
+	float stable_ratio;
+	uint32_t max_skips;
+}bee_dsp_gate_t;
+
+
+/* Bee audio RAW spectra, stamped with the frame it was computed from,
+ * bin n stands for start_hz + n * bin_hz
+ */
 typedef struct bee_spectra{
 	uint32_t spectral_sample_rate;
 	uint32_t spectral_points;
-	float raw[DSP_FFT_POINTS];
+	float start_hz;
+	float bin_hz;
+	uint64_t sample_index;
+	uint32_t timestamp;
+	uint32_t sequence;
+	uint32_t flags;
+	float rms;
+	float peak;
+	bool stale;
+#if DSP_LOG_SPECTRUM
+	int16_t level_cdb[DSP_SPECTRAL_BINS];
+#else
+	float raw[DSP_SPECTRAL_BINS];
+#endif
 }bee_spectra_t;
 
+/* Bee tone bank magnitudes, same scale as the spectra of a rectangular window */
+typedef struct bee_dsp_tones {
+	uint32_t tones;
+	bool stale;
+	uint16_t hz[GOERTZEL_MAX_TONES];
+	float mag[GOERTZEL_MAX_TONES];
+}bee_dsp_tones_t;
+
+/* dsp memory cost, per channel and shared by all channels, in bytes */
+#define DSP_CHANNEL_BYTES	(sizeof(bee_spectra_t) + sizeof(bee_stft_t) + \
+		sizeof(bee_psd_t) + sizeof(bee_features_t) + sizeof(bee_features_history_t) + \
+		sizeof(bee_goertzel_t) + sizeof(bee_zoom_t) + \
+		sizeof(bee_pitch_t) + sizeof(bee_pitch_result_t) + \
+		sizeof(bee_noise_t) + sizeof(bee_noise_report_t) + \
+		sizeof(bee_dsp_tones_t) + sizeof(bee_mel_t) + \
+		sizeof(bee_hive_result_t) + 9 * sizeof(uint32_t))
+#if DSP_USE_Q15
+#define DSP_SHARED_BYTES	(sizeof(bee_goertzel_plan_t) + sizeof(bee_zoom_plan_t) + \
+		sizeof(bee_pitch_plan_t) + sizeof(bee_fft_t) + \
+		(STFT_MAX_FRAME_LEN + STFT_MAX_FRAME_LEN + 2 * DSP_FFT_POINTS) * sizeof(q15_t) + \
+		(DSP_SPECTRAL_BINS + 2 * PITCH_FFT_POINTS) * sizeof(float))
+#else
+#define DSP_SHARED_BYTES	(sizeof(bee_goertzel_plan_t) + sizeof(bee_zoom_plan_t) + \
+		sizeof(bee_pitch_plan_t) + sizeof(bee_fft_t) + \
+		(STFT_MAX_FRAME_LEN + STFT_MAX_FRAME_LEN + DSP_FFT_POINTS + \
+		DSP_SPECTRAL_BINS + 2 * PITCH_FFT_POINTS) * sizeof(float))
+#endif
+
+/* dsp cost report, cycles measured with the DWT cycle counter */
+typedef struct bee_dsp_stats {
+	uint32_t channels;
+	uint32_t channel_bytes;
+	uint32_t shared_bytes;
+	uint32_t channel_cycles[AUDIO_CHANNELS];
+	uint32_t channel_max_cycles[AUDIO_CHANNELS];
+	uint32_t channel_frames[AUDIO_CHANNELS];
+	uint32_t channel_processed[AUDIO_CHANNELS];
+	uint32_t channel_skipped[AUDIO_CHANNELS];
+	uint32_t features_cycles;
+	uint32_t classifier_cycles;
+	uint32_t pitch_cycles;
+	uint32_t dispatches;
+	uint32_t dispatch_max_cycles;
+}bee_dsp_stats_t;
+
+/* cycles taken to turn DSP_FFT_POINTS samples into one spectrum, against
+ * the tone bank following tones[] tones over the same samples
+ */
+typedef struct bee_dsp_bench {
+	uint32_t samples;
+	uint32_t spectrum_cycles;
+	uint32_t tones[DSP_BENCH_TONE_SETS];
+	uint32_t tone_cycles[DSP_BENCH_TONE_SETS];
+}bee_dsp_bench_t;
+
 
 
 
@@ -30,6 +182,120 @@ typedef struct bee_spectra{
  */
 void bee_dsp_init(uint32_t dsp_sample);
 
+/* the setters below are safe to call while a frame is analyzed, the
+ * change is kept and applied once the frame is released
+ */
+
+/**
+ * 	@fn bee_dsp_set_framing()
+ *  @brief changes the STFT frame length, hop and window, the samples
+ *         buffered by each channel are discarded
+ *
+ *  @param
+ *  @return
+ */
+bee_retcode_t bee_dsp_set_framing(uint32_t frame_len, uint32_t hop, stft_window_t window);
+
+/**
+ * 	@fn bee_dsp_set_mode()
+ *  @brief switches between the spectrum pipeline and the tone bank, the
+ *         samples buffered by each channel are discarded
+ *
+ *  @param
+ *  @return
+ */
+bee_retcode_t bee_dsp_set_mode(dsp_mode_t mode);
+
+/**
+ * 	@fn bee_dsp_get_mode()
+ *  @brief gets the processing mode in use
+ *
+ *  @param
+ *  @return
+ */
+dsp_mode_t bee_dsp_get_mode(void);
+
+/**
+ * 	@fn bee_dsp_set_tones()
+ *  @brief changes the tones followed by the tone bank, the first one
+ *         drives the aggro level
+ *
+ *  @param
+ *  @return
+ */
+bee_retcode_t bee_dsp_set_tones(const uint16_t *tones_hz, uint32_t tones);
+
+/**
+ * 	@fn bee_dsp_set_zoom()
+ *  @brief changes the band of the zoom mode, the span is rounded to a
+ *         whole decimation of the sample rate
+ *
+ *  @param
+ *  @return
+ */
+bee_retcode_t bee_dsp_set_zoom(uint32_t center_hz, uint32_t span_hz);
+
+/**
+ * 	@fn bee_dsp_set_pitch()
+ *  @brief changes the fundamental range and threshold of the pitch tracker
+ *         run with the spectrum pipeline, 0 Hz both stops the tracker
+ *
+ *  @param
+ *  @return
+ */
+bee_retcode_t bee_dsp_set_pitch(uint32_t min_hz, uint32_t max_hz, float threshold);
+
+/**
+ * 	@fn bee_dsp_set_noise()
+ *  @brief setups the noise floor tracker, the floors are learnt again
+ *         when the sub window length changes
+ *
+ *  @param
+ *  @return
+ */
+struct bee_noise_cfg;
+bee_retcode_t bee_dsp_set_noise(const struct bee_noise_cfg *cfg);
+
+/**
+ * 	@fn bee_dsp_set_gate()
+ *  @brief setups the energy gate that skips silent or unchanged frames,
+ *         the last spectrum of a skipped channel is kept and flagged stale
+ *
+ *  @param
+ *  @return
+ */
+bee_retcode_t bee_dsp_set_gate(const bee_dsp_gate_t *cfg);
+
+/**
+ * 	@fn bee_dsp_set_band()
+ *  @brief replaces a band of the feature table, see bee_features_set_band(),
+ *         writes made while a frame is analyzed wait for its end
+ *
+ *  @param
+ *  @return k_bee_err when too many writes already wait
+ */
+struct bee_band;
+bee_retcode_t bee_dsp_set_band(uint32_t index, const struct bee_band *band);
+
+/**
+ * 	@fn bee_dsp_set_budget()
+ *  @brief sets the time a dispatch may take before the analysis of a frame
+ *         yields to the pending events, 0 disables the staging
+ *
+ *  @param
+ *  @return
+ */
+bee_retcode_t bee_dsp_set_budget(uint32_t budget_us);
+
+/**
+ * 	@fn bee_dsp_get_budget()
+ *  @brief gets the dispatch budget in us, 0 when frames are not staged
+ *
+ *  @param
+ *  @return
+ */
+uint32_t bee_dsp_get_budget(void);
+
 /**
  * 	@fn bee_dsp_get_sample_rate()
  *  @brief gets the current sample rate used on dsp system
@@ -41,7 +307,7 @@ uint32_t bee_dsp_get_sample_rate(void);
 
 /**
  * 	@fn bee_dsp_get_aggro_level()
- *  @brief gets the current agressivenes estimation
+ *  @brief gets the current agressivenes estimation of the first mic
  *
  *  @param
  *  @return
@@ -49,14 +315,126 @@ uint32_t bee_dsp_get_sample_rate(void);
 float bee_dsp_get_aggro_level(void);
 
 
+/**
+ * 	@fn bee_dsp_get_channel_aggro_level()
+ *  @brief gets the current agressivenes estimation of one mic
+ *
+ *  @param
+ *  @return
+ */
+float bee_dsp_get_channel_aggro_level(uint32_t channel);
+
+
+/**
+ * 	@fn bee_dsp_get_channel_level()
+ *  @brief gets the rms and peak of the last frame of one mic, relative
+ *         to the full scale
+ *
+ *  @param
+ *  @return
+ */
+bee_retcode_t bee_dsp_get_channel_level(uint32_t channel, float *rms, float *peak);
+
+/**
+ * 	@fn bee_dsp_get_features()
+ *  @brief gets the band features of the last report of one mic
+ *
+ *  @param
+ *  @return
+ */
+struct bee_features;
+bee_retcode_t bee_dsp_get_features(uint32_t channel, struct bee_features *out);
+
+/**
+ * 	@fn bee_dsp_get_mel()
+ *  @brief gets the log mel energies and MFCCs of the last report of one
+ *         mic, not valid on rates without generated filterbank
+ *
+ *  @param
+ *  @return
+ */
+struct bee_mel;
+bee_retcode_t bee_dsp_get_mel(uint32_t channel, struct bee_mel *out);
+
+/**
+ * 	@fn bee_dsp_get_hive_state()
+ *  @brief gets the hive state classified on the last report of one mic
+ *
+ *  @param
+ *  @return
+ */
+struct bee_hive_result;
+bee_retcode_t bee_dsp_get_hive_state(uint32_t channel, struct bee_hive_result *out);
+
+/**
+ * 	@fn bee_dsp_get_tones()
+ *  @brief gets the tone bank magnitudes of the last report of one mic
+ *
+ *  @param
+ *  @return
+ */
+bee_retcode_t bee_dsp_get_tones(uint32_t channel, bee_dsp_tones_t *out);
+
+/**
+ * 	@fn bee_dsp_get_pitch()
+ *  @brief gets the wing beat fundamental of the last report of one mic
+ *
+ *  @param
+ *  @return
+ */
+bee_retcode_t bee_dsp_get_pitch(uint32_t channel, bee_pitch_result_t *out);
+
+/**
+ * 	@fn bee_dsp_get_noise()
+ *  @brief gets the broadband power and noise floor of the last report of
+ *         one mic
+ *
+ *  @param
+ *  @return
+ */
+struct bee_noise_report;
+bee_retcode_t bee_dsp_get_noise(uint32_t channel, struct bee_noise_report *out);
+
+/**
+ * 	@fn bee_dsp_get_noise_floor()
+ *  @brief gets the noise floor of each bin of one mic, on the scale of
+ *         the averaged power spectrum
+ *
+ *  @param floor - DSP_SPECTRAL_BINS values
+ *  @return k_bee_err while no floor is ready
+ */
+bee_retcode_t bee_dsp_get_noise_floor(uint32_t channel, float *floor);
+
 /**
  * 	@fn bee_dsp_get_spectra()
- *  @brief gets the raw frequency spectrum from mic
+ *  @brief gets the raw frequency spectrum from one mic
+ *
+ *  @param
+ *  @return
+ */
+bee_retcode_t bee_dsp_get_spectra(uint32_t channel, bee_spectra_t *raw);
+
+/**
+ * 	@fn bee_dsp_get_stats()
+ *  @brief gets the memory and cycle cost per channel, the worst
+ *         case cycle counters are reset on read
+ *
+ *  @param
+ *  @return
+ */
+bee_retcode_t bee_dsp_get_stats(bee_dsp_stats_t *stats);
+
+/**
+ * 	@fn bee_dsp_benchmark()
+ *  @brief times the spectrum pipeline of the build against the tone bank
+ *         on a synthetic tone, the samples buffered by each channel are
+ *         discarded, the firmware runs it once at boot, host builds only
+ *         give an estimate from the host clock
  *
  *  @param
  *  @return
  */
-bee_retcode_t bee_dsp_get_spectra(bee_spectra_t *raw);
+bee_retcode_t bee_dsp_benchmark(bee_dsp_bench_t *bench);
 
 /**
  * 	@fn bee_dsp_handler()
@@ -0,0 +1,56 @@
+/*
+ *  @file bee_fastlog.c
+ *  @brief fast base 2 logarithm and power to dB conversion for the
+ *  log domain spectrum
+ */
+
+#include "lilbee.h"
+
+
+/** internal functions */
+
+/**
+ * 	@fn fastlog_cdb()
+ *  @brief level of one power in 0.01 dB
+ *
+ *  @param
+ *  @return
+ */
+static inline int16_t fastlog_cdb(float power, float floor)
+{
+	float level;
+
+	if(!(power > floor))
+		power = floor;
+
+	level = bee_log2f_fast(power) * FASTLOG_CDB_PER_LOG2;
+	if(level > 32767.0f)
+		return(32767);
+	if(level < -32768.0f)
+		return(-32768);
+
+	return((int16_t)lrintf(level));
+}
+
+/** public functions */
+
+void bee_power_to_cdb(const float *power, int16_t *cdb, uint32_t n, float floor)
+{
+	uint32_t blocks = n >> 2;
+
+	if(power == NULL || cdb == NULL || !(floor > 0.0f))
+		return;
+
+	/* four bins per pass, as the CMSIS kernels do */
+	while(blocks--) {
+		cdb[0] = fastlog_cdb(power[0], floor);
+		cdb[1] = fastlog_cdb(power[1], floor);
+		cdb[2] = fastlog_cdb(power[2], floor);
+		cdb[3] = fastlog_cdb(power[3], floor);
+		power += 4;
+		cdb += 4;
+	}
+
+	for(n &= 3; n; n--)
+		*cdb++ = fastlog_cdb(*power++, floor);
+}
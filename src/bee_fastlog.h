@@ -0,0 +1,60 @@
+/*
+ *  @file bee_fastlog.h
+ *  @brief fast base 2 logarithm and power to dB conversion for the
+ *  log domain spectrum
+ */
+
+#ifndef __BEE_FASTLOG_H
+#define __BEE_FASTLOG_H
+
+/* bits of sqrt(1/2), the mantissa is folded on [sqrt(1/2), sqrt(2)) */
+#define FASTLOG_SQRT_HALF_BITS	0x3F3504F3UL
+
+/* dB of a power per unit of base 2 log, 0.01 dB steps */
+#define FASTLOG_CDB_PER_LOG2	301.029996f
+
+/* log2(1 + u) least squares fit on the folded mantissa, the error against
+ * log2f stays under 1.2e-4, that is under 0.0004 dB against 10 * log10f,
+ * powers of 2 come out exact
+ */
+#define FASTLOG_C1		1.44164738f
+#define FASTLOG_C2		-0.724952837f
+#define FASTLOG_C3		0.518620416f
+#define FASTLOG_C4		-0.330077216f
+
+/**
+ * 	@fn bee_log2f_fast()
+ *  @brief base 2 logarithm of a positive normal float
+ *
+ *  @param
+ *  @return
+ */
+static inline float bee_log2f_fast(float x)
+{
+	union {
+		float f;
+		uint32_t i;
+	}v = { .f = x };
+	int32_t e;
+	float u;
+
+	/* x = m * 2^e, m on [sqrt(1/2), sqrt(2)) */
+	v.i -= FASTLOG_SQRT_HALF_BITS;
+	e = (int32_t)v.i >> 23;
+	v.i = (v.i & 0x007FFFFFUL) + FASTLOG_SQRT_HALF_BITS;
+	u = v.f - 1.0f;
+
+	return((float)e + u * (FASTLOG_C1 + u * (FASTLOG_C2 + u * (FASTLOG_C3 + u * FASTLOG_C4))));
+}
+
+/**
+ * 	@fn bee_power_to_cdb()
+ *  @brief converts bin powers to int16 levels in 0.01 dB, saturated, the
+ *         powers below floor are taken as floor
+ *
+ *  @param
+ *  @return
+ */
+void bee_power_to_cdb(const float *power, int16_t *cdb, uint32_t n, float floor);
+
+#endif
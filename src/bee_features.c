@@ -0,0 +1,208 @@
+/*
+ *  @file bee_features.c
+ *  @brief band energy feature engine, extracts the energy, peak and
+ *  share of a table of named frequency bands from a spectrum
+ */
+
+#include "lilbee.h"
+
+
+/** default bands, the hissing region first as it drives the aggro level */
+static const bee_band_t default_bands[] = {
+	{ .name = "hiss", .low_hz = 2500, .high_hz = 3500 },
+	{ .name = "hum", .low_hz = 200, .high_hz = 300 },
+	{ .name = "piping", .low_hz = 400, .high_hz = 500 },
+};
+
+/** internal variables */
+static bee_band_t bands[FEATURES_MAX_BANDS];
+static uint32_t band_count = 0;
+static uint32_t sample = 0;
+static float bin_width = 0.0f;
+
+/* bit n is set on the bins belonging to band n */
+static uint8_t bin_bands[DSP_SPECTRAL_BINS];
+
+/** internal functions */
+
+/**
+ * 	@fn features_hz_to_bin()
+ *  @brief nearest bin of a frequency
+ *
+ *  @param
+ *  @return
+ */
+static uint32_t features_hz_to_bin(uint32_t hz)
+{
+	uint32_t ret = (hz * DSP_FFT_POINTS + sample / 2) / sample;
+
+	if(ret >= DSP_SPECTRAL_BINS)
+		ret = DSP_SPECTRAL_BINS - 1;
+
+	return(ret);
+}
+
+/**
+ * 	@fn features_resolve()
+ *  @brief maps every band of the table to its bins
+ *
+ *  @param
+ *  @return
+ */
+static void features_resolve(void)
+{
+	uint32_t low;
+	uint32_t high;
+
+	memset(bin_bands, 0, sizeof(bin_bands));
+
+	if(sample == 0)
+		return;
+
+	for(uint32_t b = 0; b < band_count; b++) {
+		low = features_hz_to_bin(bands[b].low_hz);
+		high = features_hz_to_bin(bands[b].high_hz);
+
+		for(uint32_t i = low; i <= high; i++)
+			bin_bands[i] |= (1 << b);
+	}
+}
+
+/** public functions */
+
+void bee_features_init(uint32_t sample_rate)
+{
+	if(band_count == 0) {
+		band_count = sizeof(default_bands) / sizeof(default_bands[0]);
+		memcpy(bands, default_bands, sizeof(default_bands));
+	}
+
+	sample = sample_rate;
+	bin_width = (float)sample_rate / (float)DSP_FFT_POINTS;
+	features_resolve();
+}
+
+bee_retcode_t bee_features_set_band(uint32_t index, const bee_band_t *band)
+{
+	if(band == NULL || index > band_count)
+		return(k_bee_ret_invalid_param);
+
+	if(band->low_hz == 0 && band->high_hz == 0) {
+		/* removal, the bands after it move down */
+		if(index == band_count)
+			return(k_bee_ret_invalid_param);
+
+		band_count--;
+		memmove(&bands[index], &bands[index + 1],
+				(band_count - index) * sizeof(bands[0]));
+	} else {
+		if(band->low_hz > band->high_hz || index >= FEATURES_MAX_BANDS)
+			return(k_bee_ret_invalid_param);
+
+		bands[index] = *band;
+		if(index == band_count)
+			band_count++;
+	}
+
+	features_resolve();
+	return(k_bee_ret_ok);
+}
+
+uint32_t bee_features_get_bands(bee_band_t *table)
+{
+	if(table)
+		memcpy(table, bands, band_count * sizeof(bands[0]));
+
+	return(band_count);
+}
+
+void bee_features_reset_history(bee_features_history_t *history)
+{
+	if(history)
+		history->valid = false;
+}
+
+void bee_features_compute(const float *power, bee_features_history_t *history,
+		bee_features_t *out)
+{
+	const uint32_t chunks = DSP_SPECTRAL_BINS / FEATURES_ROLLOFF_CHUNK;
+	bee_band_result_t *res;
+	float chunk_energy[DSP_SPECTRAL_BINS / FEATURES_ROLLOFF_CHUNK];
+	float level;
+	float total = 0.0f;
+	float moment = 0.0f;
+	float log_sum = 0.0f;
+	float rise = 0.0f;
+	float target;
+	float peak[FEATURES_MAX_BANDS] = {0};
+	bool flux = (history != NULL && history->valid);
+	int16_t cdb;
+	uint32_t mask;
+	uint32_t b;
+	uint32_t i;
+
+	if(power == NULL || out == NULL)
+		return;
+
+	memset(out->band, 0, sizeof(out->band));
+	memset(chunk_energy, 0, sizeof(chunk_energy));
+	out->bands = band_count;
+	out->bin_width = bin_width;
+
+	for(i = 0; i < DSP_SPECTRAL_BINS; i++) {
+		total += power[i];
+		moment += (float)i * power[i];
+		chunk_energy[i / FEATURES_ROLLOFF_CHUNK] += power[i];
+
+		/* one base 2 log per bin serves the flatness and the flux */
+		level = bee_log2f_fast(power[i] + FEATURES_POWER_FLOOR);
+		log_sum += level;
+
+		if(history) {
+			cdb = (int16_t)(level * FASTLOG_CDB_PER_LOG2);
+			if(flux && cdb > history->level_cdb[i])
+				rise += (float)(cdb - history->level_cdb[i]);
+			history->level_cdb[i] = cdb;
+		}
+
+		/* only the bands holding this bin are visited */
+		for(mask = bin_bands[i]; mask; mask &= mask - 1) {
+			b = __builtin_ctz(mask);
+			res = &out->band[b];
+			res->energy += power[i];
+			if(power[i] > peak[b]) {
+				peak[b] = power[i];
+				res->peak_bin = i;
+			}
+		}
+	}
+
+	out->total_energy = total;
+	for(b = 0; b < band_count; b++) {
+		res = &out->band[b];
+		res->ratio = (total > 0.0f) ? res->energy / total : 0.0f;
+		res->peak_hz = (float)res->peak_bin * bin_width;
+	}
+
+	out->shape.centroid_hz = (total > 0.0f) ? moment / total * bin_width : 0.0f;
+	out->shape.flatness = exp2f(log_sum / (float)DSP_SPECTRAL_BINS) /
+			(total / (float)DSP_SPECTRAL_BINS + FEATURES_POWER_FLOOR);
+	out->shape.flux = rise / (100.0f * (float)DSP_SPECTRAL_BINS);
+
+	if(history)
+		history->valid = true;
+
+	/* roll-off chunk first, then the bin inside it */
+	target = total * FEATURES_ROLLOFF;
+	for(b = 0; b < chunks - 1 && target > chunk_energy[b]; b++)
+		target -= chunk_energy[b];
+
+	i = b * FEATURES_ROLLOFF_CHUNK;
+	for(; i < (b + 1) * FEATURES_ROLLOFF_CHUNK - 1; i++) {
+		target -= power[i];
+		if(target <= 0.0f)
+			break;
+	}
+
+	out->shape.rolloff_hz = (float)i * bin_width;
+}
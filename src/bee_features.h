@@ -0,0 +1,121 @@
+/*
+ *  @file bee_features.h
+ *  @brief band energy feature engine, extracts the energy, peak and
+ *  share of a table of named frequency bands from a spectrum
+ */
+
+#ifndef __BEE_FEATURES_H
+#define __BEE_FEATURES_H
+
+/* number of bands the table can hold, band 0 drives the aggro level */
+#define FEATURES_MAX_BANDS	4
+
+/* band name length, not null terminated when full */
+#define FEATURES_NAME_LEN	8
+
+/* share of the spectrum energy below the roll-off frequency */
+#define FEATURES_ROLLOFF	0.85f
+
+/* smallest bin power taken by the logs, keeps silent bins finite */
+#define FEATURES_POWER_FLOOR	1e-12f
+
+/* bins summed together while locating the roll-off */
+#define FEATURES_ROLLOFF_CHUNK	16
+
+#if (DSP_SPECTRAL_BINS % FEATURES_ROLLOFF_CHUNK) != 0
+#error "roll-off chunks must tile the spectrum"
+#endif
+
+/** frequency band, edges included */
+typedef struct bee_band {
+	char name[FEATURES_NAME_LEN];
+	uint16_t low_hz;
+	uint16_t high_hz;
+}bee_band_t;
+
+/** features of one band, energy is the sum of the bins power */
+typedef struct bee_band_result {
+	float energy;
+	float ratio;
+	uint32_t peak_bin;
+	float peak_hz;
+}bee_band_result_t;
+
+/** spectral shape, the centroid is power weighted, flatness is the
+ * geometric over the arithmetic mean of the bins power and flux the mean
+ * rise of the bins level in dB since the previous spectrum
+ */
+typedef struct bee_shape {
+	float centroid_hz;
+	float rolloff_hz;
+	float flatness;
+	float flux;
+}bee_shape_t;
+
+/** features of a spectrum */
+typedef struct bee_features {
+	uint32_t bands;
+	float bin_width;
+	float total_energy;
+	bee_shape_t shape;
+	bee_band_result_t band[FEATURES_MAX_BANDS];
+}bee_features_t;
+
+/** previous spectrum of a stream kept for the flux, in 0.01 dB */
+typedef struct bee_features_history {
+	bool valid;
+	int16_t level_cdb[DSP_SPECTRAL_BINS];
+}bee_features_history_t;
+
+
+/**
+ * 	@fn bee_features_init()
+ *  @brief resolves the band edges to bins for a sample rate
+ *
+ *  @param
+ *  @return
+ */
+void bee_features_init(uint32_t sample_rate);
+
+/**
+ * 	@fn bee_features_set_band()
+ *  @brief replaces a band of the table, an index past the last band
+ *         appends it and a band with both edges at zero removes it, only
+ *         between frames, other callers go through bee_dsp_set_band()
+ *
+ *  @param
+ *  @return
+ */
+bee_retcode_t bee_features_set_band(uint32_t index, const bee_band_t *band);
+
+/**
+ * 	@fn bee_features_get_bands()
+ *  @brief copies the band table
+ *
+ *  @param bands - FEATURES_MAX_BANDS entries
+ *  @return number of bands in the table
+ */
+uint32_t bee_features_get_bands(bee_band_t *bands);
+
+/**
+ * 	@fn bee_features_reset_history()
+ *  @brief forgets the previous spectrum, the next flux reads zero
+ *
+ *  @param
+ *  @return
+ */
+void bee_features_reset_history(bee_features_history_t *history);
+
+/**
+ * 	@fn bee_features_compute()
+ *  @brief computes every band features and the spectral shape in a single
+ *         pass over a spectrum, the history is replaced by it
+ *
+ *  @param power - DSP_SPECTRAL_BINS bin powers
+ *  @param history - previous spectrum of the stream, NULL skips the flux
+ *  @return
+ */
+void bee_features_compute(const float *power, bee_features_history_t *history,
+		bee_features_t *out);
+
+#endif
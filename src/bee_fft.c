@@ -0,0 +1,150 @@
+/*
+ *  @file bee_fft.c
+ *  @brief real FFT plans built from the tables of the selected sizes only,
+ *  the size used by the pipeline is chosen at build time
+ */
+
+#include "lilbee.h"
+
+
+/** tables of one real FFT size, the CMSIS init functions reference every
+ * size they know about so the linker keeps all of them, only the entries
+ * below are reachable here
+ */
+typedef struct fft_size {
+	uint32_t points;
+#if DSP_USE_Q15
+	const arm_cfft_instance_q15 *cfft;
+	const q15_t *coef_a;
+	const q15_t *coef_b;
+#else
+	const arm_cfft_instance_f32 *cfft;
+	const float32_t *twiddle;
+#endif
+	uint32_t bytes;
+}fft_size_t;
+
+/* tables of a real FFT of n points, the complex one runs on half of them */
+#if DSP_USE_Q15
+#define FFT_TABLE_BYTES(half, n)	(sizeof(twiddleCoef_##half##_q15) + \
+		sizeof(armBitRevIndexTable_fixed_##half) + sizeof(bee_fft_coef_a_##n) + \
+		sizeof(bee_fft_coef_b_##n))
+#else
+#define FFT_TABLE_BYTES(half, n)	(sizeof(twiddleCoef_##half) + \
+		sizeof(armBitRevIndexTable##half) + sizeof(twiddleCoef_rfft_##n))
+#endif
+
+/** internal variables */
+static const fft_size_t fft_sizes[] = {
+#if DSP_USE_Q15
+#if FFT_LINKED_SIZES & FFT_SIZE_256
+	{ 256, &arm_cfft_sR_q15_len128, bee_fft_coef_a_256, bee_fft_coef_b_256,
+		FFT_TABLE_BYTES(128, 256) },
+#endif
+#if FFT_LINKED_SIZES & FFT_SIZE_512
+	{ 512, &arm_cfft_sR_q15_len256, bee_fft_coef_a_512, bee_fft_coef_b_512,
+		FFT_TABLE_BYTES(256, 512) },
+#endif
+#if FFT_LINKED_SIZES & FFT_SIZE_1024
+	{ 1024, &arm_cfft_sR_q15_len512, bee_fft_coef_a_1024, bee_fft_coef_b_1024,
+		FFT_TABLE_BYTES(512, 1024) },
+#endif
+#if FFT_LINKED_SIZES & FFT_SIZE_2048
+	{ 2048, &arm_cfft_sR_q15_len1024, bee_fft_coef_a_2048, bee_fft_coef_b_2048,
+		FFT_TABLE_BYTES(1024, 2048) },
+#endif
+#else
+#if FFT_LINKED_SIZES & FFT_SIZE_256
+	{ 256, &arm_cfft_sR_f32_len128, twiddleCoef_rfft_256, FFT_TABLE_BYTES(128, 256) },
+#endif
+#if FFT_LINKED_SIZES & FFT_SIZE_512
+	{ 512, &arm_cfft_sR_f32_len256, twiddleCoef_rfft_512, FFT_TABLE_BYTES(256, 512) },
+#endif
+#if FFT_LINKED_SIZES & FFT_SIZE_1024
+	{ 1024, &arm_cfft_sR_f32_len512, twiddleCoef_rfft_1024, FFT_TABLE_BYTES(512, 1024) },
+#endif
+#if FFT_LINKED_SIZES & FFT_SIZE_2048
+	{ 2048, &arm_cfft_sR_f32_len1024, twiddleCoef_rfft_2048, FFT_TABLE_BYTES(1024, 2048) },
+#endif
+#endif
+};
+
+/** internal functions */
+
+/**
+ * 	@fn fft_find()
+ *  @brief gets the tables of a linked real FFT size
+ *
+ *  @param
+ *  @return
+ */
+static const fft_size_t *fft_find(uint32_t points)
+{
+	for(uint32_t i = 0; i < sizeof(fft_sizes) / sizeof(fft_sizes[0]); i++) {
+		if(fft_sizes[i].points == points)
+			return(&fft_sizes[i]);
+	}
+
+	return(NULL);
+}
+
+/** public functions */
+
+bee_retcode_t bee_fft_init(bee_fft_t *plan, uint32_t points)
+{
+	const fft_size_t *size = fft_find(points);
+
+	if(plan == NULL || size == NULL)
+		return(k_bee_ret_invalid_param);
+
+#if DSP_USE_Q15
+	/* forward transform, bit reversed output and tables walked one by one */
+	plan->fftLenReal = points;
+	plan->ifftFlagR = 0;
+	plan->bitReverseFlagR = 1;
+	plan->twidCoefRModifier = 1;
+	plan->pTwiddleAReal = (q15_t *)size->coef_a;
+	plan->pTwiddleBReal = (q15_t *)size->coef_b;
+	plan->pCfft = size->cfft;
+#else
+	/* the complex stage runs on half the points */
+	plan->Sint = *size->cfft;
+	plan->fftLenRFFT = points;
+	plan->pTwiddleRFFT = (float32_t *)size->twiddle;
+#endif
+
+	return(k_bee_ret_ok);
+}
+
+const arm_cfft_instance_f32 *bee_fft_get_complex(uint32_t points)
+{
+#if DSP_USE_Q15
+	/* only the float tables of the build size are linked next to the Q15 ones */
+	if(points != FFT_POINTS / 2)
+		return(NULL);
+
+#if FFT_POINTS == 256
+	return(&arm_cfft_sR_f32_len128);
+#elif FFT_POINTS == 512
+	return(&arm_cfft_sR_f32_len256);
+#elif FFT_POINTS == 1024
+	return(&arm_cfft_sR_f32_len512);
+#else
+	return(&arm_cfft_sR_f32_len1024);
+#endif
+#else
+	const fft_size_t *size = fft_find(2 * points);
+
+	return((size != NULL) ? size->cfft : NULL);
+#endif
+}
+
+uint32_t bee_fft_get_table_bytes(void)
+{
+	uint32_t ret = 0;
+
+	for(uint32_t i = 0; i < sizeof(fft_sizes) / sizeof(fft_sizes[0]); i++)
+		ret += fft_sizes[i].bytes;
+
+	return(ret);
+}
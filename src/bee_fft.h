@@ -0,0 +1,98 @@
+/*
+ *  @file bee_fft.h
+ *  @brief real FFT plans built from the tables of the selected sizes only,
+ *  the size used by the pipeline is chosen at build time
+ */
+
+#ifndef __BEE_FFT_H
+#define __BEE_FFT_H
+
+/* selects the fixed point Q15 spectral pipeline instead of the float one,
+ * framing, FFT and dsp only build the tables and buffers of the selected one,
+ * only the shared framing and FFT scratch shrinks, 2 KB of 11.5 KB at 512
+ * points, spectra, PSD and noise floors stay float per channel since a block
+ * exponent over a power spectrum leaves few bits, or none, to the quiet bins
+ * the floor is made of, bee_dsp_get_stats() reports the bytes of each build
+ */
+#ifndef DSP_USE_Q15
+#define DSP_USE_Q15	0
+#endif
+
+/* real FFT sizes the plan layer can link */
+#define FFT_SIZE_256	(1 << 0)
+#define FFT_SIZE_512	(1 << 1)
+#define FFT_SIZE_1024	(1 << 2)
+#define FFT_SIZE_2048	(1 << 3)
+
+#define FFT_SIZE_BIT(n)	((n) == 256 ? FFT_SIZE_256 : (n) == 512 ? FFT_SIZE_512 : \
+		(n) == 1024 ? FFT_SIZE_1024 : (n) == 2048 ? FFT_SIZE_2048 : 0)
+
+/* points of the FFT run by the pipeline */
+#ifndef FFT_POINTS
+#define FFT_POINTS	512
+#endif
+
+#if FFT_SIZE_BIT(FFT_POINTS) == 0
+#error "FFT_POINTS must be 256, 512, 1024 or 2048"
+#endif
+
+/* sizes that can be planned at runtime on top of FFT_POINTS, an OR of
+ * FFT_SIZE_x, each one links its own tables
+ */
+#ifndef FFT_RUNTIME_SIZES
+#define FFT_RUNTIME_SIZES	0
+#endif
+
+#define FFT_LINKED_SIZES	(FFT_SIZE_BIT(FFT_POINTS) | FFT_RUNTIME_SIZES)
+
+#if DSP_USE_Q15
+typedef arm_rfft_instance_q15 bee_fft_t;
+
+/* split tables decimated for each size, see tools/gen_fft_tables.py */
+extern const q15_t bee_fft_coef_a_256[256];
+extern const q15_t bee_fft_coef_b_256[256];
+extern const q15_t bee_fft_coef_a_512[512];
+extern const q15_t bee_fft_coef_b_512[512];
+extern const q15_t bee_fft_coef_a_1024[1024];
+extern const q15_t bee_fft_coef_b_1024[1024];
+extern const q15_t bee_fft_coef_a_2048[2048];
+extern const q15_t bee_fft_coef_b_2048[2048];
+#else
+typedef arm_rfft_fast_instance_f32 bee_fft_t;
+#endif
+
+/* flash the CMSIS init function of the pipeline would link for its tables */
+extern const uint32_t bee_fft_cmsis_table_bytes;
+
+
+/**
+ * 	@fn bee_fft_init()
+ *  @brief plans a forward real FFT, only the linked sizes are accepted
+ *
+ *  @param
+ *  @return
+ */
+bee_retcode_t bee_fft_init(bee_fft_t *plan, uint32_t points);
+
+/**
+ * 	@fn bee_fft_get_complex()
+ *  @brief gets the float complex FFT sharing the tables of a linked real
+ *         FFT of twice the points, NULL when not linked
+ *
+ *  @param
+ *  @return
+ */
+const arm_cfft_instance_f32 *bee_fft_get_complex(uint32_t points);
+
+/**
+ * 	@fn bee_fft_get_table_bytes()
+ *  @brief gets the flash taken by the tables of the linked real FFT sizes,
+ *         to be set against bee_fft_cmsis_table_bytes, the complex FFT of
+ *         the zoom is not counted
+ *
+ *  @param
+ *  @return
+ */
+uint32_t bee_fft_get_table_bytes(void);
+
+#endif
@@ -0,0 +1,1008 @@
+/*
+ *  @file bee_fft_tables.c
+ *  @brief real FFT split tables of each size for the Q15 pipeline,
+ *  generated by tools/gen_fft_tables.py, do not edit
+ */
+
+#include "lilbee.h"
+
+/* flash the CMSIS init function of the pipeline links for its tables,
+ * see bee_fft_get_table_bytes()
+ */
+#if DSP_USE_Q15
+const uint32_t bee_fft_cmsis_table_bytes = 73160;
+#else
+const uint32_t bee_fft_cmsis_table_bytes = 78936;
+#endif
+
+#if DSP_USE_Q15
+
+#if FFT_LINKED_SIZES & FFT_SIZE_256
+const q15_t ALIGN4 bee_fft_coef_a_256[256] = {
+	(q15_t)0x4000, (q15_t)0xc000, (q15_t)0x3e6e, (q15_t)0xc005, (q15_t)0x3cdc, (q15_t)0xc014, (q15_t)0x3b4b, (q15_t)0xc02c,
+	(q15_t)0x39ba, (q15_t)0xc04f, (q15_t)0x382a, (q15_t)0xc07b, (q15_t)0x369c, (q15_t)0xc0b1, (q15_t)0x350f, (q15_t)0xc0f1,
+	(q15_t)0x3384, (q15_t)0xc13b, (q15_t)0x31fa, (q15_t)0xc18e, (q15_t)0x3073, (q15_t)0xc1eb, (q15_t)0x2eee, (q15_t)0xc251,
+	(q15_t)0x2d6c, (q15_t)0xc2c1, (q15_t)0x2bed, (q15_t)0xc33b, (q15_t)0x2a70, (q15_t)0xc3be, (q15_t)0x28f7, (q15_t)0xc44a,
+	(q15_t)0x2782, (q15_t)0xc4df, (q15_t)0x2611, (q15_t)0xc57e, (q15_t)0x24a3, (q15_t)0xc625, (q15_t)0x233a, (q15_t)0xc6d5,
+	(q15_t)0x21d5, (q15_t)0xc78f, (q15_t)0x2074, (q15_t)0xc850, (q15_t)0x1f19, (q15_t)0xc91b, (q15_t)0x1dc3, (q15_t)0xc9ee,
+	(q15_t)0x1c72, (q15_t)0xcac9, (q15_t)0x1b26, (q15_t)0xcbad, (q15_t)0x19e0, (q15_t)0xcc98, (q15_t)0x18a0, (q15_t)0xcd8c,
+	(q15_t)0x1766, (q15_t)0xce87, (q15_t)0x1632, (q15_t)0xcf8a, (q15_t)0x1505, (q15_t)0xd094, (q15_t)0x13df, (q15_t)0xd1a6,
+	(q15_t)0x12bf, (q15_t)0xd2bf, (q15_t)0x11a6, (q15_t)0xd3df, (q15_t)0x1094, (q15_t)0xd505, (q15_t)0x0f8a, (q15_t)0xd632,
+	(q15_t)0x0e87, (q15_t)0xd766, (q15_t)0x0d8c, (q15_t)0xd8a0, (q15_t)0x0c98, (q15_t)0xd9e0, (q15_t)0x0bad, (q15_t)0xdb26,
+	(q15_t)0x0ac9, (q15_t)0xdc72, (q15_t)0x09ee, (q15_t)0xddc3, (q15_t)0x091b, (q15_t)0xdf19, (q15_t)0x0850, (q15_t)0xe074,
+	(q15_t)0x078f, (q15_t)0xe1d5, (q15_t)0x06d5, (q15_t)0xe33a, (q15_t)0x0625, (q15_t)0xe4a3, (q15_t)0x057e, (q15_t)0xe611,
+	(q15_t)0x04df, (q15_t)0xe782, (q15_t)0x044a, (q15_t)0xe8f7, (q15_t)0x03be, (q15_t)0xea70, (q15_t)0x033b, (q15_t)0xebed,
+	(q15_t)0x02c1, (q15_t)0xed6c, (q15_t)0x0251, (q15_t)0xeeee, (q15_t)0x01eb, (q15_t)0xf073, (q15_t)0x018e, (q15_t)0xf1fa,
+	(q15_t)0x013b, (q15_t)0xf384, (q15_t)0x00f1, (q15_t)0xf50f, (q15_t)0x00b1, (q15_t)0xf69c, (q15_t)0x007b, (q15_t)0xf82a,
+	(q15_t)0x004f, (q15_t)0xf9ba, (q15_t)0x002c, (q15_t)0xfb4b, (q15_t)0x0014, (q15_t)0xfcdc, (q15_t)0x0005, (q15_t)0xfe6e,
+	(q15_t)0x0000, (q15_t)0x0000, (q15_t)0x0005, (q15_t)0x0192, (q15_t)0x0014, (q15_t)0x0324, (q15_t)0x002c, (q15_t)0x04b5,
+	(q15_t)0x004f, (q15_t)0x0646, (q15_t)0x007b, (q15_t)0x07d6, (q15_t)0x00b1, (q15_t)0x0964, (q15_t)0x00f1, (q15_t)0x0af1,
+	(q15_t)0x013b, (q15_t)0x0c7c, (q15_t)0x018e, (q15_t)0x0e06, (q15_t)0x01eb, (q15_t)0x0f8d, (q15_t)0x0251, (q15_t)0x1112,
+	(q15_t)0x02c1, (q15_t)0x1294, (q15_t)0x033b, (q15_t)0x1413, (q15_t)0x03be, (q15_t)0x1590, (q15_t)0x044a, (q15_t)0x1709,
+	(q15_t)0x04df, (q15_t)0x187e, (q15_t)0x057e, (q15_t)0x19ef, (q15_t)0x0625, (q15_t)0x1b5d, (q15_t)0x06d5, (q15_t)0x1cc6,
+	(q15_t)0x078f, (q15_t)0x1e2b, (q15_t)0x0850, (q15_t)0x1f8c, (q15_t)0x091b, (q15_t)0x20e7, (q15_t)0x09ee, (q15_t)0x223d,
+	(q15_t)0x0ac9, (q15_t)0x238e, (q15_t)0x0bad, (q15_t)0x24da, (q15_t)0x0c98, (q15_t)0x2620, (q15_t)0x0d8c, (q15_t)0x2760,
+	(q15_t)0x0e87, (q15_t)0x289a, (q15_t)0x0f8a, (q15_t)0x29ce, (q15_t)0x1094, (q15_t)0x2afb, (q15_t)0x11a6, (q15_t)0x2c21,
+	(q15_t)0x12bf, (q15_t)0x2d41, (q15_t)0x13df, (q15_t)0x2e5a, (q15_t)0x1505, (q15_t)0x2f6c, (q15_t)0x1632, (q15_t)0x3076,
+	(q15_t)0x1766, (q15_t)0x3179, (q15_t)0x18a0, (q15_t)0x3274, (q15_t)0x19e0, (q15_t)0x3368, (q15_t)0x1b26, (q15_t)0x3453,
+	(q15_t)0x1c72, (q15_t)0x3537, (q15_t)0x1dc3, (q15_t)0x3612, (q15_t)0x1f19, (q15_t)0x36e5, (q15_t)0x2074, (q15_t)0x37b0,
+	(q15_t)0x21d5, (q15_t)0x3871, (q15_t)0x233a, (q15_t)0x392b, (q15_t)0x24a3, (q15_t)0x39db, (q15_t)0x2611, (q15_t)0x3a82,
+	(q15_t)0x2782, (q15_t)0x3b21, (q15_t)0x28f7, (q15_t)0x3bb6, (q15_t)0x2a70, (q15_t)0x3c42, (q15_t)0x2bed, (q15_t)0x3cc5,
+	(q15_t)0x2d6c, (q15_t)0x3d3f, (q15_t)0x2eee, (q15_t)0x3daf, (q15_t)0x3073, (q15_t)0x3e15, (q15_t)0x31fa, (q15_t)0x3e72,
+	(q15_t)0x3384, (q15_t)0x3ec5, (q15_t)0x350f, (q15_t)0x3f0f, (q15_t)0x369c, (q15_t)0x3f4f, (q15_t)0x382a, (q15_t)0x3f85,
+	(q15_t)0x39ba, (q15_t)0x3fb1, (q15_t)0x3b4b, (q15_t)0x3fd4, (q15_t)0x3cdc, (q15_t)0x3fec, (q15_t)0x3e6e, (q15_t)0x3ffb,
+};
+const q15_t ALIGN4 bee_fft_coef_b_256[256] = {
+	(q15_t)0x4000, (q15_t)0x4000, (q15_t)0x4192, (q15_t)0x3ffb, (q15_t)0x4324, (q15_t)0x3fec, (q15_t)0x44b5, (q15_t)0x3fd4,
+	(q15_t)0x4646, (q15_t)0x3fb1, (q15_t)0x47d6, (q15_t)0x3f85, (q15_t)0x4964, (q15_t)0x3f4f, (q15_t)0x4af1, (q15_t)0x3f0f,
+	(q15_t)0x4c7c, (q15_t)0x3ec5, (q15_t)0x4e06, (q15_t)0x3e72, (q15_t)0x4f8d, (q15_t)0x3e15, (q15_t)0x5112, (q15_t)0x3daf,
+	(q15_t)0x5294, (q15_t)0x3d3f, (q15_t)0x5413, (q15_t)0x3cc5, (q15_t)0x5590, (q15_t)0x3c42, (q15_t)0x5709, (q15_t)0x3bb6,
+	(q15_t)0x587e, (q15_t)0x3b21, (q15_t)0x59ef, (q15_t)0x3a82, (q15_t)0x5b5d, (q15_t)0x39db, (q15_t)0x5cc6, (q15_t)0x392b,
+	(q15_t)0x5e2b, (q15_t)0x3871, (q15_t)0x5f8c, (q15_t)0x37b0, (q15_t)0x60e7, (q15_t)0x36e5, (q15_t)0x623d, (q15_t)0x3612,
+	(q15_t)0x638e, (q15_t)0x3537, (q15_t)0x64da, (q15_t)0x3453, (q15_t)0x6620, (q15_t)0x3368, (q15_t)0x6760, (q15_t)0x3274,
+	(q15_t)0x689a, (q15_t)0x3179, (q15_t)0x69ce, (q15_t)0x3076, (q15_t)0x6afb, (q15_t)0x2f6c, (q15_t)0x6c21, (q15_t)0x2e5a,
+	(q15_t)0x6d41, (q15_t)0x2d41, (q15_t)0x6e5a, (q15_t)0x2c21, (q15_t)0x6f6c, (q15_t)0x2afb, (q15_t)0x7076, (q15_t)0x29ce,
+	(q15_t)0x7179, (q15_t)0x289a, (q15_t)0x7274, (q15_t)0x2760, (q15_t)0x7368, (q15_t)0x2620, (q15_t)0x7453, (q15_t)0x24da,
+	(q15_t)0x7537, (q15_t)0x238e, (q15_t)0x7612, (q15_t)0x223d, (q15_t)0x76e5, (q15_t)0x20e7, (q15_t)0x77b0, (q15_t)0x1f8c,
+	(q15_t)0x7871, (q15_t)0x1e2b, (q15_t)0x792b, (q15_t)0x1cc6, (q15_t)0x79db, (q15_t)0x1b5d, (q15_t)0x7a82, (q15_t)0x19ef,
+	(q15_t)0x7b21, (q15_t)0x187e, (q15_t)0x7bb6, (q15_t)0x1709, (q15_t)0x7c42, (q15_t)0x1590, (q15_t)0x7cc5, (q15_t)0x1413,
+	(q15_t)0x7d3f, (q15_t)0x1294, (q15_t)0x7daf, (q15_t)0x1112, (q15_t)0x7e15, (q15_t)0x0f8d, (q15_t)0x7e72, (q15_t)0x0e06,
+	(q15_t)0x7ec5, (q15_t)0x0c7c, (q15_t)0x7f0f, (q15_t)0x0af1, (q15_t)0x7f4f, (q15_t)0x0964, (q15_t)0x7f85, (q15_t)0x07d6,
+	(q15_t)0x7fb1, (q15_t)0x0646, (q15_t)0x7fd4, (q15_t)0x04b5, (q15_t)0x7fec, (q15_t)0x0324, (q15_t)0x7ffb, (q15_t)0x0192,
+	(q15_t)0x7fff, (q15_t)0x0000, (q15_t)0x7ffb, (q15_t)0xfe6e, (q15_t)0x7fec, (q15_t)0xfcdc, (q15_t)0x7fd4, (q15_t)0xfb4b,
+	(q15_t)0x7fb1, (q15_t)0xf9ba, (q15_t)0x7f85, (q15_t)0xf82a, (q15_t)0x7f4f, (q15_t)0xf69c, (q15_t)0x7f0f, (q15_t)0xf50f,
+	(q15_t)0x7ec5, (q15_t)0xf384, (q15_t)0x7e72, (q15_t)0xf1fa, (q15_t)0x7e15, (q15_t)0xf073, (q15_t)0x7daf, (q15_t)0xeeee,
+	(q15_t)0x7d3f, (q15_t)0xed6c, (q15_t)0x7cc5, (q15_t)0xebed, (q15_t)0x7c42, (q15_t)0xea70, (q15_t)0x7bb6, (q15_t)0xe8f7,
+	(q15_t)0x7b21, (q15_t)0xe782, (q15_t)0x7a82, (q15_t)0xe611, (q15_t)0x79db, (q15_t)0xe4a3, (q15_t)0x792b, (q15_t)0xe33a,
+	(q15_t)0x7871, (q15_t)0xe1d5, (q15_t)0x77b0, (q15_t)0xe074, (q15_t)0x76e5, (q15_t)0xdf19, (q15_t)0x7612, (q15_t)0xddc3,
+	(q15_t)0x7537, (q15_t)0xdc72, (q15_t)0x7453, (q15_t)0xdb26, (q15_t)0x7368, (q15_t)0xd9e0, (q15_t)0x7274, (q15_t)0xd8a0,
+	(q15_t)0x7179, (q15_t)0xd766, (q15_t)0x7076, (q15_t)0xd632, (q15_t)0x6f6c, (q15_t)0xd505, (q15_t)0x6e5a, (q15_t)0xd3df,
+	(q15_t)0x6d41, (q15_t)0xd2bf, (q15_t)0x6c21, (q15_t)0xd1a6, (q15_t)0x6afb, (q15_t)0xd094, (q15_t)0x69ce, (q15_t)0xcf8a,
+	(q15_t)0x689a, (q15_t)0xce87, (q15_t)0x6760, (q15_t)0xcd8c, (q15_t)0x6620, (q15_t)0xcc98, (q15_t)0x64da, (q15_t)0xcbad,
+	(q15_t)0x638e, (q15_t)0xcac9, (q15_t)0x623d, (q15_t)0xc9ee, (q15_t)0x60e7, (q15_t)0xc91b, (q15_t)0x5f8c, (q15_t)0xc850,
+	(q15_t)0x5e2b, (q15_t)0xc78f, (q15_t)0x5cc6, (q15_t)0xc6d5, (q15_t)0x5b5d, (q15_t)0xc625, (q15_t)0x59ef, (q15_t)0xc57e,
+	(q15_t)0x587e, (q15_t)0xc4df, (q15_t)0x5709, (q15_t)0xc44a, (q15_t)0x5590, (q15_t)0xc3be, (q15_t)0x5413, (q15_t)0xc33b,
+	(q15_t)0x5294, (q15_t)0xc2c1, (q15_t)0x5112, (q15_t)0xc251, (q15_t)0x4f8d, (q15_t)0xc1eb, (q15_t)0x4e06, (q15_t)0xc18e,
+	(q15_t)0x4c7c, (q15_t)0xc13b, (q15_t)0x4af1, (q15_t)0xc0f1, (q15_t)0x4964, (q15_t)0xc0b1, (q15_t)0x47d6, (q15_t)0xc07b,
+	(q15_t)0x4646, (q15_t)0xc04f, (q15_t)0x44b5, (q15_t)0xc02c, (q15_t)0x4324, (q15_t)0xc014, (q15_t)0x4192, (q15_t)0xc005,
+};
+#endif
+
+#if FFT_LINKED_SIZES & FFT_SIZE_512
+const q15_t ALIGN4 bee_fft_coef_a_512[512] = {
+	(q15_t)0x4000, (q15_t)0xc000, (q15_t)0x3f37, (q15_t)0xc001, (q15_t)0x3e6e, (q15_t)0xc005, (q15_t)0x3da5, (q15_t)0xc00b,
+	(q15_t)0x3cdc, (q15_t)0xc014, (q15_t)0x3c13, (q15_t)0xc01f, (q15_t)0x3b4b, (q15_t)0xc02c, (q15_t)0x3a82, (q15_t)0xc03c,
+	(q15_t)0x39ba, (q15_t)0xc04f, (q15_t)0x38f2, (q15_t)0xc064, (q15_t)0x382a, (q15_t)0xc07b, (q15_t)0x3763, (q15_t)0xc095,
+	(q15_t)0x369c, (q15_t)0xc0b1, (q15_t)0x35d5, (q15_t)0xc0d0, (q15_t)0x350f, (q15_t)0xc0f1, (q15_t)0x3449, (q15_t)0xc115,
+	(q15_t)0x3384, (q15_t)0xc13b, (q15_t)0x32bf, (q15_t)0xc163, (q15_t)0x31fa, (q15_t)0xc18e, (q15_t)0x3136, (q15_t)0xc1bb,
+	(q15_t)0x3073, (q15_t)0xc1eb, (q15_t)0x2fb0, (q15_t)0xc21d, (q15_t)0x2eee, (q15_t)0xc251, (q15_t)0x2e2d, (q15_t)0xc288,
+	(q15_t)0x2d6c, (q15_t)0xc2c1, (q15_t)0x2cac, (q15_t)0xc2fd, (q15_t)0x2bed, (q15_t)0xc33b, (q15_t)0x2b2e, (q15_t)0xc37b,
+	(q15_t)0x2a70, (q15_t)0xc3be, (q15_t)0x29b4, (q15_t)0xc403, (q15_t)0x28f7, (q15_t)0xc44a, (q15_t)0x283c, (q15_t)0xc493,
+	(q15_t)0x2782, (q15_t)0xc4df, (q15_t)0x26c9, (q15_t)0xc52d, (q15_t)0x2611, (q15_t)0xc57e, (q15_t)0x2559, (q15_t)0xc5d0,
+	(q15_t)0x24a3, (q15_t)0xc625, (q15_t)0x23ee, (q15_t)0xc67c, (q15_t)0x233a, (q15_t)0xc6d5, (q15_t)0x2287, (q15_t)0xc731,
+	(q15_t)0x21d5, (q15_t)0xc78f, (q15_t)0x2124, (q15_t)0xc7ee, (q15_t)0x2074, (q15_t)0xc850, (q15_t)0x1fc6, (q15_t)0xc8b5,
+	(q15_t)0x1f19, (q15_t)0xc91b, (q15_t)0x1e6d, (q15_t)0xc983, (q15_t)0x1dc3, (q15_t)0xc9ee, (q15_t)0x1d19, (q15_t)0xca5b,
+	(q15_t)0x1c72, (q15_t)0xcac9, (q15_t)0x1bcb, (q15_t)0xcb3a, (q15_t)0x1b26, (q15_t)0xcbad, (q15_t)0x1a82, (q15_t)0xcc21,
+	(q15_t)0x19e0, (q15_t)0xcc98, (q15_t)0x193f, (q15_t)0xcd11, (q15_t)0x18a0, (q15_t)0xcd8c, (q15_t)0x1802, (q15_t)0xce08,
+	(q15_t)0x1766, (q15_t)0xce87, (q15_t)0x16cb, (q15_t)0xcf07, (q15_t)0x1632, (q15_t)0xcf8a, (q15_t)0x159b, (q15_t)0xd00e,
+	(q15_t)0x1505, (q15_t)0xd094, (q15_t)0x1471, (q15_t)0xd11c, (q15_t)0x13df, (q15_t)0xd1a6, (q15_t)0x134e, (q15_t)0xd231,
+	(q15_t)0x12bf, (q15_t)0xd2bf, (q15_t)0x1231, (q15_t)0xd34e, (q15_t)0x11a6, (q15_t)0xd3df, (q15_t)0x111c, (q15_t)0xd471,
+	(q15_t)0x1094, (q15_t)0xd505, (q15_t)0x100e, (q15_t)0xd59b, (q15_t)0x0f8a, (q15_t)0xd632, (q15_t)0x0f07, (q15_t)0xd6cb,
+	(q15_t)0x0e87, (q15_t)0xd766, (q15_t)0x0e08, (q15_t)0xd802, (q15_t)0x0d8c, (q15_t)0xd8a0, (q15_t)0x0d11, (q15_t)0xd93f,
+	(q15_t)0x0c98, (q15_t)0xd9e0, (q15_t)0x0c21, (q15_t)0xda82, (q15_t)0x0bad, (q15_t)0xdb26, (q15_t)0x0b3a, (q15_t)0xdbcb,
+	(q15_t)0x0ac9, (q15_t)0xdc72, (q15_t)0x0a5b, (q15_t)0xdd19, (q15_t)0x09ee, (q15_t)0xddc3, (q15_t)0x0983, (q15_t)0xde6d,
+	(q15_t)0x091b, (q15_t)0xdf19, (q15_t)0x08b5, (q15_t)0xdfc6, (q15_t)0x0850, (q15_t)0xe074, (q15_t)0x07ee, (q15_t)0xe124,
+	(q15_t)0x078f, (q15_t)0xe1d5, (q15_t)0x0731, (q15_t)0xe287, (q15_t)0x06d5, (q15_t)0xe33a, (q15_t)0x067c, (q15_t)0xe3ee,
+	(q15_t)0x0625, (q15_t)0xe4a3, (q15_t)0x05d0, (q15_t)0xe559, (q15_t)0x057e, (q15_t)0xe611, (q15_t)0x052d, (q15_t)0xe6c9,
+	(q15_t)0x04df, (q15_t)0xe782, (q15_t)0x0493, (q15_t)0xe83c, (q15_t)0x044a, (q15_t)0xe8f7, (q15_t)0x0403, (q15_t)0xe9b4,
+	(q15_t)0x03be, (q15_t)0xea70, (q15_t)0x037b, (q15_t)0xeb2e, (q15_t)0x033b, (q15_t)0xebed, (q15_t)0x02fd, (q15_t)0xecac,
+	(q15_t)0x02c1, (q15_t)0xed6c, (q15_t)0x0288, (q15_t)0xee2d, (q15_t)0x0251, (q15_t)0xeeee, (q15_t)0x021d, (q15_t)0xefb0,
+	(q15_t)0x01eb, (q15_t)0xf073, (q15_t)0x01bb, (q15_t)0xf136, (q15_t)0x018e, (q15_t)0xf1fa, (q15_t)0x0163, (q15_t)0xf2bf,
+	(q15_t)0x013b, (q15_t)0xf384, (q15_t)0x0115, (q15_t)0xf449, (q15_t)0x00f1, (q15_t)0xf50f, (q15_t)0x00d0, (q15_t)0xf5d5,
+	(q15_t)0x00b1, (q15_t)0xf69c, (q15_t)0x0095, (q15_t)0xf763, (q15_t)0x007b, (q15_t)0xf82a, (q15_t)0x0064, (q15_t)0xf8f2,
+	(q15_t)0x004f, (q15_t)0xf9ba, (q15_t)0x003c, (q15_t)0xfa82, (q15_t)0x002c, (q15_t)0xfb4b, (q15_t)0x001f, (q15_t)0xfc13,
+	(q15_t)0x0014, (q15_t)0xfcdc, (q15_t)0x000b, (q15_t)0xfda5, (q15_t)0x0005, (q15_t)0xfe6e, (q15_t)0x0001, (q15_t)0xff37,
+	(q15_t)0x0000, (q15_t)0x0000, (q15_t)0x0001, (q15_t)0x00c9, (q15_t)0x0005, (q15_t)0x0192, (q15_t)0x000b, (q15_t)0x025b,
+	(q15_t)0x0014, (q15_t)0x0324, (q15_t)0x001f, (q15_t)0x03ed, (q15_t)0x002c, (q15_t)0x04b5, (q15_t)0x003c, (q15_t)0x057e,
+	(q15_t)0x004f, (q15_t)0x0646, (q15_t)0x0064, (q15_t)0x070e, (q15_t)0x007b, (q15_t)0x07d6, (q15_t)0x0095, (q15_t)0x089d,
+	(q15_t)0x00b1, (q15_t)0x0964, (q15_t)0x00d0, (q15_t)0x0a2b, (q15_t)0x00f1, (q15_t)0x0af1, (q15_t)0x0115, (q15_t)0x0bb7,
+	(q15_t)0x013b, (q15_t)0x0c7c, (q15_t)0x0163, (q15_t)0x0d41, (q15_t)0x018e, (q15_t)0x0e06, (q15_t)0x01bb, (q15_t)0x0eca,
+	(q15_t)0x01eb, (q15_t)0x0f8d, (q15_t)0x021d, (q15_t)0x1050, (q15_t)0x0251, (q15_t)0x1112, (q15_t)0x0288, (q15_t)0x11d3,
+	(q15_t)0x02c1, (q15_t)0x1294, (q15_t)0x02fd, (q15_t)0x1354, (q15_t)0x033b, (q15_t)0x1413, (q15_t)0x037b, (q15_t)0x14d2,
+	(q15_t)0x03be, (q15_t)0x1590, (q15_t)0x0403, (q15_t)0x164c, (q15_t)0x044a, (q15_t)0x1709, (q15_t)0x0493, (q15_t)0x17c4,
+	(q15_t)0x04df, (q15_t)0x187e, (q15_t)0x052d, (q15_t)0x1937, (q15_t)0x057e, (q15_t)0x19ef, (q15_t)0x05d0, (q15_t)0x1aa7,
+	(q15_t)0x0625, (q15_t)0x1b5d, (q15_t)0x067c, (q15_t)0x1c12, (q15_t)0x06d5, (q15_t)0x1cc6, (q15_t)0x0731, (q15_t)0x1d79,
+	(q15_t)0x078f, (q15_t)0x1e2b, (q15_t)0x07ee, (q15_t)0x1edc, (q15_t)0x0850, (q15_t)0x1f8c, (q15_t)0x08b5, (q15_t)0x203a,
+	(q15_t)0x091b, (q15_t)0x20e7, (q15_t)0x0983, (q15_t)0x2193, (q15_t)0x09ee, (q15_t)0x223d, (q15_t)0x0a5b, (q15_t)0x22e7,
+	(q15_t)0x0ac9, (q15_t)0x238e, (q15_t)0x0b3a, (q15_t)0x2435, (q15_t)0x0bad, (q15_t)0x24da, (q15_t)0x0c21, (q15_t)0x257e,
+	(q15_t)0x0c98, (q15_t)0x2620, (q15_t)0x0d11, (q15_t)0x26c1, (q15_t)0x0d8c, (q15_t)0x2760, (q15_t)0x0e08, (q15_t)0x27fe,
+	(q15_t)0x0e87, (q15_t)0x289a, (q15_t)0x0f07, (q15_t)0x2935, (q15_t)0x0f8a, (q15_t)0x29ce, (q15_t)0x100e, (q15_t)0x2a65,
+	(q15_t)0x1094, (q15_t)0x2afb, (q15_t)0x111c, (q15_t)0x2b8f, (q15_t)0x11a6, (q15_t)0x2c21, (q15_t)0x1231, (q15_t)0x2cb2,
+	(q15_t)0x12bf, (q15_t)0x2d41, (q15_t)0x134e, (q15_t)0x2dcf, (q15_t)0x13df, (q15_t)0x2e5a, (q15_t)0x1471, (q15_t)0x2ee4,
+	(q15_t)0x1505, (q15_t)0x2f6c, (q15_t)0x159b, (q15_t)0x2ff2, (q15_t)0x1632, (q15_t)0x3076, (q15_t)0x16cb, (q15_t)0x30f9,
+	(q15_t)0x1766, (q15_t)0x3179, (q15_t)0x1802, (q15_t)0x31f8, (q15_t)0x18a0, (q15_t)0x3274, (q15_t)0x193f, (q15_t)0x32ef,
+	(q15_t)0x19e0, (q15_t)0x3368, (q15_t)0x1a82, (q15_t)0x33df, (q15_t)0x1b26, (q15_t)0x3453, (q15_t)0x1bcb, (q15_t)0x34c6,
+	(q15_t)0x1c72, (q15_t)0x3537, (q15_t)0x1d19, (q15_t)0x35a5, (q15_t)0x1dc3, (q15_t)0x3612, (q15_t)0x1e6d, (q15_t)0x367d,
+	(q15_t)0x1f19, (q15_t)0x36e5, (q15_t)0x1fc6, (q15_t)0x374b, (q15_t)0x2074, (q15_t)0x37b0, (q15_t)0x2124, (q15_t)0x3812,
+	(q15_t)0x21d5, (q15_t)0x3871, (q15_t)0x2287, (q15_t)0x38cf, (q15_t)0x233a, (q15_t)0x392b, (q15_t)0x23ee, (q15_t)0x3984,
+	(q15_t)0x24a3, (q15_t)0x39db, (q15_t)0x2559, (q15_t)0x3a30, (q15_t)0x2611, (q15_t)0x3a82, (q15_t)0x26c9, (q15_t)0x3ad3,
+	(q15_t)0x2782, (q15_t)0x3b21, (q15_t)0x283c, (q15_t)0x3b6d, (q15_t)0x28f7, (q15_t)0x3bb6, (q15_t)0x29b4, (q15_t)0x3bfd,
+	(q15_t)0x2a70, (q15_t)0x3c42, (q15_t)0x2b2e, (q15_t)0x3c85, (q15_t)0x2bed, (q15_t)0x3cc5, (q15_t)0x2cac, (q15_t)0x3d03,
+	(q15_t)0x2d6c, (q15_t)0x3d3f, (q15_t)0x2e2d, (q15_t)0x3d78, (q15_t)0x2eee, (q15_t)0x3daf, (q15_t)0x2fb0, (q15_t)0x3de3,
+	(q15_t)0x3073, (q15_t)0x3e15, (q15_t)0x3136, (q15_t)0x3e45, (q15_t)0x31fa, (q15_t)0x3e72, (q15_t)0x32bf, (q15_t)0x3e9d,
+	(q15_t)0x3384, (q15_t)0x3ec5, (q15_t)0x3449, (q15_t)0x3eeb, (q15_t)0x350f, (q15_t)0x3f0f, (q15_t)0x35d5, (q15_t)0x3f30,
+	(q15_t)0x369c, (q15_t)0x3f4f, (q15_t)0x3763, (q15_t)0x3f6b, (q15_t)0x382a, (q15_t)0x3f85, (q15_t)0x38f2, (q15_t)0x3f9c,
+	(q15_t)0x39ba, (q15_t)0x3fb1, (q15_t)0x3a82, (q15_t)0x3fc4, (q15_t)0x3b4b, (q15_t)0x3fd4, (q15_t)0x3c13, (q15_t)0x3fe1,
+	(q15_t)0x3cdc, (q15_t)0x3fec, (q15_t)0x3da5, (q15_t)0x3ff5, (q15_t)0x3e6e, (q15_t)0x3ffb, (q15_t)0x3f37, (q15_t)0x3fff,
+};
+const q15_t ALIGN4 bee_fft_coef_b_512[512] = {
+	(q15_t)0x4000, (q15_t)0x4000, (q15_t)0x40c9, (q15_t)0x3fff, (q15_t)0x4192, (q15_t)0x3ffb, (q15_t)0x425b, (q15_t)0x3ff5,
+	(q15_t)0x4324, (q15_t)0x3fec, (q15_t)0x43ed, (q15_t)0x3fe1, (q15_t)0x44b5, (q15_t)0x3fd4, (q15_t)0x457e, (q15_t)0x3fc4,
+	(q15_t)0x4646, (q15_t)0x3fb1, (q15_t)0x470e, (q15_t)0x3f9c, (q15_t)0x47d6, (q15_t)0x3f85, (q15_t)0x489d, (q15_t)0x3f6b,
+	(q15_t)0x4964, (q15_t)0x3f4f, (q15_t)0x4a2b, (q15_t)0x3f30, (q15_t)0x4af1, (q15_t)0x3f0f, (q15_t)0x4bb7, (q15_t)0x3eeb,
+	(q15_t)0x4c7c, (q15_t)0x3ec5, (q15_t)0x4d41, (q15_t)0x3e9d, (q15_t)0x4e06, (q15_t)0x3e72, (q15_t)0x4eca, (q15_t)0x3e45,
+	(q15_t)0x4f8d, (q15_t)0x3e15, (q15_t)0x5050, (q15_t)0x3de3, (q15_t)0x5112, (q15_t)0x3daf, (q15_t)0x51d3, (q15_t)0x3d78,
+	(q15_t)0x5294, (q15_t)0x3d3f, (q15_t)0x5354, (q15_t)0x3d03, (q15_t)0x5413, (q15_t)0x3cc5, (q15_t)0x54d2, (q15_t)0x3c85,
+	(q15_t)0x5590, (q15_t)0x3c42, (q15_t)0x564c, (q15_t)0x3bfd, (q15_t)0x5709, (q15_t)0x3bb6, (q15_t)0x57c4, (q15_t)0x3b6d,
+	(q15_t)0x587e, (q15_t)0x3b21, (q15_t)0x5937, (q15_t)0x3ad3, (q15_t)0x59ef, (q15_t)0x3a82, (q15_t)0x5aa7, (q15_t)0x3a30,
+	(q15_t)0x5b5d, (q15_t)0x39db, (q15_t)0x5c12, (q15_t)0x3984, (q15_t)0x5cc6, (q15_t)0x392b, (q15_t)0x5d79, (q15_t)0x38cf,
+	(q15_t)0x5e2b, (q15_t)0x3871, (q15_t)0x5edc, (q15_t)0x3812, (q15_t)0x5f8c, (q15_t)0x37b0, (q15_t)0x603a, (q15_t)0x374b,
+	(q15_t)0x60e7, (q15_t)0x36e5, (q15_t)0x6193, (q15_t)0x367d, (q15_t)0x623d, (q15_t)0x3612, (q15_t)0x62e7, (q15_t)0x35a5,
+	(q15_t)0x638e, (q15_t)0x3537, (q15_t)0x6435, (q15_t)0x34c6, (q15_t)0x64da, (q15_t)0x3453, (q15_t)0x657e, (q15_t)0x33df,
+	(q15_t)0x6620, (q15_t)0x3368, (q15_t)0x66c1, (q15_t)0x32ef, (q15_t)0x6760, (q15_t)0x3274, (q15_t)0x67fe, (q15_t)0x31f8,
+	(q15_t)0x689a, (q15_t)0x3179, (q15_t)0x6935, (q15_t)0x30f9, (q15_t)0x69ce, (q15_t)0x3076, (q15_t)0x6a65, (q15_t)0x2ff2,
+	(q15_t)0x6afb, (q15_t)0x2f6c, (q15_t)0x6b8f, (q15_t)0x2ee4, (q15_t)0x6c21, (q15_t)0x2e5a, (q15_t)0x6cb2, (q15_t)0x2dcf,
+	(q15_t)0x6d41, (q15_t)0x2d41, (q15_t)0x6dcf, (q15_t)0x2cb2, (q15_t)0x6e5a, (q15_t)0x2c21, (q15_t)0x6ee4, (q15_t)0x2b8f,
+	(q15_t)0x6f6c, (q15_t)0x2afb, (q15_t)0x6ff2, (q15_t)0x2a65, (q15_t)0x7076, (q15_t)0x29ce, (q15_t)0x70f9, (q15_t)0x2935,
+	(q15_t)0x7179, (q15_t)0x289a, (q15_t)0x71f8, (q15_t)0x27fe, (q15_t)0x7274, (q15_t)0x2760, (q15_t)0x72ef, (q15_t)0x26c1,
+	(q15_t)0x7368, (q15_t)0x2620, (q15_t)0x73df, (q15_t)0x257e, (q15_t)0x7453, (q15_t)0x24da, (q15_t)0x74c6, (q15_t)0x2435,
+	(q15_t)0x7537, (q15_t)0x238e, (q15_t)0x75a5, (q15_t)0x22e7, (q15_t)0x7612, (q15_t)0x223d, (q15_t)0x767d, (q15_t)0x2193,
+	(q15_t)0x76e5, (q15_t)0x20e7, (q15_t)0x774b, (q15_t)0x203a, (q15_t)0x77b0, (q15_t)0x1f8c, (q15_t)0x7812, (q15_t)0x1edc,
+	(q15_t)0x7871, (q15_t)0x1e2b, (q15_t)0x78cf, (q15_t)0x1d79, (q15_t)0x792b, (q15_t)0x1cc6, (q15_t)0x7984, (q15_t)0x1c12,
+	(q15_t)0x79db, (q15_t)0x1b5d, (q15_t)0x7a30, (q15_t)0x1aa7, (q15_t)0x7a82, (q15_t)0x19ef, (q15_t)0x7ad3, (q15_t)0x1937,
+	(q15_t)0x7b21, (q15_t)0x187e, (q15_t)0x7b6d, (q15_t)0x17c4, (q15_t)0x7bb6, (q15_t)0x1709, (q15_t)0x7bfd, (q15_t)0x164c,
+	(q15_t)0x7c42, (q15_t)0x1590, (q15_t)0x7c85, (q15_t)0x14d2, (q15_t)0x7cc5, (q15_t)0x1413, (q15_t)0x7d03, (q15_t)0x1354,
+	(q15_t)0x7d3f, (q15_t)0x1294, (q15_t)0x7d78, (q15_t)0x11d3, (q15_t)0x7daf, (q15_t)0x1112, (q15_t)0x7de3, (q15_t)0x1050,
+	(q15_t)0x7e15, (q15_t)0x0f8d, (q15_t)0x7e45, (q15_t)0x0eca, (q15_t)0x7e72, (q15_t)0x0e06, (q15_t)0x7e9d, (q15_t)0x0d41,
+	(q15_t)0x7ec5, (q15_t)0x0c7c, (q15_t)0x7eeb, (q15_t)0x0bb7, (q15_t)0x7f0f, (q15_t)0x0af1, (q15_t)0x7f30, (q15_t)0x0a2b,
+	(q15_t)0x7f4f, (q15_t)0x0964, (q15_t)0x7f6b, (q15_t)0x089d, (q15_t)0x7f85, (q15_t)0x07d6, (q15_t)0x7f9c, (q15_t)0x070e,
+	(q15_t)0x7fb1, (q15_t)0x0646, (q15_t)0x7fc4, (q15_t)0x057e, (q15_t)0x7fd4, (q15_t)0x04b5, (q15_t)0x7fe1, (q15_t)0x03ed,
+	(q15_t)0x7fec, (q15_t)0x0324, (q15_t)0x7ff5, (q15_t)0x025b, (q15_t)0x7ffb, (q15_t)0x0192, (q15_t)0x7fff, (q15_t)0x00c9,
+	(q15_t)0x7fff, (q15_t)0x0000, (q15_t)0x7fff, (q15_t)0xff37, (q15_t)0x7ffb, (q15_t)0xfe6e, (q15_t)0x7ff5, (q15_t)0xfda5,
+	(q15_t)0x7fec, (q15_t)0xfcdc, (q15_t)0x7fe1, (q15_t)0xfc13, (q15_t)0x7fd4, (q15_t)0xfb4b, (q15_t)0x7fc4, (q15_t)0xfa82,
+	(q15_t)0x7fb1, (q15_t)0xf9ba, (q15_t)0x7f9c, (q15_t)0xf8f2, (q15_t)0x7f85, (q15_t)0xf82a, (q15_t)0x7f6b, (q15_t)0xf763,
+	(q15_t)0x7f4f, (q15_t)0xf69c, (q15_t)0x7f30, (q15_t)0xf5d5, (q15_t)0x7f0f, (q15_t)0xf50f, (q15_t)0x7eeb, (q15_t)0xf449,
+	(q15_t)0x7ec5, (q15_t)0xf384, (q15_t)0x7e9d, (q15_t)0xf2bf, (q15_t)0x7e72, (q15_t)0xf1fa, (q15_t)0x7e45, (q15_t)0xf136,
+	(q15_t)0x7e15, (q15_t)0xf073, (q15_t)0x7de3, (q15_t)0xefb0, (q15_t)0x7daf, (q15_t)0xeeee, (q15_t)0x7d78, (q15_t)0xee2d,
+	(q15_t)0x7d3f, (q15_t)0xed6c, (q15_t)0x7d03, (q15_t)0xecac, (q15_t)0x7cc5, (q15_t)0xebed, (q15_t)0x7c85, (q15_t)0xeb2e,
+	(q15_t)0x7c42, (q15_t)0xea70, (q15_t)0x7bfd, (q15_t)0xe9b4, (q15_t)0x7bb6, (q15_t)0xe8f7, (q15_t)0x7b6d, (q15_t)0xe83c,
+	(q15_t)0x7b21, (q15_t)0xe782, (q15_t)0x7ad3, (q15_t)0xe6c9, (q15_t)0x7a82, (q15_t)0xe611, (q15_t)0x7a30, (q15_t)0xe559,
+	(q15_t)0x79db, (q15_t)0xe4a3, (q15_t)0x7984, (q15_t)0xe3ee, (q15_t)0x792b, (q15_t)0xe33a, (q15_t)0x78cf, (q15_t)0xe287,
+	(q15_t)0x7871, (q15_t)0xe1d5, (q15_t)0x7812, (q15_t)0xe124, (q15_t)0x77b0, (q15_t)0xe074, (q15_t)0x774b, (q15_t)0xdfc6,
+	(q15_t)0x76e5, (q15_t)0xdf19, (q15_t)0x767d, (q15_t)0xde6d, (q15_t)0x7612, (q15_t)0xddc3, (q15_t)0x75a5, (q15_t)0xdd19,
+	(q15_t)0x7537, (q15_t)0xdc72, (q15_t)0x74c6, (q15_t)0xdbcb, (q15_t)0x7453, (q15_t)0xdb26, (q15_t)0x73df, (q15_t)0xda82,
+	(q15_t)0x7368, (q15_t)0xd9e0, (q15_t)0x72ef, (q15_t)0xd93f, (q15_t)0x7274, (q15_t)0xd8a0, (q15_t)0x71f8, (q15_t)0xd802,
+	(q15_t)0x7179, (q15_t)0xd766, (q15_t)0x70f9, (q15_t)0xd6cb, (q15_t)0x7076, (q15_t)0xd632, (q15_t)0x6ff2, (q15_t)0xd59b,
+	(q15_t)0x6f6c, (q15_t)0xd505, (q15_t)0x6ee4, (q15_t)0xd471, (q15_t)0x6e5a, (q15_t)0xd3df, (q15_t)0x6dcf, (q15_t)0xd34e,
+	(q15_t)0x6d41, (q15_t)0xd2bf, (q15_t)0x6cb2, (q15_t)0xd231, (q15_t)0x6c21, (q15_t)0xd1a6, (q15_t)0x6b8f, (q15_t)0xd11c,
+	(q15_t)0x6afb, (q15_t)0xd094, (q15_t)0x6a65, (q15_t)0xd00e, (q15_t)0x69ce, (q15_t)0xcf8a, (q15_t)0x6935, (q15_t)0xcf07,
+	(q15_t)0x689a, (q15_t)0xce87, (q15_t)0x67fe, (q15_t)0xce08, (q15_t)0x6760, (q15_t)0xcd8c, (q15_t)0x66c1, (q15_t)0xcd11,
+	(q15_t)0x6620, (q15_t)0xcc98, (q15_t)0x657e, (q15_t)0xcc21, (q15_t)0x64da, (q15_t)0xcbad, (q15_t)0x6435, (q15_t)0xcb3a,
+	(q15_t)0x638e, (q15_t)0xcac9, (q15_t)0x62e7, (q15_t)0xca5b, (q15_t)0x623d, (q15_t)0xc9ee, (q15_t)0x6193, (q15_t)0xc983,
+	(q15_t)0x60e7, (q15_t)0xc91b, (q15_t)0x603a, (q15_t)0xc8b5, (q15_t)0x5f8c, (q15_t)0xc850, (q15_t)0x5edc, (q15_t)0xc7ee,
+	(q15_t)0x5e2b, (q15_t)0xc78f, (q15_t)0x5d79, (q15_t)0xc731, (q15_t)0x5cc6, (q15_t)0xc6d5, (q15_t)0x5c12, (q15_t)0xc67c,
+	(q15_t)0x5b5d, (q15_t)0xc625, (q15_t)0x5aa7, (q15_t)0xc5d0, (q15_t)0x59ef, (q15_t)0xc57e, (q15_t)0x5937, (q15_t)0xc52d,
+	(q15_t)0x587e, (q15_t)0xc4df, (q15_t)0x57c4, (q15_t)0xc493, (q15_t)0x5709, (q15_t)0xc44a, (q15_t)0x564c, (q15_t)0xc403,
+	(q15_t)0x5590, (q15_t)0xc3be, (q15_t)0x54d2, (q15_t)0xc37b, (q15_t)0x5413, (q15_t)0xc33b, (q15_t)0x5354, (q15_t)0xc2fd,
+	(q15_t)0x5294, (q15_t)0xc2c1, (q15_t)0x51d3, (q15_t)0xc288, (q15_t)0x5112, (q15_t)0xc251, (q15_t)0x5050, (q15_t)0xc21d,
+	(q15_t)0x4f8d, (q15_t)0xc1eb, (q15_t)0x4eca, (q15_t)0xc1bb, (q15_t)0x4e06, (q15_t)0xc18e, (q15_t)0x4d41, (q15_t)0xc163,
+	(q15_t)0x4c7c, (q15_t)0xc13b, (q15_t)0x4bb7, (q15_t)0xc115, (q15_t)0x4af1, (q15_t)0xc0f1, (q15_t)0x4a2b, (q15_t)0xc0d0,
+	(q15_t)0x4964, (q15_t)0xc0b1, (q15_t)0x489d, (q15_t)0xc095, (q15_t)0x47d6, (q15_t)0xc07b, (q15_t)0x470e, (q15_t)0xc064,
+	(q15_t)0x4646, (q15_t)0xc04f, (q15_t)0x457e, (q15_t)0xc03c, (q15_t)0x44b5, (q15_t)0xc02c, (q15_t)0x43ed, (q15_t)0xc01f,
+	(q15_t)0x4324, (q15_t)0xc014, (q15_t)0x425b, (q15_t)0xc00b, (q15_t)0x4192, (q15_t)0xc005, (q15_t)0x40c9, (q15_t)0xc001,
+};
+#endif
+
+#if FFT_LINKED_SIZES & FFT_SIZE_1024
+const q15_t ALIGN4 bee_fft_coef_a_1024[1024] = {
+	(q15_t)0x4000, (q15_t)0xc000, (q15_t)0x3f9b, (q15_t)0xc000, (q15_t)0x3f37, (q15_t)0xc001, (q15_t)0x3ed2, (q15_t)0xc003,
+	(q15_t)0x3e6e, (q15_t)0xc005, (q15_t)0x3e09, (q15_t)0xc008, (q15_t)0x3da5, (q15_t)0xc00b, (q15_t)0x3d40, (q15_t)0xc00f,
+	(q15_t)0x3cdc, (q15_t)0xc014, (q15_t)0x3c78, (q15_t)0xc019, (q15_t)0x3c13, (q15_t)0xc01f, (q15_t)0x3baf, (q15_t)0xc025,
+	(q15_t)0x3b4b, (q15_t)0xc02c, (q15_t)0x3ae6, (q15_t)0xc034, (q15_t)0x3a82, (q15_t)0xc03c, (q15_t)0x3a1e, (q15_t)0xc045,
+	(q15_t)0x39ba, (q15_t)0xc04f, (q15_t)0x3956, (q15_t)0xc059, (q15_t)0x38f2, (q15_t)0xc064, (q15_t)0x388e, (q15_t)0xc06f,
+	(q15_t)0x382a, (q15_t)0xc07b, (q15_t)0x37c7, (q15_t)0xc088, (q15_t)0x3763, (q15_t)0xc095, (q15_t)0x36ff, (q15_t)0xc0a3,
+	(q15_t)0x369c, (q15_t)0xc0b1, (q15_t)0x3639, (q15_t)0xc0c0, (q15_t)0x35d5, (q15_t)0xc0d0, (q15_t)0x3572, (q15_t)0xc0e0,
+	(q15_t)0x350f, (q15_t)0xc0f1, (q15_t)0x34ac, (q15_t)0xc103, (q15_t)0x3449, (q15_t)0xc115, (q15_t)0x33e6, (q15_t)0xc128,
+	(q15_t)0x3384, (q15_t)0xc13b, (q15_t)0x3321, (q15_t)0xc14f, (q15_t)0x32bf, (q15_t)0xc163, (q15_t)0x325c, (q15_t)0xc178,
+	(q15_t)0x31fa, (q15_t)0xc18e, (q15_t)0x3198, (q15_t)0xc1a4, (q15_t)0x3136, (q15_t)0xc1bb, (q15_t)0x30d5, (q15_t)0xc1d3,
+	(q15_t)0x3073, (q15_t)0xc1eb, (q15_t)0x3012, (q15_t)0xc204, (q15_t)0x2fb0, (q15_t)0xc21d, (q15_t)0x2f4f, (q15_t)0xc237,
+	(q15_t)0x2eee, (q15_t)0xc251, (q15_t)0x2e8d, (q15_t)0xc26d, (q15_t)0x2e2d, (q15_t)0xc288, (q15_t)0x2dcc, (q15_t)0xc2a5,
+	(q15_t)0x2d6c, (q15_t)0xc2c1, (q15_t)0x2d0c, (q15_t)0xc2df, (q15_t)0x2cac, (q15_t)0xc2fd, (q15_t)0x2c4c, (q15_t)0xc31c,
+	(q15_t)0x2bed, (q15_t)0xc33b, (q15_t)0x2b8d, (q15_t)0xc35b, (q15_t)0x2b2e, (q15_t)0xc37b, (q15_t)0x2acf, (q15_t)0xc39c,
+	(q15_t)0x2a70, (q15_t)0xc3be, (q15_t)0x2a12, (q15_t)0xc3e0, (q15_t)0x29b4, (q15_t)0xc403, (q15_t)0x2955, (q15_t)0xc426,
+	(q15_t)0x28f7, (q15_t)0xc44a, (q15_t)0x289a, (q15_t)0xc46e, (q15_t)0x283c, (q15_t)0xc493, (q15_t)0x27df, (q15_t)0xc4b9,
+	(q15_t)0x2782, (q15_t)0xc4df, (q15_t)0x2725, (q15_t)0xc506, (q15_t)0x26c9, (q15_t)0xc52d, (q15_t)0x266d, (q15_t)0xc555,
+	(q15_t)0x2611, (q15_t)0xc57e, (q15_t)0x25b5, (q15_t)0xc5a7, (q15_t)0x2559, (q15_t)0xc5d0, (q15_t)0x24fe, (q15_t)0xc5fa,
+	(q15_t)0x24a3, (q15_t)0xc625, (q15_t)0x2448, (q15_t)0xc650, (q15_t)0x23ee, (q15_t)0xc67c, (q15_t)0x2394, (q15_t)0xc6a8,
+	(q15_t)0x233a, (q15_t)0xc6d5, (q15_t)0x22e0, (q15_t)0xc703, (q15_t)0x2287, (q15_t)0xc731, (q15_t)0x222d, (q15_t)0xc75f,
+	(q15_t)0x21d5, (q15_t)0xc78f, (q15_t)0x217c, (q15_t)0xc7be, (q15_t)0x2124, (q15_t)0xc7ee, (q15_t)0x20cc, (q15_t)0xc81f,
+	(q15_t)0x2074, (q15_t)0xc850, (q15_t)0x201d, (q15_t)0xc882, (q15_t)0x1fc6, (q15_t)0xc8b5, (q15_t)0x1f6f, (q15_t)0xc8e8,
+	(q15_t)0x1f19, (q15_t)0xc91b, (q15_t)0x1ec3, (q15_t)0xc94f, (q15_t)0x1e6d, (q15_t)0xc983, (q15_t)0x1e18, (q15_t)0xc9b8,
+	(q15_t)0x1dc3, (q15_t)0xc9ee, (q15_t)0x1d6e, (q15_t)0xca24, (q15_t)0x1d19, (q15_t)0xca5b, (q15_t)0x1cc5, (q15_t)0xca92,
+	(q15_t)0x1c72, (q15_t)0xcac9, (q15_t)0x1c1e, (q15_t)0xcb01, (q15_t)0x1bcb, (q15_t)0xcb3a, (q15_t)0x1b78, (q15_t)0xcb73,
+	(q15_t)0x1b26, (q15_t)0xcbad, (q15_t)0x1ad4, (q15_t)0xcbe7, (q15_t)0x1a82, (q15_t)0xcc21, (q15_t)0x1a31, (q15_t)0xcc5d,
+	(q15_t)0x19e0, (q15_t)0xcc98, (q15_t)0x198f, (q15_t)0xccd4, (q15_t)0x193f, (q15_t)0xcd11, (q15_t)0x18ef, (q15_t)0xcd4e,
+	(q15_t)0x18a0, (q15_t)0xcd8c, (q15_t)0x1851, (q15_t)0xcdca, (q15_t)0x1802, (q15_t)0xce08, (q15_t)0x17b4, (q15_t)0xce47,
+	(q15_t)0x1766, (q15_t)0xce87, (q15_t)0x1719, (q15_t)0xcec7, (q15_t)0x16cb, (q15_t)0xcf07, (q15_t)0x167f, (q15_t)0xcf48,
+	(q15_t)0x1632, (q15_t)0xcf8a, (q15_t)0x15e6, (q15_t)0xcfcc, (q15_t)0x159b, (q15_t)0xd00e, (q15_t)0x1550, (q15_t)0xd051,
+	(q15_t)0x1505, (q15_t)0xd094, (q15_t)0x14bb, (q15_t)0xd0d8, (q15_t)0x1471, (q15_t)0xd11c, (q15_t)0x1428, (q15_t)0xd161,
+	(q15_t)0x13df, (q15_t)0xd1a6, (q15_t)0x1396, (q15_t)0xd1eb, (q15_t)0x134e, (q15_t)0xd231, (q15_t)0x1306, (q15_t)0xd278,
+	(q15_t)0x12bf, (q15_t)0xd2bf, (q15_t)0x1278, (q15_t)0xd306, (q15_t)0x1231, (q15_t)0xd34e, (q15_t)0x11eb, (q15_t)0xd396,
+	(q15_t)0x11a6, (q15_t)0xd3df, (q15_t)0x1161, (q15_t)0xd428, (q15_t)0x111c, (q15_t)0xd471, (q15_t)0x10d8, (q15_t)0xd4bb,
+	(q15_t)0x1094, (q15_t)0xd505, (q15_t)0x1051, (q15_t)0xd550, (q15_t)0x100e, (q15_t)0xd59b, (q15_t)0x0fcc, (q15_t)0xd5e6,
+	(q15_t)0x0f8a, (q15_t)0xd632, (q15_t)0x0f48, (q15_t)0xd67f, (q15_t)0x0f07, (q15_t)0xd6cb, (q15_t)0x0ec7, (q15_t)0xd719,
+	(q15_t)0x0e87, (q15_t)0xd766, (q15_t)0x0e47, (q15_t)0xd7b4, (q15_t)0x0e08, (q15_t)0xd802, (q15_t)0x0dca, (q15_t)0xd851,
+	(q15_t)0x0d8c, (q15_t)0xd8a0, (q15_t)0x0d4e, (q15_t)0xd8ef, (q15_t)0x0d11, (q15_t)0xd93f, (q15_t)0x0cd4, (q15_t)0xd98f,
+	(q15_t)0x0c98, (q15_t)0xd9e0, (q15_t)0x0c5d, (q15_t)0xda31, (q15_t)0x0c21, (q15_t)0xda82, (q15_t)0x0be7, (q15_t)0xdad4,
+	(q15_t)0x0bad, (q15_t)0xdb26, (q15_t)0x0b73, (q15_t)0xdb78, (q15_t)0x0b3a, (q15_t)0xdbcb, (q15_t)0x0b01, (q15_t)0xdc1e,
+	(q15_t)0x0ac9, (q15_t)0xdc72, (q15_t)0x0a92, (q15_t)0xdcc5, (q15_t)0x0a5b, (q15_t)0xdd19, (q15_t)0x0a24, (q15_t)0xdd6e,
+	(q15_t)0x09ee, (q15_t)0xddc3, (q15_t)0x09b8, (q15_t)0xde18, (q15_t)0x0983, (q15_t)0xde6d, (q15_t)0x094f, (q15_t)0xdec3,
+	(q15_t)0x091b, (q15_t)0xdf19, (q15_t)0x08e8, (q15_t)0xdf6f, (q15_t)0x08b5, (q15_t)0xdfc6, (q15_t)0x0882, (q15_t)0xe01d,
+	(q15_t)0x0850, (q15_t)0xe074, (q15_t)0x081f, (q15_t)0xe0cc, (q15_t)0x07ee, (q15_t)0xe124, (q15_t)0x07be, (q15_t)0xe17c,
+	(q15_t)0x078f, (q15_t)0xe1d5, (q15_t)0x075f, (q15_t)0xe22d, (q15_t)0x0731, (q15_t)0xe287, (q15_t)0x0703, (q15_t)0xe2e0,
+	(q15_t)0x06d5, (q15_t)0xe33a, (q15_t)0x06a8, (q15_t)0xe394, (q15_t)0x067c, (q15_t)0xe3ee, (q15_t)0x0650, (q15_t)0xe448,
+	(q15_t)0x0625, (q15_t)0xe4a3, (q15_t)0x05fa, (q15_t)0xe4fe, (q15_t)0x05d0, (q15_t)0xe559, (q15_t)0x05a7, (q15_t)0xe5b5,
+	(q15_t)0x057e, (q15_t)0xe611, (q15_t)0x0555, (q15_t)0xe66d, (q15_t)0x052d, (q15_t)0xe6c9, (q15_t)0x0506, (q15_t)0xe725,
+	(q15_t)0x04df, (q15_t)0xe782, (q15_t)0x04b9, (q15_t)0xe7df, (q15_t)0x0493, (q15_t)0xe83c, (q15_t)0x046e, (q15_t)0xe89a,
+	(q15_t)0x044a, (q15_t)0xe8f7, (q15_t)0x0426, (q15_t)0xe955, (q15_t)0x0403, (q15_t)0xe9b4, (q15_t)0x03e0, (q15_t)0xea12,
+	(q15_t)0x03be, (q15_t)0xea70, (q15_t)0x039c, (q15_t)0xeacf, (q15_t)0x037b, (q15_t)0xeb2e, (q15_t)0x035b, (q15_t)0xeb8d,
+	(q15_t)0x033b, (q15_t)0xebed, (q15_t)0x031c, (q15_t)0xec4c, (q15_t)0x02fd, (q15_t)0xecac, (q15_t)0x02df, (q15_t)0xed0c,
+	(q15_t)0x02c1, (q15_t)0xed6c, (q15_t)0x02a5, (q15_t)0xedcc, (q15_t)0x0288, (q15_t)0xee2d, (q15_t)0x026d, (q15_t)0xee8d,
+	(q15_t)0x0251, (q15_t)0xeeee, (q15_t)0x0237, (q15_t)0xef4f, (q15_t)0x021d, (q15_t)0xefb0, (q15_t)0x0204, (q15_t)0xf012,
+	(q15_t)0x01eb, (q15_t)0xf073, (q15_t)0x01d3, (q15_t)0xf0d5, (q15_t)0x01bb, (q15_t)0xf136, (q15_t)0x01a4, (q15_t)0xf198,
+	(q15_t)0x018e, (q15_t)0xf1fa, (q15_t)0x0178, (q15_t)0xf25c, (q15_t)0x0163, (q15_t)0xf2bf, (q15_t)0x014f, (q15_t)0xf321,
+	(q15_t)0x013b, (q15_t)0xf384, (q15_t)0x0128, (q15_t)0xf3e6, (q15_t)0x0115, (q15_t)0xf449, (q15_t)0x0103, (q15_t)0xf4ac,
+	(q15_t)0x00f1, (q15_t)0xf50f, (q15_t)0x00e0, (q15_t)0xf572, (q15_t)0x00d0, (q15_t)0xf5d5, (q15_t)0x00c0, (q15_t)0xf639,
+	(q15_t)0x00b1, (q15_t)0xf69c, (q15_t)0x00a3, (q15_t)0xf6ff, (q15_t)0x0095, (q15_t)0xf763, (q15_t)0x0088, (q15_t)0xf7c7,
+	(q15_t)0x007b, (q15_t)0xf82a, (q15_t)0x006f, (q15_t)0xf88e, (q15_t)0x0064, (q15_t)0xf8f2, (q15_t)0x0059, (q15_t)0xf956,
+	(q15_t)0x004f, (q15_t)0xf9ba, (q15_t)0x0045, (q15_t)0xfa1e, (q15_t)0x003c, (q15_t)0xfa82, (q15_t)0x0034, (q15_t)0xfae6,
+	(q15_t)0x002c, (q15_t)0xfb4b, (q15_t)0x0025, (q15_t)0xfbaf, (q15_t)0x001f, (q15_t)0xfc13, (q15_t)0x0019, (q15_t)0xfc78,
+	(q15_t)0x0014, (q15_t)0xfcdc, (q15_t)0x000f, (q15_t)0xfd40, (q15_t)0x000b, (q15_t)0xfda5, (q15_t)0x0008, (q15_t)0xfe09,
+	(q15_t)0x0005, (q15_t)0xfe6e, (q15_t)0x0003, (q15_t)0xfed2, (q15_t)0x0001, (q15_t)0xff37, (q15_t)0x0000, (q15_t)0xff9b,
+	(q15_t)0x0000, (q15_t)0x0000, (q15_t)0x0000, (q15_t)0x0065, (q15_t)0x0001, (q15_t)0x00c9, (q15_t)0x0003, (q15_t)0x012e,
+	(q15_t)0x0005, (q15_t)0x0192, (q15_t)0x0008, (q15_t)0x01f7, (q15_t)0x000b, (q15_t)0x025b, (q15_t)0x000f, (q15_t)0x02c0,
+	(q15_t)0x0014, (q15_t)0x0324, (q15_t)0x0019, (q15_t)0x0388, (q15_t)0x001f, (q15_t)0x03ed, (q15_t)0x0025, (q15_t)0x0451,
+	(q15_t)0x002c, (q15_t)0x04b5, (q15_t)0x0034, (q15_t)0x051a, (q15_t)0x003c, (q15_t)0x057e, (q15_t)0x0045, (q15_t)0x05e2,
+	(q15_t)0x004f, (q15_t)0x0646, (q15_t)0x0059, (q15_t)0x06aa, (q15_t)0x0064, (q15_t)0x070e, (q15_t)0x006f, (q15_t)0x0772,
+	(q15_t)0x007b, (q15_t)0x07d6, (q15_t)0x0088, (q15_t)0x0839, (q15_t)0x0095, (q15_t)0x089d, (q15_t)0x00a3, (q15_t)0x0901,
+	(q15_t)0x00b1, (q15_t)0x0964, (q15_t)0x00c0, (q15_t)0x09c7, (q15_t)0x00d0, (q15_t)0x0a2b, (q15_t)0x00e0, (q15_t)0x0a8e,
+	(q15_t)0x00f1, (q15_t)0x0af1, (q15_t)0x0103, (q15_t)0x0b54, (q15_t)0x0115, (q15_t)0x0bb7, (q15_t)0x0128, (q15_t)0x0c1a,
+	(q15_t)0x013b, (q15_t)0x0c7c, (q15_t)0x014f, (q15_t)0x0cdf, (q15_t)0x0163, (q15_t)0x0d41, (q15_t)0x0178, (q15_t)0x0da4,
+	(q15_t)0x018e, (q15_t)0x0e06, (q15_t)0x01a4, (q15_t)0x0e68, (q15_t)0x01bb, (q15_t)0x0eca, (q15_t)0x01d3, (q15_t)0x0f2b,
+	(q15_t)0x01eb, (q15_t)0x0f8d, (q15_t)0x0204, (q15_t)0x0fee, (q15_t)0x021d, (q15_t)0x1050, (q15_t)0x0237, (q15_t)0x10b1,
+	(q15_t)0x0251, (q15_t)0x1112, (q15_t)0x026d, (q15_t)0x1173, (q15_t)0x0288, (q15_t)0x11d3, (q15_t)0x02a5, (q15_t)0x1234,
+	(q15_t)0x02c1, (q15_t)0x1294, (q15_t)0x02df, (q15_t)0x12f4, (q15_t)0x02fd, (q15_t)0x1354, (q15_t)0x031c, (q15_t)0x13b4,
+	(q15_t)0x033b, (q15_t)0x1413, (q15_t)0x035b, (q15_t)0x1473, (q15_t)0x037b, (q15_t)0x14d2, (q15_t)0x039c, (q15_t)0x1531,
+	(q15_t)0x03be, (q15_t)0x1590, (q15_t)0x03e0, (q15_t)0x15ee, (q15_t)0x0403, (q15_t)0x164c, (q15_t)0x0426, (q15_t)0x16ab,
+	(q15_t)0x044a, (q15_t)0x1709, (q15_t)0x046e, (q15_t)0x1766, (q15_t)0x0493, (q15_t)0x17c4, (q15_t)0x04b9, (q15_t)0x1821,
+	(q15_t)0x04df, (q15_t)0x187e, (q15_t)0x0506, (q15_t)0x18db, (q15_t)0x052d, (q15_t)0x1937, (q15_t)0x0555, (q15_t)0x1993,
+	(q15_t)0x057e, (q15_t)0x19ef, (q15_t)0x05a7, (q15_t)0x1a4b, (q15_t)0x05d0, (q15_t)0x1aa7, (q15_t)0x05fa, (q15_t)0x1b02,
+	(q15_t)0x0625, (q15_t)0x1b5d, (q15_t)0x0650, (q15_t)0x1bb8, (q15_t)0x067c, (q15_t)0x1c12, (q15_t)0x06a8, (q15_t)0x1c6c,
+	(q15_t)0x06d5, (q15_t)0x1cc6, (q15_t)0x0703, (q15_t)0x1d20, (q15_t)0x0731, (q15_t)0x1d79, (q15_t)0x075f, (q15_t)0x1dd3,
+	(q15_t)0x078f, (q15_t)0x1e2b, (q15_t)0x07be, (q15_t)0x1e84, (q15_t)0x07ee, (q15_t)0x1edc, (q15_t)0x081f, (q15_t)0x1f34,
+	(q15_t)0x0850, (q15_t)0x1f8c, (q15_t)0x0882, (q15_t)0x1fe3, (q15_t)0x08b5, (q15_t)0x203a, (q15_t)0x08e8, (q15_t)0x2091,
+	(q15_t)0x091b, (q15_t)0x20e7, (q15_t)0x094f, (q15_t)0x213d, (q15_t)0x0983, (q15_t)0x2193, (q15_t)0x09b8, (q15_t)0x21e8,
+	(q15_t)0x09ee, (q15_t)0x223d, (q15_t)0x0a24, (q15_t)0x2292, (q15_t)0x0a5b, (q15_t)0x22e7, (q15_t)0x0a92, (q15_t)0x233b,
+	(q15_t)0x0ac9, (q15_t)0x238e, (q15_t)0x0b01, (q15_t)0x23e2, (q15_t)0x0b3a, (q15_t)0x2435, (q15_t)0x0b73, (q15_t)0x2488,
+	(q15_t)0x0bad, (q15_t)0x24da, (q15_t)0x0be7, (q15_t)0x252c, (q15_t)0x0c21, (q15_t)0x257e, (q15_t)0x0c5d, (q15_t)0x25cf,
+	(q15_t)0x0c98, (q15_t)0x2620, (q15_t)0x0cd4, (q15_t)0x2671, (q15_t)0x0d11, (q15_t)0x26c1, (q15_t)0x0d4e, (q15_t)0x2711,
+	(q15_t)0x0d8c, (q15_t)0x2760, (q15_t)0x0dca, (q15_t)0x27af, (q15_t)0x0e08, (q15_t)0x27fe, (q15_t)0x0e47, (q15_t)0x284c,
+	(q15_t)0x0e87, (q15_t)0x289a, (q15_t)0x0ec7, (q15_t)0x28e7, (q15_t)0x0f07, (q15_t)0x2935, (q15_t)0x0f48, (q15_t)0x2981,
+	(q15_t)0x0f8a, (q15_t)0x29ce, (q15_t)0x0fcc, (q15_t)0x2a1a, (q15_t)0x100e, (q15_t)0x2a65, (q15_t)0x1051, (q15_t)0x2ab0,
+	(q15_t)0x1094, (q15_t)0x2afb, (q15_t)0x10d8, (q15_t)0x2b45, (q15_t)0x111c, (q15_t)0x2b8f, (q15_t)0x1161, (q15_t)0x2bd8,
+	(q15_t)0x11a6, (q15_t)0x2c21, (q15_t)0x11eb, (q15_t)0x2c6a, (q15_t)0x1231, (q15_t)0x2cb2, (q15_t)0x1278, (q15_t)0x2cfa,
+	(q15_t)0x12bf, (q15_t)0x2d41, (q15_t)0x1306, (q15_t)0x2d88, (q15_t)0x134e, (q15_t)0x2dcf, (q15_t)0x1396, (q15_t)0x2e15,
+	(q15_t)0x13df, (q15_t)0x2e5a, (q15_t)0x1428, (q15_t)0x2e9f, (q15_t)0x1471, (q15_t)0x2ee4, (q15_t)0x14bb, (q15_t)0x2f28,
+	(q15_t)0x1505, (q15_t)0x2f6c, (q15_t)0x1550, (q15_t)0x2faf, (q15_t)0x159b, (q15_t)0x2ff2, (q15_t)0x15e6, (q15_t)0x3034,
+	(q15_t)0x1632, (q15_t)0x3076, (q15_t)0x167f, (q15_t)0x30b8, (q15_t)0x16cb, (q15_t)0x30f9, (q15_t)0x1719, (q15_t)0x3139,
+	(q15_t)0x1766, (q15_t)0x3179, (q15_t)0x17b4, (q15_t)0x31b9, (q15_t)0x1802, (q15_t)0x31f8, (q15_t)0x1851, (q15_t)0x3236,
+	(q15_t)0x18a0, (q15_t)0x3274, (q15_t)0x18ef, (q15_t)0x32b2, (q15_t)0x193f, (q15_t)0x32ef, (q15_t)0x198f, (q15_t)0x332c,
+	(q15_t)0x19e0, (q15_t)0x3368, (q15_t)0x1a31, (q15_t)0x33a3, (q15_t)0x1a82, (q15_t)0x33df, (q15_t)0x1ad4, (q15_t)0x3419,
+	(q15_t)0x1b26, (q15_t)0x3453, (q15_t)0x1b78, (q15_t)0x348d, (q15_t)0x1bcb, (q15_t)0x34c6, (q15_t)0x1c1e, (q15_t)0x34ff,
+	(q15_t)0x1c72, (q15_t)0x3537, (q15_t)0x1cc5, (q15_t)0x356e, (q15_t)0x1d19, (q15_t)0x35a5, (q15_t)0x1d6e, (q15_t)0x35dc,
+	(q15_t)0x1dc3, (q15_t)0x3612, (q15_t)0x1e18, (q15_t)0x3648, (q15_t)0x1e6d, (q15_t)0x367d, (q15_t)0x1ec3, (q15_t)0x36b1,
+	(q15_t)0x1f19, (q15_t)0x36e5, (q15_t)0x1f6f, (q15_t)0x3718, (q15_t)0x1fc6, (q15_t)0x374b, (q15_t)0x201d, (q15_t)0x377e,
+	(q15_t)0x2074, (q15_t)0x37b0, (q15_t)0x20cc, (q15_t)0x37e1, (q15_t)0x2124, (q15_t)0x3812, (q15_t)0x217c, (q15_t)0x3842,
+	(q15_t)0x21d5, (q15_t)0x3871, (q15_t)0x222d, (q15_t)0x38a1, (q15_t)0x2287, (q15_t)0x38cf, (q15_t)0x22e0, (q15_t)0x38fd,
+	(q15_t)0x233a, (q15_t)0x392b, (q15_t)0x2394, (q15_t)0x3958, (q15_t)0x23ee, (q15_t)0x3984, (q15_t)0x2448, (q15_t)0x39b0,
+	(q15_t)0x24a3, (q15_t)0x39db, (q15_t)0x24fe, (q15_t)0x3a06, (q15_t)0x2559, (q15_t)0x3a30, (q15_t)0x25b5, (q15_t)0x3a59,
+	(q15_t)0x2611, (q15_t)0x3a82, (q15_t)0x266d, (q15_t)0x3aab, (q15_t)0x26c9, (q15_t)0x3ad3, (q15_t)0x2725, (q15_t)0x3afa,
+	(q15_t)0x2782, (q15_t)0x3b21, (q15_t)0x27df, (q15_t)0x3b47, (q15_t)0x283c, (q15_t)0x3b6d, (q15_t)0x289a, (q15_t)0x3b92,
+	(q15_t)0x28f7, (q15_t)0x3bb6, (q15_t)0x2955, (q15_t)0x3bda, (q15_t)0x29b4, (q15_t)0x3bfd, (q15_t)0x2a12, (q15_t)0x3c20,
+	(q15_t)0x2a70, (q15_t)0x3c42, (q15_t)0x2acf, (q15_t)0x3c64, (q15_t)0x2b2e, (q15_t)0x3c85, (q15_t)0x2b8d, (q15_t)0x3ca5,
+	(q15_t)0x2bed, (q15_t)0x3cc5, (q15_t)0x2c4c, (q15_t)0x3ce4, (q15_t)0x2cac, (q15_t)0x3d03, (q15_t)0x2d0c, (q15_t)0x3d21,
+	(q15_t)0x2d6c, (q15_t)0x3d3f, (q15_t)0x2dcc, (q15_t)0x3d5b, (q15_t)0x2e2d, (q15_t)0x3d78, (q15_t)0x2e8d, (q15_t)0x3d93,
+	(q15_t)0x2eee, (q15_t)0x3daf, (q15_t)0x2f4f, (q15_t)0x3dc9, (q15_t)0x2fb0, (q15_t)0x3de3, (q15_t)0x3012, (q15_t)0x3dfc,
+	(q15_t)0x3073, (q15_t)0x3e15, (q15_t)0x30d5, (q15_t)0x3e2d, (q15_t)0x3136, (q15_t)0x3e45, (q15_t)0x3198, (q15_t)0x3e5c,
+	(q15_t)0x31fa, (q15_t)0x3e72, (q15_t)0x325c, (q15_t)0x3e88, (q15_t)0x32bf, (q15_t)0x3e9d, (q15_t)0x3321, (q15_t)0x3eb1,
+	(q15_t)0x3384, (q15_t)0x3ec5, (q15_t)0x33e6, (q15_t)0x3ed8, (q15_t)0x3449, (q15_t)0x3eeb, (q15_t)0x34ac, (q15_t)0x3efd,
+	(q15_t)0x350f, (q15_t)0x3f0f, (q15_t)0x3572, (q15_t)0x3f20, (q15_t)0x35d5, (q15_t)0x3f30, (q15_t)0x3639, (q15_t)0x3f40,
+	(q15_t)0x369c, (q15_t)0x3f4f, (q15_t)0x36ff, (q15_t)0x3f5d, (q15_t)0x3763, (q15_t)0x3f6b, (q15_t)0x37c7, (q15_t)0x3f78,
+	(q15_t)0x382a, (q15_t)0x3f85, (q15_t)0x388e, (q15_t)0x3f91, (q15_t)0x38f2, (q15_t)0x3f9c, (q15_t)0x3956, (q15_t)0x3fa7,
+	(q15_t)0x39ba, (q15_t)0x3fb1, (q15_t)0x3a1e, (q15_t)0x3fbb, (q15_t)0x3a82, (q15_t)0x3fc4, (q15_t)0x3ae6, (q15_t)0x3fcc,
+	(q15_t)0x3b4b, (q15_t)0x3fd4, (q15_t)0x3baf, (q15_t)0x3fdb, (q15_t)0x3c13, (q15_t)0x3fe1, (q15_t)0x3c78, (q15_t)0x3fe7,
+	(q15_t)0x3cdc, (q15_t)0x3fec, (q15_t)0x3d40, (q15_t)0x3ff1, (q15_t)0x3da5, (q15_t)0x3ff5, (q15_t)0x3e09, (q15_t)0x3ff8,
+	(q15_t)0x3e6e, (q15_t)0x3ffb, (q15_t)0x3ed2, (q15_t)0x3ffd, (q15_t)0x3f37, (q15_t)0x3fff, (q15_t)0x3f9b, (q15_t)0x4000,
+};
+const q15_t ALIGN4 bee_fft_coef_b_1024[1024] = {
+	(q15_t)0x4000, (q15_t)0x4000, (q15_t)0x4065, (q15_t)0x4000, (q15_t)0x40c9, (q15_t)0x3fff, (q15_t)0x412e, (q15_t)0x3ffd,
+	(q15_t)0x4192, (q15_t)0x3ffb, (q15_t)0x41f7, (q15_t)0x3ff8, (q15_t)0x425b, (q15_t)0x3ff5, (q15_t)0x42c0, (q15_t)0x3ff1,
+	(q15_t)0x4324, (q15_t)0x3fec, (q15_t)0x4388, (q15_t)0x3fe7, (q15_t)0x43ed, (q15_t)0x3fe1, (q15_t)0x4451, (q15_t)0x3fdb,
+	(q15_t)0x44b5, (q15_t)0x3fd4, (q15_t)0x451a, (q15_t)0x3fcc, (q15_t)0x457e, (q15_t)0x3fc4, (q15_t)0x45e2, (q15_t)0x3fbb,
+	(q15_t)0x4646, (q15_t)0x3fb1, (q15_t)0x46aa, (q15_t)0x3fa7, (q15_t)0x470e, (q15_t)0x3f9c, (q15_t)0x4772, (q15_t)0x3f91,
+	(q15_t)0x47d6, (q15_t)0x3f85, (q15_t)0x4839, (q15_t)0x3f78, (q15_t)0x489d, (q15_t)0x3f6b, (q15_t)0x4901, (q15_t)0x3f5d,
+	(q15_t)0x4964, (q15_t)0x3f4f, (q15_t)0x49c7, (q15_t)0x3f40, (q15_t)0x4a2b, (q15_t)0x3f30, (q15_t)0x4a8e, (q15_t)0x3f20,
+	(q15_t)0x4af1, (q15_t)0x3f0f, (q15_t)0x4b54, (q15_t)0x3efd, (q15_t)0x4bb7, (q15_t)0x3eeb, (q15_t)0x4c1a, (q15_t)0x3ed8,
+	(q15_t)0x4c7c, (q15_t)0x3ec5, (q15_t)0x4cdf, (q15_t)0x3eb1, (q15_t)0x4d41, (q15_t)0x3e9d, (q15_t)0x4da4, (q15_t)0x3e88,
+	(q15_t)0x4e06, (q15_t)0x3e72, (q15_t)0x4e68, (q15_t)0x3e5c, (q15_t)0x4eca, (q15_t)0x3e45, (q15_t)0x4f2b, (q15_t)0x3e2d,
+	(q15_t)0x4f8d, (q15_t)0x3e15, (q15_t)0x4fee, (q15_t)0x3dfc, (q15_t)0x5050, (q15_t)0x3de3, (q15_t)0x50b1, (q15_t)0x3dc9,
+	(q15_t)0x5112, (q15_t)0x3daf, (q15_t)0x5173, (q15_t)0x3d93, (q15_t)0x51d3, (q15_t)0x3d78, (q15_t)0x5234, (q15_t)0x3d5b,
+	(q15_t)0x5294, (q15_t)0x3d3f, (q15_t)0x52f4, (q15_t)0x3d21, (q15_t)0x5354, (q15_t)0x3d03, (q15_t)0x53b4, (q15_t)0x3ce4,
+	(q15_t)0x5413, (q15_t)0x3cc5, (q15_t)0x5473, (q15_t)0x3ca5, (q15_t)0x54d2, (q15_t)0x3c85, (q15_t)0x5531, (q15_t)0x3c64,
+	(q15_t)0x5590, (q15_t)0x3c42, (q15_t)0x55ee, (q15_t)0x3c20, (q15_t)0x564c, (q15_t)0x3bfd, (q15_t)0x56ab, (q15_t)0x3bda,
+	(q15_t)0x5709, (q15_t)0x3bb6, (q15_t)0x5766, (q15_t)0x3b92, (q15_t)0x57c4, (q15_t)0x3b6d, (q15_t)0x5821, (q15_t)0x3b47,
+	(q15_t)0x587e, (q15_t)0x3b21, (q15_t)0x58db, (q15_t)0x3afa, (q15_t)0x5937, (q15_t)0x3ad3, (q15_t)0x5993, (q15_t)0x3aab,
+	(q15_t)0x59ef, (q15_t)0x3a82, (q15_t)0x5a4b, (q15_t)0x3a59, (q15_t)0x5aa7, (q15_t)0x3a30, (q15_t)0x5b02, (q15_t)0x3a06,
+	(q15_t)0x5b5d, (q15_t)0x39db, (q15_t)0x5bb8, (q15_t)0x39b0, (q15_t)0x5c12, (q15_t)0x3984, (q15_t)0x5c6c, (q15_t)0x3958,
+	(q15_t)0x5cc6, (q15_t)0x392b, (q15_t)0x5d20, (q15_t)0x38fd, (q15_t)0x5d79, (q15_t)0x38cf, (q15_t)0x5dd3, (q15_t)0x38a1,
+	(q15_t)0x5e2b, (q15_t)0x3871, (q15_t)0x5e84, (q15_t)0x3842, (q15_t)0x5edc, (q15_t)0x3812, (q15_t)0x5f34, (q15_t)0x37e1,
+	(q15_t)0x5f8c, (q15_t)0x37b0, (q15_t)0x5fe3, (q15_t)0x377e, (q15_t)0x603a, (q15_t)0x374b, (q15_t)0x6091, (q15_t)0x3718,
+	(q15_t)0x60e7, (q15_t)0x36e5, (q15_t)0x613d, (q15_t)0x36b1, (q15_t)0x6193, (q15_t)0x367d, (q15_t)0x61e8, (q15_t)0x3648,
+	(q15_t)0x623d, (q15_t)0x3612, (q15_t)0x6292, (q15_t)0x35dc, (q15_t)0x62e7, (q15_t)0x35a5, (q15_t)0x633b, (q15_t)0x356e,
+	(q15_t)0x638e, (q15_t)0x3537, (q15_t)0x63e2, (q15_t)0x34ff, (q15_t)0x6435, (q15_t)0x34c6, (q15_t)0x6488, (q15_t)0x348d,
+	(q15_t)0x64da, (q15_t)0x3453, (q15_t)0x652c, (q15_t)0x3419, (q15_t)0x657e, (q15_t)0x33df, (q15_t)0x65cf, (q15_t)0x33a3,
+	(q15_t)0x6620, (q15_t)0x3368, (q15_t)0x6671, (q15_t)0x332c, (q15_t)0x66c1, (q15_t)0x32ef, (q15_t)0x6711, (q15_t)0x32b2,
+	(q15_t)0x6760, (q15_t)0x3274, (q15_t)0x67af, (q15_t)0x3236, (q15_t)0x67fe, (q15_t)0x31f8, (q15_t)0x684c, (q15_t)0x31b9,
+	(q15_t)0x689a, (q15_t)0x3179, (q15_t)0x68e7, (q15_t)0x3139, (q15_t)0x6935, (q15_t)0x30f9, (q15_t)0x6981, (q15_t)0x30b8,
+	(q15_t)0x69ce, (q15_t)0x3076, (q15_t)0x6a1a, (q15_t)0x3034, (q15_t)0x6a65, (q15_t)0x2ff2, (q15_t)0x6ab0, (q15_t)0x2faf,
+	(q15_t)0x6afb, (q15_t)0x2f6c, (q15_t)0x6b45, (q15_t)0x2f28, (q15_t)0x6b8f, (q15_t)0x2ee4, (q15_t)0x6bd8, (q15_t)0x2e9f,
+	(q15_t)0x6c21, (q15_t)0x2e5a, (q15_t)0x6c6a, (q15_t)0x2e15, (q15_t)0x6cb2, (q15_t)0x2dcf, (q15_t)0x6cfa, (q15_t)0x2d88,
+	(q15_t)0x6d41, (q15_t)0x2d41, (q15_t)0x6d88, (q15_t)0x2cfa, (q15_t)0x6dcf, (q15_t)0x2cb2, (q15_t)0x6e15, (q15_t)0x2c6a,
+	(q15_t)0x6e5a, (q15_t)0x2c21, (q15_t)0x6e9f, (q15_t)0x2bd8, (q15_t)0x6ee4, (q15_t)0x2b8f, (q15_t)0x6f28, (q15_t)0x2b45,
+	(q15_t)0x6f6c, (q15_t)0x2afb, (q15_t)0x6faf, (q15_t)0x2ab0, (q15_t)0x6ff2, (q15_t)0x2a65, (q15_t)0x7034, (q15_t)0x2a1a,
+	(q15_t)0x7076, (q15_t)0x29ce, (q15_t)0x70b8, (q15_t)0x2981, (q15_t)0x70f9, (q15_t)0x2935, (q15_t)0x7139, (q15_t)0x28e7,
+	(q15_t)0x7179, (q15_t)0x289a, (q15_t)0x71b9, (q15_t)0x284c, (q15_t)0x71f8, (q15_t)0x27fe, (q15_t)0x7236, (q15_t)0x27af,
+	(q15_t)0x7274, (q15_t)0x2760, (q15_t)0x72b2, (q15_t)0x2711, (q15_t)0x72ef, (q15_t)0x26c1, (q15_t)0x732c, (q15_t)0x2671,
+	(q15_t)0x7368, (q15_t)0x2620, (q15_t)0x73a3, (q15_t)0x25cf, (q15_t)0x73df, (q15_t)0x257e, (q15_t)0x7419, (q15_t)0x252c,
+	(q15_t)0x7453, (q15_t)0x24da, (q15_t)0x748d, (q15_t)0x2488, (q15_t)0x74c6, (q15_t)0x2435, (q15_t)0x74ff, (q15_t)0x23e2,
+	(q15_t)0x7537, (q15_t)0x238e, (q15_t)0x756e, (q15_t)0x233b, (q15_t)0x75a5, (q15_t)0x22e7, (q15_t)0x75dc, (q15_t)0x2292,
+	(q15_t)0x7612, (q15_t)0x223d, (q15_t)0x7648, (q15_t)0x21e8, (q15_t)0x767d, (q15_t)0x2193, (q15_t)0x76b1, (q15_t)0x213d,
+	(q15_t)0x76e5, (q15_t)0x20e7, (q15_t)0x7718, (q15_t)0x2091, (q15_t)0x774b, (q15_t)0x203a, (q15_t)0x777e, (q15_t)0x1fe3,
+	(q15_t)0x77b0, (q15_t)0x1f8c, (q15_t)0x77e1, (q15_t)0x1f34, (q15_t)0x7812, (q15_t)0x1edc, (q15_t)0x7842, (q15_t)0x1e84,
+	(q15_t)0x7871, (q15_t)0x1e2b, (q15_t)0x78a1, (q15_t)0x1dd3, (q15_t)0x78cf, (q15_t)0x1d79, (q15_t)0x78fd, (q15_t)0x1d20,
+	(q15_t)0x792b, (q15_t)0x1cc6, (q15_t)0x7958, (q15_t)0x1c6c, (q15_t)0x7984, (q15_t)0x1c12, (q15_t)0x79b0, (q15_t)0x1bb8,
+	(q15_t)0x79db, (q15_t)0x1b5d, (q15_t)0x7a06, (q15_t)0x1b02, (q15_t)0x7a30, (q15_t)0x1aa7, (q15_t)0x7a59, (q15_t)0x1a4b,
+	(q15_t)0x7a82, (q15_t)0x19ef, (q15_t)0x7aab, (q15_t)0x1993, (q15_t)0x7ad3, (q15_t)0x1937, (q15_t)0x7afa, (q15_t)0x18db,
+	(q15_t)0x7b21, (q15_t)0x187e, (q15_t)0x7b47, (q15_t)0x1821, (q15_t)0x7b6d, (q15_t)0x17c4, (q15_t)0x7b92, (q15_t)0x1766,
+	(q15_t)0x7bb6, (q15_t)0x1709, (q15_t)0x7bda, (q15_t)0x16ab, (q15_t)0x7bfd, (q15_t)0x164c, (q15_t)0x7c20, (q15_t)0x15ee,
+	(q15_t)0x7c42, (q15_t)0x1590, (q15_t)0x7c64, (q15_t)0x1531, (q15_t)0x7c85, (q15_t)0x14d2, (q15_t)0x7ca5, (q15_t)0x1473,
+	(q15_t)0x7cc5, (q15_t)0x1413, (q15_t)0x7ce4, (q15_t)0x13b4, (q15_t)0x7d03, (q15_t)0x1354, (q15_t)0x7d21, (q15_t)0x12f4,
+	(q15_t)0x7d3f, (q15_t)0x1294, (q15_t)0x7d5b, (q15_t)0x1234, (q15_t)0x7d78, (q15_t)0x11d3, (q15_t)0x7d93, (q15_t)0x1173,
+	(q15_t)0x7daf, (q15_t)0x1112, (q15_t)0x7dc9, (q15_t)0x10b1, (q15_t)0x7de3, (q15_t)0x1050, (q15_t)0x7dfc, (q15_t)0x0fee,
+	(q15_t)0x7e15, (q15_t)0x0f8d, (q15_t)0x7e2d, (q15_t)0x0f2b, (q15_t)0x7e45, (q15_t)0x0eca, (q15_t)0x7e5c, (q15_t)0x0e68,
+	(q15_t)0x7e72, (q15_t)0x0e06, (q15_t)0x7e88, (q15_t)0x0da4, (q15_t)0x7e9d, (q15_t)0x0d41, (q15_t)0x7eb1, (q15_t)0x0cdf,
+	(q15_t)0x7ec5, (q15_t)0x0c7c, (q15_t)0x7ed8, (q15_t)0x0c1a, (q15_t)0x7eeb, (q15_t)0x0bb7, (q15_t)0x7efd, (q15_t)0x0b54,
+	(q15_t)0x7f0f, (q15_t)0x0af1, (q15_t)0x7f20, (q15_t)0x0a8e, (q15_t)0x7f30, (q15_t)0x0a2b, (q15_t)0x7f40, (q15_t)0x09c7,
+	(q15_t)0x7f4f, (q15_t)0x0964, (q15_t)0x7f5d, (q15_t)0x0901, (q15_t)0x7f6b, (q15_t)0x089d, (q15_t)0x7f78, (q15_t)0x0839,
+	(q15_t)0x7f85, (q15_t)0x07d6, (q15_t)0x7f91, (q15_t)0x0772, (q15_t)0x7f9c, (q15_t)0x070e, (q15_t)0x7fa7, (q15_t)0x06aa,
+	(q15_t)0x7fb1, (q15_t)0x0646, (q15_t)0x7fbb, (q15_t)0x05e2, (q15_t)0x7fc4, (q15_t)0x057e, (q15_t)0x7fcc, (q15_t)0x051a,
+	(q15_t)0x7fd4, (q15_t)0x04b5, (q15_t)0x7fdb, (q15_t)0x0451, (q15_t)0x7fe1, (q15_t)0x03ed, (q15_t)0x7fe7, (q15_t)0x0388,
+	(q15_t)0x7fec, (q15_t)0x0324, (q15_t)0x7ff1, (q15_t)0x02c0, (q15_t)0x7ff5, (q15_t)0x025b, (q15_t)0x7ff8, (q15_t)0x01f7,
+	(q15_t)0x7ffb, (q15_t)0x0192, (q15_t)0x7ffd, (q15_t)0x012e, (q15_t)0x7fff, (q15_t)0x00c9, (q15_t)0x7fff, (q15_t)0x0065,
+	(q15_t)0x7fff, (q15_t)0x0000, (q15_t)0x7fff, (q15_t)0xff9b, (q15_t)0x7fff, (q15_t)0xff37, (q15_t)0x7ffd, (q15_t)0xfed2,
+	(q15_t)0x7ffb, (q15_t)0xfe6e, (q15_t)0x7ff8, (q15_t)0xfe09, (q15_t)0x7ff5, (q15_t)0xfda5, (q15_t)0x7ff1, (q15_t)0xfd40,
+	(q15_t)0x7fec, (q15_t)0xfcdc, (q15_t)0x7fe7, (q15_t)0xfc78, (q15_t)0x7fe1, (q15_t)0xfc13, (q15_t)0x7fdb, (q15_t)0xfbaf,
+	(q15_t)0x7fd4, (q15_t)0xfb4b, (q15_t)0x7fcc, (q15_t)0xfae6, (q15_t)0x7fc4, (q15_t)0xfa82, (q15_t)0x7fbb, (q15_t)0xfa1e,
+	(q15_t)0x7fb1, (q15_t)0xf9ba, (q15_t)0x7fa7, (q15_t)0xf956, (q15_t)0x7f9c, (q15_t)0xf8f2, (q15_t)0x7f91, (q15_t)0xf88e,
+	(q15_t)0x7f85, (q15_t)0xf82a, (q15_t)0x7f78, (q15_t)0xf7c7, (q15_t)0x7f6b, (q15_t)0xf763, (q15_t)0x7f5d, (q15_t)0xf6ff,
+	(q15_t)0x7f4f, (q15_t)0xf69c, (q15_t)0x7f40, (q15_t)0xf639, (q15_t)0x7f30, (q15_t)0xf5d5, (q15_t)0x7f20, (q15_t)0xf572,
+	(q15_t)0x7f0f, (q15_t)0xf50f, (q15_t)0x7efd, (q15_t)0xf4ac, (q15_t)0x7eeb, (q15_t)0xf449, (q15_t)0x7ed8, (q15_t)0xf3e6,
+	(q15_t)0x7ec5, (q15_t)0xf384, (q15_t)0x7eb1, (q15_t)0xf321, (q15_t)0x7e9d, (q15_t)0xf2bf, (q15_t)0x7e88, (q15_t)0xf25c,
+	(q15_t)0x7e72, (q15_t)0xf1fa, (q15_t)0x7e5c, (q15_t)0xf198, (q15_t)0x7e45, (q15_t)0xf136, (q15_t)0x7e2d, (q15_t)0xf0d5,
+	(q15_t)0x7e15, (q15_t)0xf073, (q15_t)0x7dfc, (q15_t)0xf012, (q15_t)0x7de3, (q15_t)0xefb0, (q15_t)0x7dc9, (q15_t)0xef4f,
+	(q15_t)0x7daf, (q15_t)0xeeee, (q15_t)0x7d93, (q15_t)0xee8d, (q15_t)0x7d78, (q15_t)0xee2d, (q15_t)0x7d5b, (q15_t)0xedcc,
+	(q15_t)0x7d3f, (q15_t)0xed6c, (q15_t)0x7d21, (q15_t)0xed0c, (q15_t)0x7d03, (q15_t)0xecac, (q15_t)0x7ce4, (q15_t)0xec4c,
+	(q15_t)0x7cc5, (q15_t)0xebed, (q15_t)0x7ca5, (q15_t)0xeb8d, (q15_t)0x7c85, (q15_t)0xeb2e, (q15_t)0x7c64, (q15_t)0xeacf,
+	(q15_t)0x7c42, (q15_t)0xea70, (q15_t)0x7c20, (q15_t)0xea12, (q15_t)0x7bfd, (q15_t)0xe9b4, (q15_t)0x7bda, (q15_t)0xe955,
+	(q15_t)0x7bb6, (q15_t)0xe8f7, (q15_t)0x7b92, (q15_t)0xe89a, (q15_t)0x7b6d, (q15_t)0xe83c, (q15_t)0x7b47, (q15_t)0xe7df,
+	(q15_t)0x7b21, (q15_t)0xe782, (q15_t)0x7afa, (q15_t)0xe725, (q15_t)0x7ad3, (q15_t)0xe6c9, (q15_t)0x7aab, (q15_t)0xe66d,
+	(q15_t)0x7a82, (q15_t)0xe611, (q15_t)0x7a59, (q15_t)0xe5b5, (q15_t)0x7a30, (q15_t)0xe559, (q15_t)0x7a06, (q15_t)0xe4fe,
+	(q15_t)0x79db, (q15_t)0xe4a3, (q15_t)0x79b0, (q15_t)0xe448, (q15_t)0x7984, (q15_t)0xe3ee, (q15_t)0x7958, (q15_t)0xe394,
+	(q15_t)0x792b, (q15_t)0xe33a, (q15_t)0x78fd, (q15_t)0xe2e0, (q15_t)0x78cf, (q15_t)0xe287, (q15_t)0x78a1, (q15_t)0xe22d,
+	(q15_t)0x7871, (q15_t)0xe1d5, (q15_t)0x7842, (q15_t)0xe17c, (q15_t)0x7812, (q15_t)0xe124, (q15_t)0x77e1, (q15_t)0xe0cc,
+	(q15_t)0x77b0, (q15_t)0xe074, (q15_t)0x777e, (q15_t)0xe01d, (q15_t)0x774b, (q15_t)0xdfc6, (q15_t)0x7718, (q15_t)0xdf6f,
+	(q15_t)0x76e5, (q15_t)0xdf19, (q15_t)0x76b1, (q15_t)0xdec3, (q15_t)0x767d, (q15_t)0xde6d, (q15_t)0x7648, (q15_t)0xde18,
+	(q15_t)0x7612, (q15_t)0xddc3, (q15_t)0x75dc, (q15_t)0xdd6e, (q15_t)0x75a5, (q15_t)0xdd19, (q15_t)0x756e, (q15_t)0xdcc5,
+	(q15_t)0x7537, (q15_t)0xdc72, (q15_t)0x74ff, (q15_t)0xdc1e, (q15_t)0x74c6, (q15_t)0xdbcb, (q15_t)0x748d, (q15_t)0xdb78,
+	(q15_t)0x7453, (q15_t)0xdb26, (q15_t)0x7419, (q15_t)0xdad4, (q15_t)0x73df, (q15_t)0xda82, (q15_t)0x73a3, (q15_t)0xda31,
+	(q15_t)0x7368, (q15_t)0xd9e0, (q15_t)0x732c, (q15_t)0xd98f, (q15_t)0x72ef, (q15_t)0xd93f, (q15_t)0x72b2, (q15_t)0xd8ef,
+	(q15_t)0x7274, (q15_t)0xd8a0, (q15_t)0x7236, (q15_t)0xd851, (q15_t)0x71f8, (q15_t)0xd802, (q15_t)0x71b9, (q15_t)0xd7b4,
+	(q15_t)0x7179, (q15_t)0xd766, (q15_t)0x7139, (q15_t)0xd719, (q15_t)0x70f9, (q15_t)0xd6cb, (q15_t)0x70b8, (q15_t)0xd67f,
+	(q15_t)0x7076, (q15_t)0xd632, (q15_t)0x7034, (q15_t)0xd5e6, (q15_t)0x6ff2, (q15_t)0xd59b, (q15_t)0x6faf, (q15_t)0xd550,
+	(q15_t)0x6f6c, (q15_t)0xd505, (q15_t)0x6f28, (q15_t)0xd4bb, (q15_t)0x6ee4, (q15_t)0xd471, (q15_t)0x6e9f, (q15_t)0xd428,
+	(q15_t)0x6e5a, (q15_t)0xd3df, (q15_t)0x6e15, (q15_t)0xd396, (q15_t)0x6dcf, (q15_t)0xd34e, (q15_t)0x6d88, (q15_t)0xd306,
+	(q15_t)0x6d41, (q15_t)0xd2bf, (q15_t)0x6cfa, (q15_t)0xd278, (q15_t)0x6cb2, (q15_t)0xd231, (q15_t)0x6c6a, (q15_t)0xd1eb,
+	(q15_t)0x6c21, (q15_t)0xd1a6, (q15_t)0x6bd8, (q15_t)0xd161, (q15_t)0x6b8f, (q15_t)0xd11c, (q15_t)0x6b45, (q15_t)0xd0d8,
+	(q15_t)0x6afb, (q15_t)0xd094, (q15_t)0x6ab0, (q15_t)0xd051, (q15_t)0x6a65, (q15_t)0xd00e, (q15_t)0x6a1a, (q15_t)0xcfcc,
+	(q15_t)0x69ce, (q15_t)0xcf8a, (q15_t)0x6981, (q15_t)0xcf48, (q15_t)0x6935, (q15_t)0xcf07, (q15_t)0x68e7, (q15_t)0xcec7,
+	(q15_t)0x689a, (q15_t)0xce87, (q15_t)0x684c, (q15_t)0xce47, (q15_t)0x67fe, (q15_t)0xce08, (q15_t)0x67af, (q15_t)0xcdca,
+	(q15_t)0x6760, (q15_t)0xcd8c, (q15_t)0x6711, (q15_t)0xcd4e, (q15_t)0x66c1, (q15_t)0xcd11, (q15_t)0x6671, (q15_t)0xccd4,
+	(q15_t)0x6620, (q15_t)0xcc98, (q15_t)0x65cf, (q15_t)0xcc5d, (q15_t)0x657e, (q15_t)0xcc21, (q15_t)0x652c, (q15_t)0xcbe7,
+	(q15_t)0x64da, (q15_t)0xcbad, (q15_t)0x6488, (q15_t)0xcb73, (q15_t)0x6435, (q15_t)0xcb3a, (q15_t)0x63e2, (q15_t)0xcb01,
+	(q15_t)0x638e, (q15_t)0xcac9, (q15_t)0x633b, (q15_t)0xca92, (q15_t)0x62e7, (q15_t)0xca5b, (q15_t)0x6292, (q15_t)0xca24,
+	(q15_t)0x623d, (q15_t)0xc9ee, (q15_t)0x61e8, (q15_t)0xc9b8, (q15_t)0x6193, (q15_t)0xc983, (q15_t)0x613d, (q15_t)0xc94f,
+	(q15_t)0x60e7, (q15_t)0xc91b, (q15_t)0x6091, (q15_t)0xc8e8, (q15_t)0x603a, (q15_t)0xc8b5, (q15_t)0x5fe3, (q15_t)0xc882,
+	(q15_t)0x5f8c, (q15_t)0xc850, (q15_t)0x5f34, (q15_t)0xc81f, (q15_t)0x5edc, (q15_t)0xc7ee, (q15_t)0x5e84, (q15_t)0xc7be,
+	(q15_t)0x5e2b, (q15_t)0xc78f, (q15_t)0x5dd3, (q15_t)0xc75f, (q15_t)0x5d79, (q15_t)0xc731, (q15_t)0x5d20, (q15_t)0xc703,
+	(q15_t)0x5cc6, (q15_t)0xc6d5, (q15_t)0x5c6c, (q15_t)0xc6a8, (q15_t)0x5c12, (q15_t)0xc67c, (q15_t)0x5bb8, (q15_t)0xc650,
+	(q15_t)0x5b5d, (q15_t)0xc625, (q15_t)0x5b02, (q15_t)0xc5fa, (q15_t)0x5aa7, (q15_t)0xc5d0, (q15_t)0x5a4b, (q15_t)0xc5a7,
+	(q15_t)0x59ef, (q15_t)0xc57e, (q15_t)0x5993, (q15_t)0xc555, (q15_t)0x5937, (q15_t)0xc52d, (q15_t)0x58db, (q15_t)0xc506,
+	(q15_t)0x587e, (q15_t)0xc4df, (q15_t)0x5821, (q15_t)0xc4b9, (q15_t)0x57c4, (q15_t)0xc493, (q15_t)0x5766, (q15_t)0xc46e,
+	(q15_t)0x5709, (q15_t)0xc44a, (q15_t)0x56ab, (q15_t)0xc426, (q15_t)0x564c, (q15_t)0xc403, (q15_t)0x55ee, (q15_t)0xc3e0,
+	(q15_t)0x5590, (q15_t)0xc3be, (q15_t)0x5531, (q15_t)0xc39c, (q15_t)0x54d2, (q15_t)0xc37b, (q15_t)0x5473, (q15_t)0xc35b,
+	(q15_t)0x5413, (q15_t)0xc33b, (q15_t)0x53b4, (q15_t)0xc31c, (q15_t)0x5354, (q15_t)0xc2fd, (q15_t)0x52f4, (q15_t)0xc2df,
+	(q15_t)0x5294, (q15_t)0xc2c1, (q15_t)0x5234, (q15_t)0xc2a5, (q15_t)0x51d3, (q15_t)0xc288, (q15_t)0x5173, (q15_t)0xc26d,
+	(q15_t)0x5112, (q15_t)0xc251, (q15_t)0x50b1, (q15_t)0xc237, (q15_t)0x5050, (q15_t)0xc21d, (q15_t)0x4fee, (q15_t)0xc204,
+	(q15_t)0x4f8d, (q15_t)0xc1eb, (q15_t)0x4f2b, (q15_t)0xc1d3, (q15_t)0x4eca, (q15_t)0xc1bb, (q15_t)0x4e68, (q15_t)0xc1a4,
+	(q15_t)0x4e06, (q15_t)0xc18e, (q15_t)0x4da4, (q15_t)0xc178, (q15_t)0x4d41, (q15_t)0xc163, (q15_t)0x4cdf, (q15_t)0xc14f,
+	(q15_t)0x4c7c, (q15_t)0xc13b, (q15_t)0x4c1a, (q15_t)0xc128, (q15_t)0x4bb7, (q15_t)0xc115, (q15_t)0x4b54, (q15_t)0xc103,
+	(q15_t)0x4af1, (q15_t)0xc0f1, (q15_t)0x4a8e, (q15_t)0xc0e0, (q15_t)0x4a2b, (q15_t)0xc0d0, (q15_t)0x49c7, (q15_t)0xc0c0,
+	(q15_t)0x4964, (q15_t)0xc0b1, (q15_t)0x4901, (q15_t)0xc0a3, (q15_t)0x489d, (q15_t)0xc095, (q15_t)0x4839, (q15_t)0xc088,
+	(q15_t)0x47d6, (q15_t)0xc07b, (q15_t)0x4772, (q15_t)0xc06f, (q15_t)0x470e, (q15_t)0xc064, (q15_t)0x46aa, (q15_t)0xc059,
+	(q15_t)0x4646, (q15_t)0xc04f, (q15_t)0x45e2, (q15_t)0xc045, (q15_t)0x457e, (q15_t)0xc03c, (q15_t)0x451a, (q15_t)0xc034,
+	(q15_t)0x44b5, (q15_t)0xc02c, (q15_t)0x4451, (q15_t)0xc025, (q15_t)0x43ed, (q15_t)0xc01f, (q15_t)0x4388, (q15_t)0xc019,
+	(q15_t)0x4324, (q15_t)0xc014, (q15_t)0x42c0, (q15_t)0xc00f, (q15_t)0x425b, (q15_t)0xc00b, (q15_t)0x41f7, (q15_t)0xc008,
+	(q15_t)0x4192, (q15_t)0xc005, (q15_t)0x412e, (q15_t)0xc003, (q15_t)0x40c9, (q15_t)0xc001, (q15_t)0x4065, (q15_t)0xc000,
+};
+#endif
+
+#if FFT_LINKED_SIZES & FFT_SIZE_2048
+const q15_t ALIGN4 bee_fft_coef_a_2048[2048] = {
+	(q15_t)0x4000, (q15_t)0xc000, (q15_t)0x3fce, (q15_t)0xc000, (q15_t)0x3f9b, (q15_t)0xc000, (q15_t)0x3f69, (q15_t)0xc001,
+	(q15_t)0x3f37, (q15_t)0xc001, (q15_t)0x3f05, (q15_t)0xc002, (q15_t)0x3ed2, (q15_t)0xc003, (q15_t)0x3ea0, (q15_t)0xc004,
+	(q15_t)0x3e6e, (q15_t)0xc005, (q15_t)0x3e3c, (q15_t)0xc006, (q15_t)0x3e09, (q15_t)0xc008, (q15_t)0x3dd7, (q15_t)0xc009,
+	(q15_t)0x3da5, (q15_t)0xc00b, (q15_t)0x3d73, (q15_t)0xc00d, (q15_t)0x3d40, (q15_t)0xc00f, (q15_t)0x3d0e, (q15_t)0xc011,
+	(q15_t)0x3cdc, (q15_t)0xc014, (q15_t)0x3caa, (q15_t)0xc016, (q15_t)0x3c78, (q15_t)0xc019, (q15_t)0x3c45, (q15_t)0xc01c,
+	(q15_t)0x3c13, (q15_t)0xc01f, (q15_t)0x3be1, (q15_t)0xc022, (q15_t)0x3baf, (q15_t)0xc025, (q15_t)0x3b7d, (q15_t)0xc029,
+	(q15_t)0x3b4b, (q15_t)0xc02c, (q15_t)0x3b19, (q15_t)0xc030, (q15_t)0x3ae6, (q15_t)0xc034, (q15_t)0x3ab4, (q15_t)0xc038,
+	(q15_t)0x3a82, (q15_t)0xc03c, (q15_t)0x3a50, (q15_t)0xc041, (q15_t)0x3a1e, (q15_t)0xc045, (q15_t)0x39ec, (q15_t)0xc04a,
+	(q15_t)0x39ba, (q15_t)0xc04f, (q15_t)0x3988, (q15_t)0xc054, (q15_t)0x3956, (q15_t)0xc059, (q15_t)0x3924, (q15_t)0xc05e,
+	(q15_t)0x38f2, (q15_t)0xc064, (q15_t)0x38c0, (q15_t)0xc069, (q15_t)0x388e, (q15_t)0xc06f, (q15_t)0x385c, (q15_t)0xc075,
+	(q15_t)0x382a, (q15_t)0xc07b, (q15_t)0x37f9, (q15_t)0xc081, (q15_t)0x37c7, (q15_t)0xc088, (q15_t)0x3795, (q15_t)0xc08e,
+	(q15_t)0x3763, (q15_t)0xc095, (q15_t)0x3731, (q15_t)0xc09c, (q15_t)0x36ff, (q15_t)0xc0a3, (q15_t)0x36ce, (q15_t)0xc0aa,
+	(q15_t)0x369c, (q15_t)0xc0b1, (q15_t)0x366a, (q15_t)0xc0b9, (q15_t)0x3639, (q15_t)0xc0c0, (q15_t)0x3607, (q15_t)0xc0c8,
+	(q15_t)0x35d5, (q15_t)0xc0d0, (q15_t)0x35a4, (q15_t)0xc0d8, (q15_t)0x3572, (q15_t)0xc0e0, (q15_t)0x3540, (q15_t)0xc0e9,
+	(q15_t)0x350f, (q15_t)0xc0f1, (q15_t)0x34dd, (q15_t)0xc0fa, (q15_t)0x34ac, (q15_t)0xc103, (q15_t)0x347b, (q15_t)0xc10c,
+	(q15_t)0x3449, (q15_t)0xc115, (q15_t)0x3418, (q15_t)0xc11e, (q15_t)0x33e6, (q15_t)0xc128, (q15_t)0x33b5, (q15_t)0xc131,
+	(q15_t)0x3384, (q15_t)0xc13b, (q15_t)0x3352, (q15_t)0xc145, (q15_t)0x3321, (q15_t)0xc14f, (q15_t)0x32f0, (q15_t)0xc159,
+	(q15_t)0x32bf, (q15_t)0xc163, (q15_t)0x328e, (q15_t)0xc16e, (q15_t)0x325c, (q15_t)0xc178, (q15_t)0x322b, (q15_t)0xc183,
+	(q15_t)0x31fa, (q15_t)0xc18e, (q15_t)0x31c9, (q15_t)0xc199, (q15_t)0x3198, (q15_t)0xc1a4, (q15_t)0x3167, (q15_t)0xc1b0,
+	(q15_t)0x3136, (q15_t)0xc1bb, (q15_t)0x3105, (q15_t)0xc1c7, (q15_t)0x30d5, (q15_t)0xc1d3, (q15_t)0x30a4, (q15_t)0xc1df,
+	(q15_t)0x3073, (q15_t)0xc1eb, (q15_t)0x3042, (q15_t)0xc1f7, (q15_t)0x3012, (q15_t)0xc204, (q15_t)0x2fe1, (q15_t)0xc210,
+	(q15_t)0x2fb0, (q15_t)0xc21d, (q15_t)0x2f80, (q15_t)0xc22a, (q15_t)0x2f4f, (q15_t)0xc237, (q15_t)0x2f1f, (q15_t)0xc244,
+	(q15_t)0x2eee, (q15_t)0xc251, (q15_t)0x2ebe, (q15_t)0xc25f, (q15_t)0x2e8d, (q15_t)0xc26d, (q15_t)0x2e5d, (q15_t)0xc27a,
+	(q15_t)0x2e2d, (q15_t)0xc288, (q15_t)0x2dfc, (q15_t)0xc296, (q15_t)0x2dcc, (q15_t)0xc2a5, (q15_t)0x2d9c, (q15_t)0xc2b3,
+	(q15_t)0x2d6c, (q15_t)0xc2c1, (q15_t)0x2d3c, (q15_t)0xc2d0, (q15_t)0x2d0c, (q15_t)0xc2df, (q15_t)0x2cdc, (q15_t)0xc2ee,
+	(q15_t)0x2cac, (q15_t)0xc2fd, (q15_t)0x2c7c, (q15_t)0xc30c, (q15_t)0x2c4c, (q15_t)0xc31c, (q15_t)0x2c1c, (q15_t)0xc32b,
+	(q15_t)0x2bed, (q15_t)0xc33b, (q15_t)0x2bbd, (q15_t)0xc34b, (q15_t)0x2b8d, (q15_t)0xc35b, (q15_t)0x2b5e, (q15_t)0xc36b,
+	(q15_t)0x2b2e, (q15_t)0xc37b, (q15_t)0x2aff, (q15_t)0xc38c, (q15_t)0x2acf, (q15_t)0xc39c, (q15_t)0x2aa0, (q15_t)0xc3ad,
+	(q15_t)0x2a70, (q15_t)0xc3be, (q15_t)0x2a41, (q15_t)0xc3cf, (q15_t)0x2a12, (q15_t)0xc3e0, (q15_t)0x29e3, (q15_t)0xc3f1,
+	(q15_t)0x29b4, (q15_t)0xc403, (q15_t)0x2984, (q15_t)0xc414, (q15_t)0x2955, (q15_t)0xc426, (q15_t)0x2926, (q15_t)0xc438,
+	(q15_t)0x28f7, (q15_t)0xc44a, (q15_t)0x28c9, (q15_t)0xc45c, (q15_t)0x289a, (q15_t)0xc46e, (q15_t)0x286b, (q15_t)0xc481,
+	(q15_t)0x283c, (q15_t)0xc493, (q15_t)0x280e, (q15_t)0xc4a6, (q15_t)0x27df, (q15_t)0xc4b9, (q15_t)0x27b1, (q15_t)0xc4cc,
+	(q15_t)0x2782, (q15_t)0xc4df, (q15_t)0x2754, (q15_t)0xc4f2, (q15_t)0x2725, (q15_t)0xc506, (q15_t)0x26f7, (q15_t)0xc51a,
+	(q15_t)0x26c9, (q15_t)0xc52d, (q15_t)0x269b, (q15_t)0xc541, (q15_t)0x266d, (q15_t)0xc555, (q15_t)0x263f, (q15_t)0xc569,
+	(q15_t)0x2611, (q15_t)0xc57e, (q15_t)0x25e3, (q15_t)0xc592, (q15_t)0x25b5, (q15_t)0xc5a7, (q15_t)0x2587, (q15_t)0xc5bb,
+	(q15_t)0x2559, (q15_t)0xc5d0, (q15_t)0x252c, (q15_t)0xc5e5, (q15_t)0x24fe, (q15_t)0xc5fa, (q15_t)0x24d0, (q15_t)0xc610,
+	(q15_t)0x24a3, (q15_t)0xc625, (q15_t)0x2476, (q15_t)0xc63b, (q15_t)0x2448, (q15_t)0xc650, (q15_t)0x241b, (q15_t)0xc666,
+	(q15_t)0x23ee, (q15_t)0xc67c, (q15_t)0x23c1, (q15_t)0xc692, (q15_t)0x2394, (q15_t)0xc6a8, (q15_t)0x2367, (q15_t)0xc6bf,
+	(q15_t)0x233a, (q15_t)0xc6d5, (q15_t)0x230d, (q15_t)0xc6ec, (q15_t)0x22e0, (q15_t)0xc703, (q15_t)0x22b3, (q15_t)0xc71a,
+	(q15_t)0x2287, (q15_t)0xc731, (q15_t)0x225a, (q15_t)0xc748, (q15_t)0x222d, (q15_t)0xc75f, (q15_t)0x2201, (q15_t)0xc777,
+	(q15_t)0x21d5, (q15_t)0xc78f, (q15_t)0x21a8, (q15_t)0xc7a6, (q15_t)0x217c, (q15_t)0xc7be, (q15_t)0x2150, (q15_t)0xc7d6,
+	(q15_t)0x2124, (q15_t)0xc7ee, (q15_t)0x20f8, (q15_t)0xc807, (q15_t)0x20cc, (q15_t)0xc81f, (q15_t)0x20a0, (q15_t)0xc838,
+	(q15_t)0x2074, (q15_t)0xc850, (q15_t)0x2049, (q15_t)0xc869, (q15_t)0x201d, (q15_t)0xc882, (q15_t)0x1ff1, (q15_t)0xc89b,
+	(q15_t)0x1fc6, (q15_t)0xc8b5, (q15_t)0x1f9b, (q15_t)0xc8ce, (q15_t)0x1f6f, (q15_t)0xc8e8, (q15_t)0x1f44, (q15_t)0xc901,
+	(q15_t)0x1f19, (q15_t)0xc91b, (q15_t)0x1eee, (q15_t)0xc935, (q15_t)0x1ec3, (q15_t)0xc94f, (q15_t)0x1e98, (q15_t)0xc969,
+	(q15_t)0x1e6d, (q15_t)0xc983, (q15_t)0x1e42, (q15_t)0xc99e, (q15_t)0x1e18, (q15_t)0xc9b8, (q15_t)0x1ded, (q15_t)0xc9d3,
+	(q15_t)0x1dc3, (q15_t)0xc9ee, (q15_t)0x1d98, (q15_t)0xca09, (q15_t)0x1d6e, (q15_t)0xca24, (q15_t)0x1d44, (q15_t)0xca3f,
+	(q15_t)0x1d19, (q15_t)0xca5b, (q15_t)0x1cef, (q15_t)0xca76, (q15_t)0x1cc5, (q15_t)0xca92, (q15_t)0x1c9b, (q15_t)0xcaad,
+	(q15_t)0x1c72, (q15_t)0xcac9, (q15_t)0x1c48, (q15_t)0xcae5, (q15_t)0x1c1e, (q15_t)0xcb01, (q15_t)0x1bf5, (q15_t)0xcb1e,
+	(q15_t)0x1bcb, (q15_t)0xcb3a, (q15_t)0x1ba2, (q15_t)0xcb56, (q15_t)0x1b78, (q15_t)0xcb73, (q15_t)0x1b4f, (q15_t)0xcb90,
+	(q15_t)0x1b26, (q15_t)0xcbad, (q15_t)0x1afd, (q15_t)0xcbca, (q15_t)0x1ad4, (q15_t)0xcbe7, (q15_t)0x1aab, (q15_t)0xcc04,
+	(q15_t)0x1a82, (q15_t)0xcc21, (q15_t)0x1a5a, (q15_t)0xcc3f, (q15_t)0x1a31, (q15_t)0xcc5d, (q15_t)0x1a08, (q15_t)0xcc7a,
+	(q15_t)0x19e0, (q15_t)0xcc98, (q15_t)0x19b8, (q15_t)0xccb6, (q15_t)0x198f, (q15_t)0xccd4, (q15_t)0x1967, (q15_t)0xccf3,
+	(q15_t)0x193f, (q15_t)0xcd11, (q15_t)0x1917, (q15_t)0xcd30, (q15_t)0x18ef, (q15_t)0xcd4e, (q15_t)0x18c8, (q15_t)0xcd6d,
+	(q15_t)0x18a0, (q15_t)0xcd8c, (q15_t)0x1878, (q15_t)0xcdab, (q15_t)0x1851, (q15_t)0xcdca, (q15_t)0x182a, (q15_t)0xcde9,
+	(q15_t)0x1802, (q15_t)0xce08, (q15_t)0x17db, (q15_t)0xce28, (q15_t)0x17b4, (q15_t)0xce47, (q15_t)0x178d, (q15_t)0xce67,
+	(q15_t)0x1766, (q15_t)0xce87, (q15_t)0x173f, (q15_t)0xcea7, (q15_t)0x1719, (q15_t)0xcec7, (q15_t)0x16f2, (q15_t)0xcee7,
+	(q15_t)0x16cb, (q15_t)0xcf07, (q15_t)0x16a5, (q15_t)0xcf28, (q15_t)0x167f, (q15_t)0xcf48, (q15_t)0x1659, (q15_t)0xcf69,
+	(q15_t)0x1632, (q15_t)0xcf8a, (q15_t)0x160c, (q15_t)0xcfab, (q15_t)0x15e6, (q15_t)0xcfcc, (q15_t)0x15c1, (q15_t)0xcfed,
+	(q15_t)0x159b, (q15_t)0xd00e, (q15_t)0x1575, (q15_t)0xd030, (q15_t)0x1550, (q15_t)0xd051, (q15_t)0x152a, (q15_t)0xd073,
+	(q15_t)0x1505, (q15_t)0xd094, (q15_t)0x14e0, (q15_t)0xd0b6, (q15_t)0x14bb, (q15_t)0xd0d8, (q15_t)0x1496, (q15_t)0xd0fa,
+	(q15_t)0x1471, (q15_t)0xd11c, (q15_t)0x144c, (q15_t)0xd13e, (q15_t)0x1428, (q15_t)0xd161, (q15_t)0x1403, (q15_t)0xd183,
+	(q15_t)0x13df, (q15_t)0xd1a6, (q15_t)0x13ba, (q15_t)0xd1c9, (q15_t)0x1396, (q15_t)0xd1eb, (q15_t)0x1372, (q15_t)0xd20e,
+	(q15_t)0x134e, (q15_t)0xd231, (q15_t)0x132a, (q15_t)0xd255, (q15_t)0x1306, (q15_t)0xd278, (q15_t)0x12e2, (q15_t)0xd29b,
+	(q15_t)0x12bf, (q15_t)0xd2bf, (q15_t)0x129b, (q15_t)0xd2e2, (q15_t)0x1278, (q15_t)0xd306, (q15_t)0x1255, (q15_t)0xd32a,
+	(q15_t)0x1231, (q15_t)0xd34e, (q15_t)0x120e, (q15_t)0xd372, (q15_t)0x11eb, (q15_t)0xd396, (q15_t)0x11c9, (q15_t)0xd3ba,
+	(q15_t)0x11a6, (q15_t)0xd3df, (q15_t)0x1183, (q15_t)0xd403, (q15_t)0x1161, (q15_t)0xd428, (q15_t)0x113e, (q15_t)0xd44c,
+	(q15_t)0x111c, (q15_t)0xd471, (q15_t)0x10fa, (q15_t)0xd496, (q15_t)0x10d8, (q15_t)0xd4bb, (q15_t)0x10b6, (q15_t)0xd4e0,
+	(q15_t)0x1094, (q15_t)0xd505, (q15_t)0x1073, (q15_t)0xd52a, (q15_t)0x1051, (q15_t)0xd550, (q15_t)0x1030, (q15_t)0xd575,
+	(q15_t)0x100e, (q15_t)0xd59b, (q15_t)0x0fed, (q15_t)0xd5c1, (q15_t)0x0fcc, (q15_t)0xd5e6, (q15_t)0x0fab, (q15_t)0xd60c,
+	(q15_t)0x0f8a, (q15_t)0xd632, (q15_t)0x0f69, (q15_t)0xd659, (q15_t)0x0f48, (q15_t)0xd67f, (q15_t)0x0f28, (q15_t)0xd6a5,
+	(q15_t)0x0f07, (q15_t)0xd6cb, (q15_t)0x0ee7, (q15_t)0xd6f2, (q15_t)0x0ec7, (q15_t)0xd719, (q15_t)0x0ea7, (q15_t)0xd73f,
+	(q15_t)0x0e87, (q15_t)0xd766, (q15_t)0x0e67, (q15_t)0xd78d, (q15_t)0x0e47, (q15_t)0xd7b4, (q15_t)0x0e28, (q15_t)0xd7db,
+	(q15_t)0x0e08, (q15_t)0xd802, (q15_t)0x0de9, (q15_t)0xd82a, (q15_t)0x0dca, (q15_t)0xd851, (q15_t)0x0dab, (q15_t)0xd878,
+	(q15_t)0x0d8c, (q15_t)0xd8a0, (q15_t)0x0d6d, (q15_t)0xd8c8, (q15_t)0x0d4e, (q15_t)0xd8ef, (q15_t)0x0d30, (q15_t)0xd917,
+	(q15_t)0x0d11, (q15_t)0xd93f, (q15_t)0x0cf3, (q15_t)0xd967, (q15_t)0x0cd4, (q15_t)0xd98f, (q15_t)0x0cb6, (q15_t)0xd9b8,
+	(q15_t)0x0c98, (q15_t)0xd9e0, (q15_t)0x0c7a, (q15_t)0xda08, (q15_t)0x0c5d, (q15_t)0xda31, (q15_t)0x0c3f, (q15_t)0xda5a,
+	(q15_t)0x0c21, (q15_t)0xda82, (q15_t)0x0c04, (q15_t)0xdaab, (q15_t)0x0be7, (q15_t)0xdad4, (q15_t)0x0bca, (q15_t)0xdafd,
+	(q15_t)0x0bad, (q15_t)0xdb26, (q15_t)0x0b90, (q15_t)0xdb4f, (q15_t)0x0b73, (q15_t)0xdb78, (q15_t)0x0b56, (q15_t)0xdba2,
+	(q15_t)0x0b3a, (q15_t)0xdbcb, (q15_t)0x0b1e, (q15_t)0xdbf5, (q15_t)0x0b01, (q15_t)0xdc1e, (q15_t)0x0ae5, (q15_t)0xdc48,
+	(q15_t)0x0ac9, (q15_t)0xdc72, (q15_t)0x0aad, (q15_t)0xdc9b, (q15_t)0x0a92, (q15_t)0xdcc5, (q15_t)0x0a76, (q15_t)0xdcef,
+	(q15_t)0x0a5b, (q15_t)0xdd19, (q15_t)0x0a3f, (q15_t)0xdd44, (q15_t)0x0a24, (q15_t)0xdd6e, (q15_t)0x0a09, (q15_t)0xdd98,
+	(q15_t)0x09ee, (q15_t)0xddc3, (q15_t)0x09d3, (q15_t)0xdded, (q15_t)0x09b8, (q15_t)0xde18, (q15_t)0x099e, (q15_t)0xde42,
+	(q15_t)0x0983, (q15_t)0xde6d, (q15_t)0x0969, (q15_t)0xde98, (q15_t)0x094f, (q15_t)0xdec3, (q15_t)0x0935, (q15_t)0xdeee,
+	(q15_t)0x091b, (q15_t)0xdf19, (q15_t)0x0901, (q15_t)0xdf44, (q15_t)0x08e8, (q15_t)0xdf6f, (q15_t)0x08ce, (q15_t)0xdf9b,
+	(q15_t)0x08b5, (q15_t)0xdfc6, (q15_t)0x089b, (q15_t)0xdff1, (q15_t)0x0882, (q15_t)0xe01d, (q15_t)0x0869, (q15_t)0xe049,
+	(q15_t)0x0850, (q15_t)0xe074, (q15_t)0x0838, (q15_t)0xe0a0, (q15_t)0x081f, (q15_t)0xe0cc, (q15_t)0x0807, (q15_t)0xe0f8,
+	(q15_t)0x07ee, (q15_t)0xe124, (q15_t)0x07d6, (q15_t)0xe150, (q15_t)0x07be, (q15_t)0xe17c, (q15_t)0x07a6, (q15_t)0xe1a8,
+	(q15_t)0x078f, (q15_t)0xe1d5, (q15_t)0x0777, (q15_t)0xe201, (q15_t)0x075f, (q15_t)0xe22d, (q15_t)0x0748, (q15_t)0xe25a,
+	(q15_t)0x0731, (q15_t)0xe287, (q15_t)0x071a, (q15_t)0xe2b3, (q15_t)0x0703, (q15_t)0xe2e0, (q15_t)0x06ec, (q15_t)0xe30d,
+	(q15_t)0x06d5, (q15_t)0xe33a, (q15_t)0x06bf, (q15_t)0xe367, (q15_t)0x06a8, (q15_t)0xe394, (q15_t)0x0692, (q15_t)0xe3c1,
+	(q15_t)0x067c, (q15_t)0xe3ee, (q15_t)0x0666, (q15_t)0xe41b, (q15_t)0x0650, (q15_t)0xe448, (q15_t)0x063b, (q15_t)0xe476,
+	(q15_t)0x0625, (q15_t)0xe4a3, (q15_t)0x0610, (q15_t)0xe4d0, (q15_t)0x05fa, (q15_t)0xe4fe, (q15_t)0x05e5, (q15_t)0xe52c,
+	(q15_t)0x05d0, (q15_t)0xe559, (q15_t)0x05bb, (q15_t)0xe587, (q15_t)0x05a7, (q15_t)0xe5b5, (q15_t)0x0592, (q15_t)0xe5e3,
+	(q15_t)0x057e, (q15_t)0xe611, (q15_t)0x0569, (q15_t)0xe63f, (q15_t)0x0555, (q15_t)0xe66d, (q15_t)0x0541, (q15_t)0xe69b,
+	(q15_t)0x052d, (q15_t)0xe6c9, (q15_t)0x051a, (q15_t)0xe6f7, (q15_t)0x0506, (q15_t)0xe725, (q15_t)0x04f2, (q15_t)0xe754,
+	(q15_t)0x04df, (q15_t)0xe782, (q15_t)0x04cc, (q15_t)0xe7b1, (q15_t)0x04b9, (q15_t)0xe7df, (q15_t)0x04a6, (q15_t)0xe80e,
+	(q15_t)0x0493, (q15_t)0xe83c, (q15_t)0x0481, (q15_t)0xe86b, (q15_t)0x046e, (q15_t)0xe89a, (q15_t)0x045c, (q15_t)0xe8c9,
+	(q15_t)0x044a, (q15_t)0xe8f7, (q15_t)0x0438, (q15_t)0xe926, (q15_t)0x0426, (q15_t)0xe955, (q15_t)0x0414, (q15_t)0xe984,
+	(q15_t)0x0403, (q15_t)0xe9b4, (q15_t)0x03f1, (q15_t)0xe9e3, (q15_t)0x03e0, (q15_t)0xea12, (q15_t)0x03cf, (q15_t)0xea41,
+	(q15_t)0x03be, (q15_t)0xea70, (q15_t)0x03ad, (q15_t)0xeaa0, (q15_t)0x039c, (q15_t)0xeacf, (q15_t)0x038c, (q15_t)0xeaff,
+	(q15_t)0x037b, (q15_t)0xeb2e, (q15_t)0x036b, (q15_t)0xeb5e, (q15_t)0x035b, (q15_t)0xeb8d, (q15_t)0x034b, (q15_t)0xebbd,
+	(q15_t)0x033b, (q15_t)0xebed, (q15_t)0x032b, (q15_t)0xec1c, (q15_t)0x031c, (q15_t)0xec4c, (q15_t)0x030c, (q15_t)0xec7c,
+	(q15_t)0x02fd, (q15_t)0xecac, (q15_t)0x02ee, (q15_t)0xecdc, (q15_t)0x02df, (q15_t)0xed0c, (q15_t)0x02d0, (q15_t)0xed3c,
+	(q15_t)0x02c1, (q15_t)0xed6c, (q15_t)0x02b3, (q15_t)0xed9c, (q15_t)0x02a5, (q15_t)0xedcc, (q15_t)0x0296, (q15_t)0xedfc,
+	(q15_t)0x0288, (q15_t)0xee2d, (q15_t)0x027a, (q15_t)0xee5d, (q15_t)0x026d, (q15_t)0xee8d, (q15_t)0x025f, (q15_t)0xeebe,
+	(q15_t)0x0251, (q15_t)0xeeee, (q15_t)0x0244, (q15_t)0xef1f, (q15_t)0x0237, (q15_t)0xef4f, (q15_t)0x022a, (q15_t)0xef80,
+	(q15_t)0x021d, (q15_t)0xefb0, (q15_t)0x0210, (q15_t)0xefe1, (q15_t)0x0204, (q15_t)0xf012, (q15_t)0x01f7, (q15_t)0xf042,
+	(q15_t)0x01eb, (q15_t)0xf073, (q15_t)0x01df, (q15_t)0xf0a4, (q15_t)0x01d3, (q15_t)0xf0d5, (q15_t)0x01c7, (q15_t)0xf105,
+	(q15_t)0x01bb, (q15_t)0xf136, (q15_t)0x01b0, (q15_t)0xf167, (q15_t)0x01a4, (q15_t)0xf198, (q15_t)0x0199, (q15_t)0xf1c9,
+	(q15_t)0x018e, (q15_t)0xf1fa, (q15_t)0x0183, (q15_t)0xf22b, (q15_t)0x0178, (q15_t)0xf25c, (q15_t)0x016e, (q15_t)0xf28e,
+	(q15_t)0x0163, (q15_t)0xf2bf, (q15_t)0x0159, (q15_t)0xf2f0, (q15_t)0x014f, (q15_t)0xf321, (q15_t)0x0145, (q15_t)0xf352,
+	(q15_t)0x013b, (q15_t)0xf384, (q15_t)0x0131, (q15_t)0xf3b5, (q15_t)0x0128, (q15_t)0xf3e6, (q15_t)0x011e, (q15_t)0xf418,
+	(q15_t)0x0115, (q15_t)0xf449, (q15_t)0x010c, (q15_t)0xf47b, (q15_t)0x0103, (q15_t)0xf4ac, (q15_t)0x00fa, (q15_t)0xf4dd,
+	(q15_t)0x00f1, (q15_t)0xf50f, (q15_t)0x00e9, (q15_t)0xf540, (q15_t)0x00e0, (q15_t)0xf572, (q15_t)0x00d8, (q15_t)0xf5a4,
+	(q15_t)0x00d0, (q15_t)0xf5d5, (q15_t)0x00c8, (q15_t)0xf607, (q15_t)0x00c0, (q15_t)0xf639, (q15_t)0x00b9, (q15_t)0xf66a,
+	(q15_t)0x00b1, (q15_t)0xf69c, (q15_t)0x00aa, (q15_t)0xf6ce, (q15_t)0x00a3, (q15_t)0xf6ff, (q15_t)0x009c, (q15_t)0xf731,
+	(q15_t)0x0095, (q15_t)0xf763, (q15_t)0x008e, (q15_t)0xf795, (q15_t)0x0088, (q15_t)0xf7c7, (q15_t)0x0081, (q15_t)0xf7f9,
+	(q15_t)0x007b, (q15_t)0xf82a, (q15_t)0x0075, (q15_t)0xf85c, (q15_t)0x006f, (q15_t)0xf88e, (q15_t)0x0069, (q15_t)0xf8c0,
+	(q15_t)0x0064, (q15_t)0xf8f2, (q15_t)0x005e, (q15_t)0xf924, (q15_t)0x0059, (q15_t)0xf956, (q15_t)0x0054, (q15_t)0xf988,
+	(q15_t)0x004f, (q15_t)0xf9ba, (q15_t)0x004a, (q15_t)0xf9ec, (q15_t)0x0045, (q15_t)0xfa1e, (q15_t)0x0041, (q15_t)0xfa50,
+	(q15_t)0x003c, (q15_t)0xfa82, (q15_t)0x0038, (q15_t)0xfab4, (q15_t)0x0034, (q15_t)0xfae6, (q15_t)0x0030, (q15_t)0xfb19,
+	(q15_t)0x002c, (q15_t)0xfb4b, (q15_t)0x0029, (q15_t)0xfb7d, (q15_t)0x0025, (q15_t)0xfbaf, (q15_t)0x0022, (q15_t)0xfbe1,
+	(q15_t)0x001f, (q15_t)0xfc13, (q15_t)0x001c, (q15_t)0xfc45, (q15_t)0x0019, (q15_t)0xfc78, (q15_t)0x0016, (q15_t)0xfcaa,
+	(q15_t)0x0014, (q15_t)0xfcdc, (q15_t)0x0011, (q15_t)0xfd0e, (q15_t)0x000f, (q15_t)0xfd40, (q15_t)0x000d, (q15_t)0xfd73,
+	(q15_t)0x000b, (q15_t)0xfda5, (q15_t)0x0009, (q15_t)0xfdd7, (q15_t)0x0008, (q15_t)0xfe09, (q15_t)0x0006, (q15_t)0xfe3c,
+	(q15_t)0x0005, (q15_t)0xfe6e, (q15_t)0x0004, (q15_t)0xfea0, (q15_t)0x0003, (q15_t)0xfed2, (q15_t)0x0002, (q15_t)0xff05,
+	(q15_t)0x0001, (q15_t)0xff37, (q15_t)0x0001, (q15_t)0xff69, (q15_t)0x0000, (q15_t)0xff9b, (q15_t)0x0000, (q15_t)0xffce,
+	(q15_t)0x0000, (q15_t)0x0000, (q15_t)0x0000, (q15_t)0x0032, (q15_t)0x0000, (q15_t)0x0065, (q15_t)0x0001, (q15_t)0x0097,
+	(q15_t)0x0001, (q15_t)0x00c9, (q15_t)0x0002, (q15_t)0x00fb, (q15_t)0x0003, (q15_t)0x012e, (q15_t)0x0004, (q15_t)0x0160,
+	(q15_t)0x0005, (q15_t)0x0192, (q15_t)0x0006, (q15_t)0x01c4, (q15_t)0x0008, (q15_t)0x01f7, (q15_t)0x0009, (q15_t)0x0229,
+	(q15_t)0x000b, (q15_t)0x025b, (q15_t)0x000d, (q15_t)0x028d, (q15_t)0x000f, (q15_t)0x02c0, (q15_t)0x0011, (q15_t)0x02f2,
+	(q15_t)0x0014, (q15_t)0x0324, (q15_t)0x0016, (q15_t)0x0356, (q15_t)0x0019, (q15_t)0x0388, (q15_t)0x001c, (q15_t)0x03bb,
+	(q15_t)0x001f, (q15_t)0x03ed, (q15_t)0x0022, (q15_t)0x041f, (q15_t)0x0025, (q15_t)0x0451, (q15_t)0x0029, (q15_t)0x0483,
+	(q15_t)0x002c, (q15_t)0x04b5, (q15_t)0x0030, (q15_t)0x04e7, (q15_t)0x0034, (q15_t)0x051a, (q15_t)0x0038, (q15_t)0x054c,
+	(q15_t)0x003c, (q15_t)0x057e, (q15_t)0x0041, (q15_t)0x05b0, (q15_t)0x0045, (q15_t)0x05e2, (q15_t)0x004a, (q15_t)0x0614,
+	(q15_t)0x004f, (q15_t)0x0646, (q15_t)0x0054, (q15_t)0x0678, (q15_t)0x0059, (q15_t)0x06aa, (q15_t)0x005e, (q15_t)0x06dc,
+	(q15_t)0x0064, (q15_t)0x070e, (q15_t)0x0069, (q15_t)0x0740, (q15_t)0x006f, (q15_t)0x0772, (q15_t)0x0075, (q15_t)0x07a4,
+	(q15_t)0x007b, (q15_t)0x07d6, (q15_t)0x0081, (q15_t)0x0807, (q15_t)0x0088, (q15_t)0x0839, (q15_t)0x008e, (q15_t)0x086b,
+	(q15_t)0x0095, (q15_t)0x089d, (q15_t)0x009c, (q15_t)0x08cf, (q15_t)0x00a3, (q15_t)0x0901, (q15_t)0x00aa, (q15_t)0x0932,
+	(q15_t)0x00b1, (q15_t)0x0964, (q15_t)0x00b9, (q15_t)0x0996, (q15_t)0x00c0, (q15_t)0x09c7, (q15_t)0x00c8, (q15_t)0x09f9,
+	(q15_t)0x00d0, (q15_t)0x0a2b, (q15_t)0x00d8, (q15_t)0x0a5c, (q15_t)0x00e0, (q15_t)0x0a8e, (q15_t)0x00e9, (q15_t)0x0ac0,
+	(q15_t)0x00f1, (q15_t)0x0af1, (q15_t)0x00fa, (q15_t)0x0b23, (q15_t)0x0103, (q15_t)0x0b54, (q15_t)0x010c, (q15_t)0x0b85,
+	(q15_t)0x0115, (q15_t)0x0bb7, (q15_t)0x011e, (q15_t)0x0be8, (q15_t)0x0128, (q15_t)0x0c1a, (q15_t)0x0131, (q15_t)0x0c4b,
+	(q15_t)0x013b, (q15_t)0x0c7c, (q15_t)0x0145, (q15_t)0x0cae, (q15_t)0x014f, (q15_t)0x0cdf, (q15_t)0x0159, (q15_t)0x0d10,
+	(q15_t)0x0163, (q15_t)0x0d41, (q15_t)0x016e, (q15_t)0x0d72, (q15_t)0x0178, (q15_t)0x0da4, (q15_t)0x0183, (q15_t)0x0dd5,
+	(q15_t)0x018e, (q15_t)0x0e06, (q15_t)0x0199, (q15_t)0x0e37, (q15_t)0x01a4, (q15_t)0x0e68, (q15_t)0x01b0, (q15_t)0x0e99,
+	(q15_t)0x01bb, (q15_t)0x0eca, (q15_t)0x01c7, (q15_t)0x0efb, (q15_t)0x01d3, (q15_t)0x0f2b, (q15_t)0x01df, (q15_t)0x0f5c,
+	(q15_t)0x01eb, (q15_t)0x0f8d, (q15_t)0x01f7, (q15_t)0x0fbe, (q15_t)0x0204, (q15_t)0x0fee, (q15_t)0x0210, (q15_t)0x101f,
+	(q15_t)0x021d, (q15_t)0x1050, (q15_t)0x022a, (q15_t)0x1080, (q15_t)0x0237, (q15_t)0x10b1, (q15_t)0x0244, (q15_t)0x10e1,
+	(q15_t)0x0251, (q15_t)0x1112, (q15_t)0x025f, (q15_t)0x1142, (q15_t)0x026d, (q15_t)0x1173, (q15_t)0x027a, (q15_t)0x11a3,
+	(q15_t)0x0288, (q15_t)0x11d3, (q15_t)0x0296, (q15_t)0x1204, (q15_t)0x02a5, (q15_t)0x1234, (q15_t)0x02b3, (q15_t)0x1264,
+	(q15_t)0x02c1, (q15_t)0x1294, (q15_t)0x02d0, (q15_t)0x12c4, (q15_t)0x02df, (q15_t)0x12f4, (q15_t)0x02ee, (q15_t)0x1324,
+	(q15_t)0x02fd, (q15_t)0x1354, (q15_t)0x030c, (q15_t)0x1384, (q15_t)0x031c, (q15_t)0x13b4, (q15_t)0x032b, (q15_t)0x13e4,
+	(q15_t)0x033b, (q15_t)0x1413, (q15_t)0x034b, (q15_t)0x1443, (q15_t)0x035b, (q15_t)0x1473, (q15_t)0x036b, (q15_t)0x14a2,
+	(q15_t)0x037b, (q15_t)0x14d2, (q15_t)0x038c, (q15_t)0x1501, (q15_t)0x039c, (q15_t)0x1531, (q15_t)0x03ad, (q15_t)0x1560,
+	(q15_t)0x03be, (q15_t)0x1590, (q15_t)0x03cf, (q15_t)0x15bf, (q15_t)0x03e0, (q15_t)0x15ee, (q15_t)0x03f1, (q15_t)0x161d,
+	(q15_t)0x0403, (q15_t)0x164c, (q15_t)0x0414, (q15_t)0x167c, (q15_t)0x0426, (q15_t)0x16ab, (q15_t)0x0438, (q15_t)0x16da,
+	(q15_t)0x044a, (q15_t)0x1709, (q15_t)0x045c, (q15_t)0x1737, (q15_t)0x046e, (q15_t)0x1766, (q15_t)0x0481, (q15_t)0x1795,
+	(q15_t)0x0493, (q15_t)0x17c4, (q15_t)0x04a6, (q15_t)0x17f2, (q15_t)0x04b9, (q15_t)0x1821, (q15_t)0x04cc, (q15_t)0x184f,
+	(q15_t)0x04df, (q15_t)0x187e, (q15_t)0x04f2, (q15_t)0x18ac, (q15_t)0x0506, (q15_t)0x18db, (q15_t)0x051a, (q15_t)0x1909,
+	(q15_t)0x052d, (q15_t)0x1937, (q15_t)0x0541, (q15_t)0x1965, (q15_t)0x0555, (q15_t)0x1993, (q15_t)0x0569, (q15_t)0x19c1,
+	(q15_t)0x057e, (q15_t)0x19ef, (q15_t)0x0592, (q15_t)0x1a1d, (q15_t)0x05a7, (q15_t)0x1a4b, (q15_t)0x05bb, (q15_t)0x1a79,
+	(q15_t)0x05d0, (q15_t)0x1aa7, (q15_t)0x05e5, (q15_t)0x1ad4, (q15_t)0x05fa, (q15_t)0x1b02, (q15_t)0x0610, (q15_t)0x1b30,
+	(q15_t)0x0625, (q15_t)0x1b5d, (q15_t)0x063b, (q15_t)0x1b8a, (q15_t)0x0650, (q15_t)0x1bb8, (q15_t)0x0666, (q15_t)0x1be5,
+	(q15_t)0x067c, (q15_t)0x1c12, (q15_t)0x0692, (q15_t)0x1c3f, (q15_t)0x06a8, (q15_t)0x1c6c, (q15_t)0x06bf, (q15_t)0x1c99,
+	(q15_t)0x06d5, (q15_t)0x1cc6, (q15_t)0x06ec, (q15_t)0x1cf3, (q15_t)0x0703, (q15_t)0x1d20, (q15_t)0x071a, (q15_t)0x1d4d,
+	(q15_t)0x0731, (q15_t)0x1d79, (q15_t)0x0748, (q15_t)0x1da6, (q15_t)0x075f, (q15_t)0x1dd3, (q15_t)0x0777, (q15_t)0x1dff,
+	(q15_t)0x078f, (q15_t)0x1e2b, (q15_t)0x07a6, (q15_t)0x1e58, (q15_t)0x07be, (q15_t)0x1e84, (q15_t)0x07d6, (q15_t)0x1eb0,
+	(q15_t)0x07ee, (q15_t)0x1edc, (q15_t)0x0807, (q15_t)0x1f08, (q15_t)0x081f, (q15_t)0x1f34, (q15_t)0x0838, (q15_t)0x1f60,
+	(q15_t)0x0850, (q15_t)0x1f8c, (q15_t)0x0869, (q15_t)0x1fb7, (q15_t)0x0882, (q15_t)0x1fe3, (q15_t)0x089b, (q15_t)0x200f,
+	(q15_t)0x08b5, (q15_t)0x203a, (q15_t)0x08ce, (q15_t)0x2065, (q15_t)0x08e8, (q15_t)0x2091, (q15_t)0x0901, (q15_t)0x20bc,
+	(q15_t)0x091b, (q15_t)0x20e7, (q15_t)0x0935, (q15_t)0x2112, (q15_t)0x094f, (q15_t)0x213d, (q15_t)0x0969, (q15_t)0x2168,
+	(q15_t)0x0983, (q15_t)0x2193, (q15_t)0x099e, (q15_t)0x21be, (q15_t)0x09b8, (q15_t)0x21e8, (q15_t)0x09d3, (q15_t)0x2213,
+	(q15_t)0x09ee, (q15_t)0x223d, (q15_t)0x0a09, (q15_t)0x2268, (q15_t)0x0a24, (q15_t)0x2292, (q15_t)0x0a3f, (q15_t)0x22bc,
+	(q15_t)0x0a5b, (q15_t)0x22e7, (q15_t)0x0a76, (q15_t)0x2311, (q15_t)0x0a92, (q15_t)0x233b, (q15_t)0x0aad, (q15_t)0x2365,
+	(q15_t)0x0ac9, (q15_t)0x238e, (q15_t)0x0ae5, (q15_t)0x23b8, (q15_t)0x0b01, (q15_t)0x23e2, (q15_t)0x0b1e, (q15_t)0x240b,
+	(q15_t)0x0b3a, (q15_t)0x2435, (q15_t)0x0b56, (q15_t)0x245e, (q15_t)0x0b73, (q15_t)0x2488, (q15_t)0x0b90, (q15_t)0x24b1,
+	(q15_t)0x0bad, (q15_t)0x24da, (q15_t)0x0bca, (q15_t)0x2503, (q15_t)0x0be7, (q15_t)0x252c, (q15_t)0x0c04, (q15_t)0x2555,
+	(q15_t)0x0c21, (q15_t)0x257e, (q15_t)0x0c3f, (q15_t)0x25a6, (q15_t)0x0c5d, (q15_t)0x25cf, (q15_t)0x0c7a, (q15_t)0x25f8,
+	(q15_t)0x0c98, (q15_t)0x2620, (q15_t)0x0cb6, (q15_t)0x2648, (q15_t)0x0cd4, (q15_t)0x2671, (q15_t)0x0cf3, (q15_t)0x2699,
+	(q15_t)0x0d11, (q15_t)0x26c1, (q15_t)0x0d30, (q15_t)0x26e9, (q15_t)0x0d4e, (q15_t)0x2711, (q15_t)0x0d6d, (q15_t)0x2738,
+	(q15_t)0x0d8c, (q15_t)0x2760, (q15_t)0x0dab, (q15_t)0x2788, (q15_t)0x0dca, (q15_t)0x27af, (q15_t)0x0de9, (q15_t)0x27d6,
+	(q15_t)0x0e08, (q15_t)0x27fe, (q15_t)0x0e28, (q15_t)0x2825, (q15_t)0x0e47, (q15_t)0x284c, (q15_t)0x0e67, (q15_t)0x2873,
+	(q15_t)0x0e87, (q15_t)0x289a, (q15_t)0x0ea7, (q15_t)0x28c1, (q15_t)0x0ec7, (q15_t)0x28e7, (q15_t)0x0ee7, (q15_t)0x290e,
+	(q15_t)0x0f07, (q15_t)0x2935, (q15_t)0x0f28, (q15_t)0x295b, (q15_t)0x0f48, (q15_t)0x2981, (q15_t)0x0f69, (q15_t)0x29a7,
+	(q15_t)0x0f8a, (q15_t)0x29ce, (q15_t)0x0fab, (q15_t)0x29f4, (q15_t)0x0fcc, (q15_t)0x2a1a, (q15_t)0x0fed, (q15_t)0x2a3f,
+	(q15_t)0x100e, (q15_t)0x2a65, (q15_t)0x1030, (q15_t)0x2a8b, (q15_t)0x1051, (q15_t)0x2ab0, (q15_t)0x1073, (q15_t)0x2ad6,
+	(q15_t)0x1094, (q15_t)0x2afb, (q15_t)0x10b6, (q15_t)0x2b20, (q15_t)0x10d8, (q15_t)0x2b45, (q15_t)0x10fa, (q15_t)0x2b6a,
+	(q15_t)0x111c, (q15_t)0x2b8f, (q15_t)0x113e, (q15_t)0x2bb4, (q15_t)0x1161, (q15_t)0x2bd8, (q15_t)0x1183, (q15_t)0x2bfd,
+	(q15_t)0x11a6, (q15_t)0x2c21, (q15_t)0x11c9, (q15_t)0x2c46, (q15_t)0x11eb, (q15_t)0x2c6a, (q15_t)0x120e, (q15_t)0x2c8e,
+	(q15_t)0x1231, (q15_t)0x2cb2, (q15_t)0x1255, (q15_t)0x2cd6, (q15_t)0x1278, (q15_t)0x2cfa, (q15_t)0x129b, (q15_t)0x2d1e,
+	(q15_t)0x12bf, (q15_t)0x2d41, (q15_t)0x12e2, (q15_t)0x2d65, (q15_t)0x1306, (q15_t)0x2d88, (q15_t)0x132a, (q15_t)0x2dab,
+	(q15_t)0x134e, (q15_t)0x2dcf, (q15_t)0x1372, (q15_t)0x2df2, (q15_t)0x1396, (q15_t)0x2e15, (q15_t)0x13ba, (q15_t)0x2e37,
+	(q15_t)0x13df, (q15_t)0x2e5a, (q15_t)0x1403, (q15_t)0x2e7d, (q15_t)0x1428, (q15_t)0x2e9f, (q15_t)0x144c, (q15_t)0x2ec2,
+	(q15_t)0x1471, (q15_t)0x2ee4, (q15_t)0x1496, (q15_t)0x2f06, (q15_t)0x14bb, (q15_t)0x2f28, (q15_t)0x14e0, (q15_t)0x2f4a,
+	(q15_t)0x1505, (q15_t)0x2f6c, (q15_t)0x152a, (q15_t)0x2f8d, (q15_t)0x1550, (q15_t)0x2faf, (q15_t)0x1575, (q15_t)0x2fd0,
+	(q15_t)0x159b, (q15_t)0x2ff2, (q15_t)0x15c1, (q15_t)0x3013, (q15_t)0x15e6, (q15_t)0x3034, (q15_t)0x160c, (q15_t)0x3055,
+	(q15_t)0x1632, (q15_t)0x3076, (q15_t)0x1659, (q15_t)0x3097, (q15_t)0x167f, (q15_t)0x30b8, (q15_t)0x16a5, (q15_t)0x30d8,
+	(q15_t)0x16cb, (q15_t)0x30f9, (q15_t)0x16f2, (q15_t)0x3119, (q15_t)0x1719, (q15_t)0x3139, (q15_t)0x173f, (q15_t)0x3159,
+	(q15_t)0x1766, (q15_t)0x3179, (q15_t)0x178d, (q15_t)0x3199, (q15_t)0x17b4, (q15_t)0x31b9, (q15_t)0x17db, (q15_t)0x31d8,
+	(q15_t)0x1802, (q15_t)0x31f8, (q15_t)0x182a, (q15_t)0x3217, (q15_t)0x1851, (q15_t)0x3236, (q15_t)0x1878, (q15_t)0x3255,
+	(q15_t)0x18a0, (q15_t)0x3274, (q15_t)0x18c8, (q15_t)0x3293, (q15_t)0x18ef, (q15_t)0x32b2, (q15_t)0x1917, (q15_t)0x32d0,
+	(q15_t)0x193f, (q15_t)0x32ef, (q15_t)0x1967, (q15_t)0x330d, (q15_t)0x198f, (q15_t)0x332c, (q15_t)0x19b8, (q15_t)0x334a,
+	(q15_t)0x19e0, (q15_t)0x3368, (q15_t)0x1a08, (q15_t)0x3386, (q15_t)0x1a31, (q15_t)0x33a3, (q15_t)0x1a5a, (q15_t)0x33c1,
+	(q15_t)0x1a82, (q15_t)0x33df, (q15_t)0x1aab, (q15_t)0x33fc, (q15_t)0x1ad4, (q15_t)0x3419, (q15_t)0x1afd, (q15_t)0x3436,
+	(q15_t)0x1b26, (q15_t)0x3453, (q15_t)0x1b4f, (q15_t)0x3470, (q15_t)0x1b78, (q15_t)0x348d, (q15_t)0x1ba2, (q15_t)0x34aa,
+	(q15_t)0x1bcb, (q15_t)0x34c6, (q15_t)0x1bf5, (q15_t)0x34e2, (q15_t)0x1c1e, (q15_t)0x34ff, (q15_t)0x1c48, (q15_t)0x351b,
+	(q15_t)0x1c72, (q15_t)0x3537, (q15_t)0x1c9b, (q15_t)0x3553, (q15_t)0x1cc5, (q15_t)0x356e, (q15_t)0x1cef, (q15_t)0x358a,
+	(q15_t)0x1d19, (q15_t)0x35a5, (q15_t)0x1d44, (q15_t)0x35c1, (q15_t)0x1d6e, (q15_t)0x35dc, (q15_t)0x1d98, (q15_t)0x35f7,
+	(q15_t)0x1dc3, (q15_t)0x3612, (q15_t)0x1ded, (q15_t)0x362d, (q15_t)0x1e18, (q15_t)0x3648, (q15_t)0x1e42, (q15_t)0x3662,
+	(q15_t)0x1e6d, (q15_t)0x367d, (q15_t)0x1e98, (q15_t)0x3697, (q15_t)0x1ec3, (q15_t)0x36b1, (q15_t)0x1eee, (q15_t)0x36cb,
+	(q15_t)0x1f19, (q15_t)0x36e5, (q15_t)0x1f44, (q15_t)0x36ff, (q15_t)0x1f6f, (q15_t)0x3718, (q15_t)0x1f9b, (q15_t)0x3732,
+	(q15_t)0x1fc6, (q15_t)0x374b, (q15_t)0x1ff1, (q15_t)0x3765, (q15_t)0x201d, (q15_t)0x377e, (q15_t)0x2049, (q15_t)0x3797,
+	(q15_t)0x2074, (q15_t)0x37b0, (q15_t)0x20a0, (q15_t)0x37c8, (q15_t)0x20cc, (q15_t)0x37e1, (q15_t)0x20f8, (q15_t)0x37f9,
+	(q15_t)0x2124, (q15_t)0x3812, (q15_t)0x2150, (q15_t)0x382a, (q15_t)0x217c, (q15_t)0x3842, (q15_t)0x21a8, (q15_t)0x385a,
+	(q15_t)0x21d5, (q15_t)0x3871, (q15_t)0x2201, (q15_t)0x3889, (q15_t)0x222d, (q15_t)0x38a1, (q15_t)0x225a, (q15_t)0x38b8,
+	(q15_t)0x2287, (q15_t)0x38cf, (q15_t)0x22b3, (q15_t)0x38e6, (q15_t)0x22e0, (q15_t)0x38fd, (q15_t)0x230d, (q15_t)0x3914,
+	(q15_t)0x233a, (q15_t)0x392b, (q15_t)0x2367, (q15_t)0x3941, (q15_t)0x2394, (q15_t)0x3958, (q15_t)0x23c1, (q15_t)0x396e,
+	(q15_t)0x23ee, (q15_t)0x3984, (q15_t)0x241b, (q15_t)0x399a, (q15_t)0x2448, (q15_t)0x39b0, (q15_t)0x2476, (q15_t)0x39c5,
+	(q15_t)0x24a3, (q15_t)0x39db, (q15_t)0x24d0, (q15_t)0x39f0, (q15_t)0x24fe, (q15_t)0x3a06, (q15_t)0x252c, (q15_t)0x3a1b,
+	(q15_t)0x2559, (q15_t)0x3a30, (q15_t)0x2587, (q15_t)0x3a45, (q15_t)0x25b5, (q15_t)0x3a59, (q15_t)0x25e3, (q15_t)0x3a6e,
+	(q15_t)0x2611, (q15_t)0x3a82, (q15_t)0x263f, (q15_t)0x3a97, (q15_t)0x266d, (q15_t)0x3aab, (q15_t)0x269b, (q15_t)0x3abf,
+	(q15_t)0x26c9, (q15_t)0x3ad3, (q15_t)0x26f7, (q15_t)0x3ae6, (q15_t)0x2725, (q15_t)0x3afa, (q15_t)0x2754, (q15_t)0x3b0e,
+	(q15_t)0x2782, (q15_t)0x3b21, (q15_t)0x27b1, (q15_t)0x3b34, (q15_t)0x27df, (q15_t)0x3b47, (q15_t)0x280e, (q15_t)0x3b5a,
+	(q15_t)0x283c, (q15_t)0x3b6d, (q15_t)0x286b, (q15_t)0x3b7f, (q15_t)0x289a, (q15_t)0x3b92, (q15_t)0x28c9, (q15_t)0x3ba4,
+	(q15_t)0x28f7, (q15_t)0x3bb6, (q15_t)0x2926, (q15_t)0x3bc8, (q15_t)0x2955, (q15_t)0x3bda, (q15_t)0x2984, (q15_t)0x3bec,
+	(q15_t)0x29b4, (q15_t)0x3bfd, (q15_t)0x29e3, (q15_t)0x3c0f, (q15_t)0x2a12, (q15_t)0x3c20, (q15_t)0x2a41, (q15_t)0x3c31,
+	(q15_t)0x2a70, (q15_t)0x3c42, (q15_t)0x2aa0, (q15_t)0x3c53, (q15_t)0x2acf, (q15_t)0x3c64, (q15_t)0x2aff, (q15_t)0x3c74,
+	(q15_t)0x2b2e, (q15_t)0x3c85, (q15_t)0x2b5e, (q15_t)0x3c95, (q15_t)0x2b8d, (q15_t)0x3ca5, (q15_t)0x2bbd, (q15_t)0x3cb5,
+	(q15_t)0x2bed, (q15_t)0x3cc5, (q15_t)0x2c1c, (q15_t)0x3cd5, (q15_t)0x2c4c, (q15_t)0x3ce4, (q15_t)0x2c7c, (q15_t)0x3cf4,
+	(q15_t)0x2cac, (q15_t)0x3d03, (q15_t)0x2cdc, (q15_t)0x3d12, (q15_t)0x2d0c, (q15_t)0x3d21, (q15_t)0x2d3c, (q15_t)0x3d30,
+	(q15_t)0x2d6c, (q15_t)0x3d3f, (q15_t)0x2d9c, (q15_t)0x3d4d, (q15_t)0x2dcc, (q15_t)0x3d5b, (q15_t)0x2dfc, (q15_t)0x3d6a,
+	(q15_t)0x2e2d, (q15_t)0x3d78, (q15_t)0x2e5d, (q15_t)0x3d86, (q15_t)0x2e8d, (q15_t)0x3d93, (q15_t)0x2ebe, (q15_t)0x3da1,
+	(q15_t)0x2eee, (q15_t)0x3daf, (q15_t)0x2f1f, (q15_t)0x3dbc, (q15_t)0x2f4f, (q15_t)0x3dc9, (q15_t)0x2f80, (q15_t)0x3dd6,
+	(q15_t)0x2fb0, (q15_t)0x3de3, (q15_t)0x2fe1, (q15_t)0x3df0, (q15_t)0x3012, (q15_t)0x3dfc, (q15_t)0x3042, (q15_t)0x3e09,
+	(q15_t)0x3073, (q15_t)0x3e15, (q15_t)0x30a4, (q15_t)0x3e21, (q15_t)0x30d5, (q15_t)0x3e2d, (q15_t)0x3105, (q15_t)0x3e39,
+	(q15_t)0x3136, (q15_t)0x3e45, (q15_t)0x3167, (q15_t)0x3e50, (q15_t)0x3198, (q15_t)0x3e5c, (q15_t)0x31c9, (q15_t)0x3e67,
+	(q15_t)0x31fa, (q15_t)0x3e72, (q15_t)0x322b, (q15_t)0x3e7d, (q15_t)0x325c, (q15_t)0x3e88, (q15_t)0x328e, (q15_t)0x3e92,
+	(q15_t)0x32bf, (q15_t)0x3e9d, (q15_t)0x32f0, (q15_t)0x3ea7, (q15_t)0x3321, (q15_t)0x3eb1, (q15_t)0x3352, (q15_t)0x3ebb,
+	(q15_t)0x3384, (q15_t)0x3ec5, (q15_t)0x33b5, (q15_t)0x3ecf, (q15_t)0x33e6, (q15_t)0x3ed8, (q15_t)0x3418, (q15_t)0x3ee2,
+	(q15_t)0x3449, (q15_t)0x3eeb, (q15_t)0x347b, (q15_t)0x3ef4, (q15_t)0x34ac, (q15_t)0x3efd, (q15_t)0x34dd, (q15_t)0x3f06,
+	(q15_t)0x350f, (q15_t)0x3f0f, (q15_t)0x3540, (q15_t)0x3f17, (q15_t)0x3572, (q15_t)0x3f20, (q15_t)0x35a4, (q15_t)0x3f28,
+	(q15_t)0x35d5, (q15_t)0x3f30, (q15_t)0x3607, (q15_t)0x3f38, (q15_t)0x3639, (q15_t)0x3f40, (q15_t)0x366a, (q15_t)0x3f47,
+	(q15_t)0x369c, (q15_t)0x3f4f, (q15_t)0x36ce, (q15_t)0x3f56, (q15_t)0x36ff, (q15_t)0x3f5d, (q15_t)0x3731, (q15_t)0x3f64,
+	(q15_t)0x3763, (q15_t)0x3f6b, (q15_t)0x3795, (q15_t)0x3f72, (q15_t)0x37c7, (q15_t)0x3f78, (q15_t)0x37f9, (q15_t)0x3f7f,
+	(q15_t)0x382a, (q15_t)0x3f85, (q15_t)0x385c, (q15_t)0x3f8b, (q15_t)0x388e, (q15_t)0x3f91, (q15_t)0x38c0, (q15_t)0x3f97,
+	(q15_t)0x38f2, (q15_t)0x3f9c, (q15_t)0x3924, (q15_t)0x3fa2, (q15_t)0x3956, (q15_t)0x3fa7, (q15_t)0x3988, (q15_t)0x3fac,
+	(q15_t)0x39ba, (q15_t)0x3fb1, (q15_t)0x39ec, (q15_t)0x3fb6, (q15_t)0x3a1e, (q15_t)0x3fbb, (q15_t)0x3a50, (q15_t)0x3fbf,
+	(q15_t)0x3a82, (q15_t)0x3fc4, (q15_t)0x3ab4, (q15_t)0x3fc8, (q15_t)0x3ae6, (q15_t)0x3fcc, (q15_t)0x3b19, (q15_t)0x3fd0,
+	(q15_t)0x3b4b, (q15_t)0x3fd4, (q15_t)0x3b7d, (q15_t)0x3fd7, (q15_t)0x3baf, (q15_t)0x3fdb, (q15_t)0x3be1, (q15_t)0x3fde,
+	(q15_t)0x3c13, (q15_t)0x3fe1, (q15_t)0x3c45, (q15_t)0x3fe4, (q15_t)0x3c78, (q15_t)0x3fe7, (q15_t)0x3caa, (q15_t)0x3fea,
+	(q15_t)0x3cdc, (q15_t)0x3fec, (q15_t)0x3d0e, (q15_t)0x3fef, (q15_t)0x3d40, (q15_t)0x3ff1, (q15_t)0x3d73, (q15_t)0x3ff3,
+	(q15_t)0x3da5, (q15_t)0x3ff5, (q15_t)0x3dd7, (q15_t)0x3ff7, (q15_t)0x3e09, (q15_t)0x3ff8, (q15_t)0x3e3c, (q15_t)0x3ffa,
+	(q15_t)0x3e6e, (q15_t)0x3ffb, (q15_t)0x3ea0, (q15_t)0x3ffc, (q15_t)0x3ed2, (q15_t)0x3ffd, (q15_t)0x3f05, (q15_t)0x3ffe,
+	(q15_t)0x3f37, (q15_t)0x3fff, (q15_t)0x3f69, (q15_t)0x3fff, (q15_t)0x3f9b, (q15_t)0x4000, (q15_t)0x3fce, (q15_t)0x4000,
+};
+const q15_t ALIGN4 bee_fft_coef_b_2048[2048] = {
+	(q15_t)0x4000, (q15_t)0x4000, (q15_t)0x4032, (q15_t)0x4000, (q15_t)0x4065, (q15_t)0x4000, (q15_t)0x4097, (q15_t)0x3fff,
+	(q15_t)0x40c9, (q15_t)0x3fff, (q15_t)0x40fb, (q15_t)0x3ffe, (q15_t)0x412e, (q15_t)0x3ffd, (q15_t)0x4160, (q15_t)0x3ffc,
+	(q15_t)0x4192, (q15_t)0x3ffb, (q15_t)0x41c4, (q15_t)0x3ffa, (q15_t)0x41f7, (q15_t)0x3ff8, (q15_t)0x4229, (q15_t)0x3ff7,
+	(q15_t)0x425b, (q15_t)0x3ff5, (q15_t)0x428d, (q15_t)0x3ff3, (q15_t)0x42c0, (q15_t)0x3ff1, (q15_t)0x42f2, (q15_t)0x3fef,
+	(q15_t)0x4324, (q15_t)0x3fec, (q15_t)0x4356, (q15_t)0x3fea, (q15_t)0x4388, (q15_t)0x3fe7, (q15_t)0x43bb, (q15_t)0x3fe4,
+	(q15_t)0x43ed, (q15_t)0x3fe1, (q15_t)0x441f, (q15_t)0x3fde, (q15_t)0x4451, (q15_t)0x3fdb, (q15_t)0x4483, (q15_t)0x3fd7,
+	(q15_t)0x44b5, (q15_t)0x3fd4, (q15_t)0x44e7, (q15_t)0x3fd0, (q15_t)0x451a, (q15_t)0x3fcc, (q15_t)0x454c, (q15_t)0x3fc8,
+	(q15_t)0x457e, (q15_t)0x3fc4, (q15_t)0x45b0, (q15_t)0x3fbf, (q15_t)0x45e2, (q15_t)0x3fbb, (q15_t)0x4614, (q15_t)0x3fb6,
+	(q15_t)0x4646, (q15_t)0x3fb1, (q15_t)0x4678, (q15_t)0x3fac, (q15_t)0x46aa, (q15_t)0x3fa7, (q15_t)0x46dc, (q15_t)0x3fa2,
+	(q15_t)0x470e, (q15_t)0x3f9c, (q15_t)0x4740, (q15_t)0x3f97, (q15_t)0x4772, (q15_t)0x3f91, (q15_t)0x47a4, (q15_t)0x3f8b,
+	(q15_t)0x47d6, (q15_t)0x3f85, (q15_t)0x4807, (q15_t)0x3f7f, (q15_t)0x4839, (q15_t)0x3f78, (q15_t)0x486b, (q15_t)0x3f72,
+	(q15_t)0x489d, (q15_t)0x3f6b, (q15_t)0x48cf, (q15_t)0x3f64, (q15_t)0x4901, (q15_t)0x3f5d, (q15_t)0x4932, (q15_t)0x3f56,
+	(q15_t)0x4964, (q15_t)0x3f4f, (q15_t)0x4996, (q15_t)0x3f47, (q15_t)0x49c7, (q15_t)0x3f40, (q15_t)0x49f9, (q15_t)0x3f38,
+	(q15_t)0x4a2b, (q15_t)0x3f30, (q15_t)0x4a5c, (q15_t)0x3f28, (q15_t)0x4a8e, (q15_t)0x3f20, (q15_t)0x4ac0, (q15_t)0x3f17,
+	(q15_t)0x4af1, (q15_t)0x3f0f, (q15_t)0x4b23, (q15_t)0x3f06, (q15_t)0x4b54, (q15_t)0x3efd, (q15_t)0x4b85, (q15_t)0x3ef4,
+	(q15_t)0x4bb7, (q15_t)0x3eeb, (q15_t)0x4be8, (q15_t)0x3ee2, (q15_t)0x4c1a, (q15_t)0x3ed8, (q15_t)0x4c4b, (q15_t)0x3ecf,
+	(q15_t)0x4c7c, (q15_t)0x3ec5, (q15_t)0x4cae, (q15_t)0x3ebb, (q15_t)0x4cdf, (q15_t)0x3eb1, (q15_t)0x4d10, (q15_t)0x3ea7,
+	(q15_t)0x4d41, (q15_t)0x3e9d, (q15_t)0x4d72, (q15_t)0x3e92, (q15_t)0x4da4, (q15_t)0x3e88, (q15_t)0x4dd5, (q15_t)0x3e7d,
+	(q15_t)0x4e06, (q15_t)0x3e72, (q15_t)0x4e37, (q15_t)0x3e67, (q15_t)0x4e68, (q15_t)0x3e5c, (q15_t)0x4e99, (q15_t)0x3e50,
+	(q15_t)0x4eca, (q15_t)0x3e45, (q15_t)0x4efb, (q15_t)0x3e39, (q15_t)0x4f2b, (q15_t)0x3e2d, (q15_t)0x4f5c, (q15_t)0x3e21,
+	(q15_t)0x4f8d, (q15_t)0x3e15, (q15_t)0x4fbe, (q15_t)0x3e09, (q15_t)0x4fee, (q15_t)0x3dfc, (q15_t)0x501f, (q15_t)0x3df0,
+	(q15_t)0x5050, (q15_t)0x3de3, (q15_t)0x5080, (q15_t)0x3dd6, (q15_t)0x50b1, (q15_t)0x3dc9, (q15_t)0x50e1, (q15_t)0x3dbc,
+	(q15_t)0x5112, (q15_t)0x3daf, (q15_t)0x5142, (q15_t)0x3da1, (q15_t)0x5173, (q15_t)0x3d93, (q15_t)0x51a3, (q15_t)0x3d86,
+	(q15_t)0x51d3, (q15_t)0x3d78, (q15_t)0x5204, (q15_t)0x3d6a, (q15_t)0x5234, (q15_t)0x3d5b, (q15_t)0x5264, (q15_t)0x3d4d,
+	(q15_t)0x5294, (q15_t)0x3d3f, (q15_t)0x52c4, (q15_t)0x3d30, (q15_t)0x52f4, (q15_t)0x3d21, (q15_t)0x5324, (q15_t)0x3d12,
+	(q15_t)0x5354, (q15_t)0x3d03, (q15_t)0x5384, (q15_t)0x3cf4, (q15_t)0x53b4, (q15_t)0x3ce4, (q15_t)0x53e4, (q15_t)0x3cd5,
+	(q15_t)0x5413, (q15_t)0x3cc5, (q15_t)0x5443, (q15_t)0x3cb5, (q15_t)0x5473, (q15_t)0x3ca5, (q15_t)0x54a2, (q15_t)0x3c95,
+	(q15_t)0x54d2, (q15_t)0x3c85, (q15_t)0x5501, (q15_t)0x3c74, (q15_t)0x5531, (q15_t)0x3c64, (q15_t)0x5560, (q15_t)0x3c53,
+	(q15_t)0x5590, (q15_t)0x3c42, (q15_t)0x55bf, (q15_t)0x3c31, (q15_t)0x55ee, (q15_t)0x3c20, (q15_t)0x561d, (q15_t)0x3c0f,
+	(q15_t)0x564c, (q15_t)0x3bfd, (q15_t)0x567c, (q15_t)0x3bec, (q15_t)0x56ab, (q15_t)0x3bda, (q15_t)0x56da, (q15_t)0x3bc8,
+	(q15_t)0x5709, (q15_t)0x3bb6, (q15_t)0x5737, (q15_t)0x3ba4, (q15_t)0x5766, (q15_t)0x3b92, (q15_t)0x5795, (q15_t)0x3b7f,
+	(q15_t)0x57c4, (q15_t)0x3b6d, (q15_t)0x57f2, (q15_t)0x3b5a, (q15_t)0x5821, (q15_t)0x3b47, (q15_t)0x584f, (q15_t)0x3b34,
+	(q15_t)0x587e, (q15_t)0x3b21, (q15_t)0x58ac, (q15_t)0x3b0e, (q15_t)0x58db, (q15_t)0x3afa, (q15_t)0x5909, (q15_t)0x3ae6,
+	(q15_t)0x5937, (q15_t)0x3ad3, (q15_t)0x5965, (q15_t)0x3abf, (q15_t)0x5993, (q15_t)0x3aab, (q15_t)0x59c1, (q15_t)0x3a97,
+	(q15_t)0x59ef, (q15_t)0x3a82, (q15_t)0x5a1d, (q15_t)0x3a6e, (q15_t)0x5a4b, (q15_t)0x3a59, (q15_t)0x5a79, (q15_t)0x3a45,
+	(q15_t)0x5aa7, (q15_t)0x3a30, (q15_t)0x5ad4, (q15_t)0x3a1b, (q15_t)0x5b02, (q15_t)0x3a06, (q15_t)0x5b30, (q15_t)0x39f0,
+	(q15_t)0x5b5d, (q15_t)0x39db, (q15_t)0x5b8a, (q15_t)0x39c5, (q15_t)0x5bb8, (q15_t)0x39b0, (q15_t)0x5be5, (q15_t)0x399a,
+	(q15_t)0x5c12, (q15_t)0x3984, (q15_t)0x5c3f, (q15_t)0x396e, (q15_t)0x5c6c, (q15_t)0x3958, (q15_t)0x5c99, (q15_t)0x3941,
+	(q15_t)0x5cc6, (q15_t)0x392b, (q15_t)0x5cf3, (q15_t)0x3914, (q15_t)0x5d20, (q15_t)0x38fd, (q15_t)0x5d4d, (q15_t)0x38e6,
+	(q15_t)0x5d79, (q15_t)0x38cf, (q15_t)0x5da6, (q15_t)0x38b8, (q15_t)0x5dd3, (q15_t)0x38a1, (q15_t)0x5dff, (q15_t)0x3889,
+	(q15_t)0x5e2b, (q15_t)0x3871, (q15_t)0x5e58, (q15_t)0x385a, (q15_t)0x5e84, (q15_t)0x3842, (q15_t)0x5eb0, (q15_t)0x382a,
+	(q15_t)0x5edc, (q15_t)0x3812, (q15_t)0x5f08, (q15_t)0x37f9, (q15_t)0x5f34, (q15_t)0x37e1, (q15_t)0x5f60, (q15_t)0x37c8,
+	(q15_t)0x5f8c, (q15_t)0x37b0, (q15_t)0x5fb7, (q15_t)0x3797, (q15_t)0x5fe3, (q15_t)0x377e, (q15_t)0x600f, (q15_t)0x3765,
+	(q15_t)0x603a, (q15_t)0x374b, (q15_t)0x6065, (q15_t)0x3732, (q15_t)0x6091, (q15_t)0x3718, (q15_t)0x60bc, (q15_t)0x36ff,
+	(q15_t)0x60e7, (q15_t)0x36e5, (q15_t)0x6112, (q15_t)0x36cb, (q15_t)0x613d, (q15_t)0x36b1, (q15_t)0x6168, (q15_t)0x3697,
+	(q15_t)0x6193, (q15_t)0x367d, (q15_t)0x61be, (q15_t)0x3662, (q15_t)0x61e8, (q15_t)0x3648, (q15_t)0x6213, (q15_t)0x362d,
+	(q15_t)0x623d, (q15_t)0x3612, (q15_t)0x6268, (q15_t)0x35f7, (q15_t)0x6292, (q15_t)0x35dc, (q15_t)0x62bc, (q15_t)0x35c1,
+	(q15_t)0x62e7, (q15_t)0x35a5, (q15_t)0x6311, (q15_t)0x358a, (q15_t)0x633b, (q15_t)0x356e, (q15_t)0x6365, (q15_t)0x3553,
+	(q15_t)0x638e, (q15_t)0x3537, (q15_t)0x63b8, (q15_t)0x351b, (q15_t)0x63e2, (q15_t)0x34ff, (q15_t)0x640b, (q15_t)0x34e2,
+	(q15_t)0x6435, (q15_t)0x34c6, (q15_t)0x645e, (q15_t)0x34aa, (q15_t)0x6488, (q15_t)0x348d, (q15_t)0x64b1, (q15_t)0x3470,
+	(q15_t)0x64da, (q15_t)0x3453, (q15_t)0x6503, (q15_t)0x3436, (q15_t)0x652c, (q15_t)0x3419, (q15_t)0x6555, (q15_t)0x33fc,
+	(q15_t)0x657e, (q15_t)0x33df, (q15_t)0x65a6, (q15_t)0x33c1, (q15_t)0x65cf, (q15_t)0x33a3, (q15_t)0x65f8, (q15_t)0x3386,
+	(q15_t)0x6620, (q15_t)0x3368, (q15_t)0x6648, (q15_t)0x334a, (q15_t)0x6671, (q15_t)0x332c, (q15_t)0x6699, (q15_t)0x330d,
+	(q15_t)0x66c1, (q15_t)0x32ef, (q15_t)0x66e9, (q15_t)0x32d0, (q15_t)0x6711, (q15_t)0x32b2, (q15_t)0x6738, (q15_t)0x3293,
+	(q15_t)0x6760, (q15_t)0x3274, (q15_t)0x6788, (q15_t)0x3255, (q15_t)0x67af, (q15_t)0x3236, (q15_t)0x67d6, (q15_t)0x3217,
+	(q15_t)0x67fe, (q15_t)0x31f8, (q15_t)0x6825, (q15_t)0x31d8, (q15_t)0x684c, (q15_t)0x31b9, (q15_t)0x6873, (q15_t)0x3199,
+	(q15_t)0x689a, (q15_t)0x3179, (q15_t)0x68c1, (q15_t)0x3159, (q15_t)0x68e7, (q15_t)0x3139, (q15_t)0x690e, (q15_t)0x3119,
+	(q15_t)0x6935, (q15_t)0x30f9, (q15_t)0x695b, (q15_t)0x30d8, (q15_t)0x6981, (q15_t)0x30b8, (q15_t)0x69a7, (q15_t)0x3097,
+	(q15_t)0x69ce, (q15_t)0x3076, (q15_t)0x69f4, (q15_t)0x3055, (q15_t)0x6a1a, (q15_t)0x3034, (q15_t)0x6a3f, (q15_t)0x3013,
+	(q15_t)0x6a65, (q15_t)0x2ff2, (q15_t)0x6a8b, (q15_t)0x2fd0, (q15_t)0x6ab0, (q15_t)0x2faf, (q15_t)0x6ad6, (q15_t)0x2f8d,
+	(q15_t)0x6afb, (q15_t)0x2f6c, (q15_t)0x6b20, (q15_t)0x2f4a, (q15_t)0x6b45, (q15_t)0x2f28, (q15_t)0x6b6a, (q15_t)0x2f06,
+	(q15_t)0x6b8f, (q15_t)0x2ee4, (q15_t)0x6bb4, (q15_t)0x2ec2, (q15_t)0x6bd8, (q15_t)0x2e9f, (q15_t)0x6bfd, (q15_t)0x2e7d,
+	(q15_t)0x6c21, (q15_t)0x2e5a, (q15_t)0x6c46, (q15_t)0x2e37, (q15_t)0x6c6a, (q15_t)0x2e15, (q15_t)0x6c8e, (q15_t)0x2df2,
+	(q15_t)0x6cb2, (q15_t)0x2dcf, (q15_t)0x6cd6, (q15_t)0x2dab, (q15_t)0x6cfa, (q15_t)0x2d88, (q15_t)0x6d1e, (q15_t)0x2d65,
+	(q15_t)0x6d41, (q15_t)0x2d41, (q15_t)0x6d65, (q15_t)0x2d1e, (q15_t)0x6d88, (q15_t)0x2cfa, (q15_t)0x6dab, (q15_t)0x2cd6,
+	(q15_t)0x6dcf, (q15_t)0x2cb2, (q15_t)0x6df2, (q15_t)0x2c8e, (q15_t)0x6e15, (q15_t)0x2c6a, (q15_t)0x6e37, (q15_t)0x2c46,
+	(q15_t)0x6e5a, (q15_t)0x2c21, (q15_t)0x6e7d, (q15_t)0x2bfd, (q15_t)0x6e9f, (q15_t)0x2bd8, (q15_t)0x6ec2, (q15_t)0x2bb4,
+	(q15_t)0x6ee4, (q15_t)0x2b8f, (q15_t)0x6f06, (q15_t)0x2b6a, (q15_t)0x6f28, (q15_t)0x2b45, (q15_t)0x6f4a, (q15_t)0x2b20,
+	(q15_t)0x6f6c, (q15_t)0x2afb, (q15_t)0x6f8d, (q15_t)0x2ad6, (q15_t)0x6faf, (q15_t)0x2ab0, (q15_t)0x6fd0, (q15_t)0x2a8b,
+	(q15_t)0x6ff2, (q15_t)0x2a65, (q15_t)0x7013, (q15_t)0x2a3f, (q15_t)0x7034, (q15_t)0x2a1a, (q15_t)0x7055, (q15_t)0x29f4,
+	(q15_t)0x7076, (q15_t)0x29ce, (q15_t)0x7097, (q15_t)0x29a7, (q15_t)0x70b8, (q15_t)0x2981, (q15_t)0x70d8, (q15_t)0x295b,
+	(q15_t)0x70f9, (q15_t)0x2935, (q15_t)0x7119, (q15_t)0x290e, (q15_t)0x7139, (q15_t)0x28e7, (q15_t)0x7159, (q15_t)0x28c1,
+	(q15_t)0x7179, (q15_t)0x289a, (q15_t)0x7199, (q15_t)0x2873, (q15_t)0x71b9, (q15_t)0x284c, (q15_t)0x71d8, (q15_t)0x2825,
+	(q15_t)0x71f8, (q15_t)0x27fe, (q15_t)0x7217, (q15_t)0x27d6, (q15_t)0x7236, (q15_t)0x27af, (q15_t)0x7255, (q15_t)0x2788,
+	(q15_t)0x7274, (q15_t)0x2760, (q15_t)0x7293, (q15_t)0x2738, (q15_t)0x72b2, (q15_t)0x2711, (q15_t)0x72d0, (q15_t)0x26e9,
+	(q15_t)0x72ef, (q15_t)0x26c1, (q15_t)0x730d, (q15_t)0x2699, (q15_t)0x732c, (q15_t)0x2671, (q15_t)0x734a, (q15_t)0x2648,
+	(q15_t)0x7368, (q15_t)0x2620, (q15_t)0x7386, (q15_t)0x25f8, (q15_t)0x73a3, (q15_t)0x25cf, (q15_t)0x73c1, (q15_t)0x25a6,
+	(q15_t)0x73df, (q15_t)0x257e, (q15_t)0x73fc, (q15_t)0x2555, (q15_t)0x7419, (q15_t)0x252c, (q15_t)0x7436, (q15_t)0x2503,
+	(q15_t)0x7453, (q15_t)0x24da, (q15_t)0x7470, (q15_t)0x24b1, (q15_t)0x748d, (q15_t)0x2488, (q15_t)0x74aa, (q15_t)0x245e,
+	(q15_t)0x74c6, (q15_t)0x2435, (q15_t)0x74e2, (q15_t)0x240b, (q15_t)0x74ff, (q15_t)0x23e2, (q15_t)0x751b, (q15_t)0x23b8,
+	(q15_t)0x7537, (q15_t)0x238e, (q15_t)0x7553, (q15_t)0x2365, (q15_t)0x756e, (q15_t)0x233b, (q15_t)0x758a, (q15_t)0x2311,
+	(q15_t)0x75a5, (q15_t)0x22e7, (q15_t)0x75c1, (q15_t)0x22bc, (q15_t)0x75dc, (q15_t)0x2292, (q15_t)0x75f7, (q15_t)0x2268,
+	(q15_t)0x7612, (q15_t)0x223d, (q15_t)0x762d, (q15_t)0x2213, (q15_t)0x7648, (q15_t)0x21e8, (q15_t)0x7662, (q15_t)0x21be,
+	(q15_t)0x767d, (q15_t)0x2193, (q15_t)0x7697, (q15_t)0x2168, (q15_t)0x76b1, (q15_t)0x213d, (q15_t)0x76cb, (q15_t)0x2112,
+	(q15_t)0x76e5, (q15_t)0x20e7, (q15_t)0x76ff, (q15_t)0x20bc, (q15_t)0x7718, (q15_t)0x2091, (q15_t)0x7732, (q15_t)0x2065,
+	(q15_t)0x774b, (q15_t)0x203a, (q15_t)0x7765, (q15_t)0x200f, (q15_t)0x777e, (q15_t)0x1fe3, (q15_t)0x7797, (q15_t)0x1fb7,
+	(q15_t)0x77b0, (q15_t)0x1f8c, (q15_t)0x77c8, (q15_t)0x1f60, (q15_t)0x77e1, (q15_t)0x1f34, (q15_t)0x77f9, (q15_t)0x1f08,
+	(q15_t)0x7812, (q15_t)0x1edc, (q15_t)0x782a, (q15_t)0x1eb0, (q15_t)0x7842, (q15_t)0x1e84, (q15_t)0x785a, (q15_t)0x1e58,
+	(q15_t)0x7871, (q15_t)0x1e2b, (q15_t)0x7889, (q15_t)0x1dff, (q15_t)0x78a1, (q15_t)0x1dd3, (q15_t)0x78b8, (q15_t)0x1da6,
+	(q15_t)0x78cf, (q15_t)0x1d79, (q15_t)0x78e6, (q15_t)0x1d4d, (q15_t)0x78fd, (q15_t)0x1d20, (q15_t)0x7914, (q15_t)0x1cf3,
+	(q15_t)0x792b, (q15_t)0x1cc6, (q15_t)0x7941, (q15_t)0x1c99, (q15_t)0x7958, (q15_t)0x1c6c, (q15_t)0x796e, (q15_t)0x1c3f,
+	(q15_t)0x7984, (q15_t)0x1c12, (q15_t)0x799a, (q15_t)0x1be5, (q15_t)0x79b0, (q15_t)0x1bb8, (q15_t)0x79c5, (q15_t)0x1b8a,
+	(q15_t)0x79db, (q15_t)0x1b5d, (q15_t)0x79f0, (q15_t)0x1b30, (q15_t)0x7a06, (q15_t)0x1b02, (q15_t)0x7a1b, (q15_t)0x1ad4,
+	(q15_t)0x7a30, (q15_t)0x1aa7, (q15_t)0x7a45, (q15_t)0x1a79, (q15_t)0x7a59, (q15_t)0x1a4b, (q15_t)0x7a6e, (q15_t)0x1a1d,
+	(q15_t)0x7a82, (q15_t)0x19ef, (q15_t)0x7a97, (q15_t)0x19c1, (q15_t)0x7aab, (q15_t)0x1993, (q15_t)0x7abf, (q15_t)0x1965,
+	(q15_t)0x7ad3, (q15_t)0x1937, (q15_t)0x7ae6, (q15_t)0x1909, (q15_t)0x7afa, (q15_t)0x18db, (q15_t)0x7b0e, (q15_t)0x18ac,
+	(q15_t)0x7b21, (q15_t)0x187e, (q15_t)0x7b34, (q15_t)0x184f, (q15_t)0x7b47, (q15_t)0x1821, (q15_t)0x7b5a, (q15_t)0x17f2,
+	(q15_t)0x7b6d, (q15_t)0x17c4, (q15_t)0x7b7f, (q15_t)0x1795, (q15_t)0x7b92, (q15_t)0x1766, (q15_t)0x7ba4, (q15_t)0x1737,
+	(q15_t)0x7bb6, (q15_t)0x1709, (q15_t)0x7bc8, (q15_t)0x16da, (q15_t)0x7bda, (q15_t)0x16ab, (q15_t)0x7bec, (q15_t)0x167c,
+	(q15_t)0x7bfd, (q15_t)0x164c, (q15_t)0x7c0f, (q15_t)0x161d, (q15_t)0x7c20, (q15_t)0x15ee, (q15_t)0x7c31, (q15_t)0x15bf,
+	(q15_t)0x7c42, (q15_t)0x1590, (q15_t)0x7c53, (q15_t)0x1560, (q15_t)0x7c64, (q15_t)0x1531, (q15_t)0x7c74, (q15_t)0x1501,
+	(q15_t)0x7c85, (q15_t)0x14d2, (q15_t)0x7c95, (q15_t)0x14a2, (q15_t)0x7ca5, (q15_t)0x1473, (q15_t)0x7cb5, (q15_t)0x1443,
+	(q15_t)0x7cc5, (q15_t)0x1413, (q15_t)0x7cd5, (q15_t)0x13e4, (q15_t)0x7ce4, (q15_t)0x13b4, (q15_t)0x7cf4, (q15_t)0x1384,
+	(q15_t)0x7d03, (q15_t)0x1354, (q15_t)0x7d12, (q15_t)0x1324, (q15_t)0x7d21, (q15_t)0x12f4, (q15_t)0x7d30, (q15_t)0x12c4,
+	(q15_t)0x7d3f, (q15_t)0x1294, (q15_t)0x7d4d, (q15_t)0x1264, (q15_t)0x7d5b, (q15_t)0x1234, (q15_t)0x7d6a, (q15_t)0x1204,
+	(q15_t)0x7d78, (q15_t)0x11d3, (q15_t)0x7d86, (q15_t)0x11a3, (q15_t)0x7d93, (q15_t)0x1173, (q15_t)0x7da1, (q15_t)0x1142,
+	(q15_t)0x7daf, (q15_t)0x1112, (q15_t)0x7dbc, (q15_t)0x10e1, (q15_t)0x7dc9, (q15_t)0x10b1, (q15_t)0x7dd6, (q15_t)0x1080,
+	(q15_t)0x7de3, (q15_t)0x1050, (q15_t)0x7df0, (q15_t)0x101f, (q15_t)0x7dfc, (q15_t)0x0fee, (q15_t)0x7e09, (q15_t)0x0fbe,
+	(q15_t)0x7e15, (q15_t)0x0f8d, (q15_t)0x7e21, (q15_t)0x0f5c, (q15_t)0x7e2d, (q15_t)0x0f2b, (q15_t)0x7e39, (q15_t)0x0efb,
+	(q15_t)0x7e45, (q15_t)0x0eca, (q15_t)0x7e50, (q15_t)0x0e99, (q15_t)0x7e5c, (q15_t)0x0e68, (q15_t)0x7e67, (q15_t)0x0e37,
+	(q15_t)0x7e72, (q15_t)0x0e06, (q15_t)0x7e7d, (q15_t)0x0dd5, (q15_t)0x7e88, (q15_t)0x0da4, (q15_t)0x7e92, (q15_t)0x0d72,
+	(q15_t)0x7e9d, (q15_t)0x0d41, (q15_t)0x7ea7, (q15_t)0x0d10, (q15_t)0x7eb1, (q15_t)0x0cdf, (q15_t)0x7ebb, (q15_t)0x0cae,
+	(q15_t)0x7ec5, (q15_t)0x0c7c, (q15_t)0x7ecf, (q15_t)0x0c4b, (q15_t)0x7ed8, (q15_t)0x0c1a, (q15_t)0x7ee2, (q15_t)0x0be8,
+	(q15_t)0x7eeb, (q15_t)0x0bb7, (q15_t)0x7ef4, (q15_t)0x0b85, (q15_t)0x7efd, (q15_t)0x0b54, (q15_t)0x7f06, (q15_t)0x0b23,
+	(q15_t)0x7f0f, (q15_t)0x0af1, (q15_t)0x7f17, (q15_t)0x0ac0, (q15_t)0x7f20, (q15_t)0x0a8e, (q15_t)0x7f28, (q15_t)0x0a5c,
+	(q15_t)0x7f30, (q15_t)0x0a2b, (q15_t)0x7f38, (q15_t)0x09f9, (q15_t)0x7f40, (q15_t)0x09c7, (q15_t)0x7f47, (q15_t)0x0996,
+	(q15_t)0x7f4f, (q15_t)0x0964, (q15_t)0x7f56, (q15_t)0x0932, (q15_t)0x7f5d, (q15_t)0x0901, (q15_t)0x7f64, (q15_t)0x08cf,
+	(q15_t)0x7f6b, (q15_t)0x089d, (q15_t)0x7f72, (q15_t)0x086b, (q15_t)0x7f78, (q15_t)0x0839, (q15_t)0x7f7f, (q15_t)0x0807,
+	(q15_t)0x7f85, (q15_t)0x07d6, (q15_t)0x7f8b, (q15_t)0x07a4, (q15_t)0x7f91, (q15_t)0x0772, (q15_t)0x7f97, (q15_t)0x0740,
+	(q15_t)0x7f9c, (q15_t)0x070e, (q15_t)0x7fa2, (q15_t)0x06dc, (q15_t)0x7fa7, (q15_t)0x06aa, (q15_t)0x7fac, (q15_t)0x0678,
+	(q15_t)0x7fb1, (q15_t)0x0646, (q15_t)0x7fb6, (q15_t)0x0614, (q15_t)0x7fbb, (q15_t)0x05e2, (q15_t)0x7fbf, (q15_t)0x05b0,
+	(q15_t)0x7fc4, (q15_t)0x057e, (q15_t)0x7fc8, (q15_t)0x054c, (q15_t)0x7fcc, (q15_t)0x051a, (q15_t)0x7fd0, (q15_t)0x04e7,
+	(q15_t)0x7fd4, (q15_t)0x04b5, (q15_t)0x7fd7, (q15_t)0x0483, (q15_t)0x7fdb, (q15_t)0x0451, (q15_t)0x7fde, (q15_t)0x041f,
+	(q15_t)0x7fe1, (q15_t)0x03ed, (q15_t)0x7fe4, (q15_t)0x03bb, (q15_t)0x7fe7, (q15_t)0x0388, (q15_t)0x7fea, (q15_t)0x0356,
+	(q15_t)0x7fec, (q15_t)0x0324, (q15_t)0x7fef, (q15_t)0x02f2, (q15_t)0x7ff1, (q15_t)0x02c0, (q15_t)0x7ff3, (q15_t)0x028d,
+	(q15_t)0x7ff5, (q15_t)0x025b, (q15_t)0x7ff7, (q15_t)0x0229, (q15_t)0x7ff8, (q15_t)0x01f7, (q15_t)0x7ffa, (q15_t)0x01c4,
+	(q15_t)0x7ffb, (q15_t)0x0192, (q15_t)0x7ffc, (q15_t)0x0160, (q15_t)0x7ffd, (q15_t)0x012e, (q15_t)0x7ffe, (q15_t)0x00fb,
+	(q15_t)0x7fff, (q15_t)0x00c9, (q15_t)0x7fff, (q15_t)0x0097, (q15_t)0x7fff, (q15_t)0x0065, (q15_t)0x7fff, (q15_t)0x0032,
+	(q15_t)0x7fff, (q15_t)0x0000, (q15_t)0x7fff, (q15_t)0xffce, (q15_t)0x7fff, (q15_t)0xff9b, (q15_t)0x7fff, (q15_t)0xff69,
+	(q15_t)0x7fff, (q15_t)0xff37, (q15_t)0x7ffe, (q15_t)0xff05, (q15_t)0x7ffd, (q15_t)0xfed2, (q15_t)0x7ffc, (q15_t)0xfea0,
+	(q15_t)0x7ffb, (q15_t)0xfe6e, (q15_t)0x7ffa, (q15_t)0xfe3c, (q15_t)0x7ff8, (q15_t)0xfe09, (q15_t)0x7ff7, (q15_t)0xfdd7,
+	(q15_t)0x7ff5, (q15_t)0xfda5, (q15_t)0x7ff3, (q15_t)0xfd73, (q15_t)0x7ff1, (q15_t)0xfd40, (q15_t)0x7fef, (q15_t)0xfd0e,
+	(q15_t)0x7fec, (q15_t)0xfcdc, (q15_t)0x7fea, (q15_t)0xfcaa, (q15_t)0x7fe7, (q15_t)0xfc78, (q15_t)0x7fe4, (q15_t)0xfc45,
+	(q15_t)0x7fe1, (q15_t)0xfc13, (q15_t)0x7fde, (q15_t)0xfbe1, (q15_t)0x7fdb, (q15_t)0xfbaf, (q15_t)0x7fd7, (q15_t)0xfb7d,
+	(q15_t)0x7fd4, (q15_t)0xfb4b, (q15_t)0x7fd0, (q15_t)0xfb19, (q15_t)0x7fcc, (q15_t)0xfae6, (q15_t)0x7fc8, (q15_t)0xfab4,
+	(q15_t)0x7fc4, (q15_t)0xfa82, (q15_t)0x7fbf, (q15_t)0xfa50, (q15_t)0x7fbb, (q15_t)0xfa1e, (q15_t)0x7fb6, (q15_t)0xf9ec,
+	(q15_t)0x7fb1, (q15_t)0xf9ba, (q15_t)0x7fac, (q15_t)0xf988, (q15_t)0x7fa7, (q15_t)0xf956, (q15_t)0x7fa2, (q15_t)0xf924,
+	(q15_t)0x7f9c, (q15_t)0xf8f2, (q15_t)0x7f97, (q15_t)0xf8c0, (q15_t)0x7f91, (q15_t)0xf88e, (q15_t)0x7f8b, (q15_t)0xf85c,
+	(q15_t)0x7f85, (q15_t)0xf82a, (q15_t)0x7f7f, (q15_t)0xf7f9, (q15_t)0x7f78, (q15_t)0xf7c7, (q15_t)0x7f72, (q15_t)0xf795,
+	(q15_t)0x7f6b, (q15_t)0xf763, (q15_t)0x7f64, (q15_t)0xf731, (q15_t)0x7f5d, (q15_t)0xf6ff, (q15_t)0x7f56, (q15_t)0xf6ce,
+	(q15_t)0x7f4f, (q15_t)0xf69c, (q15_t)0x7f47, (q15_t)0xf66a, (q15_t)0x7f40, (q15_t)0xf639, (q15_t)0x7f38, (q15_t)0xf607,
+	(q15_t)0x7f30, (q15_t)0xf5d5, (q15_t)0x7f28, (q15_t)0xf5a4, (q15_t)0x7f20, (q15_t)0xf572, (q15_t)0x7f17, (q15_t)0xf540,
+	(q15_t)0x7f0f, (q15_t)0xf50f, (q15_t)0x7f06, (q15_t)0xf4dd, (q15_t)0x7efd, (q15_t)0xf4ac, (q15_t)0x7ef4, (q15_t)0xf47b,
+	(q15_t)0x7eeb, (q15_t)0xf449, (q15_t)0x7ee2, (q15_t)0xf418, (q15_t)0x7ed8, (q15_t)0xf3e6, (q15_t)0x7ecf, (q15_t)0xf3b5,
+	(q15_t)0x7ec5, (q15_t)0xf384, (q15_t)0x7ebb, (q15_t)0xf352, (q15_t)0x7eb1, (q15_t)0xf321, (q15_t)0x7ea7, (q15_t)0xf2f0,
+	(q15_t)0x7e9d, (q15_t)0xf2bf, (q15_t)0x7e92, (q15_t)0xf28e, (q15_t)0x7e88, (q15_t)0xf25c, (q15_t)0x7e7d, (q15_t)0xf22b,
+	(q15_t)0x7e72, (q15_t)0xf1fa, (q15_t)0x7e67, (q15_t)0xf1c9, (q15_t)0x7e5c, (q15_t)0xf198, (q15_t)0x7e50, (q15_t)0xf167,
+	(q15_t)0x7e45, (q15_t)0xf136, (q15_t)0x7e39, (q15_t)0xf105, (q15_t)0x7e2d, (q15_t)0xf0d5, (q15_t)0x7e21, (q15_t)0xf0a4,
+	(q15_t)0x7e15, (q15_t)0xf073, (q15_t)0x7e09, (q15_t)0xf042, (q15_t)0x7dfc, (q15_t)0xf012, (q15_t)0x7df0, (q15_t)0xefe1,
+	(q15_t)0x7de3, (q15_t)0xefb0, (q15_t)0x7dd6, (q15_t)0xef80, (q15_t)0x7dc9, (q15_t)0xef4f, (q15_t)0x7dbc, (q15_t)0xef1f,
+	(q15_t)0x7daf, (q15_t)0xeeee, (q15_t)0x7da1, (q15_t)0xeebe, (q15_t)0x7d93, (q15_t)0xee8d, (q15_t)0x7d86, (q15_t)0xee5d,
+	(q15_t)0x7d78, (q15_t)0xee2d, (q15_t)0x7d6a, (q15_t)0xedfc, (q15_t)0x7d5b, (q15_t)0xedcc, (q15_t)0x7d4d, (q15_t)0xed9c,
+	(q15_t)0x7d3f, (q15_t)0xed6c, (q15_t)0x7d30, (q15_t)0xed3c, (q15_t)0x7d21, (q15_t)0xed0c, (q15_t)0x7d12, (q15_t)0xecdc,
+	(q15_t)0x7d03, (q15_t)0xecac, (q15_t)0x7cf4, (q15_t)0xec7c, (q15_t)0x7ce4, (q15_t)0xec4c, (q15_t)0x7cd5, (q15_t)0xec1c,
+	(q15_t)0x7cc5, (q15_t)0xebed, (q15_t)0x7cb5, (q15_t)0xebbd, (q15_t)0x7ca5, (q15_t)0xeb8d, (q15_t)0x7c95, (q15_t)0xeb5e,
+	(q15_t)0x7c85, (q15_t)0xeb2e, (q15_t)0x7c74, (q15_t)0xeaff, (q15_t)0x7c64, (q15_t)0xeacf, (q15_t)0x7c53, (q15_t)0xeaa0,
+	(q15_t)0x7c42, (q15_t)0xea70, (q15_t)0x7c31, (q15_t)0xea41, (q15_t)0x7c20, (q15_t)0xea12, (q15_t)0x7c0f, (q15_t)0xe9e3,
+	(q15_t)0x7bfd, (q15_t)0xe9b4, (q15_t)0x7bec, (q15_t)0xe984, (q15_t)0x7bda, (q15_t)0xe955, (q15_t)0x7bc8, (q15_t)0xe926,
+	(q15_t)0x7bb6, (q15_t)0xe8f7, (q15_t)0x7ba4, (q15_t)0xe8c9, (q15_t)0x7b92, (q15_t)0xe89a, (q15_t)0x7b7f, (q15_t)0xe86b,
+	(q15_t)0x7b6d, (q15_t)0xe83c, (q15_t)0x7b5a, (q15_t)0xe80e, (q15_t)0x7b47, (q15_t)0xe7df, (q15_t)0x7b34, (q15_t)0xe7b1,
+	(q15_t)0x7b21, (q15_t)0xe782, (q15_t)0x7b0e, (q15_t)0xe754, (q15_t)0x7afa, (q15_t)0xe725, (q15_t)0x7ae6, (q15_t)0xe6f7,
+	(q15_t)0x7ad3, (q15_t)0xe6c9, (q15_t)0x7abf, (q15_t)0xe69b, (q15_t)0x7aab, (q15_t)0xe66d, (q15_t)0x7a97, (q15_t)0xe63f,
+	(q15_t)0x7a82, (q15_t)0xe611, (q15_t)0x7a6e, (q15_t)0xe5e3, (q15_t)0x7a59, (q15_t)0xe5b5, (q15_t)0x7a45, (q15_t)0xe587,
+	(q15_t)0x7a30, (q15_t)0xe559, (q15_t)0x7a1b, (q15_t)0xe52c, (q15_t)0x7a06, (q15_t)0xe4fe, (q15_t)0x79f0, (q15_t)0xe4d0,
+	(q15_t)0x79db, (q15_t)0xe4a3, (q15_t)0x79c5, (q15_t)0xe476, (q15_t)0x79b0, (q15_t)0xe448, (q15_t)0x799a, (q15_t)0xe41b,
+	(q15_t)0x7984, (q15_t)0xe3ee, (q15_t)0x796e, (q15_t)0xe3c1, (q15_t)0x7958, (q15_t)0xe394, (q15_t)0x7941, (q15_t)0xe367,
+	(q15_t)0x792b, (q15_t)0xe33a, (q15_t)0x7914, (q15_t)0xe30d, (q15_t)0x78fd, (q15_t)0xe2e0, (q15_t)0x78e6, (q15_t)0xe2b3,
+	(q15_t)0x78cf, (q15_t)0xe287, (q15_t)0x78b8, (q15_t)0xe25a, (q15_t)0x78a1, (q15_t)0xe22d, (q15_t)0x7889, (q15_t)0xe201,
+	(q15_t)0x7871, (q15_t)0xe1d5, (q15_t)0x785a, (q15_t)0xe1a8, (q15_t)0x7842, (q15_t)0xe17c, (q15_t)0x782a, (q15_t)0xe150,
+	(q15_t)0x7812, (q15_t)0xe124, (q15_t)0x77f9, (q15_t)0xe0f8, (q15_t)0x77e1, (q15_t)0xe0cc, (q15_t)0x77c8, (q15_t)0xe0a0,
+	(q15_t)0x77b0, (q15_t)0xe074, (q15_t)0x7797, (q15_t)0xe049, (q15_t)0x777e, (q15_t)0xe01d, (q15_t)0x7765, (q15_t)0xdff1,
+	(q15_t)0x774b, (q15_t)0xdfc6, (q15_t)0x7732, (q15_t)0xdf9b, (q15_t)0x7718, (q15_t)0xdf6f, (q15_t)0x76ff, (q15_t)0xdf44,
+	(q15_t)0x76e5, (q15_t)0xdf19, (q15_t)0x76cb, (q15_t)0xdeee, (q15_t)0x76b1, (q15_t)0xdec3, (q15_t)0x7697, (q15_t)0xde98,
+	(q15_t)0x767d, (q15_t)0xde6d, (q15_t)0x7662, (q15_t)0xde42, (q15_t)0x7648, (q15_t)0xde18, (q15_t)0x762d, (q15_t)0xdded,
+	(q15_t)0x7612, (q15_t)0xddc3, (q15_t)0x75f7, (q15_t)0xdd98, (q15_t)0x75dc, (q15_t)0xdd6e, (q15_t)0x75c1, (q15_t)0xdd44,
+	(q15_t)0x75a5, (q15_t)0xdd19, (q15_t)0x758a, (q15_t)0xdcef, (q15_t)0x756e, (q15_t)0xdcc5, (q15_t)0x7553, (q15_t)0xdc9b,
+	(q15_t)0x7537, (q15_t)0xdc72, (q15_t)0x751b, (q15_t)0xdc48, (q15_t)0x74ff, (q15_t)0xdc1e, (q15_t)0x74e2, (q15_t)0xdbf5,
+	(q15_t)0x74c6, (q15_t)0xdbcb, (q15_t)0x74aa, (q15_t)0xdba2, (q15_t)0x748d, (q15_t)0xdb78, (q15_t)0x7470, (q15_t)0xdb4f,
+	(q15_t)0x7453, (q15_t)0xdb26, (q15_t)0x7436, (q15_t)0xdafd, (q15_t)0x7419, (q15_t)0xdad4, (q15_t)0x73fc, (q15_t)0xdaab,
+	(q15_t)0x73df, (q15_t)0xda82, (q15_t)0x73c1, (q15_t)0xda5a, (q15_t)0x73a3, (q15_t)0xda31, (q15_t)0x7386, (q15_t)0xda08,
+	(q15_t)0x7368, (q15_t)0xd9e0, (q15_t)0x734a, (q15_t)0xd9b8, (q15_t)0x732c, (q15_t)0xd98f, (q15_t)0x730d, (q15_t)0xd967,
+	(q15_t)0x72ef, (q15_t)0xd93f, (q15_t)0x72d0, (q15_t)0xd917, (q15_t)0x72b2, (q15_t)0xd8ef, (q15_t)0x7293, (q15_t)0xd8c8,
+	(q15_t)0x7274, (q15_t)0xd8a0, (q15_t)0x7255, (q15_t)0xd878, (q15_t)0x7236, (q15_t)0xd851, (q15_t)0x7217, (q15_t)0xd82a,
+	(q15_t)0x71f8, (q15_t)0xd802, (q15_t)0x71d8, (q15_t)0xd7db, (q15_t)0x71b9, (q15_t)0xd7b4, (q15_t)0x7199, (q15_t)0xd78d,
+	(q15_t)0x7179, (q15_t)0xd766, (q15_t)0x7159, (q15_t)0xd73f, (q15_t)0x7139, (q15_t)0xd719, (q15_t)0x7119, (q15_t)0xd6f2,
+	(q15_t)0x70f9, (q15_t)0xd6cb, (q15_t)0x70d8, (q15_t)0xd6a5, (q15_t)0x70b8, (q15_t)0xd67f, (q15_t)0x7097, (q15_t)0xd659,
+	(q15_t)0x7076, (q15_t)0xd632, (q15_t)0x7055, (q15_t)0xd60c, (q15_t)0x7034, (q15_t)0xd5e6, (q15_t)0x7013, (q15_t)0xd5c1,
+	(q15_t)0x6ff2, (q15_t)0xd59b, (q15_t)0x6fd0, (q15_t)0xd575, (q15_t)0x6faf, (q15_t)0xd550, (q15_t)0x6f8d, (q15_t)0xd52a,
+	(q15_t)0x6f6c, (q15_t)0xd505, (q15_t)0x6f4a, (q15_t)0xd4e0, (q15_t)0x6f28, (q15_t)0xd4bb, (q15_t)0x6f06, (q15_t)0xd496,
+	(q15_t)0x6ee4, (q15_t)0xd471, (q15_t)0x6ec2, (q15_t)0xd44c, (q15_t)0x6e9f, (q15_t)0xd428, (q15_t)0x6e7d, (q15_t)0xd403,
+	(q15_t)0x6e5a, (q15_t)0xd3df, (q15_t)0x6e37, (q15_t)0xd3ba, (q15_t)0x6e15, (q15_t)0xd396, (q15_t)0x6df2, (q15_t)0xd372,
+	(q15_t)0x6dcf, (q15_t)0xd34e, (q15_t)0x6dab, (q15_t)0xd32a, (q15_t)0x6d88, (q15_t)0xd306, (q15_t)0x6d65, (q15_t)0xd2e2,
+	(q15_t)0x6d41, (q15_t)0xd2bf, (q15_t)0x6d1e, (q15_t)0xd29b, (q15_t)0x6cfa, (q15_t)0xd278, (q15_t)0x6cd6, (q15_t)0xd255,
+	(q15_t)0x6cb2, (q15_t)0xd231, (q15_t)0x6c8e, (q15_t)0xd20e, (q15_t)0x6c6a, (q15_t)0xd1eb, (q15_t)0x6c46, (q15_t)0xd1c9,
+	(q15_t)0x6c21, (q15_t)0xd1a6, (q15_t)0x6bfd, (q15_t)0xd183, (q15_t)0x6bd8, (q15_t)0xd161, (q15_t)0x6bb4, (q15_t)0xd13e,
+	(q15_t)0x6b8f, (q15_t)0xd11c, (q15_t)0x6b6a, (q15_t)0xd0fa, (q15_t)0x6b45, (q15_t)0xd0d8, (q15_t)0x6b20, (q15_t)0xd0b6,
+	(q15_t)0x6afb, (q15_t)0xd094, (q15_t)0x6ad6, (q15_t)0xd073, (q15_t)0x6ab0, (q15_t)0xd051, (q15_t)0x6a8b, (q15_t)0xd030,
+	(q15_t)0x6a65, (q15_t)0xd00e, (q15_t)0x6a3f, (q15_t)0xcfed, (q15_t)0x6a1a, (q15_t)0xcfcc, (q15_t)0x69f4, (q15_t)0xcfab,
+	(q15_t)0x69ce, (q15_t)0xcf8a, (q15_t)0x69a7, (q15_t)0xcf69, (q15_t)0x6981, (q15_t)0xcf48, (q15_t)0x695b, (q15_t)0xcf28,
+	(q15_t)0x6935, (q15_t)0xcf07, (q15_t)0x690e, (q15_t)0xcee7, (q15_t)0x68e7, (q15_t)0xcec7, (q15_t)0x68c1, (q15_t)0xcea7,
+	(q15_t)0x689a, (q15_t)0xce87, (q15_t)0x6873, (q15_t)0xce67, (q15_t)0x684c, (q15_t)0xce47, (q15_t)0x6825, (q15_t)0xce28,
+	(q15_t)0x67fe, (q15_t)0xce08, (q15_t)0x67d6, (q15_t)0xcde9, (q15_t)0x67af, (q15_t)0xcdca, (q15_t)0x6788, (q15_t)0xcdab,
+	(q15_t)0x6760, (q15_t)0xcd8c, (q15_t)0x6738, (q15_t)0xcd6d, (q15_t)0x6711, (q15_t)0xcd4e, (q15_t)0x66e9, (q15_t)0xcd30,
+	(q15_t)0x66c1, (q15_t)0xcd11, (q15_t)0x6699, (q15_t)0xccf3, (q15_t)0x6671, (q15_t)0xccd4, (q15_t)0x6648, (q15_t)0xccb6,
+	(q15_t)0x6620, (q15_t)0xcc98, (q15_t)0x65f8, (q15_t)0xcc7a, (q15_t)0x65cf, (q15_t)0xcc5d, (q15_t)0x65a6, (q15_t)0xcc3f,
+	(q15_t)0x657e, (q15_t)0xcc21, (q15_t)0x6555, (q15_t)0xcc04, (q15_t)0x652c, (q15_t)0xcbe7, (q15_t)0x6503, (q15_t)0xcbca,
+	(q15_t)0x64da, (q15_t)0xcbad, (q15_t)0x64b1, (q15_t)0xcb90, (q15_t)0x6488, (q15_t)0xcb73, (q15_t)0x645e, (q15_t)0xcb56,
+	(q15_t)0x6435, (q15_t)0xcb3a, (q15_t)0x640b, (q15_t)0xcb1e, (q15_t)0x63e2, (q15_t)0xcb01, (q15_t)0x63b8, (q15_t)0xcae5,
+	(q15_t)0x638e, (q15_t)0xcac9, (q15_t)0x6365, (q15_t)0xcaad, (q15_t)0x633b, (q15_t)0xca92, (q15_t)0x6311, (q15_t)0xca76,
+	(q15_t)0x62e7, (q15_t)0xca5b, (q15_t)0x62bc, (q15_t)0xca3f, (q15_t)0x6292, (q15_t)0xca24, (q15_t)0x6268, (q15_t)0xca09,
+	(q15_t)0x623d, (q15_t)0xc9ee, (q15_t)0x6213, (q15_t)0xc9d3, (q15_t)0x61e8, (q15_t)0xc9b8, (q15_t)0x61be, (q15_t)0xc99e,
+	(q15_t)0x6193, (q15_t)0xc983, (q15_t)0x6168, (q15_t)0xc969, (q15_t)0x613d, (q15_t)0xc94f, (q15_t)0x6112, (q15_t)0xc935,
+	(q15_t)0x60e7, (q15_t)0xc91b, (q15_t)0x60bc, (q15_t)0xc901, (q15_t)0x6091, (q15_t)0xc8e8, (q15_t)0x6065, (q15_t)0xc8ce,
+	(q15_t)0x603a, (q15_t)0xc8b5, (q15_t)0x600f, (q15_t)0xc89b, (q15_t)0x5fe3, (q15_t)0xc882, (q15_t)0x5fb7, (q15_t)0xc869,
+	(q15_t)0x5f8c, (q15_t)0xc850, (q15_t)0x5f60, (q15_t)0xc838, (q15_t)0x5f34, (q15_t)0xc81f, (q15_t)0x5f08, (q15_t)0xc807,
+	(q15_t)0x5edc, (q15_t)0xc7ee, (q15_t)0x5eb0, (q15_t)0xc7d6, (q15_t)0x5e84, (q15_t)0xc7be, (q15_t)0x5e58, (q15_t)0xc7a6,
+	(q15_t)0x5e2b, (q15_t)0xc78f, (q15_t)0x5dff, (q15_t)0xc777, (q15_t)0x5dd3, (q15_t)0xc75f, (q15_t)0x5da6, (q15_t)0xc748,
+	(q15_t)0x5d79, (q15_t)0xc731, (q15_t)0x5d4d, (q15_t)0xc71a, (q15_t)0x5d20, (q15_t)0xc703, (q15_t)0x5cf3, (q15_t)0xc6ec,
+	(q15_t)0x5cc6, (q15_t)0xc6d5, (q15_t)0x5c99, (q15_t)0xc6bf, (q15_t)0x5c6c, (q15_t)0xc6a8, (q15_t)0x5c3f, (q15_t)0xc692,
+	(q15_t)0x5c12, (q15_t)0xc67c, (q15_t)0x5be5, (q15_t)0xc666, (q15_t)0x5bb8, (q15_t)0xc650, (q15_t)0x5b8a, (q15_t)0xc63b,
+	(q15_t)0x5b5d, (q15_t)0xc625, (q15_t)0x5b30, (q15_t)0xc610, (q15_t)0x5b02, (q15_t)0xc5fa, (q15_t)0x5ad4, (q15_t)0xc5e5,
+	(q15_t)0x5aa7, (q15_t)0xc5d0, (q15_t)0x5a79, (q15_t)0xc5bb, (q15_t)0x5a4b, (q15_t)0xc5a7, (q15_t)0x5a1d, (q15_t)0xc592,
+	(q15_t)0x59ef, (q15_t)0xc57e, (q15_t)0x59c1, (q15_t)0xc569, (q15_t)0x5993, (q15_t)0xc555, (q15_t)0x5965, (q15_t)0xc541,
+	(q15_t)0x5937, (q15_t)0xc52d, (q15_t)0x5909, (q15_t)0xc51a, (q15_t)0x58db, (q15_t)0xc506, (q15_t)0x58ac, (q15_t)0xc4f2,
+	(q15_t)0x587e, (q15_t)0xc4df, (q15_t)0x584f, (q15_t)0xc4cc, (q15_t)0x5821, (q15_t)0xc4b9, (q15_t)0x57f2, (q15_t)0xc4a6,
+	(q15_t)0x57c4, (q15_t)0xc493, (q15_t)0x5795, (q15_t)0xc481, (q15_t)0x5766, (q15_t)0xc46e, (q15_t)0x5737, (q15_t)0xc45c,
+	(q15_t)0x5709, (q15_t)0xc44a, (q15_t)0x56da, (q15_t)0xc438, (q15_t)0x56ab, (q15_t)0xc426, (q15_t)0x567c, (q15_t)0xc414,
+	(q15_t)0x564c, (q15_t)0xc403, (q15_t)0x561d, (q15_t)0xc3f1, (q15_t)0x55ee, (q15_t)0xc3e0, (q15_t)0x55bf, (q15_t)0xc3cf,
+	(q15_t)0x5590, (q15_t)0xc3be, (q15_t)0x5560, (q15_t)0xc3ad, (q15_t)0x5531, (q15_t)0xc39c, (q15_t)0x5501, (q15_t)0xc38c,
+	(q15_t)0x54d2, (q15_t)0xc37b, (q15_t)0x54a2, (q15_t)0xc36b, (q15_t)0x5473, (q15_t)0xc35b, (q15_t)0x5443, (q15_t)0xc34b,
+	(q15_t)0x5413, (q15_t)0xc33b, (q15_t)0x53e4, (q15_t)0xc32b, (q15_t)0x53b4, (q15_t)0xc31c, (q15_t)0x5384, (q15_t)0xc30c,
+	(q15_t)0x5354, (q15_t)0xc2fd, (q15_t)0x5324, (q15_t)0xc2ee, (q15_t)0x52f4, (q15_t)0xc2df, (q15_t)0x52c4, (q15_t)0xc2d0,
+	(q15_t)0x5294, (q15_t)0xc2c1, (q15_t)0x5264, (q15_t)0xc2b3, (q15_t)0x5234, (q15_t)0xc2a5, (q15_t)0x5204, (q15_t)0xc296,
+	(q15_t)0x51d3, (q15_t)0xc288, (q15_t)0x51a3, (q15_t)0xc27a, (q15_t)0x5173, (q15_t)0xc26d, (q15_t)0x5142, (q15_t)0xc25f,
+	(q15_t)0x5112, (q15_t)0xc251, (q15_t)0x50e1, (q15_t)0xc244, (q15_t)0x50b1, (q15_t)0xc237, (q15_t)0x5080, (q15_t)0xc22a,
+	(q15_t)0x5050, (q15_t)0xc21d, (q15_t)0x501f, (q15_t)0xc210, (q15_t)0x4fee, (q15_t)0xc204, (q15_t)0x4fbe, (q15_t)0xc1f7,
+	(q15_t)0x4f8d, (q15_t)0xc1eb, (q15_t)0x4f5c, (q15_t)0xc1df, (q15_t)0x4f2b, (q15_t)0xc1d3, (q15_t)0x4efb, (q15_t)0xc1c7,
+	(q15_t)0x4eca, (q15_t)0xc1bb, (q15_t)0x4e99, (q15_t)0xc1b0, (q15_t)0x4e68, (q15_t)0xc1a4, (q15_t)0x4e37, (q15_t)0xc199,
+	(q15_t)0x4e06, (q15_t)0xc18e, (q15_t)0x4dd5, (q15_t)0xc183, (q15_t)0x4da4, (q15_t)0xc178, (q15_t)0x4d72, (q15_t)0xc16e,
+	(q15_t)0x4d41, (q15_t)0xc163, (q15_t)0x4d10, (q15_t)0xc159, (q15_t)0x4cdf, (q15_t)0xc14f, (q15_t)0x4cae, (q15_t)0xc145,
+	(q15_t)0x4c7c, (q15_t)0xc13b, (q15_t)0x4c4b, (q15_t)0xc131, (q15_t)0x4c1a, (q15_t)0xc128, (q15_t)0x4be8, (q15_t)0xc11e,
+	(q15_t)0x4bb7, (q15_t)0xc115, (q15_t)0x4b85, (q15_t)0xc10c, (q15_t)0x4b54, (q15_t)0xc103, (q15_t)0x4b23, (q15_t)0xc0fa,
+	(q15_t)0x4af1, (q15_t)0xc0f1, (q15_t)0x4ac0, (q15_t)0xc0e9, (q15_t)0x4a8e, (q15_t)0xc0e0, (q15_t)0x4a5c, (q15_t)0xc0d8,
+	(q15_t)0x4a2b, (q15_t)0xc0d0, (q15_t)0x49f9, (q15_t)0xc0c8, (q15_t)0x49c7, (q15_t)0xc0c0, (q15_t)0x4996, (q15_t)0xc0b9,
+	(q15_t)0x4964, (q15_t)0xc0b1, (q15_t)0x4932, (q15_t)0xc0aa, (q15_t)0x4901, (q15_t)0xc0a3, (q15_t)0x48cf, (q15_t)0xc09c,
+	(q15_t)0x489d, (q15_t)0xc095, (q15_t)0x486b, (q15_t)0xc08e, (q15_t)0x4839, (q15_t)0xc088, (q15_t)0x4807, (q15_t)0xc081,
+	(q15_t)0x47d6, (q15_t)0xc07b, (q15_t)0x47a4, (q15_t)0xc075, (q15_t)0x4772, (q15_t)0xc06f, (q15_t)0x4740, (q15_t)0xc069,
+	(q15_t)0x470e, (q15_t)0xc064, (q15_t)0x46dc, (q15_t)0xc05e, (q15_t)0x46aa, (q15_t)0xc059, (q15_t)0x4678, (q15_t)0xc054,
+	(q15_t)0x4646, (q15_t)0xc04f, (q15_t)0x4614, (q15_t)0xc04a, (q15_t)0x45e2, (q15_t)0xc045, (q15_t)0x45b0, (q15_t)0xc041,
+	(q15_t)0x457e, (q15_t)0xc03c, (q15_t)0x454c, (q15_t)0xc038, (q15_t)0x451a, (q15_t)0xc034, (q15_t)0x44e7, (q15_t)0xc030,
+	(q15_t)0x44b5, (q15_t)0xc02c, (q15_t)0x4483, (q15_t)0xc029, (q15_t)0x4451, (q15_t)0xc025, (q15_t)0x441f, (q15_t)0xc022,
+	(q15_t)0x43ed, (q15_t)0xc01f, (q15_t)0x43bb, (q15_t)0xc01c, (q15_t)0x4388, (q15_t)0xc019, (q15_t)0x4356, (q15_t)0xc016,
+	(q15_t)0x4324, (q15_t)0xc014, (q15_t)0x42f2, (q15_t)0xc011, (q15_t)0x42c0, (q15_t)0xc00f, (q15_t)0x428d, (q15_t)0xc00d,
+	(q15_t)0x425b, (q15_t)0xc00b, (q15_t)0x4229, (q15_t)0xc009, (q15_t)0x41f7, (q15_t)0xc008, (q15_t)0x41c4, (q15_t)0xc006,
+	(q15_t)0x4192, (q15_t)0xc005, (q15_t)0x4160, (q15_t)0xc004, (q15_t)0x412e, (q15_t)0xc003, (q15_t)0x40fb, (q15_t)0xc002,
+	(q15_t)0x40c9, (q15_t)0xc001, (q15_t)0x4097, (q15_t)0xc001, (q15_t)0x4065, (q15_t)0xc000, (q15_t)0x4032, (q15_t)0xc000,
+};
+#endif
+
+#endif
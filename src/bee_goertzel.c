@@ -0,0 +1,152 @@
+/*
+ *  @file bee_goertzel.c
+ *  @brief goertzel filter bank, measures a set of tones straight on the
+ *  incoming samples without framing or FFT
+ */
+
+#include "lilbee.h"
+
+
+/** internal functions */
+
+/**
+ * 	@fn goertzel_run()
+ *  @brief runs every filter over samples that belong to the same block
+ *
+ *  @param
+ *  @return
+ */
+static void goertzel_run(bee_goertzel_t *g, const bee_goertzel_plan_t *plan,
+		const int16_t *samples, uint32_t n)
+{
+	float s0;
+	float s1;
+	float s2;
+	float c;
+
+	/* one tone at a time keeps its state on registers */
+	for(uint32_t k = 0; k < plan->tones; k++) {
+		c = plan->coeff[k];
+		s1 = g->s1[k];
+		s2 = g->s2[k];
+
+		for(uint32_t i = 0; i < n; i++) {
+			s0 = (float)samples[i] + c * s1 - s2;
+			s2 = s1;
+			s1 = s0;
+		}
+
+		g->s1[k] = s1;
+		g->s2[k] = s2;
+	}
+}
+
+/**
+ * 	@fn goertzel_close()
+ *  @brief sums the power of a finished block and clears the filters
+ *
+ *  @param
+ *  @return
+ */
+static void goertzel_close(bee_goertzel_t *g, const bee_goertzel_plan_t *plan)
+{
+	const float scale = 1.0f / (32768.0f * 32768.0f);
+	float s1;
+	float s2;
+
+	for(uint32_t k = 0; k < plan->tones; k++) {
+		s1 = g->s1[k];
+		s2 = g->s2[k];
+		g->power[k] += (s1 * s1 + s2 * s2 - plan->coeff[k] * s1 * s2) * scale;
+		g->s1[k] = 0.0f;
+		g->s2[k] = 0.0f;
+	}
+
+	g->count = 0;
+	g->blocks++;
+}
+
+/** public functions */
+
+bee_retcode_t bee_goertzel_plan(bee_goertzel_plan_t *plan, const uint16_t *tones_hz,
+		uint32_t tones, uint32_t block_len, uint32_t sample_rate)
+{
+	if(plan == NULL || (tones && tones_hz == NULL) || tones > GOERTZEL_MAX_TONES ||
+			block_len == 0 || sample_rate == 0)
+		return(k_bee_ret_invalid_param);
+
+	for(uint32_t k = 0; k < tones; k++) {
+		if(2 * (uint32_t)tones_hz[k] > sample_rate)
+			return(k_bee_ret_invalid_param);
+
+		plan->coeff[k] = 2.0f * cosf(2.0f * PI * (float)tones_hz[k] /
+				(float)sample_rate);
+	}
+
+	plan->tones = tones;
+	plan->block_len = block_len;
+	return(k_bee_ret_ok);
+}
+
+void bee_goertzel_reset(bee_goertzel_t *g)
+{
+	if(g == NULL)
+		return;
+
+	memset(g, 0, sizeof(*g));
+}
+
+void bee_goertzel_restart(bee_goertzel_t *g)
+{
+	if(g == NULL)
+		return;
+
+	memset(g->s1, 0, sizeof(g->s1));
+	memset(g->s2, 0, sizeof(g->s2));
+	g->count = 0;
+}
+
+uint32_t bee_goertzel_feed(bee_goertzel_t *g, const bee_goertzel_plan_t *plan,
+		const int16_t *samples, uint32_t n)
+{
+	uint32_t ret = 0;
+	uint32_t run;
+
+	if(g == NULL || plan == NULL || samples == NULL)
+		return(0);
+
+	while(n) {
+		run = plan->block_len - g->count;
+		if(run > n)
+			run = n;
+
+		goertzel_run(g, plan, samples, run);
+		g->count += run;
+		samples += run;
+		n -= run;
+
+		if(g->count == plan->block_len) {
+			goertzel_close(g, plan);
+			ret++;
+		}
+	}
+
+	return(ret);
+}
+
+bool bee_goertzel_publish(bee_goertzel_t *g, const bee_goertzel_plan_t *plan, float *mag)
+{
+	float scale;
+
+	if(g == NULL || plan == NULL || mag == NULL || g->blocks == 0)
+		return(false);
+
+	scale = 1.0f / (float)g->blocks;
+	for(uint32_t k = 0; k < plan->tones; k++) {
+		arm_sqrt_f32(g->power[k] * scale, &mag[k]);
+		g->power[k] = 0.0f;
+	}
+
+	g->blocks = 0;
+	return(true);
+}
@@ -0,0 +1,82 @@
+/*
+ *  @file bee_goertzel.h
+ *  @brief goertzel filter bank, measures a set of tones straight on the
+ *  incoming samples without framing or FFT
+ */
+
+#ifndef __BEE_GOERTZEL_H
+#define __BEE_GOERTZEL_H
+
+/* number of tones a bank can follow */
+#define GOERTZEL_MAX_TONES	32
+
+/** tone coefficients of a bank, shared by every stream using it */
+typedef struct bee_goertzel_plan {
+	uint32_t tones;
+	uint32_t block_len;
+	float coeff[GOERTZEL_MAX_TONES];
+}bee_goertzel_plan_t;
+
+/** filter state of one audio stream, power is summed per block */
+typedef struct bee_goertzel {
+	float s1[GOERTZEL_MAX_TONES];
+	float s2[GOERTZEL_MAX_TONES];
+	float power[GOERTZEL_MAX_TONES];
+	uint32_t count;
+	uint32_t blocks;
+}bee_goertzel_t;
+
+
+/**
+ * 	@fn bee_goertzel_plan()
+ *  @brief computes the coefficients of a set of tones, a tone needs not
+ *         to sit on a FFT bin
+ *
+ *  @param block_len - samples of each measurement, sets the resolution
+ *  @return
+ */
+bee_retcode_t bee_goertzel_plan(bee_goertzel_plan_t *plan, const uint16_t *tones_hz,
+		uint32_t tones, uint32_t block_len, uint32_t sample_rate);
+
+/**
+ * 	@fn bee_goertzel_reset()
+ *  @brief discards the partial block and the summed power of a stream
+ *
+ *  @param
+ *  @return
+ */
+void bee_goertzel_reset(bee_goertzel_t *g);
+
+/**
+ * 	@fn bee_goertzel_restart()
+ *  @brief discards the partial block of a stream that is no longer
+ *         contiguous, the completed blocks are kept
+ *
+ *  @param
+ *  @return
+ */
+void bee_goertzel_restart(bee_goertzel_t *g);
+
+/**
+ * 	@fn bee_goertzel_feed()
+ *  @brief runs the filters over a run of samples, blocks may span
+ *         several calls
+ *
+ *  @param
+ *  @return number of blocks completed
+ */
+uint32_t bee_goertzel_feed(bee_goertzel_t *g, const bee_goertzel_plan_t *plan,
+		const int16_t *samples, uint32_t n);
+
+/**
+ * 	@fn bee_goertzel_publish()
+ *  @brief writes the rms magnitude of each tone over the completed blocks,
+ *         on the scale of a rectangular window FFT of the normalized
+ *         samples, and starts a new report
+ *
+ *  @param
+ *  @return false when no block was completed since the last report
+ */
+bool bee_goertzel_publish(bee_goertzel_t *g, const bee_goertzel_plan_t *plan, float *mag);
+
+#endif
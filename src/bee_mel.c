@@ -0,0 +1,53 @@
+/*
+ *  @file bee_mel.c
+ *  @brief mel filterbank and MFCC extractor, filters are sparse tables
+ *  generated for each capture rate by tools/gen_mel_tables.py
+ */
+
+#include "lilbee.h"
+
+
+/** public functions */
+
+const bee_mel_table_t *bee_mel_find(uint32_t sample_rate)
+{
+	for(uint32_t i = 0; i < MEL_TABLES; i++) {
+		if(bee_mel_tables[i].sample_rate == sample_rate)
+			return(&bee_mel_tables[i]);
+	}
+
+	return(NULL);
+}
+
+void bee_mel_compute(const bee_mel_table_t *table, const float *power, bee_mel_t *out)
+{
+	const float *w;
+	const float *bins;
+	float energy;
+
+	if(out == NULL)
+		return;
+
+	out->valid = false;
+	if(table == NULL || power == NULL)
+		return;
+
+	/* only the bins under each triangle are visited */
+	for(uint32_t b = 0; b < MEL_BANDS; b++) {
+		w = table->weights + table->offset[b];
+		bins = power + table->start[b];
+		energy = 0.0f;
+
+		for(uint32_t i = 0; i < table->len[b]; i++)
+			energy += w[i] * bins[i];
+
+		out->log_energy[b] = logf(energy + MEL_LOG_FLOOR);
+	}
+
+	for(uint32_t k = 0; k < MFCC_COEFFS; k++) {
+		arm_dot_prod_f32((float *)&bee_mfcc_dct[k * MEL_BANDS], out->log_energy,
+				MEL_BANDS, &out->mfcc[k]);
+	}
+
+	out->valid = true;
+}
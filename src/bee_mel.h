@@ -0,0 +1,59 @@
+/*
+ *  @file bee_mel.h
+ *  @brief mel filterbank and MFCC extractor, filters are sparse tables
+ *  generated for each capture rate by tools/gen_mel_tables.py
+ */
+
+#ifndef __BEE_MEL_H
+#define __BEE_MEL_H
+
+/* filterbank shape, bee_mel_tables.c must be generated again on changes */
+#define MEL_BANDS		24
+#define MFCC_COEFFS		13
+#define MEL_TABLES		4
+
+/* smallest band energy taken by the log, keeps silent bands finite */
+#define MEL_LOG_FLOOR	1e-10f
+
+/** sparse triangular filters of one rate, band b weights the bins from
+ * start[b] on with len[b] weights taken from weights + offset[b]
+ */
+typedef struct bee_mel_table {
+	uint32_t sample_rate;
+	const uint16_t *start;
+	const uint8_t *len;
+	const uint16_t *offset;
+	const float *weights;
+}bee_mel_table_t;
+
+/** mel features of a spectrum, natural log of the band power */
+typedef struct bee_mel {
+	bool valid;
+	float log_energy[MEL_BANDS];
+	float mfcc[MFCC_COEFFS];
+}bee_mel_t;
+
+/* generated tables, flash resident */
+extern const bee_mel_table_t bee_mel_tables[MEL_TABLES];
+extern const float bee_mfcc_dct[MFCC_COEFFS * MEL_BANDS];
+
+
+/**
+ * 	@fn bee_mel_find()
+ *  @brief gets the filterbank generated for a sample rate
+ *
+ *  @param
+ *  @return NULL when no table was generated for it
+ */
+const bee_mel_table_t *bee_mel_find(uint32_t sample_rate);
+
+/**
+ * 	@fn bee_mel_compute()
+ *  @brief computes the log mel energies and the MFCCs of a spectrum
+ *
+ *  @param power - DSP_SPECTRAL_BINS bin powers
+ *  @return
+ */
+void bee_mel_compute(const bee_mel_table_t *table, const float *power, bee_mel_t *out);
+
+#endif
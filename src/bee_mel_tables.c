@@ -0,0 +1,2050 @@
+/*
+ *  @file bee_mel_tables.c
+ *  @brief mel filterbank and DCT tables, generated by
+ *  tools/gen_mel_tables.py, do not edit
+ */
+
+#include "lilbee.h"
+
+#if (MEL_BANDS != 24) || (MFCC_COEFFS != 13) || (MEL_TABLES != 4)
+#error "mel tables must be generated again, see tools/gen_mel_tables.py"
+#endif
+
+#if DSP_FFT_POINTS == 256
+
+/* 8000 Hz, 50 to 4000 Hz */
+static const uint16_t mel_start_8000[MEL_BANDS] = {
+	2, 4, 6, 8, 10, 13, 15, 18, 21, 25, 28, 32,
+	36, 40, 45, 50, 56, 62, 68, 75, 82, 90, 99, 108,
+};
+static const uint8_t mel_len_8000[MEL_BANDS] = {
+	4, 4, 4, 5, 5, 5, 6, 7, 7, 7, 8, 8,
+	9, 10, 11, 12, 12, 13, 14, 15, 17, 18, 19, 20,
+};
+static const uint16_t mel_offset_8000[MEL_BANDS] = {
+	0, 4, 8, 12, 17, 22, 27, 33, 40, 47, 54, 62,
+	70, 79, 89, 100, 112, 124, 137, 151, 166, 183, 201, 220,
+};
+static const float mel_weights_8000[240] = {
+	0.21880466f, 0.76581630f, 0.70931402f, 0.20101988f, 0.29068598f, 0.79898012f,
+	0.71447461f, 0.24215754f, 0.28552539f, 0.75784246f, 0.78613116f, 0.34724471f,
+	0.21386884f, 0.65275529f, 0.91484465f, 0.50702259f, 0.09920053f, 0.08515535f,
+	0.49297741f, 0.90079947f, 0.71322271f, 0.33426630f, 0.28677729f, 0.66573370f,
+	0.95847306f, 0.60633920f, 0.25420534f, 0.04152694f, 0.39366080f, 0.74579466f,
+	0.90900286f, 0.58179304f, 0.25458323f, 0.09099714f, 0.41820696f, 0.74541677f,
+	0.93251392f, 0.62846402f, 0.32441412f, 0.02036423f, 0.06748608f, 0.37153598f,
+	0.67558588f, 0.97963577f, 0.73639361f, 0.45386437f, 0.17133513f, 0.26360639f,
+	0.54613563f, 0.82866487f, 0.89667622f, 0.63414441f, 0.37161260f, 0.10908078f,
+	0.10332378f, 0.36585559f, 0.62838740f, 0.89091922f, 0.85741024f, 0.61346044f,
+	0.36951064f, 0.12556084f, 0.14258976f, 0.38653956f, 0.63048936f, 0.87443916f,
+	0.88999061f, 0.66330758f, 0.43662455f, 0.20994152f, 0.11000939f, 0.33669242f,
+	0.56337545f, 0.79005848f, 0.98444346f, 0.77380506f, 0.56316666f, 0.35252826f,
+	0.14188987f, 0.01555654f, 0.22619494f, 0.43683334f, 0.64747174f, 0.85811013f,
+	0.93611749f, 0.74038808f, 0.54465868f, 0.34892927f, 0.15319987f, 0.06388251f,
+	0.25961192f, 0.45534132f, 0.65107073f, 0.84680013f, 0.96048070f, 0.77860503f,
+	0.59672935f, 0.41485368f, 0.23297801f, 0.05110233f, 0.03951930f, 0.22139497f,
+	0.40327065f, 0.58514632f, 0.76702199f, 0.94889767f, 0.87848280f, 0.70948029f,
+	0.54047778f, 0.37147527f, 0.20247276f, 0.03347026f, 0.12151720f, 0.29051971f,
+	0.45952222f, 0.62852473f, 0.79752724f, 0.96652974f, 0.87406072f, 0.71702022f,
+	0.55997971f, 0.40293920f, 0.24589870f, 0.08885819f, 0.12593928f, 0.28297978f,
+	0.44002029f, 0.59706080f, 0.75410130f, 0.91114181f, 0.93664363f, 0.79071845f,
+	0.64479328f, 0.49886810f, 0.35294293f, 0.20701775f, 0.06109258f, 0.06335637f,
+	0.20928155f, 0.35520672f, 0.50113190f, 0.64705707f, 0.79298225f, 0.93890742f,
+	0.92117186f, 0.78557527f, 0.64997868f, 0.51438209f, 0.37878551f, 0.24318892f,
+	0.10759233f, 0.07882814f, 0.21442473f, 0.35002132f, 0.48561791f, 0.62121449f,
+	0.75681108f, 0.89240767f, 0.97397789f, 0.84797883f, 0.72197977f, 0.59598071f,
+	0.46998166f, 0.34398260f, 0.21798354f, 0.09198448f, 0.02602211f, 0.15202117f,
+	0.27802023f, 0.40401929f, 0.53001834f, 0.65601740f, 0.78201646f, 0.90801552f,
+	0.96839298f, 0.85131214f, 0.73423130f, 0.61715046f, 0.50006962f, 0.38298877f,
+	0.26590793f, 0.14882709f, 0.03174625f, 0.03160702f, 0.14868786f, 0.26576870f,
+	0.38284954f, 0.49993038f, 0.61701123f, 0.73409207f, 0.85117291f, 0.96825375f,
+	0.92070540f, 0.81191154f, 0.70311768f, 0.59432383f, 0.48552997f, 0.37673612f,
+	0.26794226f, 0.15914841f, 0.05035455f, 0.07929460f, 0.18808846f, 0.29688232f,
+	0.40567617f, 0.51447003f, 0.62326388f, 0.73205774f, 0.84085159f, 0.94964545f,
+	0.94569703f, 0.84460361f, 0.74351018f, 0.64241676f, 0.54132334f, 0.44022991f,
+	0.33913649f, 0.23804306f, 0.13694964f, 0.03585622f, 0.05430297f, 0.15539639f,
+	0.25648982f, 0.35758324f, 0.45867666f, 0.55977009f, 0.66086351f, 0.76195694f,
+	0.86305036f, 0.96414378f, 0.93938028f, 0.84544226f, 0.75150423f, 0.65756620f,
+	0.56362817f, 0.46969014f, 0.37575211f, 0.28181409f, 0.18787606f, 0.09393803f,
+};
+
+/* 16000 Hz, 50 to 8000 Hz */
+static const uint16_t mel_start_16000[MEL_BANDS] = {
+	1, 3, 4, 5, 7, 9, 11, 13, 16, 18, 21, 25,
+	28, 32, 37, 42, 47, 53, 59, 67, 75, 83, 93, 104,
+};
+static const uint8_t mel_len_16000[MEL_BANDS] = {
+	3, 2, 3, 4, 4, 4, 5, 5, 5, 7, 7, 7,
+	9, 10, 10, 11, 12, 14, 16, 16, 18, 21, 23, 24,
+};
+static const uint16_t mel_offset_16000[MEL_BANDS] = {
+	0, 3, 5, 8, 12, 16, 20, 25, 30, 35, 42, 49,
+	56, 65, 75, 85, 96, 108, 122, 138, 154, 172, 193, 216,
+};
+static const float mel_weights_16000[240] = {
+	0.16180110f, 0.97080659f, 0.29301266f, 0.70698734f, 0.60068998f, 0.39931002f,
+	0.94173296f, 0.33887290f, 0.05826704f, 0.66112710f, 0.76066596f, 0.21410552f,
+	0.23933404f, 0.78589448f, 0.69859223f, 0.20307374f, 0.30140777f, 0.79692626f,
+	0.73486594f, 0.28562270f, 0.26513406f, 0.71437730f, 0.85165958f, 0.44437006f,
+	0.03708054f, 0.14834042f, 0.55562994f, 0.96291946f, 0.66436393f, 0.29511018f,
+	0.33563607f, 0.70488982f, 0.93278052f, 0.59801047f, 0.26324043f, 0.06721948f,
+	0.40198953f, 0.73675957f, 0.93515036f, 0.63164366f, 0.32813697f, 0.02463027f,
+	0.06484964f, 0.36835634f, 0.67186303f, 0.97536973f, 0.74716717f, 0.47200422f,
+	0.19684127f, 0.25283283f, 0.52799578f, 0.80315873f, 0.92899259f, 0.67952643f,
+	0.43006028f, 0.18059412f, 0.07100741f, 0.32047357f, 0.56993972f, 0.81940588f,
+	0.93755976f, 0.71139063f, 0.48522151f, 0.25905239f, 0.03288326f, 0.06244024f,
+	0.28860937f, 0.51477849f, 0.74094761f, 0.96711674f, 0.82476463f, 0.61971689f,
+	0.41466914f, 0.20962140f, 0.00457366f, 0.17523537f, 0.38028311f, 0.58533086f,
+	0.79037860f, 0.99542634f, 0.81824770f, 0.63234886f, 0.44645002f, 0.26055118f,
+	0.07465234f, 0.18175230f, 0.36765114f, 0.55354998f, 0.73944882f, 0.92534766f,
+	0.89914254f, 0.73060434f, 0.56206614f, 0.39352794f, 0.22498973f, 0.05645153f,
+	0.10085746f, 0.26939566f, 0.43793386f, 0.60647206f, 0.77501027f, 0.94354847f,
+	0.89838083f, 0.74558200f, 0.59278316f, 0.43998433f, 0.28718550f, 0.13438666f,
+	0.10161917f, 0.25441800f, 0.40721684f, 0.56001567f, 0.71281450f, 0.86561334f,
+	0.98330730f, 0.84477797f, 0.70624865f, 0.56771933f, 0.42919000f, 0.29066068f,
+	0.15213135f, 0.01360203f, 0.01669270f, 0.15522203f, 0.29375135f, 0.43228067f,
+	0.57081000f, 0.70933932f, 0.84786865f, 0.98639797f, 0.88673936f, 0.76114694f,
+	0.63555453f, 0.50996212f, 0.38436971f, 0.25877730f, 0.13318489f, 0.00759248f,
+	0.11326064f, 0.23885306f, 0.36444547f, 0.49003788f, 0.61563029f, 0.74122270f,
+	0.86681511f, 0.99240752f, 0.89301979f, 0.77915615f, 0.66529250f, 0.55142886f,
+	0.43756522f, 0.32370157f, 0.20983793f, 0.09597428f, 0.10698021f, 0.22084385f,
+	0.33470750f, 0.44857114f, 0.56243478f, 0.67629843f, 0.79016207f, 0.90402572f,
+	0.98378128f, 0.88055109f, 0.77732089f, 0.67409069f, 0.57086049f, 0.46763030f,
+	0.36440010f, 0.26116990f, 0.15793970f, 0.05470951f, 0.01621872f, 0.11944891f,
+	0.22267911f, 0.32590931f, 0.42913951f, 0.53236970f, 0.63559990f, 0.73883010f,
+	0.84206030f, 0.94529049f, 0.95601054f, 0.86242075f, 0.76883097f, 0.67524119f,
+	0.58165141f, 0.48806162f, 0.39447184f, 0.30088206f, 0.20729228f, 0.11370249f,
+	0.02011271f, 0.04398946f, 0.13757925f, 0.23116903f, 0.32475881f, 0.41834859f,
+	0.51193838f, 0.60552816f, 0.69911794f, 0.79270772f, 0.88629751f, 0.97988729f,
+	0.93338477f, 0.84853511f, 0.76368545f, 0.67883578f, 0.59398612f, 0.50913646f,
+	0.42428680f, 0.33943713f, 0.25458747f, 0.16973781f, 0.08488815f, 0.00003848f,
+	0.06661523f, 0.15146489f, 0.23631455f, 0.32116422f, 0.40601388f, 0.49086354f,
+	0.57571320f, 0.66056287f, 0.74541253f, 0.83026219f, 0.91511185f, 0.99996152f,
+	0.92310913f, 0.84618337f, 0.76925761f, 0.69233185f, 0.61540609f, 0.53848033f,
+	0.46155456f, 0.38462880f, 0.30770304f, 0.23077728f, 0.15385152f, 0.07692576f,
+};
+
+/* 32000 Hz, 50 to 8000 Hz */
+static const uint16_t mel_start_32000[MEL_BANDS] = {
+	1, 2, 2, 3, 4, 5, 6, 7, 8, 9, 11, 13,
+	14, 16, 19, 21, 24, 27, 30, 34, 38, 42, 47, 52,
+};
+static const uint8_t mel_len_32000[MEL_BANDS] = {
+	1, 1, 2, 2, 2, 2, 2, 2, 3, 4, 3, 3,
+	5, 5, 5, 6, 6, 7, 8, 8, 9, 10, 11, 13,
+};
+static const uint16_t mel_offset_32000[MEL_BANDS] = {
+	0, 1, 2, 4, 6, 8, 10, 12, 14, 17, 21, 24,
+	27, 32, 37, 42, 48, 54, 61, 69, 77, 86, 96, 107,
+};
+static const float mel_weights_32000[120] = {
+	0.97080659f, 0.60068998f, 0.39931002f, 0.33887290f, 0.66112710f, 0.21410552f,
+	0.78589448f, 0.20307374f, 0.79692626f, 0.28562270f, 0.71437730f, 0.44437006f,
+	0.55562994f, 0.66436393f, 0.33563607f, 0.93278052f, 0.26324043f, 0.06721948f,
+	0.73675957f, 0.63164366f, 0.02463027f, 0.36835634f, 0.97536973f, 0.47200422f,
+	0.52799578f, 0.92899259f, 0.43006028f, 0.07100741f, 0.56993972f, 0.93755976f,
+	0.48522151f, 0.03288326f, 0.06244024f, 0.51477849f, 0.96711674f, 0.61971689f,
+	0.20962140f, 0.38028311f, 0.79037860f, 0.81824770f, 0.44645002f, 0.07465234f,
+	0.18175230f, 0.55354998f, 0.92534766f, 0.73060434f, 0.39352794f, 0.05645153f,
+	0.26939566f, 0.60647206f, 0.94354847f, 0.74558200f, 0.43998433f, 0.13438666f,
+	0.25441800f, 0.56001567f, 0.86561334f, 0.84477797f, 0.56771933f, 0.29066068f,
+	0.01360203f, 0.15522203f, 0.43228067f, 0.70933932f, 0.98639797f, 0.76114694f,
+	0.50996212f, 0.25877730f, 0.00759248f, 0.23885306f, 0.49003788f, 0.74122270f,
+	0.99240752f, 0.77915615f, 0.55142886f, 0.32370157f, 0.09597428f, 0.22084385f,
+	0.44857114f, 0.67629843f, 0.90402572f, 0.88055109f, 0.67409069f, 0.46763030f,
+	0.26116990f, 0.05470951f, 0.11944891f, 0.32590931f, 0.53236970f, 0.73883010f,
+	0.94529049f, 0.86242075f, 0.67524119f, 0.48806162f, 0.30088206f, 0.11370249f,
+	0.13757925f, 0.32475881f, 0.51193838f, 0.69911794f, 0.88629751f, 0.93338477f,
+	0.76368545f, 0.59398612f, 0.42428680f, 0.25458747f, 0.08488815f, 0.06661523f,
+	0.23631455f, 0.40601388f, 0.57571320f, 0.74541253f, 0.91511185f, 0.92310913f,
+	0.76925761f, 0.61540609f, 0.46155456f, 0.30770304f, 0.15385152f, 0.00000000f,
+};
+
+/* 48000 Hz, 50 to 8000 Hz */
+static const uint16_t mel_start_48000[MEL_BANDS] = {
+	1, 1, 2, 2, 3, 3, 4, 5, 6, 6, 7, 9,
+	10, 11, 13, 14, 16, 18, 20, 23, 25, 28, 31, 35,
+};
+static const uint8_t mel_len_48000[MEL_BANDS] = {
+	1, 1, 1, 1, 1, 2, 2, 1, 1, 3, 3, 2,
+	3, 3, 3, 4, 4, 5, 5, 5, 6, 7, 8, 8,
+};
+static const uint16_t mel_offset_48000[MEL_BANDS] = {
+	0, 1, 2, 3, 4, 5, 7, 9, 10, 11, 14, 17,
+	19, 22, 25, 28, 32, 36, 41, 46, 51, 57, 64, 72,
+};
+static const float mel_weights_48000[80] = {
+	0.29301266f, 0.70698734f, 0.33887290f, 0.66112710f, 0.69859223f, 0.30140777f,
+	0.28562270f, 0.71437730f, 0.03708054f, 0.96291946f, 0.93278052f, 0.06721948f,
+	0.93515036f, 0.02463027f, 0.06484964f, 0.97536973f, 0.19684127f, 0.80315873f,
+	0.43006028f, 0.56993972f, 0.71139063f, 0.03288326f, 0.28860937f, 0.96711674f,
+	0.41466914f, 0.58533086f, 0.81824770f, 0.26055118f, 0.18175230f, 0.73944882f,
+	0.73060434f, 0.22498973f, 0.26939566f, 0.77501027f, 0.74558200f, 0.28718550f,
+	0.25441800f, 0.71281450f, 0.84477797f, 0.42919000f, 0.01360203f, 0.15522203f,
+	0.57081000f, 0.98639797f, 0.63555453f, 0.25877730f, 0.36444547f, 0.74122270f,
+	0.89301979f, 0.55142886f, 0.20983793f, 0.10698021f, 0.44857114f, 0.79016207f,
+	0.88055109f, 0.57086049f, 0.26116990f, 0.11944891f, 0.42913951f, 0.73883010f,
+	0.95601054f, 0.67524119f, 0.39447184f, 0.11370249f, 0.04398946f, 0.32475881f,
+	0.60552816f, 0.88629751f, 0.84853511f, 0.59398612f, 0.33943713f, 0.08488815f,
+	0.15146489f, 0.40601388f, 0.66056287f, 0.91511185f, 0.84618337f, 0.61540609f,
+	0.38462880f, 0.15385152f,
+};
+
+#elif DSP_FFT_POINTS == 512
+
+/* 8000 Hz, 50 to 4000 Hz */
+static const uint16_t mel_start_8000[MEL_BANDS] = {
+	4, 7, 11, 16, 20, 25, 30, 36, 42, 49, 56, 63,
+	72, 80, 90, 100, 111, 123, 136, 149, 164, 180, 197, 215,
+};
+static const uint8_t mel_len_8000[MEL_BANDS] = {
+	7, 9, 9, 9, 10, 11, 12, 13, 14, 14, 16, 17,
+	18, 20, 21, 23, 25, 26, 28, 31, 33, 35, 38, 41,
+};
+static const uint16_t mel_offset_8000[MEL_BANDS] = {
+	0, 7, 16, 25, 34, 44, 55, 67, 80, 94, 108, 124,
+	141, 159, 179, 200, 223, 248, 274, 302, 333, 366, 401, 439,
+};
+static const float mel_weights_8000[480] = {
+	0.21880466f, 0.49231048f, 0.76581630f, 0.96346110f, 0.70931402f, 0.45516695f,
+	0.20101988f, 0.03653890f, 0.29068598f, 0.54483305f, 0.79898012f, 0.95063315f,
+	0.71447461f, 0.47831607f, 0.24215754f, 0.00599900f, 0.04936685f, 0.28552539f,
+	0.52168393f, 0.75784246f, 0.99400100f, 0.78613116f, 0.56668793f, 0.34724471f,
+	0.12780148f, 0.21386884f, 0.43331207f, 0.65275529f, 0.87219852f, 0.91484465f,
+	0.71093362f, 0.50702259f, 0.30311156f, 0.09920053f, 0.08515535f, 0.28906638f,
+	0.49297741f, 0.69688844f, 0.90079947f, 0.90270091f, 0.71322271f, 0.52374450f,
+	0.33426630f, 0.14478810f, 0.09729909f, 0.28677729f, 0.47625550f, 0.66573370f,
+	0.85521190f, 0.95847306f, 0.78240613f, 0.60633920f, 0.43027227f, 0.25420534f,
+	0.07813841f, 0.04152694f, 0.21759387f, 0.39366080f, 0.56972773f, 0.74579466f,
+	0.92186159f, 0.90900286f, 0.74539795f, 0.58179304f, 0.41818813f, 0.25458323f,
+	0.09097832f, 0.09099714f, 0.25460205f, 0.41820696f, 0.58181187f, 0.74541677f,
+	0.90902168f, 0.93251392f, 0.78048897f, 0.62846402f, 0.47643907f, 0.32441412f,
+	0.17238918f, 0.02036423f, 0.06748608f, 0.21951103f, 0.37153598f, 0.52356093f,
+	0.67558588f, 0.82761082f, 0.97963577f, 0.87765823f, 0.73639361f, 0.59512899f,
+	0.45386437f, 0.31259975f, 0.17133513f, 0.03007051f, 0.12234177f, 0.26360639f,
+	0.40487101f, 0.54613563f, 0.68740025f, 0.82866487f, 0.96992949f, 0.89667622f,
+	0.76541031f, 0.63414441f, 0.50287850f, 0.37161260f, 0.24034669f, 0.10908078f,
+	0.10332378f, 0.23458969f, 0.36585559f, 0.49712150f, 0.62838740f, 0.75965331f,
+	0.89091922f, 0.97938514f, 0.85741024f, 0.73543534f, 0.61346044f, 0.49148554f,
+	0.36951064f, 0.24753574f, 0.12556084f, 0.00358593f, 0.02061486f, 0.14258976f,
+	0.26456466f, 0.38653956f, 0.50851446f, 0.63048936f, 0.75246426f, 0.87443916f,
+	0.99641407f, 0.88999061f, 0.77664909f, 0.66330758f, 0.54996606f, 0.43662455f,
+	0.32328304f, 0.20994152f, 0.09660001f, 0.11000939f, 0.22335091f, 0.33669242f,
+	0.45003394f, 0.56337545f, 0.67671696f, 0.79005848f, 0.90339999f, 0.98444346f,
+	0.87912426f, 0.77380506f, 0.66848586f, 0.56316666f, 0.45784746f, 0.35252826f,
+	0.24720906f, 0.14188987f, 0.03657067f, 0.01555654f, 0.12087574f, 0.22619494f,
+	0.33151414f, 0.43683334f, 0.54215254f, 0.64747174f, 0.75279094f, 0.85811013f,
+	0.96342933f, 0.93611749f, 0.83825279f, 0.74038808f, 0.64252338f, 0.54465868f,
+	0.44679397f, 0.34892927f, 0.25106457f, 0.15319987f, 0.05533516f, 0.06388251f,
+	0.16174721f, 0.25961192f, 0.35747662f, 0.45534132f, 0.55320603f, 0.65107073f,
+	0.74893543f, 0.84680013f, 0.94466484f, 0.96048070f, 0.86954286f, 0.77860503f,
+	0.68766719f, 0.59672935f, 0.50579152f, 0.41485368f, 0.32391584f, 0.23297801f,
+	0.14204017f, 0.05110233f, 0.03951930f, 0.13045714f, 0.22139497f, 0.31233281f,
+	0.40327065f, 0.49420848f, 0.58514632f, 0.67608416f, 0.76702199f, 0.85795983f,
+	0.94889767f, 0.96298405f, 0.87848280f, 0.79398154f, 0.70948029f, 0.62497904f,
+	0.54047778f, 0.45597653f, 0.37147527f, 0.28697402f, 0.20247276f, 0.11797151f,
+	0.03347026f, 0.03701595f, 0.12151720f, 0.20601846f, 0.29051971f, 0.37502096f,
+	0.45952222f, 0.54402347f, 0.62852473f, 0.71302598f, 0.79752724f, 0.88202849f,
+	0.96652974f, 0.95258098f, 0.87406072f, 0.79554047f, 0.71702022f, 0.63849996f,
+	0.55997971f, 0.48145946f, 0.40293920f, 0.32441895f, 0.24589870f, 0.16737844f,
+	0.08885819f, 0.01033794f, 0.04741902f, 0.12593928f, 0.20445953f, 0.28297978f,
+	0.36150004f, 0.44002029f, 0.51854054f, 0.59706080f, 0.67558105f, 0.75410130f,
+	0.83262156f, 0.91114181f, 0.98966206f, 0.93664363f, 0.86368104f, 0.79071845f,
+	0.71775587f, 0.64479328f, 0.57183069f, 0.49886810f, 0.42590552f, 0.35294293f,
+	0.27998034f, 0.20701775f, 0.13405517f, 0.06109258f, 0.06335637f, 0.13631896f,
+	0.20928155f, 0.28224413f, 0.35520672f, 0.42816931f, 0.50113190f, 0.57409448f,
+	0.64705707f, 0.72001966f, 0.79298225f, 0.86594483f, 0.93890742f, 0.98897015f,
+	0.92117186f, 0.85337356f, 0.78557527f, 0.71777697f, 0.64997868f, 0.58218039f,
+	0.51438209f, 0.44658380f, 0.37878551f, 0.31098721f, 0.24318892f, 0.17539062f,
+	0.10759233f, 0.03979404f, 0.01102985f, 0.07882814f, 0.14662644f, 0.21442473f,
+	0.28222303f, 0.35002132f, 0.41781961f, 0.48561791f, 0.55341620f, 0.62121449f,
+	0.68901279f, 0.75681108f, 0.82460938f, 0.89240767f, 0.96020596f, 0.97397789f,
+	0.91097836f, 0.84797883f, 0.78497930f, 0.72197977f, 0.65898024f, 0.59598071f,
+	0.53298118f, 0.46998166f, 0.40698213f, 0.34398260f, 0.28098307f, 0.21798354f,
+	0.15498401f, 0.09198448f, 0.02898495f, 0.02602211f, 0.08902164f, 0.15202117f,
+	0.21502070f, 0.27802023f, 0.34101976f, 0.40401929f, 0.46701882f, 0.53001834f,
+	0.59301787f, 0.65601740f, 0.71901693f, 0.78201646f, 0.84501599f, 0.90801552f,
+	0.97101505f, 0.96839298f, 0.90985256f, 0.85131214f, 0.79277172f, 0.73423130f,
+	0.67569088f, 0.61715046f, 0.55861004f, 0.50006962f, 0.44152920f, 0.38298877f,
+	0.32444835f, 0.26590793f, 0.20736751f, 0.14882709f, 0.09028667f, 0.03174625f,
+	0.03160702f, 0.09014744f, 0.14868786f, 0.20722828f, 0.26576870f, 0.32430912f,
+	0.38284954f, 0.44138996f, 0.49993038f, 0.55847080f, 0.61701123f, 0.67555165f,
+	0.73409207f, 0.79263249f, 0.85117291f, 0.90971333f, 0.96825375f, 0.97510232f,
+	0.92070540f, 0.86630847f, 0.81191154f, 0.75751461f, 0.70311768f, 0.64872076f,
+	0.59432383f, 0.53992690f, 0.48552997f, 0.43113305f, 0.37673612f, 0.32233919f,
+	0.26794226f, 0.21354533f, 0.15914841f, 0.10475148f, 0.05035455f, 0.02489768f,
+	0.07929460f, 0.13369153f, 0.18808846f, 0.24248539f, 0.29688232f, 0.35127924f,
+	0.40567617f, 0.46007310f, 0.51447003f, 0.56886695f, 0.62326388f, 0.67766081f,
+	0.73205774f, 0.78645467f, 0.84085159f, 0.89524852f, 0.94964545f, 0.99624374f,
+	0.94569703f, 0.89515032f, 0.84460361f, 0.79405689f, 0.74351018f, 0.69296347f,
+	0.64241676f, 0.59187005f, 0.54132334f, 0.49077662f, 0.44022991f, 0.38968320f,
+	0.33913649f, 0.28858978f, 0.23804306f, 0.18749635f, 0.13694964f, 0.08640293f,
+	0.03585622f, 0.00375626f, 0.05430297f, 0.10484968f, 0.15539639f, 0.20594311f,
+	0.25648982f, 0.30703653f, 0.35758324f, 0.40812995f, 0.45867666f, 0.50922338f,
+	0.55977009f, 0.61031680f, 0.66086351f, 0.71141022f, 0.76195694f, 0.81250365f,
+	0.86305036f, 0.91359707f, 0.96414378f, 0.98634930f, 0.93938028f, 0.89241127f,
+	0.84544226f, 0.79847324f, 0.75150423f, 0.70453521f, 0.65756620f, 0.61059718f,
+	0.56362817f, 0.51665916f, 0.46969014f, 0.42272113f, 0.37575211f, 0.32878310f,
+	0.28181409f, 0.23484507f, 0.18787606f, 0.14090704f, 0.09393803f, 0.04696901f,
+};
+
+/* 16000 Hz, 50 to 8000 Hz */
+static const uint16_t mel_start_16000[MEL_BANDS] = {
+	2, 5, 7, 10, 14, 17, 21, 26, 31, 36, 42, 49,
+	56, 64, 73, 83, 93, 105, 118, 133, 149, 166, 186, 207,
+};
+static const uint8_t mel_len_16000[MEL_BANDS] = {
+	5, 5, 7, 7, 7, 9, 10, 10, 11, 13, 14, 15,
+	17, 19, 20, 22, 25, 28, 31, 33, 37, 41, 45, 49,
+};
+static const uint16_t mel_offset_16000[MEL_BANDS] = {
+	0, 5, 10, 17, 24, 31, 40, 50, 60, 71, 84, 98,
+	113, 130, 149, 169, 191, 216, 244, 275, 308, 345, 386, 431,
+};
+static const float mel_weights_16000[480] = {
+	0.16180110f, 0.56630384f, 0.97080659f, 0.65973988f, 0.29301266f, 0.34026012f,
+	0.70698734f, 0.93316945f, 0.60068998f, 0.26821051f, 0.06683055f, 0.39931002f,
+	0.73178949f, 0.94173296f, 0.64030293f, 0.33887290f, 0.03744287f, 0.05826704f,
+	0.35969707f, 0.66112710f, 0.96255713f, 0.76066596f, 0.48738574f, 0.21410552f,
+	0.23933404f, 0.51261426f, 0.78589448f, 0.94635148f, 0.69859223f, 0.45083299f,
+	0.20307374f, 0.05364852f, 0.30140777f, 0.54916701f, 0.79692626f, 0.95948756f,
+	0.73486594f, 0.51024432f, 0.28562270f, 0.06100108f, 0.04051244f, 0.26513406f,
+	0.48975568f, 0.71437730f, 0.93899892f, 0.85165958f, 0.64801482f, 0.44437006f,
+	0.24072530f, 0.03708054f, 0.14834042f, 0.35198518f, 0.55562994f, 0.75927470f,
+	0.96291946f, 0.84899081f, 0.66436393f, 0.47973706f, 0.29511018f, 0.11048331f,
+	0.15100919f, 0.33563607f, 0.52026294f, 0.70488982f, 0.88951669f, 0.93278052f,
+	0.76539550f, 0.59801047f, 0.43062545f, 0.26324043f, 0.09585540f, 0.06721948f,
+	0.23460450f, 0.40198953f, 0.56937455f, 0.73675957f, 0.90414460f, 0.93515036f,
+	0.78339701f, 0.63164366f, 0.47989032f, 0.32813697f, 0.17638362f, 0.02463027f,
+	0.06484964f, 0.21660299f, 0.36835634f, 0.52010968f, 0.67186303f, 0.82361638f,
+	0.97536973f, 0.88474864f, 0.74716717f, 0.60958569f, 0.47200422f, 0.33442274f,
+	0.19684127f, 0.05925979f, 0.11525136f, 0.25283283f, 0.39041431f, 0.52799578f,
+	0.66557726f, 0.80315873f, 0.94074021f, 0.92899259f, 0.80425951f, 0.67952643f,
+	0.55479336f, 0.43006028f, 0.30532720f, 0.18059412f, 0.05586105f, 0.07100741f,
+	0.19574049f, 0.32047357f, 0.44520664f, 0.56993972f, 0.69467280f, 0.81940588f,
+	0.94413895f, 0.93755976f, 0.82447520f, 0.71139063f, 0.59830607f, 0.48522151f,
+	0.37213695f, 0.25905239f, 0.14596783f, 0.03288326f, 0.06244024f, 0.17552480f,
+	0.28860937f, 0.40169393f, 0.51477849f, 0.62786305f, 0.74094761f, 0.85403217f,
+	0.96711674f, 0.92728850f, 0.82476463f, 0.72224076f, 0.61971689f, 0.51719302f,
+	0.41466914f, 0.31214527f, 0.20962140f, 0.10709753f, 0.00457366f, 0.07271150f,
+	0.17523537f, 0.27775924f, 0.38028311f, 0.48280698f, 0.58533086f, 0.68785473f,
+	0.79037860f, 0.89290247f, 0.99542634f, 0.91119711f, 0.81824770f, 0.72529828f,
+	0.63234886f, 0.53939944f, 0.44645002f, 0.35350060f, 0.26055118f, 0.16760176f,
+	0.07465234f, 0.08880289f, 0.18175230f, 0.27470172f, 0.36765114f, 0.46060056f,
+	0.55354998f, 0.64649940f, 0.73944882f, 0.83239824f, 0.92534766f, 0.98341164f,
+	0.89914254f, 0.81487344f, 0.73060434f, 0.64633524f, 0.56206614f, 0.47779704f,
+	0.39352794f, 0.30925883f, 0.22498973f, 0.14072063f, 0.05645153f, 0.01658836f,
+	0.10085746f, 0.18512656f, 0.26939566f, 0.35366476f, 0.43793386f, 0.52220296f,
+	0.60647206f, 0.69074117f, 0.77501027f, 0.85927937f, 0.94354847f, 0.97478025f,
+	0.89838083f, 0.82198141f, 0.74558200f, 0.66918258f, 0.59278316f, 0.51638375f,
+	0.43998433f, 0.36358491f, 0.28718550f, 0.21078608f, 0.13438666f, 0.05798725f,
+	0.02521975f, 0.10161917f, 0.17801859f, 0.25441800f, 0.33081742f, 0.40721684f,
+	0.48361625f, 0.56001567f, 0.63641509f, 0.71281450f, 0.78921392f, 0.86561334f,
+	0.94201275f, 0.98330730f, 0.91404264f, 0.84477797f, 0.77551331f, 0.70624865f,
+	0.63698399f, 0.56771933f, 0.49845466f, 0.42919000f, 0.35992534f, 0.29066068f,
+	0.22139601f, 0.15213135f, 0.08286669f, 0.01360203f, 0.01669270f, 0.08595736f,
+	0.15522203f, 0.22448669f, 0.29375135f, 0.36301601f, 0.43228067f, 0.50154534f,
+	0.57081000f, 0.64007466f, 0.70933932f, 0.77860399f, 0.84786865f, 0.91713331f,
+	0.98639797f, 0.94953556f, 0.88673936f, 0.82394315f, 0.76114694f, 0.69835074f,
+	0.63555453f, 0.57275833f, 0.50996212f, 0.44716592f, 0.38436971f, 0.32157351f,
+	0.25877730f, 0.19598110f, 0.13318489f, 0.07038868f, 0.00759248f, 0.05046444f,
+	0.11326064f, 0.17605685f, 0.23885306f, 0.30164926f, 0.36444547f, 0.42724167f,
+	0.49003788f, 0.55283408f, 0.61563029f, 0.67842649f, 0.74122270f, 0.80401890f,
+	0.86681511f, 0.92961132f, 0.99240752f, 0.94995161f, 0.89301979f, 0.83608797f,
+	0.77915615f, 0.72222433f, 0.66529250f, 0.60836068f, 0.55142886f, 0.49449704f,
+	0.43756522f, 0.38063339f, 0.32370157f, 0.26676975f, 0.20983793f, 0.15290611f,
+	0.09597428f, 0.03904246f, 0.05004839f, 0.10698021f, 0.16391203f, 0.22084385f,
+	0.27777567f, 0.33470750f, 0.39163932f, 0.44857114f, 0.50550296f, 0.56243478f,
+	0.61936661f, 0.67629843f, 0.73323025f, 0.79016207f, 0.84709389f, 0.90402572f,
+	0.96095754f, 0.98378128f, 0.93216619f, 0.88055109f, 0.82893599f, 0.77732089f,
+	0.72570579f, 0.67409069f, 0.62247559f, 0.57086049f, 0.51924540f, 0.46763030f,
+	0.41601520f, 0.36440010f, 0.31278500f, 0.26116990f, 0.20955480f, 0.15793970f,
+	0.10632461f, 0.05470951f, 0.00309441f, 0.01621872f, 0.06783381f, 0.11944891f,
+	0.17106401f, 0.22267911f, 0.27429421f, 0.32590931f, 0.37752441f, 0.42913951f,
+	0.48075460f, 0.53236970f, 0.58398480f, 0.63559990f, 0.68721500f, 0.73883010f,
+	0.79044520f, 0.84206030f, 0.89367539f, 0.94529049f, 0.99690559f, 0.95601054f,
+	0.90921565f, 0.86242075f, 0.81562586f, 0.76883097f, 0.72203608f, 0.67524119f,
+	0.62844630f, 0.58165141f, 0.53485651f, 0.48806162f, 0.44126673f, 0.39447184f,
+	0.34767695f, 0.30088206f, 0.25408717f, 0.20729228f, 0.16049738f, 0.11370249f,
+	0.06690760f, 0.02011271f, 0.04398946f, 0.09078435f, 0.13757925f, 0.18437414f,
+	0.23116903f, 0.27796392f, 0.32475881f, 0.37155370f, 0.41834859f, 0.46514349f,
+	0.51193838f, 0.55873327f, 0.60552816f, 0.65232305f, 0.69911794f, 0.74591283f,
+	0.79270772f, 0.83950262f, 0.88629751f, 0.93309240f, 0.97988729f, 0.97580960f,
+	0.93338477f, 0.89095994f, 0.84853511f, 0.80611028f, 0.76368545f, 0.72126061f,
+	0.67883578f, 0.63641095f, 0.59398612f, 0.55156129f, 0.50913646f, 0.46671163f,
+	0.42428680f, 0.38186196f, 0.33943713f, 0.29701230f, 0.25458747f, 0.21216264f,
+	0.16973781f, 0.12731298f, 0.08488815f, 0.04246331f, 0.00003848f, 0.02419040f,
+	0.06661523f, 0.10904006f, 0.15146489f, 0.19388972f, 0.23631455f, 0.27873939f,
+	0.32116422f, 0.36358905f, 0.40601388f, 0.44843871f, 0.49086354f, 0.53328837f,
+	0.57571320f, 0.61813804f, 0.66056287f, 0.70298770f, 0.74541253f, 0.78783736f,
+	0.83026219f, 0.87268702f, 0.91511185f, 0.95753669f, 0.99996152f, 0.96157201f,
+	0.92310913f, 0.88464625f, 0.84618337f, 0.80772049f, 0.76925761f, 0.73079473f,
+	0.69233185f, 0.65386897f, 0.61540609f, 0.57694321f, 0.53848033f, 0.50001744f,
+	0.46155456f, 0.42309168f, 0.38462880f, 0.34616592f, 0.30770304f, 0.26924016f,
+	0.23077728f, 0.19231440f, 0.15385152f, 0.11538864f, 0.07692576f, 0.03846288f,
+};
+
+/* 32000 Hz, 50 to 8000 Hz */
+static const uint16_t mel_start_32000[MEL_BANDS] = {
+	1, 3, 4, 5, 7, 9, 11, 13, 16, 18, 21, 25,
+	28, 32, 37, 42, 47, 53, 59, 67, 75, 83, 93, 104,
+};
+static const uint8_t mel_len_32000[MEL_BANDS] = {
+	3, 2, 3, 4, 4, 4, 5, 5, 5, 7, 7, 7,
+	9, 10, 10, 11, 12, 14, 16, 16, 18, 21, 23, 25,
+};
+static const uint16_t mel_offset_32000[MEL_BANDS] = {
+	0, 3, 5, 8, 12, 16, 20, 25, 30, 35, 42, 49,
+	56, 65, 75, 85, 96, 108, 122, 138, 154, 172, 193, 216,
+};
+static const float mel_weights_32000[241] = {
+	0.16180110f, 0.97080659f, 0.29301266f, 0.70698734f, 0.60068998f, 0.39931002f,
+	0.94173296f, 0.33887290f, 0.05826704f, 0.66112710f, 0.76066596f, 0.21410552f,
+	0.23933404f, 0.78589448f, 0.69859223f, 0.20307374f, 0.30140777f, 0.79692626f,
+	0.73486594f, 0.28562270f, 0.26513406f, 0.71437730f, 0.85165958f, 0.44437006f,
+	0.03708054f, 0.14834042f, 0.55562994f, 0.96291946f, 0.66436393f, 0.29511018f,
+	0.33563607f, 0.70488982f, 0.93278052f, 0.59801047f, 0.26324043f, 0.06721948f,
+	0.40198953f, 0.73675957f, 0.93515036f, 0.63164366f, 0.32813697f, 0.02463027f,
+	0.06484964f, 0.36835634f, 0.67186303f, 0.97536973f, 0.74716717f, 0.47200422f,
+	0.19684127f, 0.25283283f, 0.52799578f, 0.80315873f, 0.92899259f, 0.67952643f,
+	0.43006028f, 0.18059412f, 0.07100741f, 0.32047357f, 0.56993972f, 0.81940588f,
+	0.93755976f, 0.71139063f, 0.48522151f, 0.25905239f, 0.03288326f, 0.06244024f,
+	0.28860937f, 0.51477849f, 0.74094761f, 0.96711674f, 0.82476463f, 0.61971689f,
+	0.41466914f, 0.20962140f, 0.00457366f, 0.17523537f, 0.38028311f, 0.58533086f,
+	0.79037860f, 0.99542634f, 0.81824770f, 0.63234886f, 0.44645002f, 0.26055118f,
+	0.07465234f, 0.18175230f, 0.36765114f, 0.55354998f, 0.73944882f, 0.92534766f,
+	0.89914254f, 0.73060434f, 0.56206614f, 0.39352794f, 0.22498973f, 0.05645153f,
+	0.10085746f, 0.26939566f, 0.43793386f, 0.60647206f, 0.77501027f, 0.94354847f,
+	0.89838083f, 0.74558200f, 0.59278316f, 0.43998433f, 0.28718550f, 0.13438666f,
+	0.10161917f, 0.25441800f, 0.40721684f, 0.56001567f, 0.71281450f, 0.86561334f,
+	0.98330730f, 0.84477797f, 0.70624865f, 0.56771933f, 0.42919000f, 0.29066068f,
+	0.15213135f, 0.01360203f, 0.01669270f, 0.15522203f, 0.29375135f, 0.43228067f,
+	0.57081000f, 0.70933932f, 0.84786865f, 0.98639797f, 0.88673936f, 0.76114694f,
+	0.63555453f, 0.50996212f, 0.38436971f, 0.25877730f, 0.13318489f, 0.00759248f,
+	0.11326064f, 0.23885306f, 0.36444547f, 0.49003788f, 0.61563029f, 0.74122270f,
+	0.86681511f, 0.99240752f, 0.89301979f, 0.77915615f, 0.66529250f, 0.55142886f,
+	0.43756522f, 0.32370157f, 0.20983793f, 0.09597428f, 0.10698021f, 0.22084385f,
+	0.33470750f, 0.44857114f, 0.56243478f, 0.67629843f, 0.79016207f, 0.90402572f,
+	0.98378128f, 0.88055109f, 0.77732089f, 0.67409069f, 0.57086049f, 0.46763030f,
+	0.36440010f, 0.26116990f, 0.15793970f, 0.05470951f, 0.01621872f, 0.11944891f,
+	0.22267911f, 0.32590931f, 0.42913951f, 0.53236970f, 0.63559990f, 0.73883010f,
+	0.84206030f, 0.94529049f, 0.95601054f, 0.86242075f, 0.76883097f, 0.67524119f,
+	0.58165141f, 0.48806162f, 0.39447184f, 0.30088206f, 0.20729228f, 0.11370249f,
+	0.02011271f, 0.04398946f, 0.13757925f, 0.23116903f, 0.32475881f, 0.41834859f,
+	0.51193838f, 0.60552816f, 0.69911794f, 0.79270772f, 0.88629751f, 0.97988729f,
+	0.93338477f, 0.84853511f, 0.76368545f, 0.67883578f, 0.59398612f, 0.50913646f,
+	0.42428680f, 0.33943713f, 0.25458747f, 0.16973781f, 0.08488815f, 0.00003848f,
+	0.06661523f, 0.15146489f, 0.23631455f, 0.32116422f, 0.40601388f, 0.49086354f,
+	0.57571320f, 0.66056287f, 0.74541253f, 0.83026219f, 0.91511185f, 0.99996152f,
+	0.92310913f, 0.84618337f, 0.76925761f, 0.69233185f, 0.61540609f, 0.53848033f,
+	0.46155456f, 0.38462880f, 0.30770304f, 0.23077728f, 0.15385152f, 0.07692576f,
+	0.00000000f,
+};
+
+/* 48000 Hz, 50 to 8000 Hz */
+static const uint16_t mel_start_48000[MEL_BANDS] = {
+	1, 2, 3, 4, 5, 6, 7, 9, 11, 12, 14, 17,
+	19, 22, 25, 28, 31, 35, 40, 45, 50, 56, 62, 69,
+};
+static const uint8_t mel_len_48000[MEL_BANDS] = {
+	2, 2, 2, 2, 2, 3, 4, 3, 3, 5, 5, 5,
+	6, 6, 6, 7, 9, 10, 10, 11, 12, 13, 15, 17,
+};
+static const uint16_t mel_offset_48000[MEL_BANDS] = {
+	0, 2, 4, 6, 8, 10, 13, 17, 20, 23, 28, 33,
+	38, 44, 50, 56, 63, 72, 82, 92, 103, 115, 128, 143,
+};
+static const float mel_weights_48000[160] = {
+	0.56630384f, 0.29301266f, 0.70698734f, 0.26821051f, 0.73178949f, 0.33887290f,
+	0.66112710f, 0.48738574f, 0.51261426f, 0.69859223f, 0.30140777f, 0.95948756f,
+	0.28562270f, 0.04051244f, 0.71437730f, 0.64801482f, 0.03708054f, 0.35198518f,
+	0.96291946f, 0.47973706f, 0.52026294f, 0.93278052f, 0.43062545f, 0.06721948f,
+	0.56937455f, 0.93515036f, 0.47989032f, 0.02463027f, 0.06484964f, 0.52010968f,
+	0.97536973f, 0.60958569f, 0.19684127f, 0.39041431f, 0.80315873f, 0.80425951f,
+	0.43006028f, 0.05586105f, 0.19574049f, 0.56993972f, 0.94413895f, 0.71139063f,
+	0.37213695f, 0.03288326f, 0.28860937f, 0.62786305f, 0.96711674f, 0.72224076f,
+	0.41466914f, 0.10709753f, 0.27775924f, 0.58533086f, 0.89290247f, 0.81824770f,
+	0.53939944f, 0.26055118f, 0.18175230f, 0.46060056f, 0.73944882f, 0.98341164f,
+	0.73060434f, 0.47779704f, 0.22498973f, 0.01658836f, 0.26939566f, 0.52220296f,
+	0.77501027f, 0.97478025f, 0.74558200f, 0.51638375f, 0.28718550f, 0.05798725f,
+	0.02521975f, 0.25441800f, 0.48361625f, 0.71281450f, 0.94201275f, 0.84477797f,
+	0.63698399f, 0.42919000f, 0.22139601f, 0.01360203f, 0.15522203f, 0.36301601f,
+	0.57081000f, 0.77860399f, 0.98639797f, 0.82394315f, 0.63555453f, 0.44716592f,
+	0.25877730f, 0.07038868f, 0.17605685f, 0.36444547f, 0.55283408f, 0.74122270f,
+	0.92961132f, 0.89301979f, 0.72222433f, 0.55142886f, 0.38063339f, 0.20983793f,
+	0.03904246f, 0.10698021f, 0.27777567f, 0.44857114f, 0.61936661f, 0.79016207f,
+	0.96095754f, 0.88055109f, 0.72570579f, 0.57086049f, 0.41601520f, 0.26116990f,
+	0.10632461f, 0.11944891f, 0.27429421f, 0.42913951f, 0.58398480f, 0.73883010f,
+	0.89367539f, 0.95601054f, 0.81562586f, 0.67524119f, 0.53485651f, 0.39447184f,
+	0.25408717f, 0.11370249f, 0.04398946f, 0.18437414f, 0.32475881f, 0.46514349f,
+	0.60552816f, 0.74591283f, 0.88629751f, 0.97580960f, 0.84853511f, 0.72126061f,
+	0.59398612f, 0.46671163f, 0.33943713f, 0.21216264f, 0.08488815f, 0.02419040f,
+	0.15146489f, 0.27873939f, 0.40601388f, 0.53328837f, 0.66056287f, 0.78783736f,
+	0.91511185f, 0.96157201f, 0.84618337f, 0.73079473f, 0.61540609f, 0.50001744f,
+	0.38462880f, 0.26924016f, 0.15385152f, 0.03846288f,
+};
+
+#elif DSP_FFT_POINTS == 1024
+
+/* 8000 Hz, 50 to 4000 Hz */
+static const uint16_t mel_start_8000[MEL_BANDS] = {
+	7, 14, 22, 31, 40, 49, 60, 71, 84, 97, 111, 126,
+	143, 160, 179, 200, 222, 245, 271, 298, 328, 359, 394, 430,
+};
+static const uint8_t mel_len_8000[MEL_BANDS] = {
+	15, 17, 18, 18, 20, 22, 24, 26, 27, 29, 32, 34,
+	36, 40, 43, 45, 49, 53, 57, 61, 66, 71, 76, 82,
+};
+static const uint16_t mel_offset_8000[MEL_BANDS] = {
+	0, 15, 32, 50, 68, 88, 110, 134, 160, 187, 216, 248,
+	282, 318, 358, 401, 446, 495, 548, 605, 666, 732, 803, 879,
+};
+static const float mel_weights_8000[961] = {
+	0.08205175f, 0.21880466f, 0.35555757f, 0.49231048f, 0.62906339f, 0.76581630f,
+	0.90256921f, 0.96346110f, 0.83638756f, 0.70931402f, 0.58224049f, 0.45516695f,
+	0.32809341f, 0.20101988f, 0.07394634f, 0.03653890f, 0.16361244f, 0.29068598f,
+	0.41775951f, 0.54483305f, 0.67190659f, 0.79898012f, 0.92605366f, 0.95063315f,
+	0.83255388f, 0.71447461f, 0.59639534f, 0.47831607f, 0.36023681f, 0.24215754f,
+	0.12407827f, 0.00599900f, 0.04936685f, 0.16744612f, 0.28552539f, 0.40360466f,
+	0.52168393f, 0.63976319f, 0.75784246f, 0.87592173f, 0.99400100f, 0.89585278f,
+	0.78613116f, 0.67640955f, 0.56668793f, 0.45696632f, 0.34724471f, 0.23752309f,
+	0.12780148f, 0.01807986f, 0.10414722f, 0.21386884f, 0.32359045f, 0.43331207f,
+	0.54303368f, 0.65275529f, 0.76247691f, 0.87219852f, 0.98192014f, 0.91484465f,
+	0.81288914f, 0.71093362f, 0.60897811f, 0.50702259f, 0.40506708f, 0.30311156f,
+	0.20115604f, 0.09920053f, 0.08515535f, 0.18711086f, 0.28906638f, 0.39102189f,
+	0.49297741f, 0.59493292f, 0.69688844f, 0.79884396f, 0.90079947f, 0.99744001f,
+	0.90270091f, 0.80796181f, 0.71322271f, 0.61848360f, 0.52374450f, 0.42900540f,
+	0.33426630f, 0.23952720f, 0.14478810f, 0.05004900f, 0.00255999f, 0.09729909f,
+	0.19203819f, 0.28677729f, 0.38151640f, 0.47625550f, 0.57099460f, 0.66573370f,
+	0.76047280f, 0.85521190f, 0.94995100f, 0.95847306f, 0.87043960f, 0.78240613f,
+	0.69437267f, 0.60633920f, 0.51830573f, 0.43027227f, 0.34223880f, 0.25420534f,
+	0.16617187f, 0.07813841f, 0.04152694f, 0.12956040f, 0.21759387f, 0.30562733f,
+	0.39366080f, 0.48169427f, 0.56972773f, 0.65776120f, 0.74579466f, 0.83382813f,
+	0.92186159f, 0.99080531f, 0.90900286f, 0.82720041f, 0.74539795f, 0.66359550f,
+	0.58179304f, 0.49999059f, 0.41818813f, 0.33638568f, 0.25458323f, 0.17278077f,
+	0.09097832f, 0.00917586f, 0.00919469f, 0.09099714f, 0.17279959f, 0.25460205f,
+	0.33640450f, 0.41820696f, 0.50000941f, 0.58181187f, 0.66361432f, 0.74541677f,
+	0.82721923f, 0.90902168f, 0.99082414f, 0.93251392f, 0.85650145f, 0.78048897f,
+	0.70447650f, 0.62846402f, 0.55245155f, 0.47643907f, 0.40042660f, 0.32441412f,
+	0.24840165f, 0.17238918f, 0.09637670f, 0.02036423f, 0.06748608f, 0.14349855f,
+	0.21951103f, 0.29552350f, 0.37153598f, 0.44754845f, 0.52356093f, 0.59957340f,
+	0.67558588f, 0.75159835f, 0.82761082f, 0.90362330f, 0.97963577f, 0.94829054f,
+	0.87765823f, 0.80702592f, 0.73639361f, 0.66576130f, 0.59512899f, 0.52449668f,
+	0.45386437f, 0.38323206f, 0.31259975f, 0.24196744f, 0.17133513f, 0.10070282f,
+	0.03007051f, 0.05170946f, 0.12234177f, 0.19297408f, 0.26360639f, 0.33423870f,
+	0.40487101f, 0.47550332f, 0.54613563f, 0.61676794f, 0.68740025f, 0.75803256f,
+	0.82866487f, 0.89929718f, 0.96992949f, 0.96230917f, 0.89667622f, 0.83104326f,
+	0.76541031f, 0.69977736f, 0.63414441f, 0.56851145f, 0.50287850f, 0.43724555f,
+	0.37161260f, 0.30597964f, 0.24034669f, 0.17471374f, 0.10908078f, 0.04344783f,
+	0.03769083f, 0.10332378f, 0.16895674f, 0.23458969f, 0.30022264f, 0.36585559f,
+	0.43148855f, 0.49712150f, 0.56275445f, 0.62838740f, 0.69402036f, 0.75965331f,
+	0.82528626f, 0.89091922f, 0.95655217f, 0.97938514f, 0.91839769f, 0.85741024f,
+	0.79642279f, 0.73543534f, 0.67444789f, 0.61346044f, 0.55247299f, 0.49148554f,
+	0.43049809f, 0.36951064f, 0.30852319f, 0.24753574f, 0.18654829f, 0.12556084f,
+	0.06457338f, 0.00358593f, 0.02061486f, 0.08160231f, 0.14258976f, 0.20357721f,
+	0.26456466f, 0.32555211f, 0.38653956f, 0.44752701f, 0.50851446f, 0.56950191f,
+	0.63048936f, 0.69147681f, 0.75246426f, 0.81345171f, 0.87443916f, 0.93542662f,
+	0.99641407f, 0.94666136f, 0.88999061f, 0.83331985f, 0.77664909f, 0.71997834f,
+	0.66330758f, 0.60663682f, 0.54996606f, 0.49329531f, 0.43662455f, 0.37995379f,
+	0.32328304f, 0.26661228f, 0.20994152f, 0.15327076f, 0.09660001f, 0.03992925f,
+	0.05333864f, 0.11000939f, 0.16668015f, 0.22335091f, 0.28002166f, 0.33669242f,
+	0.39336318f, 0.45003394f, 0.50670469f, 0.56337545f, 0.62004621f, 0.67671696f,
+	0.73338772f, 0.79005848f, 0.84672924f, 0.90339999f, 0.96007075f, 0.98444346f,
+	0.93178386f, 0.87912426f, 0.82646466f, 0.77380506f, 0.72114546f, 0.66848586f,
+	0.61582626f, 0.56316666f, 0.51050706f, 0.45784746f, 0.40518786f, 0.35252826f,
+	0.29986866f, 0.24720906f, 0.19454947f, 0.14188987f, 0.08923027f, 0.03657067f,
+	0.01555654f, 0.06821614f, 0.12087574f, 0.17353534f, 0.22619494f, 0.27885454f,
+	0.33151414f, 0.38417374f, 0.43683334f, 0.48949294f, 0.54215254f, 0.59481214f,
+	0.64747174f, 0.70013134f, 0.75279094f, 0.80545053f, 0.85811013f, 0.91076973f,
+	0.96342933f, 0.98504984f, 0.93611749f, 0.88718514f, 0.83825279f, 0.78932044f,
+	0.74038808f, 0.69145573f, 0.64252338f, 0.59359103f, 0.54465868f, 0.49572633f,
+	0.44679397f, 0.39786162f, 0.34892927f, 0.29999692f, 0.25106457f, 0.20213222f,
+	0.15319987f, 0.10426751f, 0.05533516f, 0.00640281f, 0.01495016f, 0.06388251f,
+	0.11281486f, 0.16174721f, 0.21067956f, 0.25961192f, 0.30854427f, 0.35747662f,
+	0.40640897f, 0.45534132f, 0.50427367f, 0.55320603f, 0.60213838f, 0.65107073f,
+	0.70000308f, 0.74893543f, 0.79786778f, 0.84680013f, 0.89573249f, 0.94466484f,
+	0.99359719f, 0.96048070f, 0.91501178f, 0.86954286f, 0.82407395f, 0.77860503f,
+	0.73313611f, 0.68766719f, 0.64219827f, 0.59672935f, 0.55126044f, 0.50579152f,
+	0.46032260f, 0.41485368f, 0.36938476f, 0.32391584f, 0.27844692f, 0.23297801f,
+	0.18750909f, 0.14204017f, 0.09657125f, 0.05110233f, 0.00563341f, 0.03951930f,
+	0.08498822f, 0.13045714f, 0.17592605f, 0.22139497f, 0.26686389f, 0.31233281f,
+	0.35780173f, 0.40327065f, 0.44873956f, 0.49420848f, 0.53967740f, 0.58514632f,
+	0.63061524f, 0.67608416f, 0.72155308f, 0.76702199f, 0.81249091f, 0.85795983f,
+	0.90342875f, 0.94889767f, 0.99436659f, 0.96298405f, 0.92073343f, 0.87848280f,
+	0.83623217f, 0.79398154f, 0.75173092f, 0.70948029f, 0.66722966f, 0.62497904f,
+	0.58272841f, 0.54047778f, 0.49822715f, 0.45597653f, 0.41372590f, 0.37147527f,
+	0.32922465f, 0.28697402f, 0.24472339f, 0.20247276f, 0.16022214f, 0.11797151f,
+	0.07572088f, 0.03347026f, 0.03701595f, 0.07926657f, 0.12151720f, 0.16376783f,
+	0.20601846f, 0.24826908f, 0.29051971f, 0.33277034f, 0.37502096f, 0.41727159f,
+	0.45952222f, 0.50177285f, 0.54402347f, 0.58627410f, 0.62852473f, 0.67077535f,
+	0.71302598f, 0.75527661f, 0.79752724f, 0.83977786f, 0.88202849f, 0.92427912f,
+	0.96652974f, 0.99184110f, 0.95258098f, 0.91332085f, 0.87406072f, 0.83480060f,
+	0.79554047f, 0.75628034f, 0.71702022f, 0.67776009f, 0.63849996f, 0.59923984f,
+	0.55997971f, 0.52071958f, 0.48145946f, 0.44219933f, 0.40293920f, 0.36367908f,
+	0.32441895f, 0.28515882f, 0.24589870f, 0.20663857f, 0.16737844f, 0.12811832f,
+	0.08885819f, 0.04959806f, 0.01033794f, 0.00815890f, 0.04741902f, 0.08667915f,
+	0.12593928f, 0.16519940f, 0.20445953f, 0.24371966f, 0.28297978f, 0.32223991f,
+	0.36150004f, 0.40076016f, 0.44002029f, 0.47928042f, 0.51854054f, 0.55780067f,
+	0.59706080f, 0.63632092f, 0.67558105f, 0.71484118f, 0.75410130f, 0.79336143f,
+	0.83262156f, 0.87188168f, 0.91114181f, 0.95040194f, 0.98966206f, 0.97312492f,
+	0.93664363f, 0.90016234f, 0.86368104f, 0.82719975f, 0.79071845f, 0.75423716f,
+	0.71775587f, 0.68127457f, 0.64479328f, 0.60831199f, 0.57183069f, 0.53534940f,
+	0.49886810f, 0.46238681f, 0.42590552f, 0.38942422f, 0.35294293f, 0.31646163f,
+	0.27998034f, 0.24349905f, 0.20701775f, 0.17053646f, 0.13405517f, 0.09757387f,
+	0.06109258f, 0.02461128f, 0.02687508f, 0.06335637f, 0.09983766f, 0.13631896f,
+	0.17280025f, 0.20928155f, 0.24576284f, 0.28224413f, 0.31872543f, 0.35520672f,
+	0.39168801f, 0.42816931f, 0.46465060f, 0.50113190f, 0.53761319f, 0.57409448f,
+	0.61057578f, 0.64705707f, 0.68353837f, 0.72001966f, 0.75650095f, 0.79298225f,
+	0.82946354f, 0.86594483f, 0.90242613f, 0.93890742f, 0.97538872f, 0.98897015f,
+	0.95507100f, 0.92117186f, 0.88727271f, 0.85337356f, 0.81947442f, 0.78557527f,
+	0.75167612f, 0.71777697f, 0.68387783f, 0.64997868f, 0.61607953f, 0.58218039f,
+	0.54828124f, 0.51438209f, 0.48048295f, 0.44658380f, 0.41268465f, 0.37878551f,
+	0.34488636f, 0.31098721f, 0.27708807f, 0.24318892f, 0.20928977f, 0.17539062f,
+	0.14149148f, 0.10759233f, 0.07369318f, 0.03979404f, 0.00589489f, 0.01102985f,
+	0.04492900f, 0.07882814f, 0.11272729f, 0.14662644f, 0.18052558f, 0.21442473f,
+	0.24832388f, 0.28222303f, 0.31612217f, 0.35002132f, 0.38392047f, 0.41781961f,
+	0.45171876f, 0.48561791f, 0.51951705f, 0.55341620f, 0.58731535f, 0.62121449f,
+	0.65511364f, 0.68901279f, 0.72291193f, 0.75681108f, 0.79071023f, 0.82460938f,
+	0.85850852f, 0.89240767f, 0.92630682f, 0.96020596f, 0.99410511f, 0.97397789f,
+	0.94247812f, 0.91097836f, 0.87947859f, 0.84797883f, 0.81647906f, 0.78497930f,
+	0.75347954f, 0.72197977f, 0.69048001f, 0.65898024f, 0.62748048f, 0.59598071f,
+	0.56448095f, 0.53298118f, 0.50148142f, 0.46998166f, 0.43848189f, 0.40698213f,
+	0.37548236f, 0.34398260f, 0.31248283f, 0.28098307f, 0.24948331f, 0.21798354f,
+	0.18648378f, 0.15498401f, 0.12348425f, 0.09198448f, 0.06048472f, 0.02898495f,
+	0.02602211f, 0.05752188f, 0.08902164f, 0.12052141f, 0.15202117f, 0.18352094f,
+	0.21502070f, 0.24652046f, 0.27802023f, 0.30951999f, 0.34101976f, 0.37251952f,
+	0.40401929f, 0.43551905f, 0.46701882f, 0.49851858f, 0.53001834f, 0.56151811f,
+	0.59301787f, 0.62451764f, 0.65601740f, 0.68751717f, 0.71901693f, 0.75051669f,
+	0.78201646f, 0.81351622f, 0.84501599f, 0.87651575f, 0.90801552f, 0.93951528f,
+	0.97101505f, 0.99766319f, 0.96839298f, 0.93912277f, 0.90985256f, 0.88058235f,
+	0.85131214f, 0.82204193f, 0.79277172f, 0.76350151f, 0.73423130f, 0.70496109f,
+	0.67569088f, 0.64642067f, 0.61715046f, 0.58788025f, 0.55861004f, 0.52933983f,
+	0.50006962f, 0.47079941f, 0.44152920f, 0.41225899f, 0.38298877f, 0.35371856f,
+	0.32444835f, 0.29517814f, 0.26590793f, 0.23663772f, 0.20736751f, 0.17809730f,
+	0.14882709f, 0.11955688f, 0.09028667f, 0.06101646f, 0.03174625f, 0.00247604f,
+	0.00233681f, 0.03160702f, 0.06087723f, 0.09014744f, 0.11941765f, 0.14868786f,
+	0.17795807f, 0.20722828f, 0.23649849f, 0.26576870f, 0.29503891f, 0.32430912f,
+	0.35357933f, 0.38284954f, 0.41211975f, 0.44138996f, 0.47066017f, 0.49993038f,
+	0.52920059f, 0.55847080f, 0.58774101f, 0.61701123f, 0.64628144f, 0.67555165f,
+	0.70482186f, 0.73409207f, 0.76336228f, 0.79263249f, 0.82190270f, 0.85117291f,
+	0.88044312f, 0.90971333f, 0.93898354f, 0.96825375f, 0.99752396f, 0.97510232f,
+	0.94790386f, 0.92070540f, 0.89350693f, 0.86630847f, 0.83911000f, 0.81191154f,
+	0.78471308f, 0.75751461f, 0.73031615f, 0.70311768f, 0.67591922f, 0.64872076f,
+	0.62152229f, 0.59432383f, 0.56712537f, 0.53992690f, 0.51272844f, 0.48552997f,
+	0.45833151f, 0.43113305f, 0.40393458f, 0.37673612f, 0.34953765f, 0.32233919f,
+	0.29514073f, 0.26794226f, 0.24074380f, 0.21354533f, 0.18634687f, 0.15914841f,
+	0.13194994f, 0.10475148f, 0.07755301f, 0.05035455f, 0.02315609f, 0.02489768f,
+	0.05209614f, 0.07929460f, 0.10649307f, 0.13369153f, 0.16089000f, 0.18808846f,
+	0.21528692f, 0.24248539f, 0.26968385f, 0.29688232f, 0.32408078f, 0.35127924f,
+	0.37847771f, 0.40567617f, 0.43287463f, 0.46007310f, 0.48727156f, 0.51447003f,
+	0.54166849f, 0.56886695f, 0.59606542f, 0.62326388f, 0.65046235f, 0.67766081f,
+	0.70485927f, 0.73205774f, 0.75925620f, 0.78645467f, 0.81365313f, 0.84085159f,
+	0.86805006f, 0.89524852f, 0.92244699f, 0.94964545f, 0.97684391f, 0.99624374f,
+	0.97097039f, 0.94569703f, 0.92042367f, 0.89515032f, 0.86987696f, 0.84460361f,
+	0.81933025f, 0.79405689f, 0.76878354f, 0.74351018f, 0.71823683f, 0.69296347f,
+	0.66769012f, 0.64241676f, 0.61714340f, 0.59187005f, 0.56659669f, 0.54132334f,
+	0.51604998f, 0.49077662f, 0.46550327f, 0.44022991f, 0.41495656f, 0.38968320f,
+	0.36440984f, 0.33913649f, 0.31386313f, 0.28858978f, 0.26331642f, 0.23804306f,
+	0.21276971f, 0.18749635f, 0.16222300f, 0.13694964f, 0.11167628f, 0.08640293f,
+	0.06112957f, 0.03585622f, 0.01058286f, 0.00375626f, 0.02902961f, 0.05430297f,
+	0.07957633f, 0.10484968f, 0.13012304f, 0.15539639f, 0.18066975f, 0.20594311f,
+	0.23121646f, 0.25648982f, 0.28176317f, 0.30703653f, 0.33230988f, 0.35758324f,
+	0.38285660f, 0.40812995f, 0.43340331f, 0.45867666f, 0.48395002f, 0.50922338f,
+	0.53449673f, 0.55977009f, 0.58504344f, 0.61031680f, 0.63559016f, 0.66086351f,
+	0.68613687f, 0.71141022f, 0.73668358f, 0.76195694f, 0.78723029f, 0.81250365f,
+	0.83777700f, 0.86305036f, 0.88832372f, 0.91359707f, 0.93887043f, 0.96414378f,
+	0.98941714f, 0.98634930f, 0.96286479f, 0.93938028f, 0.91589578f, 0.89241127f,
+	0.86892676f, 0.84544226f, 0.82195775f, 0.79847324f, 0.77498873f, 0.75150423f,
+	0.72801972f, 0.70453521f, 0.68105071f, 0.65756620f, 0.63408169f, 0.61059718f,
+	0.58711268f, 0.56362817f, 0.54014366f, 0.51665916f, 0.49317465f, 0.46969014f,
+	0.44620564f, 0.42272113f, 0.39923662f, 0.37575211f, 0.35226761f, 0.32878310f,
+	0.30529859f, 0.28181409f, 0.25832958f, 0.23484507f, 0.21136056f, 0.18787606f,
+	0.16439155f, 0.14090704f, 0.11742254f, 0.09393803f, 0.07045352f, 0.04696901f,
+	0.02348451f,
+};
+
+/* 16000 Hz, 50 to 8000 Hz */
+static const uint16_t mel_start_16000[MEL_BANDS] = {
+	4, 9, 14, 20, 27, 34, 42, 51, 61, 72, 84, 97,
+	111, 127, 145, 165, 186, 210, 236, 265, 297, 332, 371, 413,
+};
+static const uint8_t mel_len_16000[MEL_BANDS] = {
+	10, 11, 13, 14, 15, 17, 19, 21, 23, 25, 27, 30,
+	34, 38, 41, 45, 50, 55, 61, 67, 74, 81, 90, 99,
+};
+static const uint16_t mel_offset_16000[MEL_BANDS] = {
+	0, 10, 21, 34, 48, 63, 80, 99, 120, 143, 168, 195,
+	225, 259, 297, 338, 383, 433, 488, 549, 616, 690, 771, 861,
+};
+static const float mel_weights_16000[960] = {
+	0.16180110f, 0.36405247f, 0.56630384f, 0.76855522f, 0.97080659f, 0.84310350f,
+	0.65973988f, 0.47637627f, 0.29301266f, 0.10964904f, 0.15689650f, 0.34026012f,
+	0.52362373f, 0.70698734f, 0.89035096f, 0.93316945f, 0.76692972f, 0.60068998f,
+	0.43445025f, 0.26821051f, 0.10197078f, 0.06683055f, 0.23307028f, 0.39931002f,
+	0.56554975f, 0.73178949f, 0.89802922f, 0.94173296f, 0.79101795f, 0.64030293f,
+	0.48958792f, 0.33887290f, 0.18815789f, 0.03744287f, 0.05826704f, 0.20898205f,
+	0.35969707f, 0.51041208f, 0.66112710f, 0.81184211f, 0.96255713f, 0.89730607f,
+	0.76066596f, 0.62402585f, 0.48738574f, 0.35074563f, 0.21410552f, 0.07746541f,
+	0.10269393f, 0.23933404f, 0.37597415f, 0.51261426f, 0.64925437f, 0.78589448f,
+	0.92253459f, 0.94635148f, 0.82247186f, 0.69859223f, 0.57471261f, 0.45083299f,
+	0.32695336f, 0.20307374f, 0.07919411f, 0.05364852f, 0.17752814f, 0.30140777f,
+	0.42528739f, 0.54916701f, 0.67304664f, 0.79692626f, 0.92080589f, 0.95948756f,
+	0.84717675f, 0.73486594f, 0.62255513f, 0.51024432f, 0.39793351f, 0.28562270f,
+	0.17331189f, 0.06100108f, 0.04051244f, 0.15282325f, 0.26513406f, 0.37744487f,
+	0.48975568f, 0.60206649f, 0.71437730f, 0.82668811f, 0.93899892f, 0.95348196f,
+	0.85165958f, 0.74983720f, 0.64801482f, 0.54619244f, 0.44437006f, 0.34254768f,
+	0.24072530f, 0.13890292f, 0.03708054f, 0.04651804f, 0.14834042f, 0.25016280f,
+	0.35198518f, 0.45380756f, 0.55562994f, 0.65745232f, 0.75927470f, 0.86109708f,
+	0.96291946f, 0.94130424f, 0.84899081f, 0.75667737f, 0.66436393f, 0.57205050f,
+	0.47973706f, 0.38742362f, 0.29511018f, 0.20279675f, 0.11048331f, 0.01816987f,
+	0.05869576f, 0.15100919f, 0.24332263f, 0.33563607f, 0.42794950f, 0.52026294f,
+	0.61257638f, 0.70488982f, 0.79720325f, 0.88951669f, 0.98183013f, 0.93278052f,
+	0.84908801f, 0.76539550f, 0.68170299f, 0.59801047f, 0.51431796f, 0.43062545f,
+	0.34693294f, 0.26324043f, 0.17954792f, 0.09585540f, 0.01216289f, 0.06721948f,
+	0.15091199f, 0.23460450f, 0.31829701f, 0.40198953f, 0.48568204f, 0.56937455f,
+	0.65306706f, 0.73675957f, 0.82045208f, 0.90414460f, 0.98783711f, 0.93515036f,
+	0.85927368f, 0.78339701f, 0.70752034f, 0.63164366f, 0.55576699f, 0.47989032f,
+	0.40401364f, 0.32813697f, 0.25226029f, 0.17638362f, 0.10050695f, 0.02463027f,
+	0.06484964f, 0.14072632f, 0.21660299f, 0.29247966f, 0.36835634f, 0.44423301f,
+	0.52010968f, 0.59598636f, 0.67186303f, 0.74773971f, 0.82361638f, 0.89949305f,
+	0.97536973f, 0.95353938f, 0.88474864f, 0.81595790f, 0.74716717f, 0.67837643f,
+	0.60958569f, 0.54079495f, 0.47200422f, 0.40321348f, 0.33442274f, 0.26563201f,
+	0.19684127f, 0.12805053f, 0.05925979f, 0.04646062f, 0.11525136f, 0.18404210f,
+	0.25283283f, 0.32162357f, 0.39041431f, 0.45920505f, 0.52799578f, 0.59678652f,
+	0.66557726f, 0.73436799f, 0.80315873f, 0.87194947f, 0.94074021f, 0.99135913f,
+	0.92899259f, 0.86662605f, 0.80425951f, 0.74189297f, 0.67952643f, 0.61715990f,
+	0.55479336f, 0.49242682f, 0.43006028f, 0.36769374f, 0.30532720f, 0.24296066f,
+	0.18059412f, 0.11822758f, 0.05586105f, 0.00864087f, 0.07100741f, 0.13337395f,
+	0.19574049f, 0.25810703f, 0.32047357f, 0.38284010f, 0.44520664f, 0.50757318f,
+	0.56993972f, 0.63230626f, 0.69467280f, 0.75703934f, 0.81940588f, 0.88177242f,
+	0.94413895f, 0.99410204f, 0.93755976f, 0.88101748f, 0.82447520f, 0.76793291f,
+	0.71139063f, 0.65484835f, 0.59830607f, 0.54176379f, 0.48522151f, 0.42867923f,
+	0.37213695f, 0.31559467f, 0.25905239f, 0.20251011f, 0.14596783f, 0.08942554f,
+	0.03288326f, 0.00589796f, 0.06244024f, 0.11898252f, 0.17552480f, 0.23206709f,
+	0.28860937f, 0.34515165f, 0.40169393f, 0.45823621f, 0.51477849f, 0.57132077f,
+	0.62786305f, 0.68440533f, 0.74094761f, 0.79748989f, 0.85403217f, 0.91057446f,
+	0.96711674f, 0.97855044f, 0.92728850f, 0.87602657f, 0.82476463f, 0.77350270f,
+	0.72224076f, 0.67097882f, 0.61971689f, 0.56845495f, 0.51719302f, 0.46593108f,
+	0.41466914f, 0.36340721f, 0.31214527f, 0.26088334f, 0.20962140f, 0.15835946f,
+	0.10709753f, 0.05583559f, 0.00457366f, 0.02144956f, 0.07271150f, 0.12397343f,
+	0.17523537f, 0.22649730f, 0.27775924f, 0.32902118f, 0.38028311f, 0.43154505f,
+	0.48280698f, 0.53406892f, 0.58533086f, 0.63659279f, 0.68785473f, 0.73911666f,
+	0.79037860f, 0.84164054f, 0.89290247f, 0.94416441f, 0.99542634f, 0.95767182f,
+	0.91119711f, 0.86472240f, 0.81824770f, 0.77177299f, 0.72529828f, 0.67882357f,
+	0.63234886f, 0.58587415f, 0.53939944f, 0.49292473f, 0.44645002f, 0.39997531f,
+	0.35350060f, 0.30702589f, 0.26055118f, 0.21407647f, 0.16760176f, 0.12112705f,
+	0.07465234f, 0.02817763f, 0.04232818f, 0.08880289f, 0.13527760f, 0.18175230f,
+	0.22822701f, 0.27470172f, 0.32117643f, 0.36765114f, 0.41412585f, 0.46060056f,
+	0.50707527f, 0.55354998f, 0.60002469f, 0.64649940f, 0.69297411f, 0.73944882f,
+	0.78592353f, 0.83239824f, 0.87887295f, 0.92534766f, 0.97182237f, 0.98341164f,
+	0.94127709f, 0.89914254f, 0.85700799f, 0.81487344f, 0.77273889f, 0.73060434f,
+	0.68846979f, 0.64633524f, 0.60420069f, 0.56206614f, 0.51993159f, 0.47779704f,
+	0.43566249f, 0.39352794f, 0.35139338f, 0.30925883f, 0.26712428f, 0.22498973f,
+	0.18285518f, 0.14072063f, 0.09858608f, 0.05645153f, 0.01431698f, 0.01658836f,
+	0.05872291f, 0.10085746f, 0.14299201f, 0.18512656f, 0.22726111f, 0.26939566f,
+	0.31153021f, 0.35366476f, 0.39579931f, 0.43793386f, 0.48006841f, 0.52220296f,
+	0.56433751f, 0.60647206f, 0.64860662f, 0.69074117f, 0.73287572f, 0.77501027f,
+	0.81714482f, 0.85927937f, 0.90141392f, 0.94354847f, 0.98568302f, 0.97478025f,
+	0.93658054f, 0.89838083f, 0.86018112f, 0.82198141f, 0.78378170f, 0.74558200f,
+	0.70738229f, 0.66918258f, 0.63098287f, 0.59278316f, 0.55458345f, 0.51638375f,
+	0.47818404f, 0.43998433f, 0.40178462f, 0.36358491f, 0.32538521f, 0.28718550f,
+	0.24898579f, 0.21078608f, 0.17258637f, 0.13438666f, 0.09618696f, 0.05798725f,
+	0.01978754f, 0.02521975f, 0.06341946f, 0.10161917f, 0.13981888f, 0.17801859f,
+	0.21621830f, 0.25441800f, 0.29261771f, 0.33081742f, 0.36901713f, 0.40721684f,
+	0.44541655f, 0.48361625f, 0.52181596f, 0.56001567f, 0.59821538f, 0.63641509f,
+	0.67461479f, 0.71281450f, 0.75101421f, 0.78921392f, 0.82741363f, 0.86561334f,
+	0.90381304f, 0.94201275f, 0.98021246f, 0.98330730f, 0.94867497f, 0.91404264f,
+	0.87941031f, 0.84477797f, 0.81014564f, 0.77551331f, 0.74088098f, 0.70624865f,
+	0.67161632f, 0.63698399f, 0.60235166f, 0.56771933f, 0.53308699f, 0.49845466f,
+	0.46382233f, 0.42919000f, 0.39455767f, 0.35992534f, 0.32529301f, 0.29066068f,
+	0.25602834f, 0.22139601f, 0.18676368f, 0.15213135f, 0.11749902f, 0.08286669f,
+	0.04823436f, 0.01360203f, 0.01669270f, 0.05132503f, 0.08595736f, 0.12058969f,
+	0.15522203f, 0.18985436f, 0.22448669f, 0.25911902f, 0.29375135f, 0.32838368f,
+	0.36301601f, 0.39764834f, 0.43228067f, 0.46691301f, 0.50154534f, 0.53617767f,
+	0.57081000f, 0.60544233f, 0.64007466f, 0.67470699f, 0.70933932f, 0.74397166f,
+	0.77860399f, 0.81323632f, 0.84786865f, 0.88250098f, 0.91713331f, 0.95176564f,
+	0.98639797f, 0.98093366f, 0.94953556f, 0.91813746f, 0.88673936f, 0.85534125f,
+	0.82394315f, 0.79254505f, 0.76114694f, 0.72974884f, 0.69835074f, 0.66695264f,
+	0.63555453f, 0.60415643f, 0.57275833f, 0.54136023f, 0.50996212f, 0.47856402f,
+	0.44716592f, 0.41576781f, 0.38436971f, 0.35297161f, 0.32157351f, 0.29017540f,
+	0.25877730f, 0.22737920f, 0.19598110f, 0.16458299f, 0.13318489f, 0.10178679f,
+	0.07038868f, 0.03899058f, 0.00759248f, 0.01906634f, 0.05046444f, 0.08186254f,
+	0.11326064f, 0.14465875f, 0.17605685f, 0.20745495f, 0.23885306f, 0.27025116f,
+	0.30164926f, 0.33304736f, 0.36444547f, 0.39584357f, 0.42724167f, 0.45863977f,
+	0.49003788f, 0.52143598f, 0.55283408f, 0.58423219f, 0.61563029f, 0.64702839f,
+	0.67842649f, 0.70982460f, 0.74122270f, 0.77262080f, 0.80401890f, 0.83541701f,
+	0.86681511f, 0.89821321f, 0.92961132f, 0.96100942f, 0.99240752f, 0.97841752f,
+	0.94995161f, 0.92148570f, 0.89301979f, 0.86455388f, 0.83608797f, 0.80762206f,
+	0.77915615f, 0.75069024f, 0.72222433f, 0.69375842f, 0.66529250f, 0.63682659f,
+	0.60836068f, 0.57989477f, 0.55142886f, 0.52296295f, 0.49449704f, 0.46603113f,
+	0.43756522f, 0.40909931f, 0.38063339f, 0.35216748f, 0.32370157f, 0.29523566f,
+	0.26676975f, 0.23830384f, 0.20983793f, 0.18137202f, 0.15290611f, 0.12444020f,
+	0.09597428f, 0.06750837f, 0.03904246f, 0.01057655f, 0.02158248f, 0.05004839f,
+	0.07851430f, 0.10698021f, 0.13544612f, 0.16391203f, 0.19237794f, 0.22084385f,
+	0.24930976f, 0.27777567f, 0.30624158f, 0.33470750f, 0.36317341f, 0.39163932f,
+	0.42010523f, 0.44857114f, 0.47703705f, 0.50550296f, 0.53396887f, 0.56243478f,
+	0.59090069f, 0.61936661f, 0.64783252f, 0.67629843f, 0.70476434f, 0.73323025f,
+	0.76169616f, 0.79016207f, 0.81862798f, 0.84709389f, 0.87555980f, 0.90402572f,
+	0.93249163f, 0.96095754f, 0.98942345f, 0.98378128f, 0.95797373f, 0.93216619f,
+	0.90635864f, 0.88055109f, 0.85474354f, 0.82893599f, 0.80312844f, 0.77732089f,
+	0.75151334f, 0.72570579f, 0.69989824f, 0.67409069f, 0.64828314f, 0.62247559f,
+	0.59666804f, 0.57086049f, 0.54505294f, 0.51924540f, 0.49343785f, 0.46763030f,
+	0.44182275f, 0.41601520f, 0.39020765f, 0.36440010f, 0.33859255f, 0.31278500f,
+	0.28697745f, 0.26116990f, 0.23536235f, 0.20955480f, 0.18374725f, 0.15793970f,
+	0.13213215f, 0.10632461f, 0.08051706f, 0.05470951f, 0.02890196f, 0.00309441f,
+	0.01621872f, 0.04202627f, 0.06783381f, 0.09364136f, 0.11944891f, 0.14525646f,
+	0.17106401f, 0.19687156f, 0.22267911f, 0.24848666f, 0.27429421f, 0.30010176f,
+	0.32590931f, 0.35171686f, 0.37752441f, 0.40333196f, 0.42913951f, 0.45494706f,
+	0.48075460f, 0.50656215f, 0.53236970f, 0.55817725f, 0.58398480f, 0.60979235f,
+	0.63559990f, 0.66140745f, 0.68721500f, 0.71302255f, 0.73883010f, 0.76463765f,
+	0.79044520f, 0.81625275f, 0.84206030f, 0.86786785f, 0.89367539f, 0.91948294f,
+	0.94529049f, 0.97109804f, 0.99690559f, 0.97940798f, 0.95601054f, 0.93261309f,
+	0.90921565f, 0.88581820f, 0.86242075f, 0.83902331f, 0.81562586f, 0.79222842f,
+	0.76883097f, 0.74543353f, 0.72203608f, 0.69863863f, 0.67524119f, 0.65184374f,
+	0.62844630f, 0.60504885f, 0.58165141f, 0.55825396f, 0.53485651f, 0.51145907f,
+	0.48806162f, 0.46466418f, 0.44126673f, 0.41786929f, 0.39447184f, 0.37107440f,
+	0.34767695f, 0.32427950f, 0.30088206f, 0.27748461f, 0.25408717f, 0.23068972f,
+	0.20729228f, 0.18389483f, 0.16049738f, 0.13709994f, 0.11370249f, 0.09030505f,
+	0.06690760f, 0.04351016f, 0.02011271f, 0.02059202f, 0.04398946f, 0.06738691f,
+	0.09078435f, 0.11418180f, 0.13757925f, 0.16097669f, 0.18437414f, 0.20777158f,
+	0.23116903f, 0.25456647f, 0.27796392f, 0.30136137f, 0.32475881f, 0.34815626f,
+	0.37155370f, 0.39495115f, 0.41834859f, 0.44174604f, 0.46514349f, 0.48854093f,
+	0.51193838f, 0.53533582f, 0.55873327f, 0.58213071f, 0.60552816f, 0.62892560f,
+	0.65232305f, 0.67572050f, 0.69911794f, 0.72251539f, 0.74591283f, 0.76931028f,
+	0.79270772f, 0.81610517f, 0.83950262f, 0.86290006f, 0.88629751f, 0.90969495f,
+	0.93309240f, 0.95648984f, 0.97988729f, 0.99702202f, 0.97580960f, 0.95459719f,
+	0.93338477f, 0.91217236f, 0.89095994f, 0.86974752f, 0.84853511f, 0.82732269f,
+	0.80611028f, 0.78489786f, 0.76368545f, 0.74247303f, 0.72126061f, 0.70004820f,
+	0.67883578f, 0.65762337f, 0.63641095f, 0.61519854f, 0.59398612f, 0.57277371f,
+	0.55156129f, 0.53034887f, 0.50913646f, 0.48792404f, 0.46671163f, 0.44549921f,
+	0.42428680f, 0.40307438f, 0.38186196f, 0.36064955f, 0.33943713f, 0.31822472f,
+	0.29701230f, 0.27579989f, 0.25458747f, 0.23337506f, 0.21216264f, 0.19095022f,
+	0.16973781f, 0.14852539f, 0.12731298f, 0.10610056f, 0.08488815f, 0.06367573f,
+	0.04246331f, 0.02125090f, 0.00003848f, 0.00297798f, 0.02419040f, 0.04540281f,
+	0.06661523f, 0.08782764f, 0.10904006f, 0.13025248f, 0.15146489f, 0.17267731f,
+	0.19388972f, 0.21510214f, 0.23631455f, 0.25752697f, 0.27873939f, 0.29995180f,
+	0.32116422f, 0.34237663f, 0.36358905f, 0.38480146f, 0.40601388f, 0.42722629f,
+	0.44843871f, 0.46965113f, 0.49086354f, 0.51207596f, 0.53328837f, 0.55450079f,
+	0.57571320f, 0.59692562f, 0.61813804f, 0.63935045f, 0.66056287f, 0.68177528f,
+	0.70298770f, 0.72420011f, 0.74541253f, 0.76662494f, 0.78783736f, 0.80904978f,
+	0.83026219f, 0.85147461f, 0.87268702f, 0.89389944f, 0.91511185f, 0.93632427f,
+	0.95753669f, 0.97874910f, 0.99996152f, 0.98080345f, 0.96157201f, 0.94234057f,
+	0.92310913f, 0.90387769f, 0.88464625f, 0.86541481f, 0.84618337f, 0.82695193f,
+	0.80772049f, 0.78848905f, 0.76925761f, 0.75002617f, 0.73079473f, 0.71156329f,
+	0.69233185f, 0.67310041f, 0.65386897f, 0.63463753f, 0.61540609f, 0.59617465f,
+	0.57694321f, 0.55771177f, 0.53848033f, 0.51924888f, 0.50001744f, 0.48078600f,
+	0.46155456f, 0.44232312f, 0.42309168f, 0.40386024f, 0.38462880f, 0.36539736f,
+	0.34616592f, 0.32693448f, 0.30770304f, 0.28847160f, 0.26924016f, 0.25000872f,
+	0.23077728f, 0.21154584f, 0.19231440f, 0.17308296f, 0.15385152f, 0.13462008f,
+	0.11538864f, 0.09615720f, 0.07692576f, 0.05769432f, 0.03846288f, 0.01923144f,
+};
+
+/* 32000 Hz, 50 to 8000 Hz */
+static const uint16_t mel_start_32000[MEL_BANDS] = {
+	2, 5, 7, 10, 14, 17, 21, 26, 31, 36, 42, 49,
+	56, 64, 73, 83, 93, 105, 118, 133, 149, 166, 186, 207,
+};
+static const uint8_t mel_len_32000[MEL_BANDS] = {
+	5, 5, 7, 7, 7, 9, 10, 10, 11, 13, 14, 15,
+	17, 19, 20, 22, 25, 28, 31, 33, 37, 41, 45, 50,
+};
+static const uint16_t mel_offset_32000[MEL_BANDS] = {
+	0, 5, 10, 17, 24, 31, 40, 50, 60, 71, 84, 98,
+	113, 130, 149, 169, 191, 216, 244, 275, 308, 345, 386, 431,
+};
+static const float mel_weights_32000[481] = {
+	0.16180110f, 0.56630384f, 0.97080659f, 0.65973988f, 0.29301266f, 0.34026012f,
+	0.70698734f, 0.93316945f, 0.60068998f, 0.26821051f, 0.06683055f, 0.39931002f,
+	0.73178949f, 0.94173296f, 0.64030293f, 0.33887290f, 0.03744287f, 0.05826704f,
+	0.35969707f, 0.66112710f, 0.96255713f, 0.76066596f, 0.48738574f, 0.21410552f,
+	0.23933404f, 0.51261426f, 0.78589448f, 0.94635148f, 0.69859223f, 0.45083299f,
+	0.20307374f, 0.05364852f, 0.30140777f, 0.54916701f, 0.79692626f, 0.95948756f,
+	0.73486594f, 0.51024432f, 0.28562270f, 0.06100108f, 0.04051244f, 0.26513406f,
+	0.48975568f, 0.71437730f, 0.93899892f, 0.85165958f, 0.64801482f, 0.44437006f,
+	0.24072530f, 0.03708054f, 0.14834042f, 0.35198518f, 0.55562994f, 0.75927470f,
+	0.96291946f, 0.84899081f, 0.66436393f, 0.47973706f, 0.29511018f, 0.11048331f,
+	0.15100919f, 0.33563607f, 0.52026294f, 0.70488982f, 0.88951669f, 0.93278052f,
+	0.76539550f, 0.59801047f, 0.43062545f, 0.26324043f, 0.09585540f, 0.06721948f,
+	0.23460450f, 0.40198953f, 0.56937455f, 0.73675957f, 0.90414460f, 0.93515036f,
+	0.78339701f, 0.63164366f, 0.47989032f, 0.32813697f, 0.17638362f, 0.02463027f,
+	0.06484964f, 0.21660299f, 0.36835634f, 0.52010968f, 0.67186303f, 0.82361638f,
+	0.97536973f, 0.88474864f, 0.74716717f, 0.60958569f, 0.47200422f, 0.33442274f,
+	0.19684127f, 0.05925979f, 0.11525136f, 0.25283283f, 0.39041431f, 0.52799578f,
+	0.66557726f, 0.80315873f, 0.94074021f, 0.92899259f, 0.80425951f, 0.67952643f,
+	0.55479336f, 0.43006028f, 0.30532720f, 0.18059412f, 0.05586105f, 0.07100741f,
+	0.19574049f, 0.32047357f, 0.44520664f, 0.56993972f, 0.69467280f, 0.81940588f,
+	0.94413895f, 0.93755976f, 0.82447520f, 0.71139063f, 0.59830607f, 0.48522151f,
+	0.37213695f, 0.25905239f, 0.14596783f, 0.03288326f, 0.06244024f, 0.17552480f,
+	0.28860937f, 0.40169393f, 0.51477849f, 0.62786305f, 0.74094761f, 0.85403217f,
+	0.96711674f, 0.92728850f, 0.82476463f, 0.72224076f, 0.61971689f, 0.51719302f,
+	0.41466914f, 0.31214527f, 0.20962140f, 0.10709753f, 0.00457366f, 0.07271150f,
+	0.17523537f, 0.27775924f, 0.38028311f, 0.48280698f, 0.58533086f, 0.68785473f,
+	0.79037860f, 0.89290247f, 0.99542634f, 0.91119711f, 0.81824770f, 0.72529828f,
+	0.63234886f, 0.53939944f, 0.44645002f, 0.35350060f, 0.26055118f, 0.16760176f,
+	0.07465234f, 0.08880289f, 0.18175230f, 0.27470172f, 0.36765114f, 0.46060056f,
+	0.55354998f, 0.64649940f, 0.73944882f, 0.83239824f, 0.92534766f, 0.98341164f,
+	0.89914254f, 0.81487344f, 0.73060434f, 0.64633524f, 0.56206614f, 0.47779704f,
+	0.39352794f, 0.30925883f, 0.22498973f, 0.14072063f, 0.05645153f, 0.01658836f,
+	0.10085746f, 0.18512656f, 0.26939566f, 0.35366476f, 0.43793386f, 0.52220296f,
+	0.60647206f, 0.69074117f, 0.77501027f, 0.85927937f, 0.94354847f, 0.97478025f,
+	0.89838083f, 0.82198141f, 0.74558200f, 0.66918258f, 0.59278316f, 0.51638375f,
+	0.43998433f, 0.36358491f, 0.28718550f, 0.21078608f, 0.13438666f, 0.05798725f,
+	0.02521975f, 0.10161917f, 0.17801859f, 0.25441800f, 0.33081742f, 0.40721684f,
+	0.48361625f, 0.56001567f, 0.63641509f, 0.71281450f, 0.78921392f, 0.86561334f,
+	0.94201275f, 0.98330730f, 0.91404264f, 0.84477797f, 0.77551331f, 0.70624865f,
+	0.63698399f, 0.56771933f, 0.49845466f, 0.42919000f, 0.35992534f, 0.29066068f,
+	0.22139601f, 0.15213135f, 0.08286669f, 0.01360203f, 0.01669270f, 0.08595736f,
+	0.15522203f, 0.22448669f, 0.29375135f, 0.36301601f, 0.43228067f, 0.50154534f,
+	0.57081000f, 0.64007466f, 0.70933932f, 0.77860399f, 0.84786865f, 0.91713331f,
+	0.98639797f, 0.94953556f, 0.88673936f, 0.82394315f, 0.76114694f, 0.69835074f,
+	0.63555453f, 0.57275833f, 0.50996212f, 0.44716592f, 0.38436971f, 0.32157351f,
+	0.25877730f, 0.19598110f, 0.13318489f, 0.07038868f, 0.00759248f, 0.05046444f,
+	0.11326064f, 0.17605685f, 0.23885306f, 0.30164926f, 0.36444547f, 0.42724167f,
+	0.49003788f, 0.55283408f, 0.61563029f, 0.67842649f, 0.74122270f, 0.80401890f,
+	0.86681511f, 0.92961132f, 0.99240752f, 0.94995161f, 0.89301979f, 0.83608797f,
+	0.77915615f, 0.72222433f, 0.66529250f, 0.60836068f, 0.55142886f, 0.49449704f,
+	0.43756522f, 0.38063339f, 0.32370157f, 0.26676975f, 0.20983793f, 0.15290611f,
+	0.09597428f, 0.03904246f, 0.05004839f, 0.10698021f, 0.16391203f, 0.22084385f,
+	0.27777567f, 0.33470750f, 0.39163932f, 0.44857114f, 0.50550296f, 0.56243478f,
+	0.61936661f, 0.67629843f, 0.73323025f, 0.79016207f, 0.84709389f, 0.90402572f,
+	0.96095754f, 0.98378128f, 0.93216619f, 0.88055109f, 0.82893599f, 0.77732089f,
+	0.72570579f, 0.67409069f, 0.62247559f, 0.57086049f, 0.51924540f, 0.46763030f,
+	0.41601520f, 0.36440010f, 0.31278500f, 0.26116990f, 0.20955480f, 0.15793970f,
+	0.10632461f, 0.05470951f, 0.00309441f, 0.01621872f, 0.06783381f, 0.11944891f,
+	0.17106401f, 0.22267911f, 0.27429421f, 0.32590931f, 0.37752441f, 0.42913951f,
+	0.48075460f, 0.53236970f, 0.58398480f, 0.63559990f, 0.68721500f, 0.73883010f,
+	0.79044520f, 0.84206030f, 0.89367539f, 0.94529049f, 0.99690559f, 0.95601054f,
+	0.90921565f, 0.86242075f, 0.81562586f, 0.76883097f, 0.72203608f, 0.67524119f,
+	0.62844630f, 0.58165141f, 0.53485651f, 0.48806162f, 0.44126673f, 0.39447184f,
+	0.34767695f, 0.30088206f, 0.25408717f, 0.20729228f, 0.16049738f, 0.11370249f,
+	0.06690760f, 0.02011271f, 0.04398946f, 0.09078435f, 0.13757925f, 0.18437414f,
+	0.23116903f, 0.27796392f, 0.32475881f, 0.37155370f, 0.41834859f, 0.46514349f,
+	0.51193838f, 0.55873327f, 0.60552816f, 0.65232305f, 0.69911794f, 0.74591283f,
+	0.79270772f, 0.83950262f, 0.88629751f, 0.93309240f, 0.97988729f, 0.97580960f,
+	0.93338477f, 0.89095994f, 0.84853511f, 0.80611028f, 0.76368545f, 0.72126061f,
+	0.67883578f, 0.63641095f, 0.59398612f, 0.55156129f, 0.50913646f, 0.46671163f,
+	0.42428680f, 0.38186196f, 0.33943713f, 0.29701230f, 0.25458747f, 0.21216264f,
+	0.16973781f, 0.12731298f, 0.08488815f, 0.04246331f, 0.00003848f, 0.02419040f,
+	0.06661523f, 0.10904006f, 0.15146489f, 0.19388972f, 0.23631455f, 0.27873939f,
+	0.32116422f, 0.36358905f, 0.40601388f, 0.44843871f, 0.49086354f, 0.53328837f,
+	0.57571320f, 0.61813804f, 0.66056287f, 0.70298770f, 0.74541253f, 0.78783736f,
+	0.83026219f, 0.87268702f, 0.91511185f, 0.95753669f, 0.99996152f, 0.96157201f,
+	0.92310913f, 0.88464625f, 0.84618337f, 0.80772049f, 0.76925761f, 0.73079473f,
+	0.69233185f, 0.65386897f, 0.61540609f, 0.57694321f, 0.53848033f, 0.50001744f,
+	0.46155456f, 0.42309168f, 0.38462880f, 0.34616592f, 0.30770304f, 0.26924016f,
+	0.23077728f, 0.19231440f, 0.15385152f, 0.11538864f, 0.07692576f, 0.03846288f,
+	0.00000000f,
+};
+
+/* 48000 Hz, 50 to 8000 Hz */
+static const uint16_t mel_start_48000[MEL_BANDS] = {
+	2, 3, 5, 7, 9, 12, 14, 17, 21, 24, 28, 33,
+	37, 43, 49, 55, 62, 70, 79, 89, 99, 111, 124, 138,
+};
+static const uint8_t mel_len_48000[MEL_BANDS] = {
+	3, 4, 4, 5, 5, 5, 7, 7, 7, 9, 9, 10,
+	12, 12, 13, 15, 17, 19, 20, 22, 25, 27, 30, 33,
+};
+static const uint16_t mel_offset_48000[MEL_BANDS] = {
+	0, 3, 7, 11, 16, 21, 26, 33, 40, 47, 56, 65,
+	75, 87, 99, 112, 127, 144, 163, 183, 205, 230, 257, 287,
+};
+static const float mel_weights_48000[320] = {
+	0.56630384f, 0.84310350f, 0.29301266f, 0.15689650f, 0.70698734f, 0.76692972f,
+	0.26821051f, 0.23307028f, 0.73178949f, 0.79101795f, 0.33887290f, 0.20898205f,
+	0.66112710f, 0.89730607f, 0.48738574f, 0.07746541f, 0.10269393f, 0.51261426f,
+	0.92253459f, 0.69859223f, 0.32695336f, 0.30140777f, 0.67304664f, 0.95948756f,
+	0.62255513f, 0.28562270f, 0.04051244f, 0.37744487f, 0.71437730f, 0.95348196f,
+	0.64801482f, 0.34254768f, 0.03708054f, 0.04651804f, 0.35198518f, 0.65745232f,
+	0.96291946f, 0.75667737f, 0.47973706f, 0.20279675f, 0.24332263f, 0.52026294f,
+	0.79720325f, 0.93278052f, 0.68170299f, 0.43062545f, 0.17954792f, 0.06721948f,
+	0.31829701f, 0.56937455f, 0.82045208f, 0.93515036f, 0.70752034f, 0.47989032f,
+	0.25226029f, 0.02463027f, 0.06484964f, 0.29247966f, 0.52010968f, 0.74773971f,
+	0.97536973f, 0.81595790f, 0.60958569f, 0.40321348f, 0.19684127f, 0.18404210f,
+	0.39041431f, 0.59678652f, 0.80315873f, 0.99135913f, 0.80425951f, 0.61715990f,
+	0.43006028f, 0.24296066f, 0.05586105f, 0.00864087f, 0.19574049f, 0.38284010f,
+	0.56993972f, 0.75703934f, 0.94413895f, 0.88101748f, 0.71139063f, 0.54176379f,
+	0.37213695f, 0.20251011f, 0.03288326f, 0.11898252f, 0.28860937f, 0.45823621f,
+	0.62786305f, 0.79748989f, 0.96711674f, 0.87602657f, 0.72224076f, 0.56845495f,
+	0.41466914f, 0.26088334f, 0.10709753f, 0.12397343f, 0.27775924f, 0.43154505f,
+	0.58533086f, 0.73911666f, 0.89290247f, 0.95767182f, 0.81824770f, 0.67882357f,
+	0.53939944f, 0.39997531f, 0.26055118f, 0.12112705f, 0.04232818f, 0.18175230f,
+	0.32117643f, 0.46060056f, 0.60002469f, 0.73944882f, 0.87887295f, 0.98341164f,
+	0.85700799f, 0.73060434f, 0.60420069f, 0.47779704f, 0.35139338f, 0.22498973f,
+	0.09858608f, 0.01658836f, 0.14299201f, 0.26939566f, 0.39579931f, 0.52220296f,
+	0.64860662f, 0.77501027f, 0.90141392f, 0.97478025f, 0.86018112f, 0.74558200f,
+	0.63098287f, 0.51638375f, 0.40178462f, 0.28718550f, 0.17258637f, 0.05798725f,
+	0.02521975f, 0.13981888f, 0.25441800f, 0.36901713f, 0.48361625f, 0.59821538f,
+	0.71281450f, 0.82741363f, 0.94201275f, 0.94867497f, 0.84477797f, 0.74088098f,
+	0.63698399f, 0.53308699f, 0.42919000f, 0.32529301f, 0.22139601f, 0.11749902f,
+	0.01360203f, 0.05132503f, 0.15522203f, 0.25911902f, 0.36301601f, 0.46691301f,
+	0.57081000f, 0.67470699f, 0.77860399f, 0.88250098f, 0.98639797f, 0.91813746f,
+	0.82394315f, 0.72974884f, 0.63555453f, 0.54136023f, 0.44716592f, 0.35297161f,
+	0.25877730f, 0.16458299f, 0.07038868f, 0.08186254f, 0.17605685f, 0.27025116f,
+	0.36444547f, 0.45863977f, 0.55283408f, 0.64702839f, 0.74122270f, 0.83541701f,
+	0.92961132f, 0.97841752f, 0.89301979f, 0.80762206f, 0.72222433f, 0.63682659f,
+	0.55142886f, 0.46603113f, 0.38063339f, 0.29523566f, 0.20983793f, 0.12444020f,
+	0.03904246f, 0.02158248f, 0.10698021f, 0.19237794f, 0.27777567f, 0.36317341f,
+	0.44857114f, 0.53396887f, 0.61936661f, 0.70476434f, 0.79016207f, 0.87555980f,
+	0.96095754f, 0.95797373f, 0.88055109f, 0.80312844f, 0.72570579f, 0.64828314f,
+	0.57086049f, 0.49343785f, 0.41601520f, 0.33859255f, 0.26116990f, 0.18374725f,
+	0.10632461f, 0.02890196f, 0.04202627f, 0.11944891f, 0.19687156f, 0.27429421f,
+	0.35171686f, 0.42913951f, 0.50656215f, 0.58398480f, 0.66140745f, 0.73883010f,
+	0.81625275f, 0.89367539f, 0.97109804f, 0.95601054f, 0.88581820f, 0.81562586f,
+	0.74543353f, 0.67524119f, 0.60504885f, 0.53485651f, 0.46466418f, 0.39447184f,
+	0.32427950f, 0.25408717f, 0.18389483f, 0.11370249f, 0.04351016f, 0.04398946f,
+	0.11418180f, 0.18437414f, 0.25456647f, 0.32475881f, 0.39495115f, 0.46514349f,
+	0.53533582f, 0.60552816f, 0.67572050f, 0.74591283f, 0.81610517f, 0.88629751f,
+	0.95648984f, 0.97580960f, 0.91217236f, 0.84853511f, 0.78489786f, 0.72126061f,
+	0.65762337f, 0.59398612f, 0.53034887f, 0.46671163f, 0.40307438f, 0.33943713f,
+	0.27579989f, 0.21216264f, 0.14852539f, 0.08488815f, 0.02125090f, 0.02419040f,
+	0.08782764f, 0.15146489f, 0.21510214f, 0.27873939f, 0.34237663f, 0.40601388f,
+	0.46965113f, 0.53328837f, 0.59692562f, 0.66056287f, 0.72420011f, 0.78783736f,
+	0.85147461f, 0.91511185f, 0.97874910f, 0.96157201f, 0.90387769f, 0.84618337f,
+	0.78848905f, 0.73079473f, 0.67310041f, 0.61540609f, 0.55771177f, 0.50001744f,
+	0.44232312f, 0.38462880f, 0.32693448f, 0.26924016f, 0.21154584f, 0.15385152f,
+	0.09615720f, 0.03846288f,
+};
+
+#elif DSP_FFT_POINTS == 2048
+
+/* 8000 Hz, 50 to 4000 Hz */
+static const uint16_t mel_start_8000[MEL_BANDS] = {
+	13, 28, 44, 61, 79, 98, 120, 142, 167, 193, 221, 252,
+	285, 320, 358, 399, 443, 490, 541, 596, 655, 718, 787, 860,
+};
+static const uint8_t mel_len_8000[MEL_BANDS] = {
+	31, 33, 35, 37, 41, 44, 47, 51, 54, 59, 64, 68,
+	73, 79, 85, 91, 98, 106, 114, 122, 132, 142, 152, 164,
+};
+static const uint16_t mel_offset_8000[MEL_BANDS] = {
+	0, 31, 64, 99, 136, 177, 221, 268, 319, 373, 432, 496,
+	564, 637, 716, 801, 892, 990, 1096, 1210, 1332, 1464, 1606, 1758,
+};
+static const float mel_weights_8000[1922] = {
+	0.01367529f, 0.08205175f, 0.15042820f, 0.21880466f, 0.28718111f, 0.35555757f,
+	0.42393402f, 0.49231048f, 0.56068694f, 0.62906339f, 0.69743985f, 0.76581630f,
+	0.83419276f, 0.90256921f, 0.97094567f, 0.96346110f, 0.89992433f, 0.83638756f,
+	0.77285079f, 0.70931402f, 0.64577725f, 0.58224049f, 0.51870372f, 0.45516695f,
+	0.39163018f, 0.32809341f, 0.26455664f, 0.20101988f, 0.13748311f, 0.07394634f,
+	0.01040957f, 0.03653890f, 0.10007567f, 0.16361244f, 0.22714921f, 0.29068598f,
+	0.35422275f, 0.41775951f, 0.48129628f, 0.54483305f, 0.60836982f, 0.67190659f,
+	0.73544336f, 0.79898012f, 0.86251689f, 0.92605366f, 0.98959043f, 0.95063315f,
+	0.89159351f, 0.83255388f, 0.77351425f, 0.71447461f, 0.65543498f, 0.59639534f,
+	0.53735571f, 0.47831607f, 0.41927644f, 0.36023681f, 0.30119717f, 0.24215754f,
+	0.18311790f, 0.12407827f, 0.06503864f, 0.00599900f, 0.04936685f, 0.10840649f,
+	0.16744612f, 0.22648575f, 0.28552539f, 0.34456502f, 0.40360466f, 0.46264429f,
+	0.52168393f, 0.58072356f, 0.63976319f, 0.69880283f, 0.75784246f, 0.81688210f,
+	0.87592173f, 0.93496136f, 0.99400100f, 0.95071359f, 0.89585278f, 0.84099197f,
+	0.78613116f, 0.73127036f, 0.67640955f, 0.62154874f, 0.56668793f, 0.51182713f,
+	0.45696632f, 0.40210551f, 0.34724471f, 0.29238390f, 0.23752309f, 0.18266228f,
+	0.12780148f, 0.07294067f, 0.01807986f, 0.04928641f, 0.10414722f, 0.15900803f,
+	0.21386884f, 0.26872964f, 0.32359045f, 0.37845126f, 0.43331207f, 0.48817287f,
+	0.54303368f, 0.59789449f, 0.65275529f, 0.70761610f, 0.76247691f, 0.81733772f,
+	0.87219852f, 0.92705933f, 0.98192014f, 0.96582241f, 0.91484465f, 0.86386690f,
+	0.81288914f, 0.76191138f, 0.71093362f, 0.65995586f, 0.60897811f, 0.55800035f,
+	0.50702259f, 0.45604483f, 0.40506708f, 0.35408932f, 0.30311156f, 0.25213380f,
+	0.20115604f, 0.15017829f, 0.09920053f, 0.04822277f, 0.03417759f, 0.08515535f,
+	0.13613310f, 0.18711086f, 0.23808862f, 0.28906638f, 0.34004414f, 0.39102189f,
+	0.44199965f, 0.49297741f, 0.54395517f, 0.59493292f, 0.64591068f, 0.69688844f,
+	0.74786620f, 0.79884396f, 0.84982171f, 0.90079947f, 0.95177723f, 0.99744001f,
+	0.95007046f, 0.90270091f, 0.85533136f, 0.80796181f, 0.76059226f, 0.71322271f,
+	0.66585316f, 0.61848360f, 0.57111405f, 0.52374450f, 0.47637495f, 0.42900540f,
+	0.38163585f, 0.33426630f, 0.28689675f, 0.23952720f, 0.19215765f, 0.14478810f,
+	0.09741855f, 0.05004900f, 0.00267945f, 0.00255999f, 0.04992954f, 0.09729909f,
+	0.14466864f, 0.19203819f, 0.23940774f, 0.28677729f, 0.33414684f, 0.38151640f,
+	0.42888595f, 0.47625550f, 0.52362505f, 0.57099460f, 0.61836415f, 0.66573370f,
+	0.71310325f, 0.76047280f, 0.80784235f, 0.85521190f, 0.90258145f, 0.94995100f,
+	0.99732055f, 0.95847306f, 0.91445633f, 0.87043960f, 0.82642286f, 0.78240613f,
+	0.73838940f, 0.69437267f, 0.65035593f, 0.60633920f, 0.56232247f, 0.51830573f,
+	0.47428900f, 0.43027227f, 0.38625554f, 0.34223880f, 0.29822207f, 0.25420534f,
+	0.21018861f, 0.16617187f, 0.12215514f, 0.07813841f, 0.03412167f, 0.04152694f,
+	0.08554367f, 0.12956040f, 0.17357714f, 0.21759387f, 0.26161060f, 0.30562733f,
+	0.34964407f, 0.39366080f, 0.43767753f, 0.48169427f, 0.52571100f, 0.56972773f,
+	0.61374446f, 0.65776120f, 0.70177793f, 0.74579466f, 0.78981139f, 0.83382813f,
+	0.87784486f, 0.92186159f, 0.96587833f, 0.99080531f, 0.94990409f, 0.90900286f,
+	0.86810163f, 0.82720041f, 0.78629918f, 0.74539795f, 0.70449672f, 0.66359550f,
+	0.62269427f, 0.58179304f, 0.54089182f, 0.49999059f, 0.45908936f, 0.41818813f,
+	0.37728691f, 0.33638568f, 0.29548445f, 0.25458323f, 0.21368200f, 0.17278077f,
+	0.13187954f, 0.09097832f, 0.05007709f, 0.00917586f, 0.00919469f, 0.05009591f,
+	0.09099714f, 0.13189837f, 0.17279959f, 0.21370082f, 0.25460205f, 0.29550328f,
+	0.33640450f, 0.37730573f, 0.41820696f, 0.45910818f, 0.50000941f, 0.54091064f,
+	0.58181187f, 0.62271309f, 0.66361432f, 0.70451555f, 0.74541677f, 0.78631800f,
+	0.82721923f, 0.86812046f, 0.90902168f, 0.94992291f, 0.99082414f, 0.97052016f,
+	0.93251392f, 0.89450768f, 0.85650145f, 0.81849521f, 0.78048897f, 0.74248273f,
+	0.70447650f, 0.66647026f, 0.62846402f, 0.59045779f, 0.55245155f, 0.51444531f,
+	0.47643907f, 0.43843284f, 0.40042660f, 0.36242036f, 0.32441412f, 0.28640789f,
+	0.24840165f, 0.21039541f, 0.17238918f, 0.13438294f, 0.09637670f, 0.05837046f,
+	0.02036423f, 0.02947984f, 0.06748608f, 0.10549232f, 0.14349855f, 0.18150479f,
+	0.21951103f, 0.25751727f, 0.29552350f, 0.33352974f, 0.37153598f, 0.40954221f,
+	0.44754845f, 0.48555469f, 0.52356093f, 0.56156716f, 0.59957340f, 0.63757964f,
+	0.67558588f, 0.71359211f, 0.75159835f, 0.78960459f, 0.82761082f, 0.86561706f,
+	0.90362330f, 0.94162954f, 0.97963577f, 0.98360669f, 0.94829054f, 0.91297438f,
+	0.87765823f, 0.84234207f, 0.80702592f, 0.77170976f, 0.73639361f, 0.70107745f,
+	0.66576130f, 0.63044514f, 0.59512899f, 0.55981284f, 0.52449668f, 0.48918053f,
+	0.45386437f, 0.41854822f, 0.38323206f, 0.34791591f, 0.31259975f, 0.27728360f,
+	0.24196744f, 0.20665129f, 0.17133513f, 0.13601898f, 0.10070282f, 0.06538667f,
+	0.03007051f, 0.01639331f, 0.05170946f, 0.08702562f, 0.12234177f, 0.15765793f,
+	0.19297408f, 0.22829024f, 0.26360639f, 0.29892255f, 0.33423870f, 0.36955486f,
+	0.40487101f, 0.44018716f, 0.47550332f, 0.51081947f, 0.54613563f, 0.58145178f,
+	0.61676794f, 0.65208409f, 0.68740025f, 0.72271640f, 0.75803256f, 0.79334871f,
+	0.82866487f, 0.86398102f, 0.89929718f, 0.93461333f, 0.96992949f, 0.99512565f,
+	0.96230917f, 0.92949269f, 0.89667622f, 0.86385974f, 0.83104326f, 0.79822679f,
+	0.76541031f, 0.73259384f, 0.69977736f, 0.66696088f, 0.63414441f, 0.60132793f,
+	0.56851145f, 0.53569498f, 0.50287850f, 0.47006202f, 0.43724555f, 0.40442907f,
+	0.37161260f, 0.33879612f, 0.30597964f, 0.27316317f, 0.24034669f, 0.20753021f,
+	0.17471374f, 0.14189726f, 0.10908078f, 0.07626431f, 0.04344783f, 0.01063136f,
+	0.00487435f, 0.03769083f, 0.07050731f, 0.10332378f, 0.13614026f, 0.16895674f,
+	0.20177321f, 0.23458969f, 0.26740616f, 0.30022264f, 0.33303912f, 0.36585559f,
+	0.39867207f, 0.43148855f, 0.46430502f, 0.49712150f, 0.52993798f, 0.56275445f,
+	0.59557093f, 0.62838740f, 0.66120388f, 0.69402036f, 0.72683683f, 0.75965331f,
+	0.79246979f, 0.82528626f, 0.85810274f, 0.89091922f, 0.92373569f, 0.95655217f,
+	0.98936864f, 0.97938514f, 0.94889142f, 0.91839769f, 0.88790397f, 0.85741024f,
+	0.82691652f, 0.79642279f, 0.76592907f, 0.73543534f, 0.70494162f, 0.67444789f,
+	0.64395416f, 0.61346044f, 0.58296671f, 0.55247299f, 0.52197926f, 0.49148554f,
+	0.46099181f, 0.43049809f, 0.40000436f, 0.36951064f, 0.33901691f, 0.30852319f,
+	0.27802946f, 0.24753574f, 0.21704201f, 0.18654829f, 0.15605456f, 0.12556084f,
+	0.09506711f, 0.06457338f, 0.03407966f, 0.00358593f, 0.02061486f, 0.05110858f,
+	0.08160231f, 0.11209603f, 0.14258976f, 0.17308348f, 0.20357721f, 0.23407093f,
+	0.26456466f, 0.29505838f, 0.32555211f, 0.35604584f, 0.38653956f, 0.41703329f,
+	0.44752701f, 0.47802074f, 0.50851446f, 0.53900819f, 0.56950191f, 0.59999564f,
+	0.63048936f, 0.66098309f, 0.69147681f, 0.72197054f, 0.75246426f, 0.78295799f,
+	0.81345171f, 0.84394544f, 0.87443916f, 0.90493289f, 0.93542662f, 0.96592034f,
+	0.99641407f, 0.97499674f, 0.94666136f, 0.91832599f, 0.88999061f, 0.86165523f,
+	0.83331985f, 0.80498447f, 0.77664909f, 0.74831371f, 0.71997834f, 0.69164296f,
+	0.66330758f, 0.63497220f, 0.60663682f, 0.57830144f, 0.54996606f, 0.52163069f,
+	0.49329531f, 0.46495993f, 0.43662455f, 0.40828917f, 0.37995379f, 0.35161841f,
+	0.32328304f, 0.29494766f, 0.26661228f, 0.23827690f, 0.20994152f, 0.18160614f,
+	0.15327076f, 0.12493539f, 0.09660001f, 0.06826463f, 0.03992925f, 0.01159387f,
+	0.02500326f, 0.05333864f, 0.08167401f, 0.11000939f, 0.13834477f, 0.16668015f,
+	0.19501553f, 0.22335091f, 0.25168629f, 0.28002166f, 0.30835704f, 0.33669242f,
+	0.36502780f, 0.39336318f, 0.42169856f, 0.45003394f, 0.47836931f, 0.50670469f,
+	0.53504007f, 0.56337545f, 0.59171083f, 0.62004621f, 0.64838159f, 0.67671696f,
+	0.70505234f, 0.73338772f, 0.76172310f, 0.79005848f, 0.81839386f, 0.84672924f,
+	0.87506461f, 0.90339999f, 0.93173537f, 0.96007075f, 0.98840613f, 0.98444346f,
+	0.95811366f, 0.93178386f, 0.90545406f, 0.87912426f, 0.85279446f, 0.82646466f,
+	0.80013486f, 0.77380506f, 0.74747526f, 0.72114546f, 0.69481566f, 0.66848586f,
+	0.64215606f, 0.61582626f, 0.58949646f, 0.56316666f, 0.53683686f, 0.51050706f,
+	0.48417726f, 0.45784746f, 0.43151766f, 0.40518786f, 0.37885806f, 0.35252826f,
+	0.32619846f, 0.29986866f, 0.27353886f, 0.24720906f, 0.22087926f, 0.19454947f,
+	0.16821967f, 0.14188987f, 0.11556007f, 0.08923027f, 0.06290047f, 0.03657067f,
+	0.01024087f, 0.01555654f, 0.04188634f, 0.06821614f, 0.09454594f, 0.12087574f,
+	0.14720554f, 0.17353534f, 0.19986514f, 0.22619494f, 0.25252474f, 0.27885454f,
+	0.30518434f, 0.33151414f, 0.35784394f, 0.38417374f, 0.41050354f, 0.43683334f,
+	0.46316314f, 0.48949294f, 0.51582274f, 0.54215254f, 0.56848234f, 0.59481214f,
+	0.62114194f, 0.64747174f, 0.67380154f, 0.70013134f, 0.72646114f, 0.75279094f,
+	0.77912074f, 0.80545053f, 0.83178033f, 0.85811013f, 0.88443993f, 0.91076973f,
+	0.93709953f, 0.96342933f, 0.98975913f, 0.98504984f, 0.96058367f, 0.93611749f,
+	0.91165132f, 0.88718514f, 0.86271896f, 0.83825279f, 0.81378661f, 0.78932044f,
+	0.76485426f, 0.74038808f, 0.71592191f, 0.69145573f, 0.66698956f, 0.64252338f,
+	0.61805721f, 0.59359103f, 0.56912485f, 0.54465868f, 0.52019250f, 0.49572633f,
+	0.47126015f, 0.44679397f, 0.42232780f, 0.39786162f, 0.37339545f, 0.34892927f,
+	0.32446310f, 0.29999692f, 0.27553074f, 0.25106457f, 0.22659839f, 0.20213222f,
+	0.17766604f, 0.15319987f, 0.12873369f, 0.10426751f, 0.07980134f, 0.05533516f,
+	0.03086899f, 0.00640281f, 0.01495016f, 0.03941633f, 0.06388251f, 0.08834868f,
+	0.11281486f, 0.13728104f, 0.16174721f, 0.18621339f, 0.21067956f, 0.23514574f,
+	0.25961192f, 0.28407809f, 0.30854427f, 0.33301044f, 0.35747662f, 0.38194279f,
+	0.40640897f, 0.43087515f, 0.45534132f, 0.47980750f, 0.50427367f, 0.52873985f,
+	0.55320603f, 0.57767220f, 0.60213838f, 0.62660455f, 0.65107073f, 0.67553690f,
+	0.70000308f, 0.72446926f, 0.74893543f, 0.77340161f, 0.79786778f, 0.82233396f,
+	0.84680013f, 0.87126631f, 0.89573249f, 0.92019866f, 0.94466484f, 0.96913101f,
+	0.99359719f, 0.98321516f, 0.96048070f, 0.93774624f, 0.91501178f, 0.89227732f,
+	0.86954286f, 0.84680840f, 0.82407395f, 0.80133949f, 0.77860503f, 0.75587057f,
+	0.73313611f, 0.71040165f, 0.68766719f, 0.66493273f, 0.64219827f, 0.61946381f,
+	0.59672935f, 0.57399489f, 0.55126044f, 0.52852598f, 0.50579152f, 0.48305706f,
+	0.46032260f, 0.43758814f, 0.41485368f, 0.39211922f, 0.36938476f, 0.34665030f,
+	0.32391584f, 0.30118138f, 0.27844692f, 0.25571247f, 0.23297801f, 0.21024355f,
+	0.18750909f, 0.16477463f, 0.14204017f, 0.11930571f, 0.09657125f, 0.07383679f,
+	0.05110233f, 0.02836787f, 0.00563341f, 0.01678484f, 0.03951930f, 0.06225376f,
+	0.08498822f, 0.10772268f, 0.13045714f, 0.15319160f, 0.17592605f, 0.19866051f,
+	0.22139497f, 0.24412943f, 0.26686389f, 0.28959835f, 0.31233281f, 0.33506727f,
+	0.35780173f, 0.38053619f, 0.40327065f, 0.42600511f, 0.44873956f, 0.47147402f,
+	0.49420848f, 0.51694294f, 0.53967740f, 0.56241186f, 0.58514632f, 0.60788078f,
+	0.63061524f, 0.65334970f, 0.67608416f, 0.69881862f, 0.72155308f, 0.74428753f,
+	0.76702199f, 0.78975645f, 0.81249091f, 0.83522537f, 0.85795983f, 0.88069429f,
+	0.90342875f, 0.92616321f, 0.94889767f, 0.97163213f, 0.99436659f, 0.98410937f,
+	0.96298405f, 0.94185874f, 0.92073343f, 0.89960811f, 0.87848280f, 0.85735749f,
+	0.83623217f, 0.81510686f, 0.79398154f, 0.77285623f, 0.75173092f, 0.73060560f,
+	0.70948029f, 0.68835498f, 0.66722966f, 0.64610435f, 0.62497904f, 0.60385372f,
+	0.58272841f, 0.56160310f, 0.54047778f, 0.51935247f, 0.49822715f, 0.47710184f,
+	0.45597653f, 0.43485121f, 0.41372590f, 0.39260059f, 0.37147527f, 0.35034996f,
+	0.32922465f, 0.30809933f, 0.28697402f, 0.26584871f, 0.24472339f, 0.22359808f,
+	0.20247276f, 0.18134745f, 0.16022214f, 0.13909682f, 0.11797151f, 0.09684620f,
+	0.07572088f, 0.05459557f, 0.03347026f, 0.01234494f, 0.01589063f, 0.03701595f,
+	0.05814126f, 0.07926657f, 0.10039189f, 0.12151720f, 0.14264251f, 0.16376783f,
+	0.18489314f, 0.20601846f, 0.22714377f, 0.24826908f, 0.26939440f, 0.29051971f,
+	0.31164502f, 0.33277034f, 0.35389565f, 0.37502096f, 0.39614628f, 0.41727159f,
+	0.43839690f, 0.45952222f, 0.48064753f, 0.50177285f, 0.52289816f, 0.54402347f,
+	0.56514879f, 0.58627410f, 0.60739941f, 0.62852473f, 0.64965004f, 0.67077535f,
+	0.69190067f, 0.71302598f, 0.73415129f, 0.75527661f, 0.77640192f, 0.79752724f,
+	0.81865255f, 0.83977786f, 0.86090318f, 0.88202849f, 0.90315380f, 0.92427912f,
+	0.94540443f, 0.96652974f, 0.98765506f, 0.99184110f, 0.97221104f, 0.95258098f,
+	0.93295091f, 0.91332085f, 0.89369079f, 0.87406072f, 0.85443066f, 0.83480060f,
+	0.81517053f, 0.79554047f, 0.77591041f, 0.75628034f, 0.73665028f, 0.71702022f,
+	0.69739015f, 0.67776009f, 0.65813003f, 0.63849996f, 0.61886990f, 0.59923984f,
+	0.57960977f, 0.55997971f, 0.54034965f, 0.52071958f, 0.50108952f, 0.48145946f,
+	0.46182939f, 0.44219933f, 0.42256927f, 0.40293920f, 0.38330914f, 0.36367908f,
+	0.34404901f, 0.32441895f, 0.30478889f, 0.28515882f, 0.26552876f, 0.24589870f,
+	0.22626863f, 0.20663857f, 0.18700851f, 0.16737844f, 0.14774838f, 0.12811832f,
+	0.10848825f, 0.08885819f, 0.06922813f, 0.04959806f, 0.02996800f, 0.01033794f,
+	0.00815890f, 0.02778896f, 0.04741902f, 0.06704909f, 0.08667915f, 0.10630921f,
+	0.12593928f, 0.14556934f, 0.16519940f, 0.18482947f, 0.20445953f, 0.22408959f,
+	0.24371966f, 0.26334972f, 0.28297978f, 0.30260985f, 0.32223991f, 0.34186997f,
+	0.36150004f, 0.38113010f, 0.40076016f, 0.42039023f, 0.44002029f, 0.45965035f,
+	0.47928042f, 0.49891048f, 0.51854054f, 0.53817061f, 0.55780067f, 0.57743073f,
+	0.59706080f, 0.61669086f, 0.63632092f, 0.65595099f, 0.67558105f, 0.69521111f,
+	0.71484118f, 0.73447124f, 0.75410130f, 0.77373137f, 0.79336143f, 0.81299149f,
+	0.83262156f, 0.85225162f, 0.87188168f, 0.89151175f, 0.91114181f, 0.93077187f,
+	0.95040194f, 0.97003200f, 0.98966206f, 0.99136557f, 0.97312492f, 0.95488428f,
+	0.93664363f, 0.91840298f, 0.90016234f, 0.88192169f, 0.86368104f, 0.84544040f,
+	0.82719975f, 0.80895910f, 0.79071845f, 0.77247781f, 0.75423716f, 0.73599651f,
+	0.71775587f, 0.69951522f, 0.68127457f, 0.66303393f, 0.64479328f, 0.62655263f,
+	0.60831199f, 0.59007134f, 0.57183069f, 0.55359004f, 0.53534940f, 0.51710875f,
+	0.49886810f, 0.48062746f, 0.46238681f, 0.44414616f, 0.42590552f, 0.40766487f,
+	0.38942422f, 0.37118358f, 0.35294293f, 0.33470228f, 0.31646163f, 0.29822099f,
+	0.27998034f, 0.26173969f, 0.24349905f, 0.22525840f, 0.20701775f, 0.18877711f,
+	0.17053646f, 0.15229581f, 0.13405517f, 0.11581452f, 0.09757387f, 0.07933322f,
+	0.06109258f, 0.04285193f, 0.02461128f, 0.00637064f, 0.00863443f, 0.02687508f,
+	0.04511572f, 0.06335637f, 0.08159702f, 0.09983766f, 0.11807831f, 0.13631896f,
+	0.15455960f, 0.17280025f, 0.19104090f, 0.20928155f, 0.22752219f, 0.24576284f,
+	0.26400349f, 0.28224413f, 0.30048478f, 0.31872543f, 0.33696607f, 0.35520672f,
+	0.37344737f, 0.39168801f, 0.40992866f, 0.42816931f, 0.44640996f, 0.46465060f,
+	0.48289125f, 0.50113190f, 0.51937254f, 0.53761319f, 0.55585384f, 0.57409448f,
+	0.59233513f, 0.61057578f, 0.62881642f, 0.64705707f, 0.66529772f, 0.68353837f,
+	0.70177901f, 0.72001966f, 0.73826031f, 0.75650095f, 0.77474160f, 0.79298225f,
+	0.81122289f, 0.82946354f, 0.84770419f, 0.86594483f, 0.88418548f, 0.90242613f,
+	0.92066678f, 0.93890742f, 0.95714807f, 0.97538872f, 0.99362936f, 0.98897015f,
+	0.97202058f, 0.95507100f, 0.93812143f, 0.92117186f, 0.90422228f, 0.88727271f,
+	0.87032314f, 0.85337356f, 0.83642399f, 0.81947442f, 0.80252484f, 0.78557527f,
+	0.76862570f, 0.75167612f, 0.73472655f, 0.71777697f, 0.70082740f, 0.68387783f,
+	0.66692825f, 0.64997868f, 0.63302911f, 0.61607953f, 0.59912996f, 0.58218039f,
+	0.56523081f, 0.54828124f, 0.53133167f, 0.51438209f, 0.49743252f, 0.48048295f,
+	0.46353337f, 0.44658380f, 0.42963423f, 0.41268465f, 0.39573508f, 0.37878551f,
+	0.36183593f, 0.34488636f, 0.32793679f, 0.31098721f, 0.29403764f, 0.27708807f,
+	0.26013849f, 0.24318892f, 0.22623935f, 0.20928977f, 0.19234020f, 0.17539062f,
+	0.15844105f, 0.14149148f, 0.12454190f, 0.10759233f, 0.09064276f, 0.07369318f,
+	0.05674361f, 0.03979404f, 0.02284446f, 0.00589489f, 0.01102985f, 0.02797942f,
+	0.04492900f, 0.06187857f, 0.07882814f, 0.09577772f, 0.11272729f, 0.12967686f,
+	0.14662644f, 0.16357601f, 0.18052558f, 0.19747516f, 0.21442473f, 0.23137430f,
+	0.24832388f, 0.26527345f, 0.28222303f, 0.29917260f, 0.31612217f, 0.33307175f,
+	0.35002132f, 0.36697089f, 0.38392047f, 0.40087004f, 0.41781961f, 0.43476919f,
+	0.45171876f, 0.46866833f, 0.48561791f, 0.50256748f, 0.51951705f, 0.53646663f,
+	0.55341620f, 0.57036577f, 0.58731535f, 0.60426492f, 0.62121449f, 0.63816407f,
+	0.65511364f, 0.67206321f, 0.68901279f, 0.70596236f, 0.72291193f, 0.73986151f,
+	0.75681108f, 0.77376065f, 0.79071023f, 0.80765980f, 0.82460938f, 0.84155895f,
+	0.85850852f, 0.87545810f, 0.89240767f, 0.90935724f, 0.92630682f, 0.94325639f,
+	0.96020596f, 0.97715554f, 0.99410511f, 0.98972777f, 0.97397789f, 0.95822800f,
+	0.94247812f, 0.92672824f, 0.91097836f, 0.89522847f, 0.87947859f, 0.86372871f,
+	0.84797883f, 0.83222895f, 0.81647906f, 0.80072918f, 0.78497930f, 0.76922942f,
+	0.75347954f, 0.73772965f, 0.72197977f, 0.70622989f, 0.69048001f, 0.67473012f,
+	0.65898024f, 0.64323036f, 0.62748048f, 0.61173060f, 0.59598071f, 0.58023083f,
+	0.56448095f, 0.54873107f, 0.53298118f, 0.51723130f, 0.50148142f, 0.48573154f,
+	0.46998166f, 0.45423177f, 0.43848189f, 0.42273201f, 0.40698213f, 0.39123225f,
+	0.37548236f, 0.35973248f, 0.34398260f, 0.32823272f, 0.31248283f, 0.29673295f,
+	0.28098307f, 0.26523319f, 0.24948331f, 0.23373342f, 0.21798354f, 0.20223366f,
+	0.18648378f, 0.17073389f, 0.15498401f, 0.13923413f, 0.12348425f, 0.10773437f,
+	0.09198448f, 0.07623460f, 0.06048472f, 0.04473484f, 0.02898495f, 0.01323507f,
+	0.01027223f, 0.02602211f, 0.04177200f, 0.05752188f, 0.07327176f, 0.08902164f,
+	0.10477153f, 0.12052141f, 0.13627129f, 0.15202117f, 0.16777105f, 0.18352094f,
+	0.19927082f, 0.21502070f, 0.23077058f, 0.24652046f, 0.26227035f, 0.27802023f,
+	0.29377011f, 0.30951999f, 0.32526988f, 0.34101976f, 0.35676964f, 0.37251952f,
+	0.38826940f, 0.40401929f, 0.41976917f, 0.43551905f, 0.45126893f, 0.46701882f,
+	0.48276870f, 0.49851858f, 0.51426846f, 0.53001834f, 0.54576823f, 0.56151811f,
+	0.57726799f, 0.59301787f, 0.60876775f, 0.62451764f, 0.64026752f, 0.65601740f,
+	0.67176728f, 0.68751717f, 0.70326705f, 0.71901693f, 0.73476681f, 0.75051669f,
+	0.76626658f, 0.78201646f, 0.79776634f, 0.81351622f, 0.82926611f, 0.84501599f,
+	0.86076587f, 0.87651575f, 0.89226563f, 0.90801552f, 0.92376540f, 0.93951528f,
+	0.95526516f, 0.97101505f, 0.98676493f, 0.99766319f, 0.98302808f, 0.96839298f,
+	0.95375787f, 0.93912277f, 0.92448766f, 0.90985256f, 0.89521745f, 0.88058235f,
+	0.86594724f, 0.85131214f, 0.83667703f, 0.82204193f, 0.80740682f, 0.79277172f,
+	0.77813661f, 0.76350151f, 0.74886640f, 0.73423130f, 0.71959619f, 0.70496109f,
+	0.69032598f, 0.67569088f, 0.66105577f, 0.64642067f, 0.63178556f, 0.61715046f,
+	0.60251535f, 0.58788025f, 0.57324514f, 0.55861004f, 0.54397493f, 0.52933983f,
+	0.51470472f, 0.50006962f, 0.48543451f, 0.47079941f, 0.45616430f, 0.44152920f,
+	0.42689409f, 0.41225899f, 0.39762388f, 0.38298877f, 0.36835367f, 0.35371856f,
+	0.33908346f, 0.32444835f, 0.30981325f, 0.29517814f, 0.28054304f, 0.26590793f,
+	0.25127283f, 0.23663772f, 0.22200262f, 0.20736751f, 0.19273241f, 0.17809730f,
+	0.16346220f, 0.14882709f, 0.13419199f, 0.11955688f, 0.10492178f, 0.09028667f,
+	0.07565157f, 0.06101646f, 0.04638136f, 0.03174625f, 0.01711115f, 0.00247604f,
+	0.00233681f, 0.01697192f, 0.03160702f, 0.04624213f, 0.06087723f, 0.07551234f,
+	0.09014744f, 0.10478255f, 0.11941765f, 0.13405276f, 0.14868786f, 0.16332297f,
+	0.17795807f, 0.19259318f, 0.20722828f, 0.22186339f, 0.23649849f, 0.25113360f,
+	0.26576870f, 0.28040381f, 0.29503891f, 0.30967402f, 0.32430912f, 0.33894423f,
+	0.35357933f, 0.36821444f, 0.38284954f, 0.39748465f, 0.41211975f, 0.42675486f,
+	0.44138996f, 0.45602507f, 0.47066017f, 0.48529528f, 0.49993038f, 0.51456549f,
+	0.52920059f, 0.54383570f, 0.55847080f, 0.57310591f, 0.58774101f, 0.60237612f,
+	0.61701123f, 0.63164633f, 0.64628144f, 0.66091654f, 0.67555165f, 0.69018675f,
+	0.70482186f, 0.71945696f, 0.73409207f, 0.74872717f, 0.76336228f, 0.77799738f,
+	0.79263249f, 0.80726759f, 0.82190270f, 0.83653780f, 0.85117291f, 0.86580801f,
+	0.88044312f, 0.89507822f, 0.90971333f, 0.92434843f, 0.93898354f, 0.95361864f,
+	0.96825375f, 0.98288885f, 0.99752396f, 0.98870156f, 0.97510232f, 0.96150309f,
+	0.94790386f, 0.93430463f, 0.92070540f, 0.90710616f, 0.89350693f, 0.87990770f,
+	0.86630847f, 0.85270924f, 0.83911000f, 0.82551077f, 0.81191154f, 0.79831231f,
+	0.78471308f, 0.77111384f, 0.75751461f, 0.74391538f, 0.73031615f, 0.71671692f,
+	0.70311768f, 0.68951845f, 0.67591922f, 0.66231999f, 0.64872076f, 0.63512152f,
+	0.62152229f, 0.60792306f, 0.59432383f, 0.58072460f, 0.56712537f, 0.55352613f,
+	0.53992690f, 0.52632767f, 0.51272844f, 0.49912921f, 0.48552997f, 0.47193074f,
+	0.45833151f, 0.44473228f, 0.43113305f, 0.41753381f, 0.40393458f, 0.39033535f,
+	0.37673612f, 0.36313689f, 0.34953765f, 0.33593842f, 0.32233919f, 0.30873996f,
+	0.29514073f, 0.28154149f, 0.26794226f, 0.25434303f, 0.24074380f, 0.22714457f,
+	0.21354533f, 0.19994610f, 0.18634687f, 0.17274764f, 0.15914841f, 0.14554917f,
+	0.13194994f, 0.11835071f, 0.10475148f, 0.09115225f, 0.07755301f, 0.06395378f,
+	0.05035455f, 0.03675532f, 0.02315609f, 0.00955685f, 0.01129844f, 0.02489768f,
+	0.03849691f, 0.05209614f, 0.06569537f, 0.07929460f, 0.09289384f, 0.10649307f,
+	0.12009230f, 0.13369153f, 0.14729076f, 0.16089000f, 0.17448923f, 0.18808846f,
+	0.20168769f, 0.21528692f, 0.22888616f, 0.24248539f, 0.25608462f, 0.26968385f,
+	0.28328308f, 0.29688232f, 0.31048155f, 0.32408078f, 0.33768001f, 0.35127924f,
+	0.36487848f, 0.37847771f, 0.39207694f, 0.40567617f, 0.41927540f, 0.43287463f,
+	0.44647387f, 0.46007310f, 0.47367233f, 0.48727156f, 0.50087079f, 0.51447003f,
+	0.52806926f, 0.54166849f, 0.55526772f, 0.56886695f, 0.58246619f, 0.59606542f,
+	0.60966465f, 0.62326388f, 0.63686311f, 0.65046235f, 0.66406158f, 0.67766081f,
+	0.69126004f, 0.70485927f, 0.71845851f, 0.73205774f, 0.74565697f, 0.75925620f,
+	0.77285543f, 0.78645467f, 0.80005390f, 0.81365313f, 0.82725236f, 0.84085159f,
+	0.85445083f, 0.86805006f, 0.88164929f, 0.89524852f, 0.90884775f, 0.92244699f,
+	0.93604622f, 0.94964545f, 0.96324468f, 0.97684391f, 0.99044315f, 0.99624374f,
+	0.98360706f, 0.97097039f, 0.95833371f, 0.94569703f, 0.93306035f, 0.92042367f,
+	0.90778700f, 0.89515032f, 0.88251364f, 0.86987696f, 0.85724028f, 0.84460361f,
+	0.83196693f, 0.81933025f, 0.80669357f, 0.79405689f, 0.78142022f, 0.76878354f,
+	0.75614686f, 0.74351018f, 0.73087350f, 0.71823683f, 0.70560015f, 0.69296347f,
+	0.68032679f, 0.66769012f, 0.65505344f, 0.64241676f, 0.62978008f, 0.61714340f,
+	0.60450673f, 0.59187005f, 0.57923337f, 0.56659669f, 0.55396001f, 0.54132334f,
+	0.52868666f, 0.51604998f, 0.50341330f, 0.49077662f, 0.47813995f, 0.46550327f,
+	0.45286659f, 0.44022991f, 0.42759323f, 0.41495656f, 0.40231988f, 0.38968320f,
+	0.37704652f, 0.36440984f, 0.35177317f, 0.33913649f, 0.32649981f, 0.31386313f,
+	0.30122645f, 0.28858978f, 0.27595310f, 0.26331642f, 0.25067974f, 0.23804306f,
+	0.22540639f, 0.21276971f, 0.20013303f, 0.18749635f, 0.17485967f, 0.16222300f,
+	0.14958632f, 0.13694964f, 0.12431296f, 0.11167628f, 0.09903961f, 0.08640293f,
+	0.07376625f, 0.06112957f, 0.04849290f, 0.03585622f, 0.02321954f, 0.01058286f,
+	0.00375626f, 0.01639294f, 0.02902961f, 0.04166629f, 0.05430297f, 0.06693965f,
+	0.07957633f, 0.09221300f, 0.10484968f, 0.11748636f, 0.13012304f, 0.14275972f,
+	0.15539639f, 0.16803307f, 0.18066975f, 0.19330643f, 0.20594311f, 0.21857978f,
+	0.23121646f, 0.24385314f, 0.25648982f, 0.26912650f, 0.28176317f, 0.29439985f,
+	0.30703653f, 0.31967321f, 0.33230988f, 0.34494656f, 0.35758324f, 0.37021992f,
+	0.38285660f, 0.39549327f, 0.40812995f, 0.42076663f, 0.43340331f, 0.44603999f,
+	0.45867666f, 0.47131334f, 0.48395002f, 0.49658670f, 0.50922338f, 0.52186005f,
+	0.53449673f, 0.54713341f, 0.55977009f, 0.57240677f, 0.58504344f, 0.59768012f,
+	0.61031680f, 0.62295348f, 0.63559016f, 0.64822683f, 0.66086351f, 0.67350019f,
+	0.68613687f, 0.69877355f, 0.71141022f, 0.72404690f, 0.73668358f, 0.74932026f,
+	0.76195694f, 0.77459361f, 0.78723029f, 0.79986697f, 0.81250365f, 0.82514033f,
+	0.83777700f, 0.85041368f, 0.86305036f, 0.87568704f, 0.88832372f, 0.90096039f,
+	0.91359707f, 0.92623375f, 0.93887043f, 0.95150710f, 0.96414378f, 0.97678046f,
+	0.98941714f, 0.99809155f, 0.98634930f, 0.97460705f, 0.96286479f, 0.95112254f,
+	0.93938028f, 0.92763803f, 0.91589578f, 0.90415352f, 0.89241127f, 0.88066902f,
+	0.86892676f, 0.85718451f, 0.84544226f, 0.83370000f, 0.82195775f, 0.81021550f,
+	0.79847324f, 0.78673099f, 0.77498873f, 0.76324648f, 0.75150423f, 0.73976197f,
+	0.72801972f, 0.71627747f, 0.70453521f, 0.69279296f, 0.68105071f, 0.66930845f,
+	0.65756620f, 0.64582395f, 0.63408169f, 0.62233944f, 0.61059718f, 0.59885493f,
+	0.58711268f, 0.57537042f, 0.56362817f, 0.55188592f, 0.54014366f, 0.52840141f,
+	0.51665916f, 0.50491690f, 0.49317465f, 0.48143240f, 0.46969014f, 0.45794789f,
+	0.44620564f, 0.43446338f, 0.42272113f, 0.41097887f, 0.39923662f, 0.38749437f,
+	0.37575211f, 0.36400986f, 0.35226761f, 0.34052535f, 0.32878310f, 0.31704085f,
+	0.30529859f, 0.29355634f, 0.28181409f, 0.27007183f, 0.25832958f, 0.24658732f,
+	0.23484507f, 0.22310282f, 0.21136056f, 0.19961831f, 0.18787606f, 0.17613380f,
+	0.16439155f, 0.15264930f, 0.14090704f, 0.12916479f, 0.11742254f, 0.10568028f,
+	0.09393803f, 0.08219577f, 0.07045352f, 0.05871127f, 0.04696901f, 0.03522676f,
+	0.02348451f, 0.01174225f,
+};
+
+/* 16000 Hz, 50 to 8000 Hz */
+static const uint16_t mel_start_16000[MEL_BANDS] = {
+	7, 17, 28, 40, 53, 68, 84, 102, 121, 143, 167, 193,
+	222, 254, 290, 329, 372, 419, 472, 529, 593, 663, 741, 826,
+};
+static const uint8_t mel_len_16000[MEL_BANDS] = {
+	21, 23, 25, 28, 31, 34, 37, 41, 46, 50, 55, 61,
+	68, 75, 82, 90, 100, 110, 121, 134, 148, 163, 180, 198,
+};
+static const uint16_t mel_offset_16000[MEL_BANDS] = {
+	0, 21, 44, 69, 97, 128, 162, 199, 240, 286, 336, 391,
+	452, 520, 595, 677, 767, 867, 977, 1098, 1232, 1380, 1543, 1723,
+};
+static const float mel_weights_16000[1921] = {
+	0.06067541f, 0.16180110f, 0.26292678f, 0.36405247f, 0.46517816f, 0.56630384f,
+	0.66742953f, 0.76855522f, 0.86968090f, 0.97080659f, 0.93478530f, 0.84310350f,
+	0.75142169f, 0.65973988f, 0.56805808f, 0.47637627f, 0.38469446f, 0.29301266f,
+	0.20133085f, 0.10964904f, 0.01796724f, 0.06521470f, 0.15689650f, 0.24857831f,
+	0.34026012f, 0.43194192f, 0.52362373f, 0.61530554f, 0.70698734f, 0.79866915f,
+	0.89035096f, 0.98203276f, 0.93316945f, 0.85004958f, 0.76692972f, 0.68380985f,
+	0.60068998f, 0.51757011f, 0.43445025f, 0.35133038f, 0.26821051f, 0.18509064f,
+	0.10197078f, 0.01885091f, 0.06683055f, 0.14995042f, 0.23307028f, 0.31619015f,
+	0.39931002f, 0.48242989f, 0.56554975f, 0.64866962f, 0.73178949f, 0.81490936f,
+	0.89802922f, 0.98114909f, 0.94173296f, 0.86637545f, 0.79101795f, 0.71566044f,
+	0.64030293f, 0.56494542f, 0.48958792f, 0.41423041f, 0.33887290f, 0.26351540f,
+	0.18815789f, 0.11280038f, 0.03744287f, 0.05826704f, 0.13362455f, 0.20898205f,
+	0.28433956f, 0.35969707f, 0.43505458f, 0.51041208f, 0.58576959f, 0.66112710f,
+	0.73648460f, 0.81184211f, 0.88719962f, 0.96255713f, 0.96562612f, 0.89730607f,
+	0.82898601f, 0.76066596f, 0.69234590f, 0.62402585f, 0.55570579f, 0.48738574f,
+	0.41906569f, 0.35074563f, 0.28242558f, 0.21410552f, 0.14578547f, 0.07746541f,
+	0.00914536f, 0.03437388f, 0.10269393f, 0.17101399f, 0.23933404f, 0.30765410f,
+	0.37597415f, 0.44429421f, 0.51261426f, 0.58093431f, 0.64925437f, 0.71757442f,
+	0.78589448f, 0.85421453f, 0.92253459f, 0.99085464f, 0.94635148f, 0.88441167f,
+	0.82247186f, 0.76053205f, 0.69859223f, 0.63665242f, 0.57471261f, 0.51277280f,
+	0.45083299f, 0.38889317f, 0.32695336f, 0.26501355f, 0.20307374f, 0.14113392f,
+	0.07919411f, 0.01725430f, 0.05364852f, 0.11558833f, 0.17752814f, 0.23946795f,
+	0.30140777f, 0.36334758f, 0.42528739f, 0.48722720f, 0.54916701f, 0.61110683f,
+	0.67304664f, 0.73498645f, 0.79692626f, 0.85886608f, 0.92080589f, 0.98274570f,
+	0.95948756f, 0.90333215f, 0.84717675f, 0.79102134f, 0.73486594f, 0.67871053f,
+	0.62255513f, 0.56639972f, 0.51024432f, 0.45408891f, 0.39793351f, 0.34177810f,
+	0.28562270f, 0.22946729f, 0.17331189f, 0.11715648f, 0.06100108f, 0.00484567f,
+	0.04051244f, 0.09666785f, 0.15282325f, 0.20897866f, 0.26513406f, 0.32128947f,
+	0.37744487f, 0.43360028f, 0.48975568f, 0.54591109f, 0.60206649f, 0.65822190f,
+	0.71437730f, 0.77053271f, 0.82668811f, 0.88284352f, 0.93899892f, 0.99515433f,
+	0.95348196f, 0.90257077f, 0.85165958f, 0.80074839f, 0.74983720f, 0.69892601f,
+	0.64801482f, 0.59710363f, 0.54619244f, 0.49528125f, 0.44437006f, 0.39345887f,
+	0.34254768f, 0.29163649f, 0.24072530f, 0.18981411f, 0.13890292f, 0.08799173f,
+	0.03708054f, 0.04651804f, 0.09742923f, 0.14834042f, 0.19925161f, 0.25016280f,
+	0.30107399f, 0.35198518f, 0.40289637f, 0.45380756f, 0.50471875f, 0.55562994f,
+	0.60654113f, 0.65745232f, 0.70836351f, 0.75927470f, 0.81018589f, 0.86109708f,
+	0.91200827f, 0.96291946f, 0.98746096f, 0.94130424f, 0.89514753f, 0.84899081f,
+	0.80283409f, 0.75667737f, 0.71052065f, 0.66436393f, 0.61820721f, 0.57205050f,
+	0.52589378f, 0.47973706f, 0.43358034f, 0.38742362f, 0.34126690f, 0.29511018f,
+	0.24895347f, 0.20279675f, 0.15664003f, 0.11048331f, 0.06432659f, 0.01816987f,
+	0.01253904f, 0.05869576f, 0.10485247f, 0.15100919f, 0.19716591f, 0.24332263f,
+	0.28947935f, 0.33563607f, 0.38179279f, 0.42794950f, 0.47410622f, 0.52026294f,
+	0.56641966f, 0.61257638f, 0.65873310f, 0.70488982f, 0.75104653f, 0.79720325f,
+	0.84335997f, 0.88951669f, 0.93567341f, 0.98183013f, 0.97462678f, 0.93278052f,
+	0.89093427f, 0.84908801f, 0.80724175f, 0.76539550f, 0.72354924f, 0.68170299f,
+	0.63985673f, 0.59801047f, 0.55616422f, 0.51431796f, 0.47247171f, 0.43062545f,
+	0.38877919f, 0.34693294f, 0.30508668f, 0.26324043f, 0.22139417f, 0.17954792f,
+	0.13770166f, 0.09585540f, 0.05400915f, 0.01216289f, 0.02537322f, 0.06721948f,
+	0.10906573f, 0.15091199f, 0.19275825f, 0.23460450f, 0.27645076f, 0.31829701f,
+	0.36014327f, 0.40198953f, 0.44383578f, 0.48568204f, 0.52752829f, 0.56937455f,
+	0.61122081f, 0.65306706f, 0.69491332f, 0.73675957f, 0.77860583f, 0.82045208f,
+	0.86229834f, 0.90414460f, 0.94599085f, 0.98783711f, 0.97308869f, 0.93515036f,
+	0.89721202f, 0.85927368f, 0.82133535f, 0.78339701f, 0.74545867f, 0.70752034f,
+	0.66958200f, 0.63164366f, 0.59370533f, 0.55576699f, 0.51782865f, 0.47989032f,
+	0.44195198f, 0.40401364f, 0.36607531f, 0.32813697f, 0.29019863f, 0.25226029f,
+	0.21432196f, 0.17638362f, 0.13844528f, 0.10050695f, 0.06256861f, 0.02463027f,
+	0.02691131f, 0.06484964f, 0.10278798f, 0.14072632f, 0.17866465f, 0.21660299f,
+	0.25454133f, 0.29247966f, 0.33041800f, 0.36835634f, 0.40629467f, 0.44423301f,
+	0.48217135f, 0.52010968f, 0.55804802f, 0.59598636f, 0.63392469f, 0.67186303f,
+	0.70980137f, 0.74773971f, 0.78567804f, 0.82361638f, 0.86155472f, 0.89949305f,
+	0.93743139f, 0.97536973f, 0.98793475f, 0.95353938f, 0.91914401f, 0.88474864f,
+	0.85035327f, 0.81595790f, 0.78156253f, 0.74716717f, 0.71277180f, 0.67837643f,
+	0.64398106f, 0.60958569f, 0.57519032f, 0.54079495f, 0.50639959f, 0.47200422f,
+	0.43760885f, 0.40321348f, 0.36881811f, 0.33442274f, 0.30002737f, 0.26563201f,
+	0.23123664f, 0.19684127f, 0.16244590f, 0.12805053f, 0.09365516f, 0.05925979f,
+	0.02486443f, 0.01206525f, 0.04646062f, 0.08085599f, 0.11525136f, 0.14964673f,
+	0.18404210f, 0.21843747f, 0.25283283f, 0.28722820f, 0.32162357f, 0.35601894f,
+	0.39041431f, 0.42480968f, 0.45920505f, 0.49360041f, 0.52799578f, 0.56239115f,
+	0.59678652f, 0.63118189f, 0.66557726f, 0.69997263f, 0.73436799f, 0.76876336f,
+	0.80315873f, 0.83755410f, 0.87194947f, 0.90634484f, 0.94074021f, 0.97513557f,
+	0.99135913f, 0.96017586f, 0.92899259f, 0.89780932f, 0.86662605f, 0.83544278f,
+	0.80425951f, 0.77307624f, 0.74189297f, 0.71070970f, 0.67952643f, 0.64834316f,
+	0.61715990f, 0.58597663f, 0.55479336f, 0.52361009f, 0.49242682f, 0.46124355f,
+	0.43006028f, 0.39887701f, 0.36769374f, 0.33651047f, 0.30532720f, 0.27414393f,
+	0.24296066f, 0.21177739f, 0.18059412f, 0.14941085f, 0.11822758f, 0.08704431f,
+	0.05586105f, 0.02467778f, 0.00864087f, 0.03982414f, 0.07100741f, 0.10219068f,
+	0.13337395f, 0.16455722f, 0.19574049f, 0.22692376f, 0.25810703f, 0.28929030f,
+	0.32047357f, 0.35165684f, 0.38284010f, 0.41402337f, 0.44520664f, 0.47638991f,
+	0.50757318f, 0.53875645f, 0.56993972f, 0.60112299f, 0.63230626f, 0.66348953f,
+	0.69467280f, 0.72585607f, 0.75703934f, 0.78822261f, 0.81940588f, 0.85058915f,
+	0.88177242f, 0.91295569f, 0.94413895f, 0.97532222f, 0.99410204f, 0.96583090f,
+	0.93755976f, 0.90928862f, 0.88101748f, 0.85274634f, 0.82447520f, 0.79620406f,
+	0.76793291f, 0.73966177f, 0.71139063f, 0.68311949f, 0.65484835f, 0.62657721f,
+	0.59830607f, 0.57003493f, 0.54176379f, 0.51349265f, 0.48522151f, 0.45695037f,
+	0.42867923f, 0.40040809f, 0.37213695f, 0.34386581f, 0.31559467f, 0.28732353f,
+	0.25905239f, 0.23078125f, 0.20251011f, 0.17423897f, 0.14596783f, 0.11769668f,
+	0.08942554f, 0.06115440f, 0.03288326f, 0.00461212f, 0.00589796f, 0.03416910f,
+	0.06244024f, 0.09071138f, 0.11898252f, 0.14725366f, 0.17552480f, 0.20379594f,
+	0.23206709f, 0.26033823f, 0.28860937f, 0.31688051f, 0.34515165f, 0.37342279f,
+	0.40169393f, 0.42996507f, 0.45823621f, 0.48650735f, 0.51477849f, 0.54304963f,
+	0.57132077f, 0.59959191f, 0.62786305f, 0.65613419f, 0.68440533f, 0.71267647f,
+	0.74094761f, 0.76921875f, 0.79748989f, 0.82576103f, 0.85403217f, 0.88230332f,
+	0.91057446f, 0.93884560f, 0.96711674f, 0.99538788f, 0.97855044f, 0.95291947f,
+	0.92728850f, 0.90165754f, 0.87602657f, 0.85039560f, 0.82476463f, 0.79913366f,
+	0.77350270f, 0.74787173f, 0.72224076f, 0.69660979f, 0.67097882f, 0.64534786f,
+	0.61971689f, 0.59408592f, 0.56845495f, 0.54282398f, 0.51719302f, 0.49156205f,
+	0.46593108f, 0.44030011f, 0.41466914f, 0.38903818f, 0.36340721f, 0.33777624f,
+	0.31214527f, 0.28651430f, 0.26088334f, 0.23525237f, 0.20962140f, 0.18399043f,
+	0.15835946f, 0.13272850f, 0.10709753f, 0.08146656f, 0.05583559f, 0.03020462f,
+	0.00457366f, 0.02144956f, 0.04708053f, 0.07271150f, 0.09834246f, 0.12397343f,
+	0.14960440f, 0.17523537f, 0.20086634f, 0.22649730f, 0.25212827f, 0.27775924f,
+	0.30339021f, 0.32902118f, 0.35465214f, 0.38028311f, 0.40591408f, 0.43154505f,
+	0.45717602f, 0.48280698f, 0.50843795f, 0.53406892f, 0.55969989f, 0.58533086f,
+	0.61096182f, 0.63659279f, 0.66222376f, 0.68785473f, 0.71348570f, 0.73911666f,
+	0.76474763f, 0.79037860f, 0.81600957f, 0.84164054f, 0.86727150f, 0.89290247f,
+	0.91853344f, 0.94416441f, 0.96979538f, 0.99542634f, 0.98090918f, 0.95767182f,
+	0.93443447f, 0.91119711f, 0.88795976f, 0.86472240f, 0.84148505f, 0.81824770f,
+	0.79501034f, 0.77177299f, 0.74853563f, 0.72529828f, 0.70206092f, 0.67882357f,
+	0.65558621f, 0.63234886f, 0.60911150f, 0.58587415f, 0.56263679f, 0.53939944f,
+	0.51616208f, 0.49292473f, 0.46968737f, 0.44645002f, 0.42321266f, 0.39997531f,
+	0.37673795f, 0.35350060f, 0.33026324f, 0.30702589f, 0.28378854f, 0.26055118f,
+	0.23731383f, 0.21407647f, 0.19083912f, 0.16760176f, 0.14436441f, 0.12112705f,
+	0.09788970f, 0.07465234f, 0.05141499f, 0.02817763f, 0.00494028f, 0.01909082f,
+	0.04232818f, 0.06556553f, 0.08880289f, 0.11204024f, 0.13527760f, 0.15851495f,
+	0.18175230f, 0.20498966f, 0.22822701f, 0.25146437f, 0.27470172f, 0.29793908f,
+	0.32117643f, 0.34441379f, 0.36765114f, 0.39088850f, 0.41412585f, 0.43736321f,
+	0.46060056f, 0.48383792f, 0.50707527f, 0.53031263f, 0.55354998f, 0.57678734f,
+	0.60002469f, 0.62326205f, 0.64649940f, 0.66973676f, 0.69297411f, 0.71621146f,
+	0.73944882f, 0.76268617f, 0.78592353f, 0.80916088f, 0.83239824f, 0.85563559f,
+	0.87887295f, 0.90211030f, 0.92534766f, 0.94858501f, 0.97182237f, 0.99505972f,
+	0.98341164f, 0.96234437f, 0.94127709f, 0.92020982f, 0.89914254f, 0.87807527f,
+	0.85700799f, 0.83594072f, 0.81487344f, 0.79380616f, 0.77273889f, 0.75167161f,
+	0.73060434f, 0.70953706f, 0.68846979f, 0.66740251f, 0.64633524f, 0.62526796f,
+	0.60420069f, 0.58313341f, 0.56206614f, 0.54099886f, 0.51993159f, 0.49886431f,
+	0.47779704f, 0.45672976f, 0.43566249f, 0.41459521f, 0.39352794f, 0.37246066f,
+	0.35139338f, 0.33032611f, 0.30925883f, 0.28819156f, 0.26712428f, 0.24605701f,
+	0.22498973f, 0.20392246f, 0.18285518f, 0.16178791f, 0.14072063f, 0.11965336f,
+	0.09858608f, 0.07751881f, 0.05645153f, 0.03538426f, 0.01431698f, 0.01658836f,
+	0.03765563f, 0.05872291f, 0.07979018f, 0.10085746f, 0.12192473f, 0.14299201f,
+	0.16405928f, 0.18512656f, 0.20619384f, 0.22726111f, 0.24832839f, 0.26939566f,
+	0.29046294f, 0.31153021f, 0.33259749f, 0.35366476f, 0.37473204f, 0.39579931f,
+	0.41686659f, 0.43793386f, 0.45900114f, 0.48006841f, 0.50113569f, 0.52220296f,
+	0.54327024f, 0.56433751f, 0.58540479f, 0.60647206f, 0.62753934f, 0.64860662f,
+	0.66967389f, 0.69074117f, 0.71180844f, 0.73287572f, 0.75394299f, 0.77501027f,
+	0.79607754f, 0.81714482f, 0.83821209f, 0.85927937f, 0.88034664f, 0.90141392f,
+	0.92248119f, 0.94354847f, 0.96461574f, 0.98568302f, 0.99388010f, 0.97478025f,
+	0.95568039f, 0.93658054f, 0.91748068f, 0.89838083f, 0.87928097f, 0.86018112f,
+	0.84108127f, 0.82198141f, 0.80288156f, 0.78378170f, 0.76468185f, 0.74558200f,
+	0.72648214f, 0.70738229f, 0.68828243f, 0.66918258f, 0.65008273f, 0.63098287f,
+	0.61188302f, 0.59278316f, 0.57368331f, 0.55458345f, 0.53548360f, 0.51638375f,
+	0.49728389f, 0.47818404f, 0.45908418f, 0.43998433f, 0.42088448f, 0.40178462f,
+	0.38268477f, 0.36358491f, 0.34448506f, 0.32538521f, 0.30628535f, 0.28718550f,
+	0.26808564f, 0.24898579f, 0.22988594f, 0.21078608f, 0.19168623f, 0.17258637f,
+	0.15348652f, 0.13438666f, 0.11528681f, 0.09618696f, 0.07708710f, 0.05798725f,
+	0.03888739f, 0.01978754f, 0.00068769f, 0.00611990f, 0.02521975f, 0.04431961f,
+	0.06341946f, 0.08251932f, 0.10161917f, 0.12071903f, 0.13981888f, 0.15891873f,
+	0.17801859f, 0.19711844f, 0.21621830f, 0.23531815f, 0.25441800f, 0.27351786f,
+	0.29261771f, 0.31171757f, 0.33081742f, 0.34991727f, 0.36901713f, 0.38811698f,
+	0.40721684f, 0.42631669f, 0.44541655f, 0.46451640f, 0.48361625f, 0.50271611f,
+	0.52181596f, 0.54091582f, 0.56001567f, 0.57911552f, 0.59821538f, 0.61731523f,
+	0.63641509f, 0.65551494f, 0.67461479f, 0.69371465f, 0.71281450f, 0.73191436f,
+	0.75101421f, 0.77011406f, 0.78921392f, 0.80831377f, 0.82741363f, 0.84651348f,
+	0.86561334f, 0.88471319f, 0.90381304f, 0.92291290f, 0.94201275f, 0.96111261f,
+	0.98021246f, 0.99931231f, 0.98330730f, 0.96599113f, 0.94867497f, 0.93135880f,
+	0.91404264f, 0.89672647f, 0.87941031f, 0.86209414f, 0.84477797f, 0.82746181f,
+	0.81014564f, 0.79282948f, 0.77551331f, 0.75819715f, 0.74088098f, 0.72356482f,
+	0.70624865f, 0.68893248f, 0.67161632f, 0.65430015f, 0.63698399f, 0.61966782f,
+	0.60235166f, 0.58503549f, 0.56771933f, 0.55040316f, 0.53308699f, 0.51577083f,
+	0.49845466f, 0.48113850f, 0.46382233f, 0.44650617f, 0.42919000f, 0.41187383f,
+	0.39455767f, 0.37724150f, 0.35992534f, 0.34260917f, 0.32529301f, 0.30797684f,
+	0.29066068f, 0.27334451f, 0.25602834f, 0.23871218f, 0.22139601f, 0.20407985f,
+	0.18676368f, 0.16944752f, 0.15213135f, 0.13481519f, 0.11749902f, 0.10018285f,
+	0.08286669f, 0.06555052f, 0.04823436f, 0.03091819f, 0.01360203f, 0.01669270f,
+	0.03400887f, 0.05132503f, 0.06864120f, 0.08595736f, 0.10327353f, 0.12058969f,
+	0.13790586f, 0.15522203f, 0.17253819f, 0.18985436f, 0.20717052f, 0.22448669f,
+	0.24180285f, 0.25911902f, 0.27643518f, 0.29375135f, 0.31106752f, 0.32838368f,
+	0.34569985f, 0.36301601f, 0.38033218f, 0.39764834f, 0.41496451f, 0.43228067f,
+	0.44959684f, 0.46691301f, 0.48422917f, 0.50154534f, 0.51886150f, 0.53617767f,
+	0.55349383f, 0.57081000f, 0.58812617f, 0.60544233f, 0.62275850f, 0.64007466f,
+	0.65739083f, 0.67470699f, 0.69202316f, 0.70933932f, 0.72665549f, 0.74397166f,
+	0.76128782f, 0.77860399f, 0.79592015f, 0.81323632f, 0.83055248f, 0.84786865f,
+	0.86518481f, 0.88250098f, 0.89981715f, 0.91713331f, 0.93444948f, 0.95176564f,
+	0.96908181f, 0.98639797f, 0.99663272f, 0.98093366f, 0.96523461f, 0.94953556f,
+	0.93383651f, 0.91813746f, 0.90243841f, 0.88673936f, 0.87104030f, 0.85534125f,
+	0.83964220f, 0.82394315f, 0.80824410f, 0.79254505f, 0.77684600f, 0.76114694f,
+	0.74544789f, 0.72974884f, 0.71404979f, 0.69835074f, 0.68265169f, 0.66695264f,
+	0.65125358f, 0.63555453f, 0.61985548f, 0.60415643f, 0.58845738f, 0.57275833f,
+	0.55705928f, 0.54136023f, 0.52566117f, 0.50996212f, 0.49426307f, 0.47856402f,
+	0.46286497f, 0.44716592f, 0.43146687f, 0.41576781f, 0.40006876f, 0.38436971f,
+	0.36867066f, 0.35297161f, 0.33727256f, 0.32157351f, 0.30587445f, 0.29017540f,
+	0.27447635f, 0.25877730f, 0.24307825f, 0.22737920f, 0.21168015f, 0.19598110f,
+	0.18028204f, 0.16458299f, 0.14888394f, 0.13318489f, 0.11748584f, 0.10178679f,
+	0.08608774f, 0.07038868f, 0.05468963f, 0.03899058f, 0.02329153f, 0.00759248f,
+	0.00336728f, 0.01906634f, 0.03476539f, 0.05046444f, 0.06616349f, 0.08186254f,
+	0.09756159f, 0.11326064f, 0.12895970f, 0.14465875f, 0.16035780f, 0.17605685f,
+	0.19175590f, 0.20745495f, 0.22315400f, 0.23885306f, 0.25455211f, 0.27025116f,
+	0.28595021f, 0.30164926f, 0.31734831f, 0.33304736f, 0.34874642f, 0.36444547f,
+	0.38014452f, 0.39584357f, 0.41154262f, 0.42724167f, 0.44294072f, 0.45863977f,
+	0.47433883f, 0.49003788f, 0.50573693f, 0.52143598f, 0.53713503f, 0.55283408f,
+	0.56853313f, 0.58423219f, 0.59993124f, 0.61563029f, 0.63132934f, 0.64702839f,
+	0.66272744f, 0.67842649f, 0.69412555f, 0.70982460f, 0.72552365f, 0.74122270f,
+	0.75692175f, 0.77262080f, 0.78831985f, 0.80401890f, 0.81971796f, 0.83541701f,
+	0.85111606f, 0.86681511f, 0.88251416f, 0.89821321f, 0.91391226f, 0.92961132f,
+	0.94531037f, 0.96100942f, 0.97670847f, 0.99240752f, 0.99265048f, 0.97841752f,
+	0.96418457f, 0.94995161f, 0.93571866f, 0.92148570f, 0.90725275f, 0.89301979f,
+	0.87878684f, 0.86455388f, 0.85032093f, 0.83608797f, 0.82185501f, 0.80762206f,
+	0.79338910f, 0.77915615f, 0.76492319f, 0.75069024f, 0.73645728f, 0.72222433f,
+	0.70799137f, 0.69375842f, 0.67952546f, 0.66529250f, 0.65105955f, 0.63682659f,
+	0.62259364f, 0.60836068f, 0.59412773f, 0.57989477f, 0.56566182f, 0.55142886f,
+	0.53719590f, 0.52296295f, 0.50872999f, 0.49449704f, 0.48026408f, 0.46603113f,
+	0.45179817f, 0.43756522f, 0.42333226f, 0.40909931f, 0.39486635f, 0.38063339f,
+	0.36640044f, 0.35216748f, 0.33793453f, 0.32370157f, 0.30946862f, 0.29523566f,
+	0.28100271f, 0.26676975f, 0.25253680f, 0.23830384f, 0.22407088f, 0.20983793f,
+	0.19560497f, 0.18137202f, 0.16713906f, 0.15290611f, 0.13867315f, 0.12444020f,
+	0.11020724f, 0.09597428f, 0.08174133f, 0.06750837f, 0.05327542f, 0.03904246f,
+	0.02480951f, 0.01057655f, 0.00734952f, 0.02158248f, 0.03581543f, 0.05004839f,
+	0.06428134f, 0.07851430f, 0.09274725f, 0.10698021f, 0.12121316f, 0.13544612f,
+	0.14967907f, 0.16391203f, 0.17814499f, 0.19237794f, 0.20661090f, 0.22084385f,
+	0.23507681f, 0.24930976f, 0.26354272f, 0.27777567f, 0.29200863f, 0.30624158f,
+	0.32047454f, 0.33470750f, 0.34894045f, 0.36317341f, 0.37740636f, 0.39163932f,
+	0.40587227f, 0.42010523f, 0.43433818f, 0.44857114f, 0.46280410f, 0.47703705f,
+	0.49127001f, 0.50550296f, 0.51973592f, 0.53396887f, 0.54820183f, 0.56243478f,
+	0.57666774f, 0.59090069f, 0.60513365f, 0.61936661f, 0.63359956f, 0.64783252f,
+	0.66206547f, 0.67629843f, 0.69053138f, 0.70476434f, 0.71899729f, 0.73323025f,
+	0.74746320f, 0.76169616f, 0.77592912f, 0.79016207f, 0.80439503f, 0.81862798f,
+	0.83286094f, 0.84709389f, 0.86132685f, 0.87555980f, 0.88979276f, 0.90402572f,
+	0.91825867f, 0.93249163f, 0.94672458f, 0.96095754f, 0.97519049f, 0.98942345f,
+	0.99668506f, 0.98378128f, 0.97087751f, 0.95797373f, 0.94506996f, 0.93216619f,
+	0.91926241f, 0.90635864f, 0.89345486f, 0.88055109f, 0.86764731f, 0.85474354f,
+	0.84183976f, 0.82893599f, 0.81603221f, 0.80312844f, 0.79022466f, 0.77732089f,
+	0.76441711f, 0.75151334f, 0.73860957f, 0.72570579f, 0.71280202f, 0.69989824f,
+	0.68699447f, 0.67409069f, 0.66118692f, 0.64828314f, 0.63537937f, 0.62247559f,
+	0.60957182f, 0.59666804f, 0.58376427f, 0.57086049f, 0.55795672f, 0.54505294f,
+	0.53214917f, 0.51924540f, 0.50634162f, 0.49343785f, 0.48053407f, 0.46763030f,
+	0.45472652f, 0.44182275f, 0.42891897f, 0.41601520f, 0.40311142f, 0.39020765f,
+	0.37730387f, 0.36440010f, 0.35149632f, 0.33859255f, 0.32568877f, 0.31278500f,
+	0.29988123f, 0.28697745f, 0.27407368f, 0.26116990f, 0.24826613f, 0.23536235f,
+	0.22245858f, 0.20955480f, 0.19665103f, 0.18374725f, 0.17084348f, 0.15793970f,
+	0.14503593f, 0.13213215f, 0.11922838f, 0.10632461f, 0.09342083f, 0.08051706f,
+	0.06761328f, 0.05470951f, 0.04180573f, 0.02890196f, 0.01599818f, 0.00309441f,
+	0.00331494f, 0.01621872f, 0.02912249f, 0.04202627f, 0.05493004f, 0.06783381f,
+	0.08073759f, 0.09364136f, 0.10654514f, 0.11944891f, 0.13235269f, 0.14525646f,
+	0.15816024f, 0.17106401f, 0.18396779f, 0.19687156f, 0.20977534f, 0.22267911f,
+	0.23558289f, 0.24848666f, 0.26139043f, 0.27429421f, 0.28719798f, 0.30010176f,
+	0.31300553f, 0.32590931f, 0.33881308f, 0.35171686f, 0.36462063f, 0.37752441f,
+	0.39042818f, 0.40333196f, 0.41623573f, 0.42913951f, 0.44204328f, 0.45494706f,
+	0.46785083f, 0.48075460f, 0.49365838f, 0.50656215f, 0.51946593f, 0.53236970f,
+	0.54527348f, 0.55817725f, 0.57108103f, 0.58398480f, 0.59688858f, 0.60979235f,
+	0.62269613f, 0.63559990f, 0.64850368f, 0.66140745f, 0.67431123f, 0.68721500f,
+	0.70011877f, 0.71302255f, 0.72592632f, 0.73883010f, 0.75173387f, 0.76463765f,
+	0.77754142f, 0.79044520f, 0.80334897f, 0.81625275f, 0.82915652f, 0.84206030f,
+	0.85496407f, 0.86786785f, 0.88077162f, 0.89367539f, 0.90657917f, 0.91948294f,
+	0.93238672f, 0.94529049f, 0.95819427f, 0.97109804f, 0.98400182f, 0.99690559f,
+	0.99110671f, 0.97940798f, 0.96770926f, 0.95601054f, 0.94431181f, 0.93261309f,
+	0.92091437f, 0.90921565f, 0.89751692f, 0.88581820f, 0.87411948f, 0.86242075f,
+	0.85072203f, 0.83902331f, 0.82732459f, 0.81562586f, 0.80392714f, 0.79222842f,
+	0.78052969f, 0.76883097f, 0.75713225f, 0.74543353f, 0.73373480f, 0.72203608f,
+	0.71033736f, 0.69863863f, 0.68693991f, 0.67524119f, 0.66354247f, 0.65184374f,
+	0.64014502f, 0.62844630f, 0.61674757f, 0.60504885f, 0.59335013f, 0.58165141f,
+	0.56995268f, 0.55825396f, 0.54655524f, 0.53485651f, 0.52315779f, 0.51145907f,
+	0.49976035f, 0.48806162f, 0.47636290f, 0.46466418f, 0.45296546f, 0.44126673f,
+	0.42956801f, 0.41786929f, 0.40617056f, 0.39447184f, 0.38277312f, 0.37107440f,
+	0.35937567f, 0.34767695f, 0.33597823f, 0.32427950f, 0.31258078f, 0.30088206f,
+	0.28918334f, 0.27748461f, 0.26578589f, 0.25408717f, 0.24238844f, 0.23068972f,
+	0.21899100f, 0.20729228f, 0.19559355f, 0.18389483f, 0.17219611f, 0.16049738f,
+	0.14879866f, 0.13709994f, 0.12540122f, 0.11370249f, 0.10200377f, 0.09030505f,
+	0.07860632f, 0.06690760f, 0.05520888f, 0.04351016f, 0.03181143f, 0.02011271f,
+	0.00841399f, 0.00889329f, 0.02059202f, 0.03229074f, 0.04398946f, 0.05568819f,
+	0.06738691f, 0.07908563f, 0.09078435f, 0.10248308f, 0.11418180f, 0.12588052f,
+	0.13757925f, 0.14927797f, 0.16097669f, 0.17267541f, 0.18437414f, 0.19607286f,
+	0.20777158f, 0.21947031f, 0.23116903f, 0.24286775f, 0.25456647f, 0.26626520f,
+	0.27796392f, 0.28966264f, 0.30136137f, 0.31306009f, 0.32475881f, 0.33645753f,
+	0.34815626f, 0.35985498f, 0.37155370f, 0.38325243f, 0.39495115f, 0.40664987f,
+	0.41834859f, 0.43004732f, 0.44174604f, 0.45344476f, 0.46514349f, 0.47684221f,
+	0.48854093f, 0.50023965f, 0.51193838f, 0.52363710f, 0.53533582f, 0.54703454f,
+	0.55873327f, 0.57043199f, 0.58213071f, 0.59382944f, 0.60552816f, 0.61722688f,
+	0.62892560f, 0.64062433f, 0.65232305f, 0.66402177f, 0.67572050f, 0.68741922f,
+	0.69911794f, 0.71081666f, 0.72251539f, 0.73421411f, 0.74591283f, 0.75761156f,
+	0.76931028f, 0.78100900f, 0.79270772f, 0.80440645f, 0.81610517f, 0.82780389f,
+	0.83950262f, 0.85120134f, 0.86290006f, 0.87459878f, 0.88629751f, 0.89799623f,
+	0.90969495f, 0.92139368f, 0.93309240f, 0.94479112f, 0.95648984f, 0.96818857f,
+	0.97988729f, 0.99158601f, 0.99702202f, 0.98641581f, 0.97580960f, 0.96520339f,
+	0.95459719f, 0.94399098f, 0.93338477f, 0.92277856f, 0.91217236f, 0.90156615f,
+	0.89095994f, 0.88035373f, 0.86974752f, 0.85914132f, 0.84853511f, 0.83792890f,
+	0.82732269f, 0.81671649f, 0.80611028f, 0.79550407f, 0.78489786f, 0.77429165f,
+	0.76368545f, 0.75307924f, 0.74247303f, 0.73186682f, 0.72126061f, 0.71065441f,
+	0.70004820f, 0.68944199f, 0.67883578f, 0.66822958f, 0.65762337f, 0.64701716f,
+	0.63641095f, 0.62580474f, 0.61519854f, 0.60459233f, 0.59398612f, 0.58337991f,
+	0.57277371f, 0.56216750f, 0.55156129f, 0.54095508f, 0.53034887f, 0.51974267f,
+	0.50913646f, 0.49853025f, 0.48792404f, 0.47731783f, 0.46671163f, 0.45610542f,
+	0.44549921f, 0.43489300f, 0.42428680f, 0.41368059f, 0.40307438f, 0.39246817f,
+	0.38186196f, 0.37125576f, 0.36064955f, 0.35004334f, 0.33943713f, 0.32883093f,
+	0.31822472f, 0.30761851f, 0.29701230f, 0.28640609f, 0.27579989f, 0.26519368f,
+	0.25458747f, 0.24398126f, 0.23337506f, 0.22276885f, 0.21216264f, 0.20155643f,
+	0.19095022f, 0.18034402f, 0.16973781f, 0.15913160f, 0.14852539f, 0.13791918f,
+	0.12731298f, 0.11670677f, 0.10610056f, 0.09549435f, 0.08488815f, 0.07428194f,
+	0.06367573f, 0.05306952f, 0.04246331f, 0.03185711f, 0.02125090f, 0.01064469f,
+	0.00003848f, 0.00297798f, 0.01358419f, 0.02419040f, 0.03479661f, 0.04540281f,
+	0.05600902f, 0.06661523f, 0.07722144f, 0.08782764f, 0.09843385f, 0.10904006f,
+	0.11964627f, 0.13025248f, 0.14085868f, 0.15146489f, 0.16207110f, 0.17267731f,
+	0.18328351f, 0.19388972f, 0.20449593f, 0.21510214f, 0.22570835f, 0.23631455f,
+	0.24692076f, 0.25752697f, 0.26813318f, 0.27873939f, 0.28934559f, 0.29995180f,
+	0.31055801f, 0.32116422f, 0.33177042f, 0.34237663f, 0.35298284f, 0.36358905f,
+	0.37419526f, 0.38480146f, 0.39540767f, 0.40601388f, 0.41662009f, 0.42722629f,
+	0.43783250f, 0.44843871f, 0.45904492f, 0.46965113f, 0.48025733f, 0.49086354f,
+	0.50146975f, 0.51207596f, 0.52268217f, 0.53328837f, 0.54389458f, 0.55450079f,
+	0.56510700f, 0.57571320f, 0.58631941f, 0.59692562f, 0.60753183f, 0.61813804f,
+	0.62874424f, 0.63935045f, 0.64995666f, 0.66056287f, 0.67116907f, 0.68177528f,
+	0.69238149f, 0.70298770f, 0.71359391f, 0.72420011f, 0.73480632f, 0.74541253f,
+	0.75601874f, 0.76662494f, 0.77723115f, 0.78783736f, 0.79844357f, 0.80904978f,
+	0.81965598f, 0.83026219f, 0.84086840f, 0.85147461f, 0.86208082f, 0.87268702f,
+	0.88329323f, 0.89389944f, 0.90450565f, 0.91511185f, 0.92571806f, 0.93632427f,
+	0.94693048f, 0.95753669f, 0.96814289f, 0.97874910f, 0.98935531f, 0.99996152f,
+	0.99041917f, 0.98080345f, 0.97118773f, 0.96157201f, 0.95195629f, 0.94234057f,
+	0.93272485f, 0.92310913f, 0.91349341f, 0.90387769f, 0.89426197f, 0.88464625f,
+	0.87503053f, 0.86541481f, 0.85579909f, 0.84618337f, 0.83656765f, 0.82695193f,
+	0.81733621f, 0.80772049f, 0.79810477f, 0.78848905f, 0.77887333f, 0.76925761f,
+	0.75964189f, 0.75002617f, 0.74041045f, 0.73079473f, 0.72117901f, 0.71156329f,
+	0.70194757f, 0.69233185f, 0.68271613f, 0.67310041f, 0.66348469f, 0.65386897f,
+	0.64425325f, 0.63463753f, 0.62502181f, 0.61540609f, 0.60579037f, 0.59617465f,
+	0.58655893f, 0.57694321f, 0.56732749f, 0.55771177f, 0.54809605f, 0.53848033f,
+	0.52886460f, 0.51924888f, 0.50963316f, 0.50001744f, 0.49040172f, 0.48078600f,
+	0.47117028f, 0.46155456f, 0.45193884f, 0.44232312f, 0.43270740f, 0.42309168f,
+	0.41347596f, 0.40386024f, 0.39424452f, 0.38462880f, 0.37501308f, 0.36539736f,
+	0.35578164f, 0.34616592f, 0.33655020f, 0.32693448f, 0.31731876f, 0.30770304f,
+	0.29808732f, 0.28847160f, 0.27885588f, 0.26924016f, 0.25962444f, 0.25000872f,
+	0.24039300f, 0.23077728f, 0.22116156f, 0.21154584f, 0.20193012f, 0.19231440f,
+	0.18269868f, 0.17308296f, 0.16346724f, 0.15385152f, 0.14423580f, 0.13462008f,
+	0.12500436f, 0.11538864f, 0.10577292f, 0.09615720f, 0.08654148f, 0.07692576f,
+	0.06731004f, 0.05769432f, 0.04807860f, 0.03846288f, 0.02884716f, 0.01923144f,
+	0.00961572f,
+};
+
+/* 32000 Hz, 50 to 8000 Hz */
+static const uint16_t mel_start_32000[MEL_BANDS] = {
+	4, 9, 14, 20, 27, 34, 42, 51, 61, 72, 84, 97,
+	111, 127, 145, 165, 186, 210, 236, 265, 297, 332, 371, 413,
+};
+static const uint8_t mel_len_32000[MEL_BANDS] = {
+	10, 11, 13, 14, 15, 17, 19, 21, 23, 25, 27, 30,
+	34, 38, 41, 45, 50, 55, 61, 67, 74, 81, 90, 100,
+};
+static const uint16_t mel_offset_32000[MEL_BANDS] = {
+	0, 10, 21, 34, 48, 63, 80, 99, 120, 143, 168, 195,
+	225, 259, 297, 338, 383, 433, 488, 549, 616, 690, 771, 861,
+};
+static const float mel_weights_32000[961] = {
+	0.16180110f, 0.36405247f, 0.56630384f, 0.76855522f, 0.97080659f, 0.84310350f,
+	0.65973988f, 0.47637627f, 0.29301266f, 0.10964904f, 0.15689650f, 0.34026012f,
+	0.52362373f, 0.70698734f, 0.89035096f, 0.93316945f, 0.76692972f, 0.60068998f,
+	0.43445025f, 0.26821051f, 0.10197078f, 0.06683055f, 0.23307028f, 0.39931002f,
+	0.56554975f, 0.73178949f, 0.89802922f, 0.94173296f, 0.79101795f, 0.64030293f,
+	0.48958792f, 0.33887290f, 0.18815789f, 0.03744287f, 0.05826704f, 0.20898205f,
+	0.35969707f, 0.51041208f, 0.66112710f, 0.81184211f, 0.96255713f, 0.89730607f,
+	0.76066596f, 0.62402585f, 0.48738574f, 0.35074563f, 0.21410552f, 0.07746541f,
+	0.10269393f, 0.23933404f, 0.37597415f, 0.51261426f, 0.64925437f, 0.78589448f,
+	0.92253459f, 0.94635148f, 0.82247186f, 0.69859223f, 0.57471261f, 0.45083299f,
+	0.32695336f, 0.20307374f, 0.07919411f, 0.05364852f, 0.17752814f, 0.30140777f,
+	0.42528739f, 0.54916701f, 0.67304664f, 0.79692626f, 0.92080589f, 0.95948756f,
+	0.84717675f, 0.73486594f, 0.62255513f, 0.51024432f, 0.39793351f, 0.28562270f,
+	0.17331189f, 0.06100108f, 0.04051244f, 0.15282325f, 0.26513406f, 0.37744487f,
+	0.48975568f, 0.60206649f, 0.71437730f, 0.82668811f, 0.93899892f, 0.95348196f,
+	0.85165958f, 0.74983720f, 0.64801482f, 0.54619244f, 0.44437006f, 0.34254768f,
+	0.24072530f, 0.13890292f, 0.03708054f, 0.04651804f, 0.14834042f, 0.25016280f,
+	0.35198518f, 0.45380756f, 0.55562994f, 0.65745232f, 0.75927470f, 0.86109708f,
+	0.96291946f, 0.94130424f, 0.84899081f, 0.75667737f, 0.66436393f, 0.57205050f,
+	0.47973706f, 0.38742362f, 0.29511018f, 0.20279675f, 0.11048331f, 0.01816987f,
+	0.05869576f, 0.15100919f, 0.24332263f, 0.33563607f, 0.42794950f, 0.52026294f,
+	0.61257638f, 0.70488982f, 0.79720325f, 0.88951669f, 0.98183013f, 0.93278052f,
+	0.84908801f, 0.76539550f, 0.68170299f, 0.59801047f, 0.51431796f, 0.43062545f,
+	0.34693294f, 0.26324043f, 0.17954792f, 0.09585540f, 0.01216289f, 0.06721948f,
+	0.15091199f, 0.23460450f, 0.31829701f, 0.40198953f, 0.48568204f, 0.56937455f,
+	0.65306706f, 0.73675957f, 0.82045208f, 0.90414460f, 0.98783711f, 0.93515036f,
+	0.85927368f, 0.78339701f, 0.70752034f, 0.63164366f, 0.55576699f, 0.47989032f,
+	0.40401364f, 0.32813697f, 0.25226029f, 0.17638362f, 0.10050695f, 0.02463027f,
+	0.06484964f, 0.14072632f, 0.21660299f, 0.29247966f, 0.36835634f, 0.44423301f,
+	0.52010968f, 0.59598636f, 0.67186303f, 0.74773971f, 0.82361638f, 0.89949305f,
+	0.97536973f, 0.95353938f, 0.88474864f, 0.81595790f, 0.74716717f, 0.67837643f,
+	0.60958569f, 0.54079495f, 0.47200422f, 0.40321348f, 0.33442274f, 0.26563201f,
+	0.19684127f, 0.12805053f, 0.05925979f, 0.04646062f, 0.11525136f, 0.18404210f,
+	0.25283283f, 0.32162357f, 0.39041431f, 0.45920505f, 0.52799578f, 0.59678652f,
+	0.66557726f, 0.73436799f, 0.80315873f, 0.87194947f, 0.94074021f, 0.99135913f,
+	0.92899259f, 0.86662605f, 0.80425951f, 0.74189297f, 0.67952643f, 0.61715990f,
+	0.55479336f, 0.49242682f, 0.43006028f, 0.36769374f, 0.30532720f, 0.24296066f,
+	0.18059412f, 0.11822758f, 0.05586105f, 0.00864087f, 0.07100741f, 0.13337395f,
+	0.19574049f, 0.25810703f, 0.32047357f, 0.38284010f, 0.44520664f, 0.50757318f,
+	0.56993972f, 0.63230626f, 0.69467280f, 0.75703934f, 0.81940588f, 0.88177242f,
+	0.94413895f, 0.99410204f, 0.93755976f, 0.88101748f, 0.82447520f, 0.76793291f,
+	0.71139063f, 0.65484835f, 0.59830607f, 0.54176379f, 0.48522151f, 0.42867923f,
+	0.37213695f, 0.31559467f, 0.25905239f, 0.20251011f, 0.14596783f, 0.08942554f,
+	0.03288326f, 0.00589796f, 0.06244024f, 0.11898252f, 0.17552480f, 0.23206709f,
+	0.28860937f, 0.34515165f, 0.40169393f, 0.45823621f, 0.51477849f, 0.57132077f,
+	0.62786305f, 0.68440533f, 0.74094761f, 0.79748989f, 0.85403217f, 0.91057446f,
+	0.96711674f, 0.97855044f, 0.92728850f, 0.87602657f, 0.82476463f, 0.77350270f,
+	0.72224076f, 0.67097882f, 0.61971689f, 0.56845495f, 0.51719302f, 0.46593108f,
+	0.41466914f, 0.36340721f, 0.31214527f, 0.26088334f, 0.20962140f, 0.15835946f,
+	0.10709753f, 0.05583559f, 0.00457366f, 0.02144956f, 0.07271150f, 0.12397343f,
+	0.17523537f, 0.22649730f, 0.27775924f, 0.32902118f, 0.38028311f, 0.43154505f,
+	0.48280698f, 0.53406892f, 0.58533086f, 0.63659279f, 0.68785473f, 0.73911666f,
+	0.79037860f, 0.84164054f, 0.89290247f, 0.94416441f, 0.99542634f, 0.95767182f,
+	0.91119711f, 0.86472240f, 0.81824770f, 0.77177299f, 0.72529828f, 0.67882357f,
+	0.63234886f, 0.58587415f, 0.53939944f, 0.49292473f, 0.44645002f, 0.39997531f,
+	0.35350060f, 0.30702589f, 0.26055118f, 0.21407647f, 0.16760176f, 0.12112705f,
+	0.07465234f, 0.02817763f, 0.04232818f, 0.08880289f, 0.13527760f, 0.18175230f,
+	0.22822701f, 0.27470172f, 0.32117643f, 0.36765114f, 0.41412585f, 0.46060056f,
+	0.50707527f, 0.55354998f, 0.60002469f, 0.64649940f, 0.69297411f, 0.73944882f,
+	0.78592353f, 0.83239824f, 0.87887295f, 0.92534766f, 0.97182237f, 0.98341164f,
+	0.94127709f, 0.89914254f, 0.85700799f, 0.81487344f, 0.77273889f, 0.73060434f,
+	0.68846979f, 0.64633524f, 0.60420069f, 0.56206614f, 0.51993159f, 0.47779704f,
+	0.43566249f, 0.39352794f, 0.35139338f, 0.30925883f, 0.26712428f, 0.22498973f,
+	0.18285518f, 0.14072063f, 0.09858608f, 0.05645153f, 0.01431698f, 0.01658836f,
+	0.05872291f, 0.10085746f, 0.14299201f, 0.18512656f, 0.22726111f, 0.26939566f,
+	0.31153021f, 0.35366476f, 0.39579931f, 0.43793386f, 0.48006841f, 0.52220296f,
+	0.56433751f, 0.60647206f, 0.64860662f, 0.69074117f, 0.73287572f, 0.77501027f,
+	0.81714482f, 0.85927937f, 0.90141392f, 0.94354847f, 0.98568302f, 0.97478025f,
+	0.93658054f, 0.89838083f, 0.86018112f, 0.82198141f, 0.78378170f, 0.74558200f,
+	0.70738229f, 0.66918258f, 0.63098287f, 0.59278316f, 0.55458345f, 0.51638375f,
+	0.47818404f, 0.43998433f, 0.40178462f, 0.36358491f, 0.32538521f, 0.28718550f,
+	0.24898579f, 0.21078608f, 0.17258637f, 0.13438666f, 0.09618696f, 0.05798725f,
+	0.01978754f, 0.02521975f, 0.06341946f, 0.10161917f, 0.13981888f, 0.17801859f,
+	0.21621830f, 0.25441800f, 0.29261771f, 0.33081742f, 0.36901713f, 0.40721684f,
+	0.44541655f, 0.48361625f, 0.52181596f, 0.56001567f, 0.59821538f, 0.63641509f,
+	0.67461479f, 0.71281450f, 0.75101421f, 0.78921392f, 0.82741363f, 0.86561334f,
+	0.90381304f, 0.94201275f, 0.98021246f, 0.98330730f, 0.94867497f, 0.91404264f,
+	0.87941031f, 0.84477797f, 0.81014564f, 0.77551331f, 0.74088098f, 0.70624865f,
+	0.67161632f, 0.63698399f, 0.60235166f, 0.56771933f, 0.53308699f, 0.49845466f,
+	0.46382233f, 0.42919000f, 0.39455767f, 0.35992534f, 0.32529301f, 0.29066068f,
+	0.25602834f, 0.22139601f, 0.18676368f, 0.15213135f, 0.11749902f, 0.08286669f,
+	0.04823436f, 0.01360203f, 0.01669270f, 0.05132503f, 0.08595736f, 0.12058969f,
+	0.15522203f, 0.18985436f, 0.22448669f, 0.25911902f, 0.29375135f, 0.32838368f,
+	0.36301601f, 0.39764834f, 0.43228067f, 0.46691301f, 0.50154534f, 0.53617767f,
+	0.57081000f, 0.60544233f, 0.64007466f, 0.67470699f, 0.70933932f, 0.74397166f,
+	0.77860399f, 0.81323632f, 0.84786865f, 0.88250098f, 0.91713331f, 0.95176564f,
+	0.98639797f, 0.98093366f, 0.94953556f, 0.91813746f, 0.88673936f, 0.85534125f,
+	0.82394315f, 0.79254505f, 0.76114694f, 0.72974884f, 0.69835074f, 0.66695264f,
+	0.63555453f, 0.60415643f, 0.57275833f, 0.54136023f, 0.50996212f, 0.47856402f,
+	0.44716592f, 0.41576781f, 0.38436971f, 0.35297161f, 0.32157351f, 0.29017540f,
+	0.25877730f, 0.22737920f, 0.19598110f, 0.16458299f, 0.13318489f, 0.10178679f,
+	0.07038868f, 0.03899058f, 0.00759248f, 0.01906634f, 0.05046444f, 0.08186254f,
+	0.11326064f, 0.14465875f, 0.17605685f, 0.20745495f, 0.23885306f, 0.27025116f,
+	0.30164926f, 0.33304736f, 0.36444547f, 0.39584357f, 0.42724167f, 0.45863977f,
+	0.49003788f, 0.52143598f, 0.55283408f, 0.58423219f, 0.61563029f, 0.64702839f,
+	0.67842649f, 0.70982460f, 0.74122270f, 0.77262080f, 0.80401890f, 0.83541701f,
+	0.86681511f, 0.89821321f, 0.92961132f, 0.96100942f, 0.99240752f, 0.97841752f,
+	0.94995161f, 0.92148570f, 0.89301979f, 0.86455388f, 0.83608797f, 0.80762206f,
+	0.77915615f, 0.75069024f, 0.72222433f, 0.69375842f, 0.66529250f, 0.63682659f,
+	0.60836068f, 0.57989477f, 0.55142886f, 0.52296295f, 0.49449704f, 0.46603113f,
+	0.43756522f, 0.40909931f, 0.38063339f, 0.35216748f, 0.32370157f, 0.29523566f,
+	0.26676975f, 0.23830384f, 0.20983793f, 0.18137202f, 0.15290611f, 0.12444020f,
+	0.09597428f, 0.06750837f, 0.03904246f, 0.01057655f, 0.02158248f, 0.05004839f,
+	0.07851430f, 0.10698021f, 0.13544612f, 0.16391203f, 0.19237794f, 0.22084385f,
+	0.24930976f, 0.27777567f, 0.30624158f, 0.33470750f, 0.36317341f, 0.39163932f,
+	0.42010523f, 0.44857114f, 0.47703705f, 0.50550296f, 0.53396887f, 0.56243478f,
+	0.59090069f, 0.61936661f, 0.64783252f, 0.67629843f, 0.70476434f, 0.73323025f,
+	0.76169616f, 0.79016207f, 0.81862798f, 0.84709389f, 0.87555980f, 0.90402572f,
+	0.93249163f, 0.96095754f, 0.98942345f, 0.98378128f, 0.95797373f, 0.93216619f,
+	0.90635864f, 0.88055109f, 0.85474354f, 0.82893599f, 0.80312844f, 0.77732089f,
+	0.75151334f, 0.72570579f, 0.69989824f, 0.67409069f, 0.64828314f, 0.62247559f,
+	0.59666804f, 0.57086049f, 0.54505294f, 0.51924540f, 0.49343785f, 0.46763030f,
+	0.44182275f, 0.41601520f, 0.39020765f, 0.36440010f, 0.33859255f, 0.31278500f,
+	0.28697745f, 0.26116990f, 0.23536235f, 0.20955480f, 0.18374725f, 0.15793970f,
+	0.13213215f, 0.10632461f, 0.08051706f, 0.05470951f, 0.02890196f, 0.00309441f,
+	0.01621872f, 0.04202627f, 0.06783381f, 0.09364136f, 0.11944891f, 0.14525646f,
+	0.17106401f, 0.19687156f, 0.22267911f, 0.24848666f, 0.27429421f, 0.30010176f,
+	0.32590931f, 0.35171686f, 0.37752441f, 0.40333196f, 0.42913951f, 0.45494706f,
+	0.48075460f, 0.50656215f, 0.53236970f, 0.55817725f, 0.58398480f, 0.60979235f,
+	0.63559990f, 0.66140745f, 0.68721500f, 0.71302255f, 0.73883010f, 0.76463765f,
+	0.79044520f, 0.81625275f, 0.84206030f, 0.86786785f, 0.89367539f, 0.91948294f,
+	0.94529049f, 0.97109804f, 0.99690559f, 0.97940798f, 0.95601054f, 0.93261309f,
+	0.90921565f, 0.88581820f, 0.86242075f, 0.83902331f, 0.81562586f, 0.79222842f,
+	0.76883097f, 0.74543353f, 0.72203608f, 0.69863863f, 0.67524119f, 0.65184374f,
+	0.62844630f, 0.60504885f, 0.58165141f, 0.55825396f, 0.53485651f, 0.51145907f,
+	0.48806162f, 0.46466418f, 0.44126673f, 0.41786929f, 0.39447184f, 0.37107440f,
+	0.34767695f, 0.32427950f, 0.30088206f, 0.27748461f, 0.25408717f, 0.23068972f,
+	0.20729228f, 0.18389483f, 0.16049738f, 0.13709994f, 0.11370249f, 0.09030505f,
+	0.06690760f, 0.04351016f, 0.02011271f, 0.02059202f, 0.04398946f, 0.06738691f,
+	0.09078435f, 0.11418180f, 0.13757925f, 0.16097669f, 0.18437414f, 0.20777158f,
+	0.23116903f, 0.25456647f, 0.27796392f, 0.30136137f, 0.32475881f, 0.34815626f,
+	0.37155370f, 0.39495115f, 0.41834859f, 0.44174604f, 0.46514349f, 0.48854093f,
+	0.51193838f, 0.53533582f, 0.55873327f, 0.58213071f, 0.60552816f, 0.62892560f,
+	0.65232305f, 0.67572050f, 0.69911794f, 0.72251539f, 0.74591283f, 0.76931028f,
+	0.79270772f, 0.81610517f, 0.83950262f, 0.86290006f, 0.88629751f, 0.90969495f,
+	0.93309240f, 0.95648984f, 0.97988729f, 0.99702202f, 0.97580960f, 0.95459719f,
+	0.93338477f, 0.91217236f, 0.89095994f, 0.86974752f, 0.84853511f, 0.82732269f,
+	0.80611028f, 0.78489786f, 0.76368545f, 0.74247303f, 0.72126061f, 0.70004820f,
+	0.67883578f, 0.65762337f, 0.63641095f, 0.61519854f, 0.59398612f, 0.57277371f,
+	0.55156129f, 0.53034887f, 0.50913646f, 0.48792404f, 0.46671163f, 0.44549921f,
+	0.42428680f, 0.40307438f, 0.38186196f, 0.36064955f, 0.33943713f, 0.31822472f,
+	0.29701230f, 0.27579989f, 0.25458747f, 0.23337506f, 0.21216264f, 0.19095022f,
+	0.16973781f, 0.14852539f, 0.12731298f, 0.10610056f, 0.08488815f, 0.06367573f,
+	0.04246331f, 0.02125090f, 0.00003848f, 0.00297798f, 0.02419040f, 0.04540281f,
+	0.06661523f, 0.08782764f, 0.10904006f, 0.13025248f, 0.15146489f, 0.17267731f,
+	0.19388972f, 0.21510214f, 0.23631455f, 0.25752697f, 0.27873939f, 0.29995180f,
+	0.32116422f, 0.34237663f, 0.36358905f, 0.38480146f, 0.40601388f, 0.42722629f,
+	0.44843871f, 0.46965113f, 0.49086354f, 0.51207596f, 0.53328837f, 0.55450079f,
+	0.57571320f, 0.59692562f, 0.61813804f, 0.63935045f, 0.66056287f, 0.68177528f,
+	0.70298770f, 0.72420011f, 0.74541253f, 0.76662494f, 0.78783736f, 0.80904978f,
+	0.83026219f, 0.85147461f, 0.87268702f, 0.89389944f, 0.91511185f, 0.93632427f,
+	0.95753669f, 0.97874910f, 0.99996152f, 0.98080345f, 0.96157201f, 0.94234057f,
+	0.92310913f, 0.90387769f, 0.88464625f, 0.86541481f, 0.84618337f, 0.82695193f,
+	0.80772049f, 0.78848905f, 0.76925761f, 0.75002617f, 0.73079473f, 0.71156329f,
+	0.69233185f, 0.67310041f, 0.65386897f, 0.63463753f, 0.61540609f, 0.59617465f,
+	0.57694321f, 0.55771177f, 0.53848033f, 0.51924888f, 0.50001744f, 0.48078600f,
+	0.46155456f, 0.44232312f, 0.42309168f, 0.40386024f, 0.38462880f, 0.36539736f,
+	0.34616592f, 0.32693448f, 0.30770304f, 0.28847160f, 0.26924016f, 0.25000872f,
+	0.23077728f, 0.21154584f, 0.19231440f, 0.17308296f, 0.15385152f, 0.13462008f,
+	0.11538864f, 0.09615720f, 0.07692576f, 0.05769432f, 0.03846288f, 0.01923144f,
+	0.00000000f,
+};
+
+/* 48000 Hz, 50 to 8000 Hz */
+static const uint16_t mel_start_48000[MEL_BANDS] = {
+	3, 6, 10, 14, 18, 23, 28, 34, 41, 48, 56, 65,
+	74, 85, 97, 110, 124, 140, 158, 177, 198, 221, 247, 276,
+};
+static const uint8_t mel_len_48000[MEL_BANDS] = {
+	7, 8, 8, 9, 10, 11, 13, 14, 15, 17, 18, 20,
+	23, 25, 27, 30, 34, 37, 40, 44, 49, 55, 60, 66,
+};
+static const uint16_t mel_offset_48000[MEL_BANDS] = {
+	0, 7, 15, 23, 32, 42, 53, 66, 80, 95, 112, 130,
+	150, 173, 198, 225, 255, 289, 326, 366, 410, 459, 514, 574,
+};
+static const float mel_weights_48000[640] = {
+	0.26292678f, 0.56630384f, 0.86968090f, 0.84310350f, 0.56805808f, 0.29301266f,
+	0.01796724f, 0.15689650f, 0.43194192f, 0.70698734f, 0.98203276f, 0.76692972f,
+	0.51757011f, 0.26821051f, 0.01885091f, 0.23307028f, 0.48242989f, 0.73178949f,
+	0.98114909f, 0.79101795f, 0.56494542f, 0.33887290f, 0.11280038f, 0.20898205f,
+	0.43505458f, 0.66112710f, 0.88719962f, 0.89730607f, 0.69234590f, 0.48738574f,
+	0.28242558f, 0.07746541f, 0.10269393f, 0.30765410f, 0.51261426f, 0.71757442f,
+	0.92253459f, 0.88441167f, 0.69859223f, 0.51277280f, 0.32695336f, 0.14113392f,
+	0.11558833f, 0.30140777f, 0.48722720f, 0.67304664f, 0.85886608f, 0.95948756f,
+	0.79102134f, 0.62255513f, 0.45408891f, 0.28562270f, 0.11715648f, 0.04051244f,
+	0.20897866f, 0.37744487f, 0.54591109f, 0.71437730f, 0.88284352f, 0.95348196f,
+	0.80074839f, 0.64801482f, 0.49528125f, 0.34254768f, 0.18981411f, 0.03708054f,
+	0.04651804f, 0.19925161f, 0.35198518f, 0.50471875f, 0.65745232f, 0.81018589f,
+	0.96291946f, 0.89514753f, 0.75667737f, 0.61820721f, 0.47973706f, 0.34126690f,
+	0.20279675f, 0.06432659f, 0.10485247f, 0.24332263f, 0.38179279f, 0.52026294f,
+	0.65873310f, 0.79720325f, 0.93567341f, 0.93278052f, 0.80724175f, 0.68170299f,
+	0.55616422f, 0.43062545f, 0.30508668f, 0.17954792f, 0.05400915f, 0.06721948f,
+	0.19275825f, 0.31829701f, 0.44383578f, 0.56937455f, 0.69491332f, 0.82045208f,
+	0.94599085f, 0.93515036f, 0.82133535f, 0.70752034f, 0.59370533f, 0.47989032f,
+	0.36607531f, 0.25226029f, 0.13844528f, 0.02463027f, 0.06484964f, 0.17866465f,
+	0.29247966f, 0.40629467f, 0.52010968f, 0.63392469f, 0.74773971f, 0.86155472f,
+	0.97536973f, 0.91914401f, 0.81595790f, 0.71277180f, 0.60958569f, 0.50639959f,
+	0.40321348f, 0.30002737f, 0.19684127f, 0.09365516f, 0.08085599f, 0.18404210f,
+	0.28722820f, 0.39041431f, 0.49360041f, 0.59678652f, 0.69997263f, 0.80315873f,
+	0.90634484f, 0.99135913f, 0.89780932f, 0.80425951f, 0.71070970f, 0.61715990f,
+	0.52361009f, 0.43006028f, 0.33651047f, 0.24296066f, 0.14941085f, 0.05586105f,
+	0.00864087f, 0.10219068f, 0.19574049f, 0.28929030f, 0.38284010f, 0.47638991f,
+	0.56993972f, 0.66348953f, 0.75703934f, 0.85058915f, 0.94413895f, 0.96583090f,
+	0.88101748f, 0.79620406f, 0.71139063f, 0.62657721f, 0.54176379f, 0.45695037f,
+	0.37213695f, 0.28732353f, 0.20251011f, 0.11769668f, 0.03288326f, 0.03416910f,
+	0.11898252f, 0.20379594f, 0.28860937f, 0.37342279f, 0.45823621f, 0.54304963f,
+	0.62786305f, 0.71267647f, 0.79748989f, 0.88230332f, 0.96711674f, 0.95291947f,
+	0.87602657f, 0.79913366f, 0.72224076f, 0.64534786f, 0.56845495f, 0.49156205f,
+	0.41466914f, 0.33777624f, 0.26088334f, 0.18399043f, 0.10709753f, 0.03020462f,
+	0.04708053f, 0.12397343f, 0.20086634f, 0.27775924f, 0.35465214f, 0.43154505f,
+	0.50843795f, 0.58533086f, 0.66222376f, 0.73911666f, 0.81600957f, 0.89290247f,
+	0.96979538f, 0.95767182f, 0.88795976f, 0.81824770f, 0.74853563f, 0.67882357f,
+	0.60911150f, 0.53939944f, 0.46968737f, 0.39997531f, 0.33026324f, 0.26055118f,
+	0.19083912f, 0.12112705f, 0.05141499f, 0.04232818f, 0.11204024f, 0.18175230f,
+	0.25146437f, 0.32117643f, 0.39088850f, 0.46060056f, 0.53031263f, 0.60002469f,
+	0.66973676f, 0.73944882f, 0.80916088f, 0.87887295f, 0.94858501f, 0.98341164f,
+	0.92020982f, 0.85700799f, 0.79380616f, 0.73060434f, 0.66740251f, 0.60420069f,
+	0.54099886f, 0.47779704f, 0.41459521f, 0.35139338f, 0.28819156f, 0.22498973f,
+	0.16178791f, 0.09858608f, 0.03538426f, 0.01658836f, 0.07979018f, 0.14299201f,
+	0.20619384f, 0.26939566f, 0.33259749f, 0.39579931f, 0.45900114f, 0.52220296f,
+	0.58540479f, 0.64860662f, 0.71180844f, 0.77501027f, 0.83821209f, 0.90141392f,
+	0.96461574f, 0.97478025f, 0.91748068f, 0.86018112f, 0.80288156f, 0.74558200f,
+	0.68828243f, 0.63098287f, 0.57368331f, 0.51638375f, 0.45908418f, 0.40178462f,
+	0.34448506f, 0.28718550f, 0.22988594f, 0.17258637f, 0.11528681f, 0.05798725f,
+	0.00068769f, 0.02521975f, 0.08251932f, 0.13981888f, 0.19711844f, 0.25441800f,
+	0.31171757f, 0.36901713f, 0.42631669f, 0.48361625f, 0.54091582f, 0.59821538f,
+	0.65551494f, 0.71281450f, 0.77011406f, 0.82741363f, 0.88471319f, 0.94201275f,
+	0.99931231f, 0.94867497f, 0.89672647f, 0.84477797f, 0.79282948f, 0.74088098f,
+	0.68893248f, 0.63698399f, 0.58503549f, 0.53308699f, 0.48113850f, 0.42919000f,
+	0.37724150f, 0.32529301f, 0.27334451f, 0.22139601f, 0.16944752f, 0.11749902f,
+	0.06555052f, 0.01360203f, 0.05132503f, 0.10327353f, 0.15522203f, 0.20717052f,
+	0.25911902f, 0.31106752f, 0.36301601f, 0.41496451f, 0.46691301f, 0.51886150f,
+	0.57081000f, 0.62275850f, 0.67470699f, 0.72665549f, 0.77860399f, 0.83055248f,
+	0.88250098f, 0.93444948f, 0.98639797f, 0.96523461f, 0.91813746f, 0.87104030f,
+	0.82394315f, 0.77684600f, 0.72974884f, 0.68265169f, 0.63555453f, 0.58845738f,
+	0.54136023f, 0.49426307f, 0.44716592f, 0.40006876f, 0.35297161f, 0.30587445f,
+	0.25877730f, 0.21168015f, 0.16458299f, 0.11748584f, 0.07038868f, 0.02329153f,
+	0.03476539f, 0.08186254f, 0.12895970f, 0.17605685f, 0.22315400f, 0.27025116f,
+	0.31734831f, 0.36444547f, 0.41154262f, 0.45863977f, 0.50573693f, 0.55283408f,
+	0.59993124f, 0.64702839f, 0.69412555f, 0.74122270f, 0.78831985f, 0.83541701f,
+	0.88251416f, 0.92961132f, 0.97670847f, 0.97841752f, 0.93571866f, 0.89301979f,
+	0.85032093f, 0.80762206f, 0.76492319f, 0.72222433f, 0.67952546f, 0.63682659f,
+	0.59412773f, 0.55142886f, 0.50872999f, 0.46603113f, 0.42333226f, 0.38063339f,
+	0.33793453f, 0.29523566f, 0.25253680f, 0.20983793f, 0.16713906f, 0.12444020f,
+	0.08174133f, 0.03904246f, 0.02158248f, 0.06428134f, 0.10698021f, 0.14967907f,
+	0.19237794f, 0.23507681f, 0.27777567f, 0.32047454f, 0.36317341f, 0.40587227f,
+	0.44857114f, 0.49127001f, 0.53396887f, 0.57666774f, 0.61936661f, 0.66206547f,
+	0.70476434f, 0.74746320f, 0.79016207f, 0.83286094f, 0.87555980f, 0.91825867f,
+	0.96095754f, 0.99668506f, 0.95797373f, 0.91926241f, 0.88055109f, 0.84183976f,
+	0.80312844f, 0.76441711f, 0.72570579f, 0.68699447f, 0.64828314f, 0.60957182f,
+	0.57086049f, 0.53214917f, 0.49343785f, 0.45472652f, 0.41601520f, 0.37730387f,
+	0.33859255f, 0.29988123f, 0.26116990f, 0.22245858f, 0.18374725f, 0.14503593f,
+	0.10632461f, 0.06761328f, 0.02890196f, 0.00331494f, 0.04202627f, 0.08073759f,
+	0.11944891f, 0.15816024f, 0.19687156f, 0.23558289f, 0.27429421f, 0.31300553f,
+	0.35171686f, 0.39042818f, 0.42913951f, 0.46785083f, 0.50656215f, 0.54527348f,
+	0.58398480f, 0.62269613f, 0.66140745f, 0.70011877f, 0.73883010f, 0.77754142f,
+	0.81625275f, 0.85496407f, 0.89367539f, 0.93238672f, 0.97109804f, 0.99110671f,
+	0.95601054f, 0.92091437f, 0.88581820f, 0.85072203f, 0.81562586f, 0.78052969f,
+	0.74543353f, 0.71033736f, 0.67524119f, 0.64014502f, 0.60504885f, 0.56995268f,
+	0.53485651f, 0.49976035f, 0.46466418f, 0.42956801f, 0.39447184f, 0.35937567f,
+	0.32427950f, 0.28918334f, 0.25408717f, 0.21899100f, 0.18389483f, 0.14879866f,
+	0.11370249f, 0.07860632f, 0.04351016f, 0.00841399f, 0.00889329f, 0.04398946f,
+	0.07908563f, 0.11418180f, 0.14927797f, 0.18437414f, 0.21947031f, 0.25456647f,
+	0.28966264f, 0.32475881f, 0.35985498f, 0.39495115f, 0.43004732f, 0.46514349f,
+	0.50023965f, 0.53533582f, 0.57043199f, 0.60552816f, 0.64062433f, 0.67572050f,
+	0.71081666f, 0.74591283f, 0.78100900f, 0.81610517f, 0.85120134f, 0.88629751f,
+	0.92139368f, 0.95648984f, 0.99158601f, 0.97580960f, 0.94399098f, 0.91217236f,
+	0.88035373f, 0.84853511f, 0.81671649f, 0.78489786f, 0.75307924f, 0.72126061f,
+	0.68944199f, 0.65762337f, 0.62580474f, 0.59398612f, 0.56216750f, 0.53034887f,
+	0.49853025f, 0.46671163f, 0.43489300f, 0.40307438f, 0.37125576f, 0.33943713f,
+	0.30761851f, 0.27579989f, 0.24398126f, 0.21216264f, 0.18034402f, 0.14852539f,
+	0.11670677f, 0.08488815f, 0.05306952f, 0.02125090f, 0.02419040f, 0.05600902f,
+	0.08782764f, 0.11964627f, 0.15146489f, 0.18328351f, 0.21510214f, 0.24692076f,
+	0.27873939f, 0.31055801f, 0.34237663f, 0.37419526f, 0.40601388f, 0.43783250f,
+	0.46965113f, 0.50146975f, 0.53328837f, 0.56510700f, 0.59692562f, 0.62874424f,
+	0.66056287f, 0.69238149f, 0.72420011f, 0.75601874f, 0.78783736f, 0.81965598f,
+	0.85147461f, 0.88329323f, 0.91511185f, 0.94693048f, 0.97874910f, 0.99041917f,
+	0.96157201f, 0.93272485f, 0.90387769f, 0.87503053f, 0.84618337f, 0.81733621f,
+	0.78848905f, 0.75964189f, 0.73079473f, 0.70194757f, 0.67310041f, 0.64425325f,
+	0.61540609f, 0.58655893f, 0.55771177f, 0.52886460f, 0.50001744f, 0.47117028f,
+	0.44232312f, 0.41347596f, 0.38462880f, 0.35578164f, 0.32693448f, 0.29808732f,
+	0.26924016f, 0.24039300f, 0.21154584f, 0.18269868f, 0.15385152f, 0.12500436f,
+	0.09615720f, 0.06731004f, 0.03846288f, 0.00961572f,
+};
+
+#else
+#error "mel tables must be generated again, see tools/gen_mel_tables.py"
+#endif
+
+const bee_mel_table_t bee_mel_tables[MEL_TABLES] = {
+	{ 8000, mel_start_8000, mel_len_8000, mel_offset_8000, mel_weights_8000 },
+	{ 16000, mel_start_16000, mel_len_16000, mel_offset_16000, mel_weights_16000 },
+	{ 32000, mel_start_32000, mel_len_32000, mel_offset_32000, mel_weights_32000 },
+	{ 48000, mel_start_48000, mel_len_48000, mel_offset_48000, mel_weights_48000 },
+};
+
+/* orthonormal DCT-II, MFCC_COEFFS rows of MEL_BANDS */
+const float bee_mfcc_dct[MFCC_COEFFS * MEL_BANDS] = {
+	0.20412415f, 0.20412415f, 0.20412415f, 0.20412415f, 0.20412415f, 0.20412415f,
+	0.20412415f, 0.20412415f, 0.20412415f, 0.20412415f, 0.20412415f, 0.20412415f,
+	0.20412415f, 0.20412415f, 0.20412415f, 0.20412415f, 0.20412415f, 0.20412415f,
+	0.20412415f, 0.20412415f, 0.20412415f, 0.20412415f, 0.20412415f, 0.20412415f,
+	0.28805706f, 0.28312832f, 0.27335518f, 0.25890486f, 0.24002460f, 0.21703746f,
+	0.19033674f, 0.16037931f, 0.12767775f, 0.09279158f, 0.05631772f, 0.01888026f,
+	-0.01888026f, -0.05631772f, -0.09279158f, -0.12767775f, -0.16037931f, -0.19033674f,
+	-0.21703746f, -0.24002460f, -0.25890486f, -0.27335518f, -0.28312832f, -0.28805706f,
+	0.28620548f, 0.26670105f, 0.22902138f, 0.17573429f, 0.11047119f, 0.03767967f,
+	-0.03767967f, -0.11047119f, -0.17573429f, -0.22902138f, -0.26670105f, -0.28620548f,
+	-0.28620548f, -0.26670105f, -0.22902138f, -0.17573429f, -0.11047119f, -0.03767967f,
+	0.03767967f, 0.11047119f, 0.17573429f, 0.22902138f, 0.26670105f, 0.28620548f,
+	0.28312832f, 0.24002460f, 0.16037931f, 0.05631772f, -0.05631772f, -0.16037931f,
+	-0.24002460f, -0.28312832f, -0.28312832f, -0.24002460f, -0.16037931f, -0.05631772f,
+	0.05631772f, 0.16037931f, 0.24002460f, 0.28312832f, 0.28312832f, 0.24002460f,
+	0.16037931f, 0.05631772f, -0.05631772f, -0.16037931f, -0.24002460f, -0.28312832f,
+	0.27883877f, 0.20412415f, 0.07471462f, -0.07471462f, -0.20412415f, -0.27883877f,
+	-0.27883877f, -0.20412415f, -0.07471462f, 0.07471462f, 0.20412415f, 0.27883877f,
+	0.27883877f, 0.20412415f, 0.07471462f, -0.07471462f, -0.20412415f, -0.27883877f,
+	-0.27883877f, -0.20412415f, -0.07471462f, 0.07471462f, 0.20412415f, 0.27883877f,
+	0.27335518f, 0.16037931f, -0.01888026f, -0.19033674f, -0.28312832f, -0.25890486f,
+	-0.12767775f, 0.05631772f, 0.21703746f, 0.28805706f, 0.24002460f, 0.09279158f,
+	-0.09279158f, -0.24002460f, -0.28805706f, -0.21703746f, -0.05631772f, 0.12767775f,
+	0.25890486f, 0.28312832f, 0.19033674f, 0.01888026f, -0.16037931f, -0.27335518f,
+	0.26670105f, 0.11047119f, -0.11047119f, -0.26670105f, -0.26670105f, -0.11047119f,
+	0.11047119f, 0.26670105f, 0.26670105f, 0.11047119f, -0.11047119f, -0.26670105f,
+	-0.26670105f, -0.11047119f, 0.11047119f, 0.26670105f, 0.26670105f, 0.11047119f,
+	-0.11047119f, -0.26670105f, -0.26670105f, -0.11047119f, 0.11047119f, 0.26670105f,
+	0.25890486f, 0.05631772f, -0.19033674f, -0.28805706f, -0.16037931f, 0.09279158f,
+	0.27335518f, 0.24002460f, 0.01888026f, -0.21703746f, -0.28312832f, -0.12767775f,
+	0.12767775f, 0.28312832f, 0.21703746f, -0.01888026f, -0.24002460f, -0.27335518f,
+	-0.09279158f, 0.16037931f, 0.28805706f, 0.19033674f, -0.05631772f, -0.25890486f,
+	0.25000000f, 0.00000000f, -0.25000000f, -0.25000000f, -0.00000000f, 0.25000000f,
+	0.25000000f, 0.00000000f, -0.25000000f, -0.25000000f, -0.00000000f, 0.25000000f,
+	0.25000000f, 0.00000000f, -0.25000000f, -0.25000000f, 0.00000000f, 0.25000000f,
+	0.25000000f, 0.00000000f, -0.25000000f, -0.25000000f, 0.00000000f, 0.25000000f,
+	0.24002460f, -0.05631772f, -0.28312832f, -0.16037931f, 0.16037931f, 0.28312832f,
+	0.05631772f, -0.24002460f, -0.24002460f, 0.05631772f, 0.28312832f, 0.16037931f,
+	-0.16037931f, -0.28312832f, -0.05631772f, 0.24002460f, 0.24002460f, -0.05631772f,
+	-0.28312832f, -0.16037931f, 0.16037931f, 0.28312832f, 0.05631772f, -0.24002460f,
+	0.22902138f, -0.11047119f, -0.28620548f, -0.03767967f, 0.26670105f, 0.17573429f,
+	-0.17573429f, -0.26670105f, 0.03767967f, 0.28620548f, 0.11047119f, -0.22902138f,
+	-0.22902138f, 0.11047119f, 0.28620548f, 0.03767967f, -0.26670105f, -0.17573429f,
+	0.17573429f, 0.26670105f, -0.03767967f, -0.28620548f, -0.11047119f, 0.22902138f,
+	0.21703746f, -0.16037931f, -0.25890486f, 0.09279158f, 0.28312832f, -0.01888026f,
+	-0.28805706f, -0.05631772f, 0.27335518f, 0.12767775f, -0.24002460f, -0.19033674f,
+	0.19033674f, 0.24002460f, -0.12767775f, -0.27335518f, 0.05631772f, 0.28805706f,
+	0.01888026f, -0.28312832f, -0.09279158f, 0.25890486f, 0.16037931f, -0.21703746f,
+	0.20412415f, -0.20412415f, -0.20412415f, 0.20412415f, 0.20412415f, -0.20412415f,
+	-0.20412415f, 0.20412415f, 0.20412415f, -0.20412415f, -0.20412415f, 0.20412415f,
+	0.20412415f, -0.20412415f, -0.20412415f, 0.20412415f, 0.20412415f, -0.20412415f,
+	-0.20412415f, 0.20412415f, 0.20412415f, -0.20412415f, -0.20412415f, 0.20412415f,
+};
@@ -0,0 +1,159 @@
+/*
+ *  @file bee_noise.c
+ *  @brief per bin noise floor by minimum statistics over the reported
+ *  spectra, and the spectral subtraction of that floor
+ */
+
+#include "lilbee.h"
+
+
+/** internal functions */
+
+/**
+ * 	@fn noise_floor_bin()
+ *  @brief smallest power of a bin over the running and past sub windows
+ *
+ *  @param
+ *  @return
+ */
+static inline float noise_floor_bin(const bee_noise_t *n, uint32_t bin)
+{
+	float floor = n->running[bin];
+	uint32_t windows = (n->windows < NOISE_SUBWINDOWS) ? n->windows : NOISE_SUBWINDOWS;
+
+	for(uint32_t s = 0; s < windows; s++) {
+		if(n->past[s][bin] < floor)
+			floor = n->past[s][bin];
+	}
+
+	return(floor);
+}
+
+/**
+ * 	@fn noise_floor_tonal()
+ *  @brief floor of the bin in the middle of the ring, held under the
+ *  lowest floor around it so a steady tone keeps standing over the floor,
+ *  the ring holds the floors of the bins first up to last
+ *
+ *  @param
+ *  @return
+ */
+static inline float noise_floor_tonal(const float *ring, uint32_t bin, uint32_t first,
+		uint32_t last)
+{
+	float low = ring[first % NOISE_TONAL_SPAN];
+
+	for(uint32_t i = first + 1; i <= last; i++) {
+		if(ring[i % NOISE_TONAL_SPAN] < low)
+			low = ring[i % NOISE_TONAL_SPAN];
+	}
+
+	low *= NOISE_TONAL_RATIO;
+	return((ring[bin % NOISE_TONAL_SPAN] < low) ? ring[bin % NOISE_TONAL_SPAN] : low);
+}
+
+/** public functions */
+
+bee_retcode_t bee_noise_check(const bee_noise_cfg_t *cfg)
+{
+	if(cfg == NULL || cfg->mode >= k_noise_max_modes || cfg->reports == 0 ||
+			cfg->bias < 1.0f || cfg->over < 0.0f || cfg->floor < 0.0f || cfg->floor > 1.0f)
+		return(k_bee_ret_invalid_param);
+
+	return(k_bee_ret_ok);
+}
+
+void bee_noise_reset(bee_noise_t *n)
+{
+	if(n == NULL)
+		return;
+
+	n->sub = 0;
+	n->count = 0;
+	n->windows = 0;
+}
+
+void bee_noise_update(bee_noise_t *n, const bee_noise_cfg_t *cfg, float *power,
+		bee_noise_report_t *report)
+{
+	float ring[NOISE_TONAL_SPAN];
+	bool subtract;
+	float total = 0.0f;
+	float noise = 0.0f;
+	float floor;
+	float p;
+	uint32_t c;
+
+	if(n == NULL || cfg == NULL || power == NULL || cfg->mode == k_noise_off)
+		return;
+
+	/* the first sub window only gives a floor for the next ones */
+	subtract = (cfg->mode == k_noise_subtract && n->windows != 0);
+
+	/* a bin is done once the floors of the bins around it are known */
+	for(uint32_t b = 0; b < DSP_SPECTRAL_BINS + NOISE_TONAL_BINS; b++) {
+		if(b < DSP_SPECTRAL_BINS) {
+			if(n->count == 0 || power[b] < n->running[b])
+				n->running[b] = power[b];
+
+			ring[b % NOISE_TONAL_SPAN] = cfg->bias * noise_floor_bin(n, b);
+		}
+
+		if(b < NOISE_TONAL_BINS)
+			continue;
+
+		c = b - NOISE_TONAL_BINS;
+		floor = noise_floor_tonal(ring, c, (c > NOISE_TONAL_BINS) ? c - NOISE_TONAL_BINS : 0,
+				(b < DSP_SPECTRAL_BINS) ? b : DSP_SPECTRAL_BINS - 1);
+
+		/* a bin holds no more noise than power */
+		p = power[c];
+		total += p;
+		noise += (floor < p) ? floor : p;
+
+		if(subtract) {
+			p -= cfg->over * floor;
+			power[c] = (p > cfg->floor * power[c]) ? p : cfg->floor * power[c];
+		}
+	}
+
+	/* the running minimum becomes the oldest past one */
+	if(++n->count >= cfg->reports) {
+		memcpy(n->past[n->sub], n->running, sizeof(n->running));
+		n->sub = (n->sub + 1) % NOISE_SUBWINDOWS;
+		n->count = 0;
+		if(n->windows < NOISE_SUBWINDOWS)
+			n->windows++;
+	}
+
+	if(report) {
+		report->ready = (n->windows != 0);
+		report->power = total;
+		report->noise = noise;
+		report->snr_db = 10.0f * log10f((total + NOISE_POWER_FLOOR) /
+				(report->noise + NOISE_POWER_FLOOR));
+	}
+}
+
+bool bee_noise_get_floor(const bee_noise_t *n, const bee_noise_cfg_t *cfg, float *floor)
+{
+	float ring[NOISE_TONAL_SPAN];
+	uint32_t c;
+
+	if(n == NULL || cfg == NULL || floor == NULL || n->windows == 0)
+		return(false);
+
+	for(uint32_t b = 0; b < DSP_SPECTRAL_BINS + NOISE_TONAL_BINS; b++) {
+		if(b < DSP_SPECTRAL_BINS)
+			ring[b % NOISE_TONAL_SPAN] = cfg->bias * noise_floor_bin(n, b);
+
+		if(b < NOISE_TONAL_BINS)
+			continue;
+
+		c = b - NOISE_TONAL_BINS;
+		floor[c] = noise_floor_tonal(ring, c, (c > NOISE_TONAL_BINS) ? c - NOISE_TONAL_BINS : 0,
+				(b < DSP_SPECTRAL_BINS) ? b : DSP_SPECTRAL_BINS - 1);
+	}
+
+	return(true);
+}
@@ -0,0 +1,112 @@
+/*
+ *  @file bee_noise.h
+ *  @brief per bin noise floor by minimum statistics over the reported
+ *  spectra, and the spectral subtraction of that floor
+ */
+
+#ifndef __BEE_NOISE_H
+#define __BEE_NOISE_H
+
+/* the minimum is searched over NOISE_SUBWINDOWS sub windows of reports,
+ * the window slides one sub window at a time
+ */
+#define NOISE_SUBWINDOWS		4
+
+/* a steady tone is learnt by the minima as well, the floor of a bin is
+ * held to NOISE_TONAL_RATIO times the lowest floor NOISE_TONAL_BINS around
+ * it so the hum of the colony is not taken for noise
+ */
+#define NOISE_TONAL_BINS		4
+#define NOISE_TONAL_SPAN		(2 * NOISE_TONAL_BINS + 1)
+#define NOISE_TONAL_RATIO		2.0f
+
+/* defaults, 4 x 16 reports, a minute at 1 s reports, see tools/noise_bench -c */
+#define NOISE_DEFAULT_MODE		k_noise_subtract
+#define NOISE_DEFAULT_REPORTS	16
+#define NOISE_DEFAULT_BIAS		1.5f
+#define NOISE_DEFAULT_OVER		1.0f
+#define NOISE_DEFAULT_FLOOR		0.05f
+
+/* smallest power taken by the SNR, keeps silent reports finite */
+#define NOISE_POWER_FLOOR		1e-12f
+
+/** noise handling */
+typedef enum {
+	k_noise_off = 0,
+	k_noise_track,
+	k_noise_subtract,
+	k_noise_max_modes,
+}noise_mode_t;
+
+/** tracker setup, a sub window lasts reports reports, the minimum times
+ * bias is the floor, tones excepted, subtraction removes over times the
+ * floor and keeps at least floor times the bin power
+ */
+typedef struct bee_noise_cfg {
+	noise_mode_t mode;
+	uint32_t reports;
+	float bias;
+	float over;
+	float floor;
+}bee_noise_cfg_t;
+
+/** tracker state of one audio stream, minima of the past sub windows
+ * and of the running one
+ */
+typedef struct bee_noise {
+	float past[NOISE_SUBWINDOWS][DSP_SPECTRAL_BINS];
+	float running[DSP_SPECTRAL_BINS];
+	uint32_t sub;
+	uint32_t count;
+	uint32_t windows;
+}bee_noise_t;
+
+/** broadband figures of the last report, powers summed over the bins */
+typedef struct bee_noise_report {
+	bool ready;
+	float power;
+	float noise;
+	float snr_db;
+}bee_noise_report_t;
+
+
+/**
+ * 	@fn bee_noise_check()
+ *  @brief validates a tracker setup
+ *
+ *  @param
+ *  @return
+ */
+bee_retcode_t bee_noise_check(const bee_noise_cfg_t *cfg);
+
+/**
+ * 	@fn bee_noise_reset()
+ *  @brief forgets the floor, a new one is ready after a sub window
+ *
+ *  @param
+ *  @return
+ */
+void bee_noise_reset(bee_noise_t *n);
+
+/**
+ * 	@fn bee_noise_update()
+ *  @brief adds the power of a report to the minima then, in subtract
+ *         mode and once a floor is ready, subtracts it in place
+ *
+ *  @param power - DSP_SPECTRAL_BINS bin powers
+ *  @param report - may be NULL
+ *  @return
+ */
+void bee_noise_update(bee_noise_t *n, const bee_noise_cfg_t *cfg, float *power,
+		bee_noise_report_t *report);
+
+/**
+ * 	@fn bee_noise_get_floor()
+ *  @brief writes the floor of each bin, on the scale of the bin powers
+ *
+ *  @param
+ *  @return false when no floor is ready yet
+ */
+bool bee_noise_get_floor(const bee_noise_t *n, const bee_noise_cfg_t *cfg, float *floor);
+
+#endif
@@ -0,0 +1,293 @@
+/*
+ *  @file bee_pitch.c
+ *  @brief wing beat fundamental tracker, YIN on a decimated stream with
+ *  the autocorrelation taken through the complex FFT of the zoom
+ */
+
+#include "lilbee.h"
+
+
+/** internal variables */
+
+/* correlation scratch shared by every stream, the difference of lag n
+ * ends on its real slot and the cumulative mean normalized one on its
+ * imaginary slot
+ */
+static float pitch_work[2 * PITCH_FFT_POINTS];
+
+/** internal functions */
+
+/**
+ * 	@fn pitch_design()
+ *  @brief hamming windowed sinc low-pass cut at half the decimated rate,
+ *  unity gain at DC
+ *
+ *  @param
+ *  @return
+ */
+static void pitch_design(bee_pitch_plan_t *plan)
+{
+	float fc = 0.5f / (float)plan->decimation;
+	float mid = 0.5f * (float)(plan->taps - 1);
+	float sum = 0.0f;
+	float t;
+
+	for(uint32_t n = 0; n < plan->taps; n++) {
+		t = (float)n - mid;
+		plan->coeff[n] = (t == 0.0f) ? 2.0f * fc : sinf(2.0f * PI * fc * t) / (PI * t);
+		plan->coeff[n] *= 0.54f - 0.46f * cosf(2.0f * PI * (float)n / (float)(plan->taps - 1));
+		sum += plan->coeff[n];
+	}
+
+	arm_scale_f32(plan->coeff, 1.0f / sum, plan->coeff, plan->taps);
+}
+
+/**
+ * 	@fn pitch_difference()
+ *  @brief cumulative mean normalized difference of the frame up to
+ *  max_lag + 1, the difference of each lag comes from the correlation and
+ *  the energy of the two ends of the frame it leaves out
+ *
+ *  @param
+ *  @return
+ */
+static void pitch_difference(const float *x, float energy, uint32_t max_lag)
+{
+	const arm_cfft_instance_f32 *cfft = bee_fft_get_complex(PITCH_FFT_POINTS);
+	float *w = pitch_work;
+	float head = energy;
+	float tail = energy;
+	float sum = 0.0f;
+	float d;
+
+	/* zero padded so the lags do not wrap around */
+	memset(w, 0, sizeof(pitch_work));
+	for(uint32_t n = 0; n < PITCH_FRAME_LEN; n++)
+		w[2 * n] = x[n];
+
+	arm_cfft_f32(cfft, w, 0, 1);
+	for(uint32_t k = 0; k < PITCH_FFT_POINTS; k++) {
+		w[2 * k] = w[2 * k] * w[2 * k] + w[2 * k + 1] * w[2 * k + 1];
+		w[2 * k + 1] = 0.0f;
+	}
+	arm_cfft_f32(cfft, w, 1, 1);
+
+	/* d(lag) = sum (x[j] - x[j + lag])^2 over the overlap */
+	w[1] = 1.0f;
+	for(uint32_t lag = 1; lag <= max_lag + 1; lag++) {
+		head -= x[PITCH_FRAME_LEN - lag] * x[PITCH_FRAME_LEN - lag];
+		tail -= x[lag - 1] * x[lag - 1];
+
+		d = head + tail - 2.0f * w[2 * lag];
+		if(d < 0.0f)
+			d = 0.0f;
+
+		sum += d;
+		w[2 * lag] = d;
+		w[2 * lag + 1] = (sum > 0.0f) ? d * (float)lag / sum : 1.0f;
+	}
+}
+
+/**
+ * 	@fn pitch_pick()
+ *  @brief first lag dipping under the threshold, followed down to its
+ *  minimum, or the deepest lag when none does
+ *
+ *  @param
+ *  @return
+ */
+static uint32_t pitch_pick(const bee_pitch_plan_t *plan)
+{
+	const float *w = pitch_work;
+	uint32_t pick = plan->min_lag;
+
+	for(uint32_t lag = plan->min_lag; lag <= plan->max_lag; lag++) {
+		if(w[2 * lag + 1] < plan->threshold) {
+			while(lag < plan->max_lag && w[2 * lag + 3] < w[2 * lag + 1])
+				lag++;
+
+			return(lag);
+		}
+
+		if(w[2 * lag + 1] < w[2 * pick + 1])
+			pick = lag;
+	}
+
+	return(pick);
+}
+
+/** public functions */
+
+bee_retcode_t bee_pitch_plan(bee_pitch_plan_t *plan, uint32_t min_hz, uint32_t max_hz,
+		float threshold, uint32_t sample_rate)
+{
+	uint32_t decimation;
+	float rate;
+
+	if(plan == NULL || min_hz == 0 || max_hz <= min_hz || sample_rate == 0 ||
+			threshold <= 0.0f || threshold >= 1.0f)
+		return(k_bee_ret_invalid_param);
+
+	/* the highest rate whose longest lag fits the frame */
+	decimation = (sample_rate + min_hz * PITCH_MAX_LAG - 1) / (min_hz * PITCH_MAX_LAG);
+	if(decimation == 0)
+		decimation = 1;
+	if(decimation > PITCH_MAX_DECIMATION)
+		return(k_bee_ret_invalid_param);
+
+	rate = (float)sample_rate / (float)decimation;
+	if((float)max_hz > PITCH_MAX_RATIO * rate)
+		return(k_bee_ret_invalid_param);
+
+	plan->decimation = decimation;
+	plan->taps = PITCH_TAPS_PER_DECIMATION * decimation + 1;
+	plan->rate_hz = rate;
+	plan->threshold = threshold;
+	plan->min_lag = (uint32_t)(rate / (float)max_hz);
+	plan->max_lag = (uint32_t)ceilf(rate / (float)min_hz);
+
+	/* the interpolation looks one lag either side */
+	if(plan->min_lag < 2)
+		plan->min_lag = 2;
+	if(plan->max_lag > PITCH_MAX_LAG)
+		plan->max_lag = PITCH_MAX_LAG;
+
+	pitch_design(plan);
+	return(k_bee_ret_ok);
+}
+
+void bee_pitch_reset(bee_pitch_t *p, const bee_pitch_plan_t *plan)
+{
+	if(p == NULL || plan == NULL)
+		return;
+
+	p->pending = 0;
+	p->count = 0;
+	p->f0_sum = 0.0f;
+	p->weight_sum = 0.0f;
+	p->confidence_sum = 0.0f;
+	p->frames = 0;
+	p->periodic = 0;
+	memset(&p->last, 0, sizeof(p->last));
+	if(plan->decimation == 0)
+		return;
+
+	arm_fir_decimate_init_f32(&p->fir, plan->taps, plan->decimation,
+			(float *)plan->coeff, p->state, plan->decimation);
+}
+
+void bee_pitch_restart(bee_pitch_t *p, const bee_pitch_plan_t *plan)
+{
+	if(p == NULL || plan == NULL)
+		return;
+
+	p->pending = 0;
+	p->count = 0;
+	if(plan->decimation == 0)
+		return;
+
+	arm_fir_decimate_init_f32(&p->fir, plan->taps, plan->decimation,
+			(float *)plan->coeff, p->state, plan->decimation);
+}
+
+uint32_t bee_pitch_feed(bee_pitch_t *p, const bee_pitch_plan_t *plan,
+		const int16_t *samples, uint32_t n)
+{
+	uint32_t used = 0;
+
+	if(p == NULL || plan == NULL || samples == NULL || plan->decimation == 0)
+		return(0);
+
+	while(used < n && p->count < PITCH_FRAME_LEN) {
+		/* normalized as the wideband samples */
+		p->block[p->pending] = (float)samples[used++] * (1.0f / 32768.0f);
+
+		if(++p->pending == plan->decimation) {
+			arm_fir_decimate_f32(&p->fir, p->block, &p->frame[p->count], plan->decimation);
+			p->pending = 0;
+			p->count++;
+		}
+	}
+
+	return(used);
+}
+
+bool bee_pitch_frame_ready(const bee_pitch_t *p)
+{
+	return(p != NULL && p->count == PITCH_FRAME_LEN);
+}
+
+void bee_pitch_estimate(bee_pitch_t *p, const bee_pitch_plan_t *plan, bee_pitch_frame_t *out)
+{
+	const float *w = pitch_work;
+	bee_pitch_frame_t est = { 0.0f, 0.0f, false };
+	float energy;
+	float prev;
+	float next;
+	float den;
+	float shift = 0.0f;
+	uint32_t lag;
+
+	if(p == NULL || plan == NULL || p->count != PITCH_FRAME_LEN)
+		return;
+
+	p->count = 0;
+	arm_dot_prod_f32(p->frame, p->frame, PITCH_FRAME_LEN, &energy);
+
+	/* silence has no period, it still counts against the confidence */
+	if(energy >= PITCH_MIN_ENERGY * (float)PITCH_FRAME_LEN) {
+		pitch_difference(p->frame, energy, plan->max_lag);
+		lag = pitch_pick(plan);
+
+		/* parabola through the raw differences around the picked lag, the
+		 * normalized ones are skewed on the short lags
+		 */
+		prev = w[2 * lag - 2];
+		next = w[2 * lag + 2];
+		den = prev - 2.0f * w[2 * lag] + next;
+		if(den > 0.0f)
+			shift = 0.5f * (prev - next) / den;
+		if(shift > 0.5f)
+			shift = 0.5f;
+		if(shift < -0.5f)
+			shift = -0.5f;
+
+		est.confidence = 1.0f - w[2 * lag + 1];
+		if(est.confidence < 0.0f)
+			est.confidence = 0.0f;
+		est.periodic = (w[2 * lag + 1] < plan->threshold);
+		est.f0_hz = plan->rate_hz / ((float)lag + shift);
+	}
+
+	p->frames++;
+	p->confidence_sum += est.confidence;
+	if(est.periodic) {
+		p->periodic++;
+		p->f0_sum += est.f0_hz * est.confidence;
+		p->weight_sum += est.confidence;
+	}
+
+	p->last = est;
+	if(out)
+		*out = est;
+}
+
+bool bee_pitch_publish(bee_pitch_t *p, bee_pitch_result_t *result)
+{
+	if(p == NULL || result == NULL || p->frames == 0)
+		return(false);
+
+	result->f0_hz = (p->weight_sum > 0.0f) ? p->f0_sum / p->weight_sum : 0.0f;
+	result->confidence = p->confidence_sum / (float)p->frames;
+	result->frames = p->frames;
+	result->periodic = p->periodic;
+	result->last = p->last;
+
+	p->f0_sum = 0.0f;
+	p->weight_sum = 0.0f;
+	p->confidence_sum = 0.0f;
+	p->frames = 0;
+	p->periodic = 0;
+
+	return(true);
+}
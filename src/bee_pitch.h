@@ -0,0 +1,161 @@
+/*
+ *  @file bee_pitch.h
+ *  @brief wing beat fundamental tracker, YIN on a decimated stream with
+ *  the autocorrelation taken through the complex FFT of the zoom
+ */
+
+#ifndef __BEE_PITCH_H
+#define __BEE_PITCH_H
+
+/* complex FFT points of the correlation, the real frame is zero padded to
+ * twice its length so the circular correlation comes out linear
+ */
+#define PITCH_FFT_POINTS		(FFT_POINTS / 2)
+#define PITCH_FRAME_LEN			(PITCH_FFT_POINTS / 2)
+
+/* lags are searched up to half the frame, so the difference of the
+ * longest lag still sums half a frame
+ */
+#define PITCH_MAX_LAG			(PITCH_FRAME_LEN / 2)
+
+/* decimation limits, the lowest fundamental sets the decimated rate */
+#define PITCH_MAX_DECIMATION	16
+
+/* hamming windowed sinc taps per unit of decimation */
+#define PITCH_TAPS_PER_DECIMATION	8
+#define PITCH_MAX_TAPS			(PITCH_TAPS_PER_DECIMATION * PITCH_MAX_DECIMATION + 1)
+
+/* highest fundamental over the decimated rate, keeps it clear of the
+ * decimation filter edge
+ */
+#define PITCH_MAX_RATIO			0.4f
+
+/* defaults, flight tone and fanning up to the higher piping harmonics */
+#define PITCH_DEFAULT_MIN_HZ	100
+#define PITCH_DEFAULT_MAX_HZ	1000
+#define PITCH_DEFAULT_THRESHOLD	0.2f
+
+/* frames quieter than this energy per sample give no estimate, -80 dBFS */
+#define PITCH_MIN_ENERGY		1e-8f
+
+/** tracker setup, a frame is periodic when its normalized difference
+ * dips under threshold, taps are shared by every stream using it
+ */
+typedef struct bee_pitch_plan {
+	uint32_t decimation;
+	uint32_t taps;
+	uint32_t min_lag;
+	uint32_t max_lag;
+	float rate_hz;
+	float threshold;
+	float coeff[PITCH_MAX_TAPS];
+}bee_pitch_plan_t;
+
+/** estimate of one frame, confidence is 1 minus the normalized
+ * difference at the chosen lag
+ */
+typedef struct bee_pitch_frame {
+	float f0_hz;
+	float confidence;
+	bool periodic;
+}bee_pitch_frame_t;
+
+/** estimates of a report, f0 is the confidence weighted mean of the
+ * periodic frames and confidence the mean over every frame
+ */
+typedef struct bee_pitch_result {
+	float f0_hz;
+	float confidence;
+	uint32_t frames;
+	uint32_t periodic;
+	bool stale;
+	bee_pitch_frame_t last;
+}bee_pitch_result_t;
+
+/** tracker state of one audio stream, frames do not overlap */
+typedef struct bee_pitch {
+	arm_fir_decimate_instance_f32 fir;
+	float state[PITCH_MAX_TAPS + PITCH_MAX_DECIMATION - 1];
+	float block[PITCH_MAX_DECIMATION];
+	uint32_t pending;
+	uint32_t count;
+	float frame[PITCH_FRAME_LEN];
+	bee_pitch_frame_t last;
+	float f0_sum;
+	float weight_sum;
+	float confidence_sum;
+	uint32_t frames;
+	uint32_t periodic;
+}bee_pitch_t;
+
+
+/**
+ * 	@fn bee_pitch_plan()
+ *  @brief picks the decimation that fits the lowest fundamental on the
+ *         frame and designs its filter
+ *
+ *  @param
+ *  @return
+ */
+bee_retcode_t bee_pitch_plan(bee_pitch_plan_t *plan, uint32_t min_hz, uint32_t max_hz,
+		float threshold, uint32_t sample_rate);
+
+/**
+ * 	@fn bee_pitch_reset()
+ *  @brief restarts a stream on a plan, the filter history and the report
+ *         are cleared
+ *
+ *  @param
+ *  @return
+ */
+void bee_pitch_reset(bee_pitch_t *p, const bee_pitch_plan_t *plan);
+
+/**
+ * 	@fn bee_pitch_restart()
+ *  @brief discards the partial frame and the filter history of a stream
+ *         that is no longer contiguous, the estimates of the report are kept
+ *
+ *  @param
+ *  @return
+ */
+void bee_pitch_restart(bee_pitch_t *p, const bee_pitch_plan_t *plan);
+
+/**
+ * 	@fn bee_pitch_feed()
+ *  @brief decimates samples until a frame is complete
+ *
+ *  @param
+ *  @return number of samples consumed
+ */
+uint32_t bee_pitch_feed(bee_pitch_t *p, const bee_pitch_plan_t *plan,
+		const int16_t *samples, uint32_t n);
+
+/**
+ * 	@fn bee_pitch_frame_ready()
+ *  @brief checks if a frame of decimated samples is complete
+ *
+ *  @param
+ *  @return
+ */
+bool bee_pitch_frame_ready(const bee_pitch_t *p);
+
+/**
+ * 	@fn bee_pitch_estimate()
+ *  @brief estimates the fundamental of the complete frame and adds it to
+ *         the report
+ *
+ *  @param out - may be NULL
+ *  @return
+ */
+void bee_pitch_estimate(bee_pitch_t *p, const bee_pitch_plan_t *plan, bee_pitch_frame_t *out);
+
+/**
+ * 	@fn bee_pitch_publish()
+ *  @brief writes the estimates of the report and starts a new one
+ *
+ *  @param
+ *  @return false when no frame was estimated since the last report
+ */
+bool bee_pitch_publish(bee_pitch_t *p, bee_pitch_result_t *result);
+
+#endif
@@ -0,0 +1,98 @@
+/*
+ *  @file bee_psd.c
+ *  @brief welch power spectral density accumulator, averages the power
+ *  of the STFT frames and publishes at a reporting interval
+ */
+
+#include "lilbee.h"
+
+
+/** internal variables */
+static bee_psd_cfg_t config = {
+	.mode = PSD_DEFAULT_MODE,
+	.frames = PSD_DEFAULT_FRAMES,
+	.report_ms = PSD_DEFAULT_REPORT_MS,
+};
+
+
+/** public functions */
+
+bee_retcode_t bee_psd_config(const bee_psd_cfg_t *cfg)
+{
+	if(cfg == NULL || cfg->mode >= k_psd_max_modes || cfg->frames == 0 ||
+			cfg->report_ms == 0)
+		return(k_bee_ret_invalid_param);
+
+	config = *cfg;
+	return(k_bee_ret_ok);
+}
+
+void bee_psd_get_config(bee_psd_cfg_t *cfg)
+{
+	if(cfg)
+		*cfg = config;
+}
+
+void bee_psd_reset(bee_psd_t *psd)
+{
+	if(psd == NULL)
+		return;
+
+	arm_fill_f32(0.0f, psd->power, DSP_SPECTRAL_BINS);
+	psd->frames = 0;
+	psd->fresh = false;
+}
+
+void bee_psd_accumulate(bee_psd_t *psd, const float *power)
+{
+	float alpha;
+
+	if(psd == NULL || power == NULL)
+		return;
+
+	if(psd->mode != config.mode) {
+		bee_psd_reset(psd);
+		psd->mode = config.mode;
+	}
+
+	if(config.mode == k_psd_exponential && psd->frames != 0) {
+		/* p += alpha * (new - p), the first frame seeds the average */
+		alpha = 1.0f / (float)config.frames;
+		for(uint32_t i = 0; i < DSP_SPECTRAL_BINS; i++) {
+			psd->power[i] += alpha * (power[i] - psd->power[i]);
+		}
+		psd->frames = 1;
+	} else if(config.mode == k_psd_exponential) {
+		arm_copy_f32((float *)power, psd->power, DSP_SPECTRAL_BINS);
+		psd->frames = 1;
+	} else {
+		arm_add_f32(psd->power, (float *)power, psd->power, DSP_SPECTRAL_BINS);
+		psd->frames++;
+	}
+
+	psd->fresh = true;
+}
+
+bool bee_psd_publish(bee_psd_t *psd, float *power)
+{
+	if(psd == NULL || power == NULL || !psd->fresh)
+		return(false);
+
+	/* block sums are turned into the mean, the exponential average
+	 * already is one
+	 */
+	arm_scale_f32(psd->power, 1.0f / (float)psd->frames, power, DSP_SPECTRAL_BINS);
+
+	if(config.mode == k_psd_block) {
+		arm_fill_f32(0.0f, psd->power, DSP_SPECTRAL_BINS);
+		psd->frames = 0;
+	}
+
+	psd->fresh = false;
+	return(true);
+}
+
+uint32_t bee_psd_report_samples(uint32_t sample_rate)
+{
+	return((uint32_t)(((uint64_t)config.report_ms * sample_rate) / 1000));
+}
@@ -0,0 +1,97 @@
+/*
+ *  @file bee_psd.h
+ *  @brief welch power spectral density accumulator, averages the power
+ *  of the STFT frames and publishes at a reporting interval
+ */
+
+#ifndef __BEE_PSD_H
+#define __BEE_PSD_H
+
+/* default averaging, block mean of the frames of each 1 s report */
+#define PSD_DEFAULT_MODE		k_psd_block
+#define PSD_DEFAULT_FRAMES		8
+#define PSD_DEFAULT_REPORT_MS	1000
+
+/** averaging modes */
+typedef enum {
+	k_psd_block = 0,
+	k_psd_exponential,
+	k_psd_max_modes,
+}psd_mode_t;
+
+/** averaging setup, block mode averages every frame of a report, the
+ * exponential one weights each new frame by 1 / frames and keeps its
+ * memory across reports
+ */
+typedef struct bee_psd_cfg {
+	psd_mode_t mode;
+	uint32_t frames;
+	uint32_t report_ms;
+}bee_psd_cfg_t;
+
+/** averaging state of one audio stream */
+typedef struct bee_psd {
+	float power[DSP_SPECTRAL_BINS];
+	uint32_t frames;
+	psd_mode_t mode;
+	bool fresh;
+}bee_psd_t;
+
+
+/**
+ * 	@fn bee_psd_config()
+ *  @brief changes the averaging shared by all streams, a stream restarts
+ *         its average at its next frame if the mode changed
+ *
+ *  @param
+ *  @return
+ */
+bee_retcode_t bee_psd_config(const bee_psd_cfg_t *cfg);
+
+/**
+ * 	@fn bee_psd_get_config()
+ *  @brief gets the averaging in use
+ *
+ *  @param
+ *  @return
+ */
+void bee_psd_get_config(bee_psd_cfg_t *cfg);
+
+/**
+ * 	@fn bee_psd_reset()
+ *  @brief discards the power averaged by a stream
+ *
+ *  @param
+ *  @return
+ */
+void bee_psd_reset(bee_psd_t *psd);
+
+/**
+ * 	@fn bee_psd_accumulate()
+ *  @brief adds the power spectrum of a frame to the average
+ *
+ *  @param
+ *  @return
+ */
+void bee_psd_accumulate(bee_psd_t *psd, const float *power);
+
+/**
+ * 	@fn bee_psd_publish()
+ *  @brief writes the averaged power of each bin, on the scale of a single
+ *         frame power spectrum, and starts a new report
+ *
+ *  @param
+ *  @return false when no frame was averaged since the last report
+ */
+bool bee_psd_publish(bee_psd_t *psd, float *power);
+
+/**
+ * 	@fn bee_psd_report_samples()
+ *  @brief gets the reporting interval in samples
+ *
+ *  @param
+ *  @return
+ */
+uint32_t bee_psd_report_samples(uint32_t sample_rate);
+
+#endif
@@ -0,0 +1,192 @@
+/*
+ *  @file bee_spectrogram.c
+ *  @brief spectrogram history of the first mic, the last reported spectra
+ *  kept as 8 bit log levels on a ring that can be read back while the
+ *  acquisition runs
+ */
+
+#include "lilbee.h"
+
+
+/** internal variables */
+#if SPECTROGRAM_IN_RAM2
+static bee_spectrogram_row_t ring[SPECTROGRAM_ROWS] BEE_RAM2_BSS;
+#else
+static bee_spectrogram_row_t ring[SPECTROGRAM_ROWS];
+#endif
+static bee_spectra_t spectra;
+static uint32_t next_row = 0;
+static uint32_t every = SPECTROGRAM_DEFAULT_EVERY;
+static uint32_t skipped = 0;
+
+/** internal functions */
+
+/**
+ * 	@fn spectrogram_level()
+ *  @brief quantizes a level in 0.01 dB to a row code, saturated
+ *
+ *  @param
+ *  @return
+ */
+static uint8_t spectrogram_level(float cdb)
+{
+	float code = (cdb - (float)SPECTROGRAM_FLOOR_CDB) / (float)SPECTROGRAM_STEP_CDB + 0.5f;
+
+	if(code <= 0.0f)
+		return(0);
+	if(code >= 255.0f)
+		return(255);
+
+	return((uint8_t)code);
+}
+
+/**
+ * 	@fn spectrogram_quantize()
+ *  @brief reduces the bins of a spectrum to the row columns, each column
+ *  takes its loudest bin so narrow tones survive the merge
+ *
+ *  @param
+ *  @return
+ */
+static void spectrogram_quantize(const bee_spectra_t *s, uint8_t *level)
+{
+	const uint32_t merge = 1UL << SPECTROGRAM_BIN_SHIFT;
+
+	for(uint32_t c = 0; c < SPECTROGRAM_COLS; c++) {
+#if DSP_LOG_SPECTRUM
+		const int16_t *cdb = &s->level_cdb[c * merge];
+		int16_t top = cdb[0];
+
+		for(uint32_t i = 1; i < merge; i++) {
+			if(cdb[i] > top)
+				top = cdb[i];
+		}
+
+		level[c] = spectrogram_level((float)top);
+#else
+		const float *mag = &s->raw[c * merge];
+		float top = mag[0];
+
+		for(uint32_t i = 1; i < merge; i++) {
+			if(mag[i] > top)
+				top = mag[i];
+		}
+
+		/* magnitudes, the power is the square */
+		top *= top;
+		if(top < DSP_LOG_FLOOR)
+			top = DSP_LOG_FLOOR;
+
+		level[c] = spectrogram_level(bee_log2f_fast(top) * FASTLOG_CDB_PER_LOG2);
+#endif
+	}
+}
+
+/**
+ * 	@fn on_spectrogram_report()
+ *  @brief keeps the wideband spectrum of the first mic after each report
+ *
+ *  @param
+ *  @return
+ */
+static void on_spectrogram_report(void)
+{
+	/* zoom and tone bank spectra do not share the row columns */
+	if(bee_dsp_get_mode() != k_dsp_mode_spectrum)
+		return;
+
+	if(++skipped < every)
+		return;
+
+	/* a gated report keeps the previous spectrum, nothing new to keep */
+	if(bee_dsp_get_spectra(0, &spectra) != k_bee_ret_ok || spectra.stale)
+		return;
+
+	skipped = 0;
+	bee_spectrogram_push(&spectra);
+}
+
+/** public functions */
+
+void bee_spectrogram_init(void)
+{
+	next_row = 0;
+	skipped = 0;
+	every = SPECTROGRAM_DEFAULT_EVERY;
+}
+
+bee_retcode_t bee_spectrogram_config(const bee_spectrogram_cfg_t *cfg)
+{
+	if(cfg == NULL || cfg->every == 0)
+		return(k_bee_ret_invalid_param);
+
+	every = cfg->every;
+	skipped = 0;
+	return(k_bee_ret_ok);
+}
+
+bee_retcode_t bee_spectrogram_push(const bee_spectra_t *s)
+{
+	bee_spectrogram_row_t *row;
+
+	if(s == NULL || s->spectral_points != DSP_SPECTRAL_BINS)
+		return(k_bee_ret_invalid_param);
+
+	row = &ring[next_row % SPECTROGRAM_ROWS];
+	row->tick_ms = HAL_GetTick();
+	row->sequence = s->sequence;
+	spectrogram_quantize(s, row->level);
+
+	next_row++;
+	return(k_bee_ret_ok);
+}
+
+bee_retcode_t bee_spectrogram_read(uint32_t row, bee_spectrogram_row_t *out)
+{
+	if(out == NULL)
+		return(k_bee_ret_invalid_param);
+
+	/* rows are only written from the main loop, readers there see whole rows */
+	if(row >= next_row || next_row - row > SPECTROGRAM_ROWS)
+		return(k_bee_err);
+
+	*out = ring[row % SPECTROGRAM_ROWS];
+	return(k_bee_ret_ok);
+}
+
+bee_retcode_t bee_spectrogram_get_info(bee_spectrogram_info_t *info)
+{
+	bee_psd_cfg_t psd;
+	uint32_t period_ms;
+
+	if(info == NULL)
+		return(k_bee_ret_invalid_param);
+
+	bee_psd_get_config(&psd);
+	period_ms = psd.report_ms * every;
+
+	info->rows = SPECTROGRAM_ROWS;
+	info->cols = SPECTROGRAM_COLS;
+	info->row_bytes = SPECTROGRAM_ROW_BYTES;
+	info->bytes = SPECTROGRAM_BYTES;
+	info->bytes_per_minute = (period_ms) ?
+			(uint32_t)((60000ULL * sizeof(bee_spectrogram_row_t)) / period_ms) : 0;
+	info->minutes = (float)SPECTROGRAM_ROWS * (float)period_ms / 60000.0f;
+	info->col_hz = (float)audio_get_profile()->sample_rate / (float)DSP_FFT_POINTS *
+			(float)(1UL << SPECTROGRAM_BIN_SHIFT);
+	info->floor_cdb = SPECTROGRAM_FLOOR_CDB;
+	info->step_cdb = SPECTROGRAM_STEP_CDB;
+	info->next = next_row;
+	info->first = (next_row > SPECTROGRAM_ROWS) ? next_row - SPECTROGRAM_ROWS : 0;
+
+	return(k_bee_ret_ok);
+}
+
+void bee_spectrogram_handler(system_event_t ev)
+{
+	switch(ev) {
+	case k_aggresivity_available:
+		on_spectrogram_report();
+		break;
+	}
+}
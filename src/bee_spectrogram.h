@@ -0,0 +1,135 @@
+/*
+ *  @file bee_spectrogram.h
+ *  @brief spectrogram history of the first mic, the last reported spectra
+ *  kept as 8 bit log levels on a ring that can be read back while the
+ *  acquisition runs
+ */
+
+#ifndef __BEE_SPECTROGRAM_H
+#define __BEE_SPECTROGRAM_H
+
+/* rows on the ring, 4 min of 1 s reports */
+#ifndef SPECTROGRAM_ROWS
+#define SPECTROGRAM_ROWS		240
+#endif
+
+/* adjacent bins merged per column as a power of 2, 0 keeps every bin */
+#ifndef SPECTROGRAM_BIN_SHIFT
+#define SPECTROGRAM_BIN_SHIFT	2
+#endif
+
+/* places the ring on SRAM2 instead of SRAM1, it only fits there once the
+ * trigger history is shortened
+ */
+#ifndef SPECTROGRAM_IN_RAM2
+#define SPECTROGRAM_IN_RAM2		0
+#endif
+
+#define SPECTROGRAM_COLS		(DSP_SPECTRAL_BINS >> SPECTROGRAM_BIN_SHIFT)
+
+#if SPECTROGRAM_COLS == 0
+#error "SPECTROGRAM_BIN_SHIFT merges more bins than the spectrum has"
+#endif
+
+/* level n stands for FLOOR + n * STEP in 0.01 dB of the power, -110 dB
+ * up to +53.2 dB in 0.64 dB steps
+ */
+#define SPECTROGRAM_FLOOR_CDB	(-11000)
+#define SPECTROGRAM_STEP_CDB	64
+
+/* defaults, every report is kept */
+#define SPECTROGRAM_DEFAULT_EVERY	1
+
+/** one spectrum of the history, each column is the loudest bin it merges */
+typedef struct bee_spectrogram_row {
+	uint32_t tick_ms;
+	uint32_t sequence;
+	uint8_t level[SPECTROGRAM_COLS];
+}bee_spectrogram_row_t;
+
+/* bytes of a row as it is exported, without trailing padding */
+#define SPECTROGRAM_ROW_BYTES	(offsetof(bee_spectrogram_row_t, level) + SPECTROGRAM_COLS)
+
+/* ring memory cost in bytes */
+#define SPECTROGRAM_BYTES		(SPECTROGRAM_ROWS * sizeof(bee_spectrogram_row_t))
+
+/** history setup, one report out of every is kept, a larger one stretches
+ * the history over more minutes with the same memory
+ */
+typedef struct bee_spectrogram_cfg {
+	uint32_t every;
+}bee_spectrogram_cfg_t;
+
+/** ring layout and memory figures, rows are numbered from the first one
+ * pushed, first is the oldest still held and next the one to be written
+ */
+typedef struct bee_spectrogram_info {
+	uint32_t rows;
+	uint32_t cols;
+	uint32_t row_bytes;
+	uint32_t bytes;
+	uint32_t bytes_per_minute;
+	float minutes;
+	float col_hz;
+	int16_t floor_cdb;
+	int16_t step_cdb;
+	uint32_t first;
+	uint32_t next;
+}bee_spectrogram_info_t;
+
+
+/**
+ * 	@fn bee_spectrogram_init()
+ *  @brief empties the history and restores the default setup
+ *
+ *  @param
+ *  @return
+ */
+void bee_spectrogram_init(void);
+
+/**
+ * 	@fn bee_spectrogram_config()
+ *  @brief changes the reports kept, the rows already held stay
+ *
+ *  @param
+ *  @return
+ */
+bee_retcode_t bee_spectrogram_config(const bee_spectrogram_cfg_t *cfg);
+
+/**
+ * 	@fn bee_spectrogram_push()
+ *  @brief quantizes a published spectrum and writes it over the oldest row
+ *
+ *  @param
+ *  @return
+ */
+bee_retcode_t bee_spectrogram_push(const bee_spectra_t *spectra);
+
+/**
+ * 	@fn bee_spectrogram_read()
+ *  @brief copies a row out of the ring
+ *
+ *  @param row - row number, from first up to next - 1
+ *  @return k_bee_err when the row was overwritten or is not written yet
+ */
+bee_retcode_t bee_spectrogram_read(uint32_t row, bee_spectrogram_row_t *out);
+
+/**
+ * 	@fn bee_spectrogram_get_info()
+ *  @brief gets the ring layout and its memory figures at the current setup
+ *
+ *  @param
+ *  @return
+ */
+bee_retcode_t bee_spectrogram_get_info(bee_spectrogram_info_t *info);
+
+/**
+ * 	@fn bee_spectrogram_handler()
+ *  @brief spectrogram application handler
+ *
+ *  @param
+ *  @return
+ */
+void bee_spectrogram_handler(system_event_t ev);
+
+#endif
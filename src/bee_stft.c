@@ -0,0 +1,198 @@
+/*
+ *  @file bee_stft.c
+ *  @brief short time fourier framing, cuts the captured audio stream in
+ *  overlapped and windowed frames ready to be transformed
+ */
+
+#include "lilbee.h"
+
+#define STFT_RING_MASK	(STFT_MAX_FRAME_LEN - 1)
+
+/** internal variables */
+static uint32_t frame_len = STFT_DEFAULT_FRAME_LEN;
+static uint32_t hop = STFT_DEFAULT_HOP;
+static stft_window_t window_type = STFT_DEFAULT_WINDOW;
+
+#if DSP_USE_Q15
+/* window in Q15, samples are already Q15 */
+static q15_t window_table[STFT_MAX_FRAME_LEN];
+#else
+/* window with the int16 to float scale folded in */
+static float window_table[STFT_MAX_FRAME_LEN];
+#endif
+
+/** internal functions */
+
+/**
+ * 	@fn stft_window_coef()
+ *  @brief computes one coefficient of a periodic window, periodic windows
+ *  sum to a constant when overlapped at 50% (hann) or 75% (all of them)
+ *
+ *  @param
+ *  @return
+ */
+static float stft_window_coef(stft_window_t window, uint32_t n, uint32_t len)
+{
+	float phase = 2.0f * PI * (float)n / (float)len;
+	float ret = 1.0f;
+
+	switch(window) {
+	case k_stft_window_hann:
+		ret = 0.5f - 0.5f * cosf(phase);
+		break;
+
+	case k_stft_window_hamming:
+		ret = 0.54f - 0.46f * cosf(phase);
+		break;
+
+	case k_stft_window_blackman:
+		ret = 0.42f - 0.5f * cosf(phase) + 0.08f * cosf(2.0f * phase);
+		break;
+
+	default:
+		break;
+	}
+
+	return(ret);
+}
+
+/** public functions */
+
+bee_retcode_t bee_stft_init(uint32_t len, uint32_t step, stft_window_t window)
+{
+	if(len < STFT_MIN_FRAME_LEN || len > STFT_MAX_FRAME_LEN)
+		return(k_bee_ret_invalid_param);
+
+	if(step == 0 || step > len || window >= k_stft_max_windows)
+		return(k_bee_ret_invalid_param);
+
+	frame_len = len;
+	hop = step;
+	window_type = window;
+
+	for(uint32_t i = 0; i < frame_len; i++) {
+#if DSP_USE_Q15
+		window_table[i] = (q15_t)__SSAT((int32_t)(stft_window_coef(window, i,
+				frame_len) * 32768.0f + 0.5f), 16);
+#else
+		window_table[i] = stft_window_coef(window, i, frame_len) / 32768.0f;
+#endif
+	}
+
+	return(k_bee_ret_ok);
+}
+
+void bee_stft_reset(bee_stft_t *st)
+{
+	if(st) {
+		st->wr_index = 0;
+		st->count = 0;
+	}
+}
+
+uint32_t bee_stft_feed(bee_stft_t *st, const int16_t *samples, uint32_t n)
+{
+	uint32_t used = 0;
+
+	if(st == NULL || samples == NULL)
+		return(0);
+
+	while(used < n && st->count < frame_len) {
+		st->ring[st->wr_index] = samples[used++];
+		st->wr_index = (st->wr_index + 1) & STFT_RING_MASK;
+		st->count++;
+	}
+
+	return(used);
+}
+
+bool bee_stft_frame_ready(const bee_stft_t *st)
+{
+	return(st != NULL && st->count >= frame_len);
+}
+
+bee_retcode_t bee_stft_drop_frame(bee_stft_t *st)
+{
+	if(!bee_stft_frame_ready(st))
+		return(k_bee_err);
+
+	st->count -= hop;
+	return(k_bee_ret_ok);
+}
+
+#if DSP_USE_Q15
+bee_retcode_t bee_stft_get_frame_q15(bee_stft_t *st, q15_t *out, uint32_t *shift)
+{
+	uint32_t rd;
+	uint32_t i;
+	int32_t sample;
+	int32_t peak = 0;
+
+	if(!bee_stft_frame_ready(st) || out == NULL || shift == NULL)
+		return(k_bee_err);
+
+	/* window and peak search in a single pass over the oldest frame */
+	rd = (st->wr_index - st->count) & STFT_RING_MASK;
+	for(i = 0; i < frame_len; i++) {
+		sample = ((int32_t)st->ring[rd] * window_table[i]) >> 15;
+		out[i] = (q15_t)sample;
+		if(sample < 0)
+			sample = -sample;
+		if(sample > peak)
+			peak = sample;
+		rd = (rd + 1) & STFT_RING_MASK;
+	}
+
+	for(; i < STFT_MAX_FRAME_LEN; i++) {
+		out[i] = 0;
+	}
+
+	/* block floating point, the loudest sample takes the whole range so
+	 * the FFT stage scaling does not bury quiet frames on the noise
+	 */
+	*shift = (peak != 0) ? __CLZ((uint32_t)peak) - 17 : 0;
+	if(*shift)
+		arm_shift_q15(out, (int8_t)*shift, out, frame_len);
+
+	st->count -= hop;
+	return(k_bee_ret_ok);
+}
+#else
+bee_retcode_t bee_stft_get_frame(bee_stft_t *st, float *out)
+{
+	uint32_t rd;
+	uint32_t i;
+
+	if(!bee_stft_frame_ready(st) || out == NULL)
+		return(k_bee_err);
+
+	/* window and conversion in a single pass over the oldest frame */
+	rd = (st->wr_index - st->count) & STFT_RING_MASK;
+	for(i = 0; i < frame_len; i++) {
+		out[i] = (float)st->ring[rd] * window_table[i];
+		rd = (rd + 1) & STFT_RING_MASK;
+	}
+
+	for(; i < STFT_MAX_FRAME_LEN; i++) {
+		out[i] = 0.0f;
+	}
+
+	st->count -= hop;
+	return(k_bee_ret_ok);
+}
+#endif
+
+uint32_t bee_stft_get_frame_len(void)
+{
+	return(frame_len);
+}
+
+uint32_t bee_stft_get_hop(void)
+{
+	return(hop);
+}
+
+stft_window_t bee_stft_get_window(void)
+{
+	return(window_type);
+}
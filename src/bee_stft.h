@@ -0,0 +1,139 @@
+/*
+ *  @file bee_stft.h
+ *  @brief short time fourier framing, cuts the captured audio stream in
+ *  overlapped and windowed frames ready to be transformed
+ */
+
+#ifndef __BEE_STFT_H
+#define __BEE_STFT_H
+
+/* largest frame length supported, the FFT size, shorter frames are zero padded */
+#define STFT_MAX_FRAME_LEN	FFT_POINTS
+
+/* smallest frame length supported */
+#define STFT_MIN_FRAME_LEN	64
+
+/* default framing, 50% overlapped hann frames of the FFT size */
+#define STFT_DEFAULT_FRAME_LEN	STFT_MAX_FRAME_LEN
+#define STFT_DEFAULT_HOP		(STFT_DEFAULT_FRAME_LEN / 2)
+#define STFT_DEFAULT_WINDOW		k_stft_window_hann
+
+/** analysis windows */
+typedef enum {
+	k_stft_window_rect = 0,
+	k_stft_window_hann,
+	k_stft_window_hamming,
+	k_stft_window_blackman,
+	k_stft_max_windows,
+}stft_window_t;
+
+/** framing state of one audio stream */
+typedef struct bee_stft {
+	int16_t ring[STFT_MAX_FRAME_LEN];
+	uint32_t wr_index;
+	uint32_t count;
+}bee_stft_t;
+
+
+/**
+ * 	@fn bee_stft_init()
+ *  @brief setups the framing shared by all streams and precomputes the
+ *         window table, streams must be reset afterwards
+ *
+ *  @param frame_len - samples per frame, from STFT_MIN_FRAME_LEN up to
+ *         STFT_MAX_FRAME_LEN, shorter frames are zero padded
+ *  @param hop - samples between two frames, from 1 up to frame_len
+ *  @return
+ */
+bee_retcode_t bee_stft_init(uint32_t frame_len, uint32_t hop, stft_window_t window);
+
+/**
+ * 	@fn bee_stft_reset()
+ *  @brief discards the samples buffered by a stream
+ *
+ *  @param
+ *  @return
+ */
+void bee_stft_reset(bee_stft_t *st);
+
+/**
+ * 	@fn bee_stft_feed()
+ *  @brief buffers samples until a full frame is available
+ *
+ *  @param
+ *  @return number of samples consumed, less than n when a frame got ready
+ */
+uint32_t bee_stft_feed(bee_stft_t *st, const int16_t *samples, uint32_t n);
+
+/**
+ * 	@fn bee_stft_frame_ready()
+ *  @brief checks if a full frame is buffered
+ *
+ *  @param
+ *  @return
+ */
+bool bee_stft_frame_ready(const bee_stft_t *st);
+
+/**
+ * 	@fn bee_stft_drop_frame()
+ *  @brief advances the stream by one hop past the oldest frame, without
+ *         transforming it
+ *
+ *  @param
+ *  @return
+ */
+bee_retcode_t bee_stft_drop_frame(bee_stft_t *st);
+
+#if !DSP_USE_Q15
+/**
+ * 	@fn bee_stft_get_frame()
+ *  @brief windows and converts the oldest frame to float, then advances
+ *         the stream by one hop
+ *
+ *  @param out - STFT_MAX_FRAME_LEN floats, zero padded after frame length
+ *  @return
+ */
+bee_retcode_t bee_stft_get_frame(bee_stft_t *st, float *out);
+#endif
+
+#if DSP_USE_Q15
+/**
+ * 	@fn bee_stft_get_frame_q15()
+ *  @brief windows the oldest frame in Q15, then normalizes it as a block
+ *         floating point frame, and advances the stream by one hop
+ *
+ *  @param out - STFT_MAX_FRAME_LEN samples, zero padded after frame length
+ *  @param shift - left shift applied to the whole block by normalization
+ *  @return
+ */
+bee_retcode_t bee_stft_get_frame_q15(bee_stft_t *st, q15_t *out, uint32_t *shift);
+#endif
+
+/**
+ * 	@fn bee_stft_get_frame_len()
+ *  @brief gets the configured frame length
+ *
+ *  @param
+ *  @return
+ */
+uint32_t bee_stft_get_frame_len(void);
+
+/**
+ * 	@fn bee_stft_get_hop()
+ *  @brief gets the configured hop
+ *
+ *  @param
+ *  @return
+ */
+uint32_t bee_stft_get_hop(void);
+
+/**
+ * 	@fn bee_stft_get_window()
+ *  @brief gets the configured analysis window
+ *
+ *  @param
+ *  @return
+ */
+stft_window_t bee_stft_get_window(void);
+
+#endif
@@ -0,0 +1,317 @@
+/*
+ *  @file bee_trigger.c
+ *  @brief keeps a rolling raw audio history of one mic in SRAM2 and
+ *  freezes the audio around a feature trigger for later retrieval
+ */
+
+#include "lilbee.h"
+
+
+/** internal variables */
+static int16_t history[TRIGGER_HISTORY_LEN] BEE_RAM2_BSS;
+
+/* write side belongs to the capture IRQ while not frozen */
+static volatile uint32_t wr_index = 0;
+static volatile uint32_t filled = 0;
+static volatile uint64_t next_sample_index = 0;
+static volatile uint32_t history_rate = 0;
+static volatile uint32_t post_remaining = 0;
+static volatile trigger_state_t state = k_trigger_armed;
+
+static uint32_t pre_len = 0;
+static uint32_t frozen_tick = 0;
+static bee_trigger_cfg_t config;
+static bee_trigger_info_t snapshot;
+
+/** internal functions */
+
+/**
+ * 	@fn trigger_ms_to_samples()
+ *  @brief converts a window length to samples at the history rate
+ *
+ *  @param
+ *  @return
+ */
+static uint32_t trigger_ms_to_samples(uint32_t ms)
+{
+	uint32_t ret = (uint32_t)(((uint64_t)ms * history_rate) / 1000);
+
+	if(ret > TRIGGER_HISTORY_LEN)
+		ret = TRIGGER_HISTORY_LEN;
+
+	return(ret);
+}
+
+/**
+ * 	@fn trigger_start()
+ *  @brief opens the post trigger window, the capture IRQ freezes the
+ *  history once it is written
+ *
+ *  @param
+ *  @return
+ */
+static void trigger_start(float value)
+{
+	uint32_t primask = __get_PRIMASK();
+	uint32_t post_len;
+
+	__disable_irq();
+
+	if(state != k_trigger_armed || history_rate == 0) {
+		__set_PRIMASK(primask);
+		return;
+	}
+
+	post_len = trigger_ms_to_samples(config.post_ms);
+	pre_len = trigger_ms_to_samples(config.pre_ms);
+	if(pre_len > TRIGGER_HISTORY_LEN - post_len)
+		pre_len = TRIGGER_HISTORY_LEN - post_len;
+
+	snapshot.trigger_sample_index = next_sample_index;
+	snapshot.trigger_value = value;
+	snapshot.sample_rate = history_rate;
+	snapshot.channel = config.channel;
+
+	post_remaining = post_len;
+	state = k_trigger_collecting;
+
+	if(post_len == 0) {
+		state = k_trigger_frozen;
+		event_queue_put(k_trigger_captured);
+	}
+
+	__set_PRIMASK(primask);
+}
+
+/**
+ * 	@fn on_trigger_features()
+ *  @brief checks the watched feature after each processed frame
+ *
+ *  @param
+ *  @return
+ */
+static void on_trigger_features(void)
+{
+	float value = 0.0f;
+	float rms;
+	float peak;
+
+	if(state != k_trigger_armed)
+		return;
+
+	switch(config.source) {
+	case k_trigger_src_aggro:
+		value = bee_dsp_get_channel_aggro_level(config.channel);
+		break;
+
+	case k_trigger_src_rms:
+	case k_trigger_src_peak:
+		if(bee_dsp_get_channel_level(config.channel, &rms, &peak) != k_bee_ret_ok)
+			return;
+		value = (config.source == k_trigger_src_rms) ? rms : peak;
+		break;
+
+	default:
+		return;
+	}
+
+	if(value >= config.threshold)
+		trigger_start(value);
+}
+
+/**
+ * 	@fn on_trigger_hold()
+ *  @brief rearms the trigger once the snapshot was held past its hold
+ *  time, so the history rolls again when no peer comes to read it
+ *
+ *  @param
+ *  @return
+ */
+static void on_trigger_hold(void)
+{
+	if(state != k_trigger_frozen || config.hold_ms == 0)
+		return;
+
+	if(HAL_GetTick() - frozen_tick < config.hold_ms)
+		return;
+
+	bee_trigger_rearm();
+
+	/* a peer told about the snapshot learns it is gone */
+	event_queue_put(k_trigger_snapshot);
+}
+
+/**
+ * 	@fn on_trigger_captured()
+ *  @brief describes the frozen snapshot, the history stays untouched
+ *  until the trigger is rearmed or the hold time runs out
+ *
+ *  @param
+ *  @return
+ */
+static void on_trigger_captured(void)
+{
+	uint64_t length;
+
+	if(state != k_trigger_frozen)
+		return;
+
+	/* pre window plus everything written after the trigger */
+	length = pre_len + (next_sample_index - snapshot.trigger_sample_index);
+	if(length > filled)
+		length = filled;
+
+	snapshot.length = (uint32_t)length;
+	snapshot.first_sample_index = next_sample_index - length;
+	frozen_tick = HAL_GetTick();
+
+	/* the snapshot can be read from now on */
+	event_queue_put(k_trigger_snapshot);
+}
+
+
+/** public functions */
+
+void bee_trigger_init(void)
+{
+	config.source = TRIGGER_DEFAULT_SOURCE;
+	config.channel = 0;
+	config.threshold = TRIGGER_DEFAULT_THRESHOLD;
+	config.pre_ms = TRIGGER_DEFAULT_PRE_MS;
+	config.post_ms = TRIGGER_DEFAULT_POST_MS;
+	config.hold_ms = TRIGGER_DEFAULT_HOLD_MS;
+
+	/* SRAM2 is not cleared by the startup */
+	memset(history, 0, sizeof(history));
+	bee_trigger_rearm();
+}
+
+bee_retcode_t bee_trigger_config(const bee_trigger_cfg_t *cfg)
+{
+	uint32_t primask;
+
+	if(cfg == NULL || cfg->source >= k_trigger_max_srcs ||
+			cfg->channel >= AUDIO_CHANNELS)
+		return(k_bee_ret_invalid_param);
+
+	primask = __get_PRIMASK();
+	__disable_irq();
+	config = *cfg;
+	__set_PRIMASK(primask);
+
+	/* a new channel needs a new history */
+	bee_trigger_rearm();
+	return(k_bee_ret_ok);
+}
+
+bee_retcode_t bee_trigger_fire(void)
+{
+	if(state != k_trigger_armed)
+		return(k_bee_err);
+
+	trigger_start(0.0f);
+	return(k_bee_ret_ok);
+}
+
+void bee_trigger_rearm(void)
+{
+	uint32_t primask = __get_PRIMASK();
+
+	__disable_irq();
+	filled = 0;
+	history_rate = 0;
+	post_remaining = 0;
+	memset(&snapshot, 0, sizeof(snapshot));
+	state = k_trigger_armed;
+	__set_PRIMASK(primask);
+}
+
+void bee_trigger_hold(void)
+{
+	frozen_tick = HAL_GetTick();
+}
+
+bee_retcode_t bee_trigger_get_info(bee_trigger_info_t *info)
+{
+	if(info == NULL)
+		return(k_bee_ret_invalid_param);
+
+	*info = snapshot;
+	info->state = state;
+	return(k_bee_ret_ok);
+}
+
+uint32_t bee_trigger_read(uint32_t offset, int16_t *dst, uint32_t n)
+{
+	uint32_t rd;
+
+	if(dst == NULL || state != k_trigger_frozen || offset >= snapshot.length)
+		return(0);
+
+	if(n > snapshot.length - offset)
+		n = snapshot.length - offset;
+
+	rd = (wr_index + TRIGGER_HISTORY_LEN - snapshot.length + offset) % TRIGGER_HISTORY_LEN;
+	for(uint32_t i = 0; i < n; i++) {
+		dst[i] = history[rd];
+		if(++rd == TRIGGER_HISTORY_LEN)
+			rd = 0;
+	}
+
+	return(n);
+}
+
+void bee_trigger_on_block(const int16_t *samples, uint32_t n,
+		uint64_t sample_index, uint32_t sample_rate)
+{
+	uint32_t wr = wr_index;
+
+	if(state == k_trigger_frozen || samples == NULL)
+		return;
+
+	/* a rate change or a restarted capture breaks the history */
+	if(sample_rate != history_rate || sample_index != next_sample_index) {
+		filled = 0;
+		history_rate = sample_rate;
+		state = k_trigger_armed;
+	}
+
+	for(uint32_t i = 0; i < n; i++) {
+		history[wr] = samples[i];
+		if(++wr == TRIGGER_HISTORY_LEN)
+			wr = 0;
+	}
+
+	wr_index = wr;
+	next_sample_index = sample_index + n;
+	filled = (filled + n > TRIGGER_HISTORY_LEN) ? TRIGGER_HISTORY_LEN : filled + n;
+
+	if(state == k_trigger_collecting) {
+		if(post_remaining <= n) {
+			post_remaining = 0;
+			state = k_trigger_frozen;
+			event_queue_put(k_trigger_captured);
+		} else {
+			post_remaining -= n;
+		}
+	}
+}
+
+uint32_t bee_trigger_get_channel(void)
+{
+	return(config.channel);
+}
+
+void bee_trigger_handler(system_event_t ev)
+{
+	switch(ev) {
+	case k_dsp_endprocess:
+		on_trigger_hold();
+		on_trigger_features();
+		break;
+
+	case k_trigger_captured:
+		on_trigger_captured();
+		break;
+	}
+}
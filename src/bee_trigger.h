@@ -0,0 +1,156 @@
+/*
+ *  @file bee_trigger.h
+ *  @brief keeps a rolling raw audio history of one mic in SRAM2 and
+ *  freezes the audio around a feature trigger for later retrieval
+ */
+
+#ifndef __BEE_TRIGGER_H
+#define __BEE_TRIGGER_H
+
+/* history length in samples, 30KB of SRAM2, 320 ms at 48K and 1.9 s at 8K */
+#define TRIGGER_HISTORY_LEN		(15 * 1024)
+
+/* default trigger, loud events over -12 dBFS */
+#define TRIGGER_DEFAULT_SOURCE		k_trigger_src_rms
+#define TRIGGER_DEFAULT_THRESHOLD	0.25f
+#define TRIGGER_DEFAULT_PRE_MS		200
+#define TRIGGER_DEFAULT_POST_MS		100
+
+/* a snapshot nobody reads is released after a minute so the history rolls
+ * again, 0 holds it until it is exported
+ */
+#define TRIGGER_DEFAULT_HOLD_MS		60000
+
+/** feature watched by the trigger */
+typedef enum {
+	k_trigger_src_none = 0,
+	k_trigger_src_aggro,
+	k_trigger_src_rms,
+	k_trigger_src_peak,
+	k_trigger_max_srcs,
+}trigger_source_t;
+
+/** trigger states */
+typedef enum {
+	k_trigger_armed = 0,
+	k_trigger_collecting,
+	k_trigger_frozen,
+}trigger_state_t;
+
+/** trigger setup, pre and post windows are trimmed to the history */
+typedef struct bee_trigger_cfg {
+	trigger_source_t source;
+	uint32_t channel;
+	float threshold;
+	uint32_t pre_ms;
+	uint32_t post_ms;
+	uint32_t hold_ms;
+}bee_trigger_cfg_t;
+
+/** frozen snapshot description */
+typedef struct bee_trigger_info {
+	trigger_state_t state;
+	uint32_t sample_rate;
+	uint32_t channel;
+	uint64_t first_sample_index;
+	uint64_t trigger_sample_index;
+	uint32_t length;
+	float trigger_value;
+}bee_trigger_info_t;
+
+
+/**
+ * 	@fn bee_trigger_init()
+ *  @brief clears the history and arms the trigger with default setup
+ *
+ *  @param
+ *  @return
+ */
+void bee_trigger_init(void);
+
+/**
+ * 	@fn bee_trigger_config()
+ *  @brief changes the trigger setup and rearms it
+ *
+ *  @param
+ *  @return
+ */
+bee_retcode_t bee_trigger_config(const bee_trigger_cfg_t *cfg);
+
+/**
+ * 	@fn bee_trigger_fire()
+ *  @brief triggers a capture right now, whatever the feature value is
+ *
+ *  @param
+ *  @return
+ */
+bee_retcode_t bee_trigger_fire(void);
+
+/**
+ * 	@fn bee_trigger_rearm()
+ *  @brief releases the frozen snapshot and resumes the rolling history
+ *
+ *  @param
+ *  @return
+ */
+void bee_trigger_rearm(void);
+
+/**
+ * 	@fn bee_trigger_hold()
+ *  @brief restarts the hold time of the frozen snapshot, called while it
+ *         is read so an export is not cut by the timeout
+ *
+ *  @param
+ *  @return
+ */
+void bee_trigger_hold(void);
+
+/**
+ * 	@fn bee_trigger_get_info()
+ *  @brief gets the trigger state and the frozen snapshot description
+ *
+ *  @param
+ *  @return
+ */
+bee_retcode_t bee_trigger_get_info(bee_trigger_info_t *info);
+
+/**
+ * 	@fn bee_trigger_read()
+ *  @brief copies samples of the frozen snapshot
+ *
+ *  @param offset - first sample to copy, from the snapshot start
+ *  @return number of samples copied, 0 when nothing is frozen
+ */
+uint32_t bee_trigger_read(uint32_t offset, int16_t *dst, uint32_t n);
+
+/**
+ * 	@fn bee_trigger_on_block()
+ *  @brief appends a converted block to the history, called from the
+ *         capture IRQ for every block of the watched channel
+ *
+ *  @param
+ *  @return
+ */
+void bee_trigger_on_block(const int16_t *samples, uint32_t n,
+		uint64_t sample_index, uint32_t sample_rate);
+
+/**
+ * 	@fn bee_trigger_get_channel()
+ *  @brief gets the channel recorded on the history
+ *
+ *  @param
+ *  @return
+ */
+uint32_t bee_trigger_get_channel(void);
+
+/**
+ * 	@fn bee_trigger_handler()
+ *  @brief trigger application handler, watches the features and
+ *         releases a snapshot held past its hold time
+ *
+ *  @param
+ *  @return
+ */
+void bee_trigger_handler(system_event_t ev);
+
+#endif
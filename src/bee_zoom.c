@@ -0,0 +1,171 @@
+/*
+ *  @file bee_zoom.c
+ *  @brief zoom FFT, mixes a band down to DC, low-passes and decimates it
+ *  then takes a complex FFT of the narrow band for a finer resolution
+ */
+
+#include "lilbee.h"
+
+
+/** internal functions */
+
+/**
+ * 	@fn zoom_design()
+ *  @brief hamming windowed sinc low-pass cut at half the decimated rate,
+ *  unity gain at DC
+ *
+ *  @param
+ *  @return
+ */
+static void zoom_design(bee_zoom_plan_t *plan)
+{
+	float fc = 0.5f / (float)plan->decimation;
+	float mid = 0.5f * (float)(plan->taps - 1);
+	float sum = 0.0f;
+	float t;
+
+	for(uint32_t n = 0; n < plan->taps; n++) {
+		t = (float)n - mid;
+		plan->coeff[n] = (t == 0.0f) ? 2.0f * fc : sinf(2.0f * PI * fc * t) / (PI * t);
+		plan->coeff[n] *= 0.54f - 0.46f * cosf(2.0f * PI * (float)n / (float)(plan->taps - 1));
+		sum += plan->coeff[n];
+	}
+
+	arm_scale_f32(plan->coeff, 1.0f / sum, plan->coeff, plan->taps);
+}
+
+/**
+ * 	@fn zoom_decimate()
+ *  @brief filters one decimation worth of mixed samples into the frame
+ *
+ *  @param
+ *  @return
+ */
+static void zoom_decimate(bee_zoom_t *z, const bee_zoom_plan_t *plan)
+{
+	float norm;
+
+	arm_fir_decimate_f32(&z->fir_i, z->mix_i, &z->frame[2 * z->count], plan->decimation);
+	arm_fir_decimate_f32(&z->fir_q, z->mix_q, &z->frame[2 * z->count + 1], plan->decimation);
+	z->pending = 0;
+	z->count++;
+
+	/* keeps the oscillator on the unit circle, first order is enough
+	 * for the drift of one decimation
+	 */
+	norm = 1.5f - 0.5f * (z->osc_re * z->osc_re + z->osc_im * z->osc_im);
+	z->osc_re *= norm;
+	z->osc_im *= norm;
+}
+
+/** public functions */
+
+bee_retcode_t bee_zoom_plan(bee_zoom_plan_t *plan, uint32_t center_hz, uint32_t span_hz,
+		uint32_t sample_rate)
+{
+	uint32_t decimation;
+	float span;
+	float w;
+
+	if(plan == NULL || span_hz == 0 || sample_rate == 0)
+		return(k_bee_ret_invalid_param);
+
+	decimation = (sample_rate + span_hz / 2) / span_hz;
+	if(decimation < ZOOM_MIN_DECIMATION || decimation > ZOOM_MAX_DECIMATION)
+		return(k_bee_ret_invalid_param);
+
+	/* the band must stay between DC and nyquist */
+	span = (float)sample_rate / (float)decimation;
+	if((float)center_hz < 0.5f * span || (float)center_hz + 0.5f * span > 0.5f * (float)sample_rate)
+		return(k_bee_ret_invalid_param);
+
+	plan->decimation = decimation;
+	plan->taps = ZOOM_TAPS_PER_DECIMATION * decimation + 1;
+	plan->bin_hz = span / (float)ZOOM_FFT_POINTS;
+	plan->start_hz = (float)center_hz - 0.5f * span;
+
+	w = 2.0f * PI * (float)center_hz / (float)sample_rate;
+	plan->step_re = cosf(w);
+	plan->step_im = -sinf(w);
+
+	zoom_design(plan);
+	return(k_bee_ret_ok);
+}
+
+void bee_zoom_reset(bee_zoom_t *z, const bee_zoom_plan_t *plan)
+{
+	if(z == NULL || plan == NULL)
+		return;
+
+	z->pending = 0;
+	z->count = 0;
+	if(plan->decimation == 0)
+		return;
+
+	arm_fir_decimate_init_f32(&z->fir_i, plan->taps, plan->decimation,
+			(float *)plan->coeff, z->state_i, plan->decimation);
+	arm_fir_decimate_init_f32(&z->fir_q, plan->taps, plan->decimation,
+			(float *)plan->coeff, z->state_q, plan->decimation);
+
+	z->osc_re = 1.0f;
+	z->osc_im = 0.0f;
+}
+
+uint32_t bee_zoom_feed(bee_zoom_t *z, const bee_zoom_plan_t *plan,
+		const int16_t *samples, uint32_t n)
+{
+	uint32_t used = 0;
+	float re;
+	float x;
+
+	if(z == NULL || plan == NULL || samples == NULL || plan->decimation == 0)
+		return(0);
+
+	while(used < n && z->count < ZOOM_FFT_POINTS) {
+		/* x * e^(-jwn), normalized as the wideband samples */
+		x = (float)samples[used++] * (1.0f / 32768.0f);
+		z->mix_i[z->pending] = x * z->osc_re;
+		z->mix_q[z->pending] = x * z->osc_im;
+
+		re = z->osc_re * plan->step_re - z->osc_im * plan->step_im;
+		z->osc_im = z->osc_re * plan->step_im + z->osc_im * plan->step_re;
+		z->osc_re = re;
+
+		if(++z->pending == plan->decimation)
+			zoom_decimate(z, plan);
+	}
+
+	return(used);
+}
+
+bool bee_zoom_frame_ready(const bee_zoom_t *z)
+{
+	return(z != NULL && z->count == ZOOM_FFT_POINTS);
+}
+
+void bee_zoom_get_power(bee_zoom_t *z, float *power)
+{
+	/* a real tone reads the same power as on the wideband path, whose
+	 * real FFT has twice the points
+	 */
+	const float gain = 2.0f * 2.0f;
+	float w;
+
+	if(z == NULL || power == NULL || z->count != ZOOM_FFT_POINTS)
+		return;
+
+	for(uint32_t n = 0; n < ZOOM_FFT_POINTS; n++) {
+		w = 0.5f - 0.5f * cosf(2.0f * PI * (float)n / (float)ZOOM_FFT_POINTS);
+		z->frame[2 * n] *= w;
+		z->frame[2 * n + 1] *= w;
+	}
+
+	arm_cfft_f32(bee_fft_get_complex(ZOOM_FFT_POINTS), z->frame, 0, 1);
+
+	/* negative frequencies first, so bins rise from start_hz */
+	arm_cmplx_mag_squared_f32(&z->frame[ZOOM_FFT_POINTS], power, ZOOM_FFT_POINTS / 2);
+	arm_cmplx_mag_squared_f32(z->frame, &power[ZOOM_FFT_POINTS / 2], ZOOM_FFT_POINTS / 2);
+	arm_scale_f32(power, gain, power, ZOOM_FFT_POINTS);
+
+	z->count = 0;
+}
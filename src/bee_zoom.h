@@ -0,0 +1,104 @@
+/*
+ *  @file bee_zoom.h
+ *  @brief zoom FFT, mixes a band down to DC, low-passes and decimates it
+ *  then takes a complex FFT of the narrow band for a finer resolution
+ */
+
+#ifndef __BEE_ZOOM_H
+#define __BEE_ZOOM_H
+
+/* complex FFT points, one spectrum bin each, same cost as the wideband
+ * real FFT of twice the points
+ */
+#define ZOOM_FFT_POINTS			(FFT_POINTS / 2)
+
+/* decimation limits, the span is the sample rate over the decimation */
+#define ZOOM_MIN_DECIMATION		2
+#define ZOOM_MAX_DECIMATION		48
+
+/* hamming windowed sinc taps per unit of decimation, the bins within
+ * +/- 0.3 span of the centre keep aliases under -50 dB
+ */
+#define ZOOM_TAPS_PER_DECIMATION	8
+#define ZOOM_MAX_TAPS			(ZOOM_TAPS_PER_DECIMATION * ZOOM_MAX_DECIMATION + 1)
+
+/** zoom setup, filter taps are shared by every stream using it */
+typedef struct bee_zoom_plan {
+	uint32_t decimation;
+	uint32_t taps;
+	float start_hz;
+	float bin_hz;
+	float step_re;
+	float step_im;
+	float coeff[ZOOM_MAX_TAPS];
+}bee_zoom_plan_t;
+
+/** zoom state of one audio stream, decimated samples are interleaved
+ * complex and frames do not overlap
+ */
+typedef struct bee_zoom {
+	arm_fir_decimate_instance_f32 fir_i;
+	arm_fir_decimate_instance_f32 fir_q;
+	float state_i[ZOOM_MAX_TAPS + ZOOM_MAX_DECIMATION - 1];
+	float state_q[ZOOM_MAX_TAPS + ZOOM_MAX_DECIMATION - 1];
+	float mix_i[ZOOM_MAX_DECIMATION];
+	float mix_q[ZOOM_MAX_DECIMATION];
+	float osc_re;
+	float osc_im;
+	uint32_t pending;
+	uint32_t count;
+	float frame[2 * ZOOM_FFT_POINTS];
+}bee_zoom_t;
+
+
+/**
+ * 	@fn bee_zoom_plan()
+ *  @brief designs the mixer and decimation filter of a band, the span is
+ *         rounded to a whole decimation of the rate
+ *
+ *  @param
+ *  @return
+ */
+bee_retcode_t bee_zoom_plan(bee_zoom_plan_t *plan, uint32_t center_hz, uint32_t span_hz,
+		uint32_t sample_rate);
+
+/**
+ * 	@fn bee_zoom_reset()
+ *  @brief restarts a stream on a plan, the filters history is cleared
+ *
+ *  @param
+ *  @return
+ */
+void bee_zoom_reset(bee_zoom_t *z, const bee_zoom_plan_t *plan);
+
+/**
+ * 	@fn bee_zoom_feed()
+ *  @brief mixes and decimates samples until a frame is complete
+ *
+ *  @param
+ *  @return number of samples consumed
+ */
+uint32_t bee_zoom_feed(bee_zoom_t *z, const bee_zoom_plan_t *plan,
+		const int16_t *samples, uint32_t n);
+
+/**
+ * 	@fn bee_zoom_frame_ready()
+ *  @brief checks if a frame of decimated samples is complete
+ *
+ *  @param
+ *  @return
+ */
+bool bee_zoom_frame_ready(const bee_zoom_t *z);
+
+/**
+ * 	@fn bee_zoom_get_power()
+ *  @brief windows and transforms the complete frame, the power of each
+ *         bin is written from start_hz up, on the scale of the wideband
+ *         power spectrum
+ *
+ *  @param power - ZOOM_FFT_POINTS bins
+ *  @return
+ */
+void bee_zoom_get_power(bee_zoom_t *z, float *power);
+
+#endif
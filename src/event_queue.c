@@ -1,7 +1,7 @@
 /**
  * @brief event queue interface file
  */
-#include "event_queue.h"
+#include "lilbee.h"
 
 /**
  * private variables
@@ -27,16 +27,24 @@ system_event_t event_queue_peek(void)
 }
 system_event_t event_queue_get(void)
 {
+    /* events are also posted from IRQ context */
+    uint32_t primask = __get_PRIMASK();
+    __disable_irq();
+
     system_event_t ret = (noof_elements == 0)? k_noevent : event_queue[get_index];
     if(ret != k_noevent) {
         get_index = (get_index + 1) % EVENT_QUEUE_LEN;
         noof_elements--;
     }
+
+    __set_PRIMASK(primask);
     return(ret);
 }
 int event_queue_put(system_event_t ev)
 {
     int ret = 0;
+    uint32_t primask = __get_PRIMASK();
+    __disable_irq();
 
     if(noof_elements < EVENT_QUEUE_LEN) {
         /* send event to the most back position of queue */
@@ -48,5 +56,6 @@ int event_queue_put(system_event_t ev)
         ret = -1;
     }
 
+    __set_PRIMASK(primask);
     return(ret);
 }
@@ -9,7 +9,6 @@
 typedef enum {
     k_noevent=0,
 	k_blehcievent,
-	k_audioblockevent,
 	k_audiostartedcapture,
 	k_audiostoppedcapture,
 	k_dsp_incoming_audio_available,
@@ -17,7 +16,13 @@ typedef enum {
 	k_aggresivity_available,
 	k_bleconnected,
 	k_bledisconnected,
-	k_bleadvertising
+	k_bleadvertising,
+	k_trigger_captured,
+	k_anomaly_changed,
+	k_dsp_stage_continue,
+	k_spectrogram_export,
+	k_trigger_snapshot,
+	k_trigger_export
 }system_event_t;
 
 
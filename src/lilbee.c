@@ -7,6 +7,13 @@
 #include "lilbee.h"
 
 
+/** internal variables */
+
+/* spectrum against tone bank cost in node cycles, timed once at boot with
+ * the DWT counter and read back with the debugger
+ */
+static bee_dsp_bench_t dsp_bench;
+
 /** internal functions */
 
 
@@ -75,6 +82,22 @@ static void sysclk_config(void)
   }
 }
 
+/**
+ * 	@fn cycle_counter_init()
+ *  @brief enables the DWT cycle counter used to profile the application
+ *
+ *  @param
+ *  @return
+ *
+ *
+ */
+static void cycle_counter_init(void)
+{
+	CoreDebug->DEMCR |= CoreDebug_DEMCR_TRCENA_Msk;
+	DWT->CYCCNT = 0;
+	DWT->CTRL |= DWT_CTRL_CYCCNTENA_Msk;
+}
+
 /** Public functions */
 
 
@@ -89,13 +112,19 @@ int main(void)
 {
 	sysclk_config();
 	HAL_Init();
+	cycle_counter_init();
 
 	BSP_LED_Init(LED1);
 
 	/* inits the sub applications */
-	bee_dsp_init(AUDIO_SAMPLE_FREQ);
 	audio_acq_init();
+	bee_classifier_init();
+	bee_dsp_init(audio_get_profile()->sample_rate);
+	bee_dsp_benchmark(&dsp_bench);
 	bee_ble_init();
+	bee_trigger_init();
+	bee_baseline_init();
+	bee_spectrogram_init();
 
 	/* start the analysis*/
 	audio_start_capture();
@@ -106,6 +135,9 @@ int main(void)
 		audio_handler(ev);
 		bee_dsp_handler(ev);
 		bee_ble_handler(ev);
+		bee_trigger_handler(ev);
+		bee_baseline_handler(ev);
+		bee_spectrogram_handler(ev);
 
 		if(event_queue_peek() == k_noevent) {
 			/* No event pending, sleep the cpu */
@@ -15,14 +15,66 @@ typedef enum {
 	k_bee_err,
 }bee_retcode_t;
 
+/** places a buffer on SRAM2, left uninitialized by the startup */
+#define BEE_RAM2_BSS	__attribute__((section(".ram2_bss")))
+
 
 /** libc headers */
 #include <string.h>
 #include <stdbool.h>
 #include <stdlib.h>
 #include <stdint.h>
+#include <stddef.h>
 #include <math.h>
 
+#ifdef BEE_HOST_BUILD
+#ifdef BEE_HOST_PIPELINE
+/** capture and dsp on stand ins of the SoC and BSP, see tools/host_replay.c */
+#include "arm_math.h"
+#include "arm_const_structs.h"
+#include "arm_common_tables.h"
+#include "host_bsp.h"
+
+#include "event_queue.h"
+#include "bee_audio_acquisition.h"
+#include "bee_fastlog.h"
+#include "bee_fft.h"
+#include "bee_stft.h"
+#include "bee_goertzel.h"
+#include "bee_zoom.h"
+#include "bee_pitch.h"
+#include "bee_dsp.h"
+#include "bee_psd.h"
+#include "bee_noise.h"
+#include "bee_features.h"
+#include "bee_mel.h"
+#include "bee_classifier.h"
+#include "bee_baseline.h"
+#include "bee_spectrogram.h"
+#include "bee_trigger.h"
+#else
+/** host build of the portable modules, see tools/classifier_runner.c */
+#include "bee_classifier.h"
+
+#ifdef BEE_HOST_DSP
+/** CMSIS-DSP built for the host, see tools/pitch_bench.c and noise_bench.c */
+#include "arm_math.h"
+#include "arm_const_structs.h"
+#include "arm_common_tables.h"
+#include "bee_fft.h"
+
+/* spectrum of the node pipeline, see bee_dsp.h */
+#define DSP_FFT_POINTS		FFT_POINTS
+#define DSP_SPECTRAL_BINS	(DSP_FFT_POINTS / 2)
+
+#include "bee_fastlog.h"
+#include "bee_pitch.h"
+#include "bee_noise.h"
+#include "bee_features.h"
+#endif
+#endif
+#else
+
 /** SoC headers */
 #include "stm32l4xx.h"
 #include "stm32l4xx_periph_conf.h"
@@ -64,10 +116,25 @@ typedef enum {
 
 /** applications headers */
 #include "event_queue.h"
-#include "bee_dsp.h"
 #include "bee_audio_acquisition.h"
-#include "bee_ble_service.h"
+#include "bee_fastlog.h"
+#include "bee_fft.h"
+#include "bee_stft.h"
+#include "bee_goertzel.h"
+#include "bee_zoom.h"
+#include "bee_pitch.h"
 #include "bee_dsp.h"
+#include "bee_psd.h"
+#include "bee_noise.h"
+#include "bee_features.h"
+#include "bee_mel.h"
+#include "bee_classifier.h"
+#include "bee_baseline.h"
+#include "bee_spectrogram.h"
+#include "bee_ble_service.h"
+#include "bee_trigger.h"
+
+#endif
 
 
 /** reference doc */
@@ -0,0 +1,162 @@
+/*
+ *  @file classifier_runner.c
+ *  @brief runs the firmware classifier on recorded feature sets on a PC,
+ *  the same fixed point code as the node is built against a host shim
+ *
+ *  build:
+ *  cc -O2 -DBEE_HOST_BUILD -Isrc tools/classifier_runner.c src/bee_classifier.c \
+ *     src/bee_model_default.c -lm -o classifier_runner
+ *
+ *  usage:
+ *  classifier_runner [-m model.bin] [-v] features.csv
+ *
+ *  each csv line holds one feature vector, optionally followed by the
+ *  expected hive state (0 normal, 1 queenless, 2 pre-swarm, 3 agitated)
+ */
+
+#include "lilbee.h"
+#include <stdio.h>
+#include <time.h>
+
+
+/** internal variables */
+static const char *state_names[k_hive_max_states] = {
+	"normal", "queenless", "pre-swarm", "agitated",
+};
+
+/* blob is read on an aligned buffer, as it would sit in flash */
+static uint32_t model_blob[64 * 1024 / sizeof(uint32_t)];
+
+/** internal functions */
+
+/**
+ * 	@fn runner_load_model()
+ *  @brief reads a binary model blob
+ *
+ *  @param
+ *  @return
+ */
+static bee_retcode_t runner_load_model(const char *path)
+{
+	FILE *f = fopen(path, "rb");
+	size_t size;
+
+	if(f == NULL)
+		return(k_bee_ret_invalid_param);
+
+	size = fread(model_blob, 1, sizeof(model_blob), f);
+	fclose(f);
+
+	return(bee_classifier_load(model_blob, (uint32_t)size));
+}
+
+/**
+ * 	@fn runner_parse()
+ *  @brief splits a csv line, returns the number of values
+ *
+ *  @param
+ *  @return
+ */
+static uint32_t runner_parse(char *line, float *values, uint32_t max)
+{
+	uint32_t n = 0;
+	char *end;
+
+	while(n < max) {
+		values[n] = strtof(line, &end);
+		if(end == line)
+			break;
+
+		n++;
+		line = end;
+		while(*line == ',' || *line == ' ' || *line == '\t')
+			line++;
+	}
+
+	return(n);
+}
+
+int main(int argc, char **argv)
+{
+	float values[CLASSIFIER_MAX_INPUTS + 1];
+	uint32_t confusion[k_hive_max_states][k_hive_max_states] = {{0}};
+	bee_hive_result_t result;
+	struct timespec t0;
+	struct timespec t1;
+	double ns = 0.0;
+	uint32_t inputs;
+	uint32_t vectors = 0;
+	uint32_t labelled = 0;
+	uint32_t hits = 0;
+	uint32_t n;
+	bool verbose = false;
+	const char *csv = NULL;
+	char line[1024];
+	FILE *f;
+	int label;
+
+	for(int i = 1; i < argc; i++) {
+		if(!strcmp(argv[i], "-m") && i + 1 < argc) {
+			if(runner_load_model(argv[++i]) != k_bee_ret_ok) {
+				fprintf(stderr, "invalid model %s\n", argv[i]);
+				return(1);
+			}
+		} else if(!strcmp(argv[i], "-v")) {
+			verbose = true;
+		} else {
+			csv = argv[i];
+		}
+	}
+
+	if(bee_classifier_inputs() == 0 && bee_classifier_init() != k_bee_ret_ok) {
+		fprintf(stderr, "invalid default model\n");
+		return(1);
+	}
+
+	f = (csv) ? fopen(csv, "r") : NULL;
+	if(f == NULL) {
+		fprintf(stderr, "usage: %s [-m model.bin] [-v] features.csv\n", argv[0]);
+		return(1);
+	}
+
+	inputs = bee_classifier_inputs();
+	while(fgets(line, sizeof(line), f)) {
+		n = runner_parse(line, values, inputs + 1);
+		if(n < inputs)
+			continue;
+
+		clock_gettime(CLOCK_MONOTONIC, &t0);
+		bee_classifier_run(values, inputs, &result);
+		clock_gettime(CLOCK_MONOTONIC, &t1);
+		ns += (t1.tv_sec - t0.tv_sec) * 1e9 + (t1.tv_nsec - t0.tv_nsec);
+		vectors++;
+
+		if(verbose)
+			printf("%u %s %.3f\n", vectors, state_names[result.state], result.confidence);
+
+		label = (n > inputs) ? (int)values[inputs] : -1;
+		if(label >= 0 && label < k_hive_max_states) {
+			confusion[label][result.state]++;
+			hits += (label == (int)result.state);
+			labelled++;
+		}
+	}
+
+	fclose(f);
+
+	printf("vectors %u, inputs %u, %.0f ns per inference\n", vectors, inputs,
+			(vectors) ? ns / vectors : 0.0);
+
+	if(labelled) {
+		printf("accuracy %.2f%% over %u labelled vectors\n", 100.0 * hits / labelled, labelled);
+		printf("confusion, rows expected, columns predicted\n");
+		for(uint32_t r = 0; r < k_hive_max_states; r++) {
+			printf("%-10s", state_names[r]);
+			for(uint32_t c = 0; c < k_hive_max_states; c++)
+				printf(" %6u", confusion[r][c]);
+			printf("\n");
+		}
+	}
+
+	return(0);
+}
@@ -0,0 +1,125 @@
+#!/usr/bin/env python3
+"""
+Generates src/bee_fft_tables.c, the real FFT split tables of every size the
+plan layer supports for the Q15 pipeline, and the flash the CMSIS init
+function of each pipeline links for its tables, which bee_fft.c sets the
+sizeof of the linked tables against.
+
+CMSIS-DSP keeps a single 8192 point split table pair and walks it with a
+stride, so arm_rfft_init_q15 links 32 kB of tables whatever the size. Here
+the pair is decimated once per size, the values are taken from the CMSIS
+sources so both give the same output bit for bit. The float pipeline takes
+its tables straight from arm_common_tables.c.
+
+Run it again whenever the CMSIS-DSP version or the supported sizes change:
+
+    python3 tools/gen_fft_tables.py > src/bee_fft_tables.c
+"""
+
+import argparse
+import os
+import re
+
+
+SIZES = [256, 512, 1024, 2048]
+
+# the CMSIS init functions reach every size they know about
+CMSIS_F32_SIZES = [16, 32, 64, 128, 256, 512, 1024, 2048]
+CMSIS_Q15_SIZES = [16, 32, 64, 128, 256, 512, 1024, 2048, 4096]
+CMSIS_SPLIT_POINTS = 8192
+
+
+def load_split(path, name):
+    text = open(path).read()
+    body = re.search(r'%s\[\d+\]\s*=\s*\{(.*?)\};' % name, text, re.S).group(1)
+    values = [int(v, 16) for v in re.findall(r'\(q15_t\)0x([0-9a-fA-F]+)', body)]
+    assert len(values) == CMSIS_SPLIT_POINTS
+    return [v - 0x10000 if v & 0x8000 else v for v in values]
+
+
+def table_sizes(path):
+    """element counts of the tables declared by arm_common_tables.h"""
+    text = open(path).read()
+    sizes = {}
+    for name, n in re.findall(r'extern const \w+ (\w+)\[(\d+)\];', text):
+        sizes[name] = int(n)
+    for name, n in re.findall(r'#define (\w+)_TABLE_LENGTH \(\(uint16_t\)(\d+)\)', text):
+        sizes[name] = int(n)
+    return sizes
+
+
+def cmsis_f32_bytes(t):
+    return sum(4 * t['twiddleCoef_%d' % n] + 2 * t['ARMBITREVINDEXTABLE_%d' % n] +
+               4 * t['twiddleCoef_rfft_%d' % (2 * n)] for n in CMSIS_F32_SIZES)
+
+
+def cmsis_q15_bytes(t):
+    return 2 * 2 * CMSIS_SPLIT_POINTS + sum(
+        2 * t['twiddleCoef_%d_q15' % n] + 2 * t['ARMBITREVINDEXTABLE_FIXED_%d' % n]
+        for n in CMSIS_Q15_SIZES)
+
+
+def hexes(values, per_line=8):
+    lines = []
+    for i in range(0, len(values), per_line):
+        lines.append('\t' + ', '.join('(q15_t)0x%04x' % (v & 0xffff)
+                                      for v in values[i:i + per_line]) + ',')
+    return '\n'.join(lines)
+
+
+def main():
+    here = os.path.dirname(os.path.abspath(__file__))
+    dsp = os.path.join(here, '..', 'Drivers', 'CMSIS', 'DSP')
+
+    ap = argparse.ArgumentParser()
+    ap.add_argument('--cmsis', default=dsp)
+    args = ap.parse_args()
+
+    t = table_sizes(os.path.join(args.cmsis, 'Include', 'arm_common_tables.h'))
+    split = os.path.join(args.cmsis, 'Source', 'TransformFunctions', 'arm_rfft_init_q15.c')
+    coef_a = load_split(split, 'realCoefAQ15')
+    coef_b = load_split(split, 'realCoefBQ15')
+
+    print('/*')
+    print(' *  @file bee_fft_tables.c')
+    print(' *  @brief real FFT split tables of each size for the Q15 pipeline,')
+    print(' *  generated by tools/gen_fft_tables.py, do not edit')
+    print(' */')
+    print()
+    print('#include "lilbee.h"')
+    print()
+    print('/* flash the CMSIS init function of the pipeline links for its tables,')
+    print(' * see bee_fft_get_table_bytes()')
+    print(' */')
+    print('#if DSP_USE_Q15')
+    print('const uint32_t bee_fft_cmsis_table_bytes = %d;' % cmsis_q15_bytes(t))
+    print('#else')
+    print('const uint32_t bee_fft_cmsis_table_bytes = %d;' % cmsis_f32_bytes(t))
+    print('#endif')
+    print()
+    print('#if DSP_USE_Q15')
+
+    for n in SIZES:
+        # CMSIS walks its table 2 * modifier entries at a time
+        step = 2 * (CMSIS_SPLIT_POINTS // n)
+        a, b = [], []
+        for i in range(n // 2):
+            a += coef_a[i * step:i * step + 2]
+            b += coef_b[i * step:i * step + 2]
+
+        print()
+        print('#if FFT_LINKED_SIZES & FFT_SIZE_%d' % n)
+        print('const q15_t ALIGN4 bee_fft_coef_a_%d[%d] = {' % (n, n))
+        print(hexes(a))
+        print('};')
+        print('const q15_t ALIGN4 bee_fft_coef_b_%d[%d] = {' % (n, n))
+        print(hexes(b))
+        print('};')
+        print('#endif')
+
+    print()
+    print('#endif')
+
+
+if __name__ == '__main__':
+    main()
@@ -0,0 +1,152 @@
+#!/usr/bin/env python3
+"""
+Generates src/bee_mel_tables.c, the sparse mel filterbank of every capture
+profile rate and the DCT-II used to compute the MFCCs, so the firmware holds
+them in flash and computes nothing at boot.
+
+Tables are written for every FFT size the pipeline builds with, the one of
+DSP_FFT_POINTS is picked at compile time. Run it again whenever MEL_BANDS,
+MFCC_COEFFS or the capture profiles change:
+
+    python3 tools/gen_mel_tables.py > src/bee_mel_tables.c
+"""
+
+import argparse
+import math
+
+
+def hz_to_mel(hz):
+    return 2595.0 * math.log10(1.0 + hz / 700.0)
+
+
+def mel_to_hz(mel):
+    return 700.0 * (10.0 ** (mel / 2595.0) - 1.0)
+
+
+def filterbank(rate, fft, bands, fmin, fmax):
+    """unit peak triangles over the FFT bins, returns (start, weights) per band"""
+    fmax = min(fmax, rate / 2.0)
+    lo, hi = hz_to_mel(fmin), hz_to_mel(fmax)
+    edges = [mel_to_hz(lo + (hi - lo) * i / (bands + 1)) for i in range(bands + 2)]
+    width = rate / fft
+    out = []
+
+    for b in range(bands):
+        left, center, right = edges[b], edges[b + 1], edges[b + 2]
+        weights = []
+        for k in range(fft // 2):
+            f = k * width
+            if left < f <= center:
+                w = (f - left) / (center - left)
+            elif center < f < right:
+                w = (right - f) / (right - center)
+            else:
+                w = 0.0
+            weights.append(w)
+
+        nz = [k for k, w in enumerate(weights) if w > 0.0]
+        if not nz:
+            # narrower than a bin, the nearest bin stands for the band
+            k = min(int(round(center / width)), fft // 2 - 1)
+            out.append((k, [1.0]))
+        else:
+            out.append((nz[0], weights[nz[0]:nz[-1] + 1]))
+
+    return out
+
+
+def floats(values, per_line=6):
+    lines = []
+    for i in range(0, len(values), per_line):
+        lines.append('\t' + ', '.join('%.8ff' % v for v in values[i:i + per_line]) + ',')
+    return '\n'.join(lines)
+
+
+def ints(values, per_line=12):
+    lines = []
+    for i in range(0, len(values), per_line):
+        lines.append('\t' + ', '.join('%d' % v for v in values[i:i + per_line]) + ',')
+    return '\n'.join(lines)
+
+
+def main():
+    ap = argparse.ArgumentParser()
+    ap.add_argument('--fft', default='256,512,1024,2048')
+    ap.add_argument('--bands', type=int, default=24)
+    ap.add_argument('--coeffs', type=int, default=13)
+    ap.add_argument('--fmin', type=float, default=50.0)
+    ap.add_argument('--fmax', type=float, default=8000.0)
+    ap.add_argument('--rates', default='8000,16000,32000,48000')
+    args = ap.parse_args()
+    rates = [int(r) for r in args.rates.split(',')]
+    sizes = [int(n) for n in args.fft.split(',')]
+
+    print('/*')
+    print(' *  @file bee_mel_tables.c')
+    print(' *  @brief mel filterbank and DCT tables, generated by')
+    print(' *  tools/gen_mel_tables.py, do not edit')
+    print(' */')
+    print()
+    print('#include "lilbee.h"')
+    print()
+    print('#if (MEL_BANDS != %d) || (MFCC_COEFFS != %d) || (MEL_TABLES != %d)'
+          % (args.bands, args.coeffs, len(rates)))
+    print('#error "mel tables must be generated again, see tools/gen_mel_tables.py"')
+    print('#endif')
+    print()
+
+    for i, fft in enumerate(sizes):
+        print('#%s DSP_FFT_POINTS == %d' % ('if' if i == 0 else 'elif', fft))
+        print()
+
+        for rate in rates:
+            bank = filterbank(rate, fft, args.bands, args.fmin, args.fmax)
+            offset, offsets, weights = 0, [], []
+            for start, w in bank:
+                offsets.append(offset)
+                weights.extend(w)
+                offset += len(w)
+            assert max(len(w) for _, w in bank) < 256 and offset < 65536
+
+            print('/* %d Hz, %.0f to %.0f Hz */' % (rate, args.fmin, min(args.fmax, rate / 2.0)))
+            print('static const uint16_t mel_start_%d[MEL_BANDS] = {' % rate)
+            print(ints([s for s, _ in bank]))
+            print('};')
+            print('static const uint8_t mel_len_%d[MEL_BANDS] = {' % rate)
+            print(ints([len(w) for _, w in bank]))
+            print('};')
+            print('static const uint16_t mel_offset_%d[MEL_BANDS] = {' % rate)
+            print(ints(offsets))
+            print('};')
+            print('static const float mel_weights_%d[%d] = {' % (rate, len(weights)))
+            print(floats(weights))
+            print('};')
+            print()
+
+    print('#else')
+    print('#error "mel tables must be generated again, see tools/gen_mel_tables.py"')
+    print('#endif')
+    print()
+
+    print('const bee_mel_table_t bee_mel_tables[MEL_TABLES] = {')
+    for rate in rates:
+        print('\t{ %d, mel_start_%d, mel_len_%d, mel_offset_%d, mel_weights_%d },'
+              % (rate, rate, rate, rate, rate))
+    print('};')
+    print()
+
+    # orthonormal DCT-II, row k holds the basis of coefficient k
+    n = args.bands
+    dct = []
+    for k in range(args.coeffs):
+        scale = math.sqrt((1.0 if k == 0 else 2.0) / n)
+        dct.extend(scale * math.cos(math.pi * k * (i + 0.5) / n) for i in range(n))
+
+    print('/* orthonormal DCT-II, MFCC_COEFFS rows of MEL_BANDS */')
+    print('const float bee_mfcc_dct[MFCC_COEFFS * MEL_BANDS] = {')
+    print(floats(dct))
+    print('};')
+
+
+if __name__ == '__main__':
+    main()
@@ -0,0 +1,153 @@
+#!/usr/bin/env python3
+"""
+Quantizes a float hive state model to the int8 blob read by
+src/bee_classifier.c, as a C source with the default model or as a raw
+binary blob.
+
+The model is a JSON file with the feature standardization and one or two
+dense layers, the hidden one followed by a ReLU:
+
+    {
+        "mean": [...], "std": [...],
+        "hidden_max": 6.0,
+        "layers": [ { "weights": [[...], ...], "bias": [...] }, ... ]
+    }
+
+weights are [outputs][inputs], the last layer has one output per hive state
+(normal, queenless, pre-swarm, agitated) and hidden_max is the largest
+hidden activation expected on the training set.
+
+    python3 tools/gen_model_blob.py model.json -o model.bin
+    python3 tools/gen_model_blob.py model.json -c > src/bee_model_default.c
+    python3 tools/gen_model_blob.py --placeholder 18 -c > src/bee_model_default.c
+"""
+
+import argparse
+import json
+import math
+import struct
+import sys
+
+MAGIC = 0x4D454542
+VERSION = 1
+CLASSES = 4
+
+# standardized features are quantized at 32 steps per deviation, +/- 4 sigma
+INPUT_STEPS = 32.0
+
+
+def placeholder(inputs):
+    """untrained model, always answers normal with a low confidence"""
+    return {
+        'mean': [0.0] * inputs,
+        'std': [1.0] * inputs,
+        'layers': [{
+            'weights': [[0.0] * inputs for _ in range(CLASSES)],
+            'bias': [1.0, 0.0, 0.0, 0.0],
+        }],
+    }
+
+
+def quantize_weights(weights):
+    peak = max(abs(w) for row in weights for w in row)
+    scale = 127.0 / peak if peak > 0.0 else 1.0
+    q = [[max(-128, min(127, int(round(w * scale)))) for w in row] for row in weights]
+    return q, scale
+
+
+def multiplier_shift(m):
+    """m = multiplier / 2^(31 + shift) with multiplier on [2^30, 2^31)"""
+    frac, exp = math.frexp(m)
+    mult = int(round(frac * (1 << 31)))
+    if mult == (1 << 31):
+        mult //= 2
+        exp += 1
+    return mult, -exp
+
+
+def build(model):
+    layers = model['layers']
+    inputs = len(model['mean'])
+    if not 1 <= len(layers) <= 2 or len(layers[-1]['bias']) != CLASSES:
+        raise ValueError('one or two layers, the last one with %d outputs' % CLASSES)
+
+    body = b''
+    body += struct.pack('<%df' % inputs, *model['mean'])
+    body += struct.pack('<%df' % inputs, *[INPUT_STEPS / s for s in model['std']])
+
+    in_scale = INPUT_STEPS
+    hidden = len(layers[0]['bias']) if len(layers) > 1 else 0
+    output_scale = 1.0
+
+    for n, layer in enumerate(layers):
+        wq, w_scale = quantize_weights(layer['weights'])
+        acc_scale = w_scale * in_scale
+        bias = [int(round(b * acc_scale)) for b in layer['bias']]
+
+        if n < len(layers) - 1:
+            out_scale = 127.0 / model.get('hidden_max', 6.0)
+            mult, shift = multiplier_shift(out_scale / acc_scale)
+            in_scale = out_scale
+        else:
+            mult, shift = 0, 0
+            output_scale = 1.0 / acc_scale
+
+        flat = [w for row in wq for w in row]
+        flat += [0] * (-len(flat) % 4)
+        body += struct.pack('<ii', mult, shift)
+        body += struct.pack('<%di' % len(bias), *bias)
+        body += struct.pack('<%db' % len(flat), *flat)
+
+    header_len = 28
+    header = struct.pack('<IHHHHHHfII', MAGIC, VERSION, len(layers), inputs, hidden,
+                         CLASSES, 0, output_scale, header_len + len(body),
+                         sum(body) & 0xFFFFFFFF)
+    assert len(header) == header_len
+    return header + body
+
+
+def c_source(blob, origin):
+    out = ['/*',
+           ' *  @file bee_model_default.c',
+           ' *  @brief default hive state model, generated by',
+           ' *  tools/gen_model_blob.py from %s, do not edit' % origin,
+           ' */',
+           '',
+           '#include "lilbee.h"',
+           '',
+           'const uint8_t bee_model_default[] __attribute__((aligned(4))) = {']
+    for i in range(0, len(blob), 12):
+        out.append('\t' + ', '.join('0x%02x' % b for b in blob[i:i + 12]) + ',')
+    out += ['};',
+            '',
+            'const uint32_t bee_model_default_size = sizeof(bee_model_default);',
+            '']
+    return '\n'.join(out)
+
+
+def main():
+    ap = argparse.ArgumentParser()
+    ap.add_argument('model', nargs='?')
+    ap.add_argument('--placeholder', type=int, metavar='INPUTS')
+    ap.add_argument('-c', action='store_true', help='write the C default model')
+    ap.add_argument('-o', help='write the binary blob to a file')
+    args = ap.parse_args()
+
+    if args.placeholder:
+        model, origin = placeholder(args.placeholder), 'an untrained placeholder'
+    elif args.model:
+        with open(args.model) as f:
+            model, origin = json.load(f), args.model
+    else:
+        ap.error('a model or --placeholder is needed')
+
+    blob = build(model)
+    if args.o:
+        with open(args.o, 'wb') as f:
+            f.write(blob)
+    if args.c or not args.o:
+        sys.stdout.write(c_source(blob, origin))
+
+
+if __name__ == '__main__':
+    main()
@@ -0,0 +1,157 @@
+/*
+ *  @file host_bsp.c
+ *  @brief stand ins of the SoC, HAL and audio BSP the application modules
+ *  use, so the capture and dsp build on a PC and are fed from WAV files
+ */
+
+#include "lilbee.h"
+#include <time.h>
+#include "../Drivers/BSP/SensorTile/SensorTile_audio_in_pcm.h"
+
+/* volume the capture runs at, the one of the BSP */
+#define HOST_AUDIO_VOLUME		64
+
+/* DFSDM output a PCM sample maps to at that volume, undone by the kernel */
+#define HOST_DFSDM_SHIFT		9
+
+/* channels the kernel state is kept for, the MAX_CH_NUMBER of the BSP */
+#define HOST_MAX_CHANNELS		4
+
+
+/** internal variables */
+uint32_t SystemCoreClock = HOST_CORE_CLOCK_HZ;
+
+static host_dwt_t dwt;
+static uint32_t tick_ms = 0;
+
+static uint32_t audio_rate = 0;
+static uint32_t audio_channels = 0;
+static bool audio_recording = false;
+static uint16_t *pcm_data = NULL;
+static uint32_t pcm_stride = 0;
+static uint32_t half = 0;
+static int32_t rec_buff[HOST_MAX_CHANNELS][AUDIO_BLOCK_SIZE];
+static HP_FilterState_TypeDef filters[HOST_MAX_CHANNELS];
+static SENSORTILE_AudioIn_LevelTypeDef levels[HOST_MAX_CHANNELS];
+
+/** public functions */
+
+host_dwt_t *host_dwt_read(void)
+{
+	struct timespec now;
+	uint64_t ns;
+
+	clock_gettime(CLOCK_MONOTONIC, &now);
+	ns = (uint64_t)now.tv_sec * 1000000000ULL + (uint64_t)now.tv_nsec;
+
+	/* wraps as the 32 bit counter of the node does */
+	dwt.CYCCNT = (uint32_t)((ns * (SystemCoreClock / 1000000)) / 1000);
+	return(&dwt);
+}
+
+uint32_t HAL_GetTick(void)
+{
+	return(tick_ms);
+}
+
+uint8_t BSP_AUDIO_IN_InitEx(uint32_t AudioFreq, uint32_t ChnlNbr,
+		const SENSORTILE_AudioIn_DecimationTypeDef *Decimation)
+{
+	if(Decimation == NULL || ChnlNbr == 0 || ChnlNbr > AUDIO_CHANNELS ||
+			AudioFreq % AUDIO_WINDOW_LEN)
+		return(AUDIO_ERROR);
+
+	audio_rate = AudioFreq;
+	audio_channels = ChnlNbr;
+	memset(filters, 0, sizeof(filters));
+	return(AUDIO_OK);
+}
+
+uint8_t BSP_AUDIO_IN_DeInit(void)
+{
+	audio_recording = false;
+	audio_rate = 0;
+	return(AUDIO_OK);
+}
+
+uint8_t BSP_AUDIO_IN_Record(uint16_t *pbuf, uint32_t size)
+{
+	(void)size;
+
+	if(pbuf == NULL || audio_rate == 0)
+		return(AUDIO_ERROR);
+
+	pcm_data = pbuf;
+	pcm_stride = 0;
+	half = 0;
+	audio_recording = true;
+	return(AUDIO_OK);
+}
+
+uint8_t BSP_AUDIO_IN_SetPlanarBuffer(uint16_t *pbuf, uint32_t ChannelStride)
+{
+	if(pbuf == NULL)
+		return(AUDIO_ERROR);
+
+	pcm_data = pbuf;
+	pcm_stride = ChannelStride;
+	return(AUDIO_OK);
+}
+
+uint8_t BSP_AUDIO_IN_Stop(void)
+{
+	audio_recording = false;
+	return(AUDIO_OK);
+}
+
+uint8_t BSP_AUDIO_IN_GetLevel(uint32_t Channel, SENSORTILE_AudioIn_LevelTypeDef *Level)
+{
+	if(Level == NULL || Channel >= audio_channels)
+		return(AUDIO_ERROR);
+
+	*Level = levels[Channel];
+	return(AUDIO_OK);
+}
+
+uint32_t host_bsp_block_size(void)
+{
+	return((audio_recording) ? audio_rate / AUDIO_WINDOW_LEN : 0);
+}
+
+uint8_t host_bsp_push(const int16_t *pcm, uint32_t channels)
+{
+	uint32_t block = host_bsp_block_size();
+
+	if(block == 0 || pcm == NULL || channels == 0)
+		return(AUDIO_ERROR);
+
+	for(uint32_t ch = 0; ch < audio_channels; ch++) {
+		for(uint32_t i = 0; i < block; i++)
+			rec_buff[ch][i] = (int32_t)pcm[i * channels + ((ch < channels) ? ch : channels - 1)] *
+					(1 << HOST_DFSDM_SHIFT);
+	}
+
+	/* same split as DFSDMx_ProcessBlock() */
+	if(pcm_stride) {
+		for(uint32_t ch = 0; ch < audio_channels; ch++)
+			PCM_HPFilterMono(rec_buff[ch], pcm_data + ch * pcm_stride, block, HOST_AUDIO_VOLUME,
+					&filters[ch], &levels[ch]);
+	} else if(audio_channels == 1) {
+		PCM_HPFilterMono(rec_buff[0], pcm_data, block, HOST_AUDIO_VOLUME, &filters[0], &levels[0]);
+	} else {
+		for(uint32_t ch = 0; ch + 1 < audio_channels; ch += 2)
+			PCM_HPFilterPair(rec_buff[ch], rec_buff[ch + 1], pcm_data + ch, audio_channels, block,
+					HOST_AUDIO_VOLUME, &filters[ch], &levels[ch]);
+	}
+
+	tick_ms++;
+
+	/* halves alternate as on the circular DMA */
+	half ^= 1;
+	if(half)
+		BSP_AUDIO_IN_HalfTransfer_CallBack();
+	else
+		BSP_AUDIO_IN_TransferComplete_CallBack();
+
+	return(AUDIO_OK);
+}
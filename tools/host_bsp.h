@@ -0,0 +1,159 @@
+/*
+ *  @file host_bsp.h
+ *  @brief stand ins of the SoC, HAL and audio BSP the application modules
+ *  use, so the capture and dsp build on a PC and are fed from WAV files,
+ *  included after the CMSIS headers
+ */
+
+#ifndef __HOST_BSP_H
+#define __HOST_BSP_H
+
+/* core clock the DWT counter is scaled to, the one of the node */
+#define HOST_CORE_CLOCK_HZ		80000000
+
+/** audio BSP */
+#define AUDIO_OK				((uint8_t)0)
+#define AUDIO_ERROR				((uint8_t)1)
+
+#define AUDIO_FREQUENCY_48K		((uint32_t)48000)
+#define AUDIO_FREQUENCY_32K		((uint32_t)32000)
+#define AUDIO_FREQUENCY_16K		((uint32_t)16000)
+#define AUDIO_FREQUENCY_8K		((uint32_t)8000)
+
+#define DFSDM_FILTER_SINC3_ORDER	((uint32_t)0x60000000)
+#define DFSDM_FILTER_SINC4_ORDER	((uint32_t)0x80000000)
+#define DFSDM_FILTER_SINC5_ORDER	((uint32_t)0xA0000000)
+
+/** DFSDM decimation setup of one capture rate, unused by the host */
+typedef struct {
+	uint32_t ClockDivider;
+	uint32_t Oversampling;
+	uint32_t SincOrder;
+	uint32_t RightBitShift;
+}SENSORTILE_AudioIn_DecimationTypeDef;
+
+/** state of the DC removal filter of a channel */
+typedef struct {
+	int32_t Z;
+	int32_t oldOut;
+	int32_t oldIn;
+}HP_FilterState_TypeDef;
+
+/** level of one converted block of a channel */
+typedef struct {
+	uint64_t Energy;
+	uint32_t Peak;
+}SENSORTILE_AudioIn_LevelTypeDef;
+
+/** DWT cycle counter, reads follow the host clock at the node core clock */
+typedef struct {
+	uint32_t CYCCNT;
+}host_dwt_t;
+
+#define DWT						(host_dwt_read())
+
+extern uint32_t SystemCoreClock;
+
+/** interrupts, the replay runs the DMA callbacks from the main loop, the
+ * CMSIS core versions are ARM assembly so they are renamed away, a build
+ * defining HOST_IRQ_SIGNAL runs them from that signal instead and masking
+ * it stands for PRIMASK, so the critical sections hold against them
+ */
+#ifdef HOST_IRQ_SIGNAL
+#include <signal.h>
+
+static inline uint32_t host_get_primask(void)
+{
+	sigset_t set;
+
+	sigprocmask(SIG_BLOCK, NULL, &set);
+	return(sigismember(&set, HOST_IRQ_SIGNAL) == 1);
+}
+
+static inline void host_set_primask(uint32_t primask)
+{
+	sigset_t set;
+
+	sigemptyset(&set);
+	sigaddset(&set, HOST_IRQ_SIGNAL);
+	sigprocmask((primask) ? SIG_BLOCK : SIG_UNBLOCK, &set, NULL);
+}
+
+#define __disable_irq()			host_set_primask(1)
+#define __enable_irq()			host_set_primask(0)
+#else
+static inline uint32_t host_get_primask(void)
+{
+	return(0);
+}
+
+static inline void host_set_primask(uint32_t primask)
+{
+	(void)primask;
+}
+
+#define __disable_irq()			host_irq()
+#define __enable_irq()			host_irq()
+#endif
+
+static inline void host_irq(void)
+{
+}
+
+#define __get_PRIMASK()			host_get_primask()
+#define __set_PRIMASK(x)		host_set_primask(x)
+#define __WFI()					host_irq()
+
+/**
+ * 	@fn host_dwt_read()
+ *  @brief updates the cycle counter from the host clock
+ *
+ *  @param
+ *  @return
+ */
+host_dwt_t *host_dwt_read(void);
+
+/**
+ * 	@fn HAL_GetTick()
+ *  @brief ms tick, advanced by the replayed audio so the runs repeat
+ *
+ *  @param
+ *  @return
+ */
+uint32_t HAL_GetTick(void);
+
+uint8_t BSP_AUDIO_IN_InitEx(uint32_t AudioFreq, uint32_t ChnlNbr,
+		const SENSORTILE_AudioIn_DecimationTypeDef *Decimation);
+uint8_t BSP_AUDIO_IN_DeInit(void);
+uint8_t BSP_AUDIO_IN_Record(uint16_t *pbuf, uint32_t size);
+uint8_t BSP_AUDIO_IN_SetPlanarBuffer(uint16_t *pbuf, uint32_t ChannelStride);
+uint8_t BSP_AUDIO_IN_Stop(void);
+uint8_t BSP_AUDIO_IN_GetLevel(uint32_t Channel, SENSORTILE_AudioIn_LevelTypeDef *Level);
+
+void BSP_AUDIO_IN_TransferComplete_CallBack(void);
+void BSP_AUDIO_IN_HalfTransfer_CallBack(void);
+
+/**
+ * 	@fn host_bsp_block_size()
+ *  @brief samples per channel of a DMA half transfer at the rate in use,
+ *         0 while not recording
+ *
+ *  @param
+ *  @return
+ */
+uint32_t host_bsp_block_size(void);
+
+/**
+ * 	@fn host_bsp_push()
+ *  @brief converts a block as the DFSDM would, the interleaved samples of
+ *         channels channels are scaled to the DFSDM output and run through
+ *         the PCM kernel of the BSP into the buffer set by the capture,
+ *         missing channels repeat the last one, then the DMA callback of
+ *         the half is run
+ *
+ *  @param pcm - host_bsp_block_size() frames
+ *  @return AUDIO_ERROR while not recording
+ */
+uint8_t host_bsp_push(const int16_t *pcm, uint32_t channels);
+
+#endif
@@ -0,0 +1,49 @@
+/*
+ *  @file host_cmsis.c
+ *  @brief C form of the CMSIS-DSP routines only shipped as ARM assembly,
+ *  for the host builds of the tools
+ */
+
+#include <stdint.h>
+
+
+/* bit reversal of arm_bitreversal2.S, the table holds byte offsets of
+ * the complex pairs to swap
+ */
+void arm_bitreversal_32(uint32_t *src, const uint16_t len, const uint16_t *table)
+{
+	uint32_t a;
+	uint32_t b;
+	uint32_t tmp;
+
+	for(uint32_t i = 0; i < len; i += 2) {
+		a = table[i] >> 2;
+		b = table[i + 1] >> 2;
+
+		tmp = src[a];
+		src[a] = src[b];
+		src[b] = tmp;
+		tmp = src[a + 1];
+		src[a + 1] = src[b + 1];
+		src[b + 1] = tmp;
+	}
+}
+
+void arm_bitreversal_16(uint16_t *src, const uint16_t len, const uint16_t *table)
+{
+	uint32_t a;
+	uint32_t b;
+	uint16_t tmp;
+
+	for(uint32_t i = 0; i < len; i += 2) {
+		a = table[i] >> 2;
+		b = table[i + 1] >> 2;
+
+		tmp = src[a];
+		src[a] = src[b];
+		src[b] = tmp;
+		tmp = src[a + 1];
+		src[a + 1] = src[b + 1];
+		src[b + 1] = tmp;
+	}
+}
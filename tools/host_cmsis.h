@@ -0,0 +1,27 @@
+/*
+ *  @file host_cmsis.h
+ *  @brief core intrinsics CMSIS-DSP needs when built for a PC, forced
+ *  ahead of every file of a host build with -include
+ */
+
+#ifndef __HOST_CMSIS_H
+#define __HOST_CMSIS_H
+
+#include <stdint.h>
+
+/* signed saturation to bits bits */
+static inline int32_t __SSAT(int32_t val, uint32_t bits)
+{
+	int32_t max = (int32_t)((1UL << (bits - 1)) - 1);
+	int32_t min = -max - 1;
+
+	return((val > max) ? max : (val < min) ? min : val);
+}
+
+/* leading zeros, 32 for 0 */
+static inline uint8_t __CLZ(uint32_t val)
+{
+	return((val == 0) ? 32 : (uint8_t)__builtin_clz(val));
+}
+
+#endif
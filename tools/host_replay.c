@@ -0,0 +1,757 @@
+/*
+ *  @file host_replay.c
+ *  @brief runs the node capture and dsp on a PC, WAV files are converted
+ *  block by block through the DMA callbacks of the capture and the events
+ *  are served as the main loop does, every report is written as csv with
+ *  the time each stage took, and can be checked against a golden csv
+ *
+ *  build:
+ *  D=Drivers/CMSIS/DSP/Source
+ *  cc -O2 -DBEE_HOST_BUILD -DBEE_HOST_PIPELINE -DARM_MATH_CM0 -include tools/host_cmsis.h \
+ *     -Isrc -Itools -IDrivers/CMSIS/Include -IDrivers/CMSIS/DSP/Include \
+ *     tools/host_replay.c tools/host_bsp.c tools/host_wav.c tools/host_cmsis.c \
+ *     src/event_queue.c src/bee_audio_acquisition.c src/bee_dsp.c src/bee_fastlog.c \
+ *     src/bee_fft.c src/bee_fft_tables.c src/bee_stft.c src/bee_goertzel.c src/bee_zoom.c \
+ *     src/bee_pitch.c src/bee_psd.c src/bee_noise.c src/bee_features.c src/bee_mel.c \
+ *     src/bee_mel_tables.c src/bee_classifier.c src/bee_model_default.c \
+ *     src/bee_trigger.c src/bee_baseline.c src/bee_spectrogram.c \
+ *     $(find $D -name '*.c') -lm -o host_replay
+ *
+ *  the build flags of the node apply, -DDSP_USE_Q15=1, -DFFT_POINTS=1024,
+ *  -DAUDIO_CHANNELS=2 and so on
+ *
+ *  usage:
+ *  host_replay [-m mode] [-b budget_us] [-a] [-k] [-r rate] [-s seconds] [-o reports.csv]
+ *              [-t timing.csv] [-g golden.csv] [-e tolerance] [-S spectra.csv]
+ *              [-C spectra.csv] [file.wav]
+ *
+ *  with no file a synthetic hive is replayed at rate, 16 kHz by default,
+ *  -a turns the energy gate off so every frame is analyzed,
+ *  reports go to stdout without -o, -g compares every report against a
+ *  csv written before by -o and fails on the first run that moved a value
+ *  further than tolerance, relative to 1 + |golden|, the summary gives the
+ *  longest dsp dispatch in host time, how the budget splits a frame and
+ *  not the HCI latency of the node, which the latency characteristic
+ *  reports, -b 0 runs every frame in a single dispatch, -k times the
+ *  spectrum against the tone banks of bee_dsp_benchmark() after the
+ *  replay, a host estimate in cycles of the node clock scaled from host
+ *  time, the node figures are the ones the firmware takes at boot, -S
+ *  writes the magnitudes of every reported spectrum and -C compares them
+ *  against the ones written by another build over the same input, so a
+ *  -DDSP_USE_Q15=1 build run with -C on the -S output of the float one
+ *  gives the error of the fixed point spectra next to the dsp time per
+ *  frame and the dsp RAM of each
+ */
+
+#include "lilbee.h"
+#include "host_wav.h"
+#include <stdio.h>
+#include <time.h>
+
+
+/* synthetic hive, hum with its harmonics breathing slowly, fanning tone
+ * and hiss bursts over a low noise floor
+ */
+#define REPLAY_RATE			16000
+#define REPLAY_SECONDS		30
+#define REPLAY_HUM_HZ		240.0f
+#define REPLAY_FAN_HZ		460.0f
+#define REPLAY_HISS_HZ		3000.0f
+#define REPLAY_HISS_EVERY	7
+#define REPLAY_HISS_LENGTH	2
+
+/* default golden tolerance, relative to 1 + |golden| */
+#define REPLAY_TOLERANCE	1e-4
+
+/* benchmark runs, the fastest one of each is kept */
+#define REPLAY_BENCH_RUNS	200
+
+/* longest csv line */
+#define REPLAY_LINE_LEN		2048
+
+/** internal types */
+typedef struct replay_timing {
+	uint32_t frame;
+	uint64_t dsp_ns;
+	uint32_t dispatches;
+	uint32_t channel_cycles[AUDIO_CHANNELS];
+	uint32_t pitch_cycles;
+	bool report;
+	uint32_t features_cycles;
+	uint32_t classifier_cycles;
+	bool done;
+}replay_timing_t;
+
+/** internal variables */
+static FILE *reports_csv = NULL;
+static FILE *timing_csv = NULL;
+static FILE *golden_csv = NULL;
+static double tolerance = REPLAY_TOLERANCE;
+static uint32_t rate = 0;
+
+static replay_timing_t timing;
+static bool timing_open = false;
+static uint32_t frames = 0;
+static uint32_t reports = 0;
+static uint64_t dsp_ns = 0;
+static uint64_t dsp_max_ns = 0;
+
+/* longest dispatch in host time, the node latency is only taken on the node */
+static uint64_t dispatch_max_ns = 0;
+
+static uint32_t golden_rows = 0;
+static uint32_t golden_fails = 0;
+static double golden_worst = 0.0;
+
+/* spectra written, and compared against the ones of another build */
+static FILE *spectra_csv = NULL;
+static FILE *reference_csv = NULL;
+static uint32_t reference_rows = 0;
+static bool reference_short = false;
+static double reference_signal = 0.0;
+static double reference_noise = 0.0;
+static double reference_worst = 0.0;
+
+/* lcg noise, the synthetic hive is the same on every host */
+static uint32_t replay_seed = 1;
+
+/** internal functions */
+
+/**
+ * 	@fn replay_noise()
+ *  @brief uniform noise in -1 to 1
+ *
+ *  @param
+ *  @return
+ */
+static float replay_noise(void)
+{
+	replay_seed = replay_seed * 1664525UL + 1013904223UL;
+	return((float)(int32_t)replay_seed / 2147483648.0f);
+}
+
+/**
+ * 	@fn replay_hive()
+ *  @brief synthetic mono hive, in 16 bit samples
+ *
+ *  @param
+ *  @return
+ */
+static void replay_hive(int16_t *x, uint32_t n, uint32_t sample_rate)
+{
+	const float hum[4] = { 0.08f, 0.04f, 0.025f, 0.015f };
+	float t;
+	float s;
+	float breath;
+
+	replay_seed = 1;
+	for(uint32_t i = 0; i < n; i++) {
+		t = (float)i / (float)sample_rate;
+		breath = 1.0f + 0.5f * sinf(2.0f * PI * 0.3f * t);
+
+		s = 0.0f;
+		for(uint32_t h = 0; h < 4; h++)
+			s += breath * hum[h] * sinf(2.0f * PI * REPLAY_HUM_HZ * (float)(h + 1) * t);
+
+		s += 0.02f * sinf(2.0f * PI * REPLAY_FAN_HZ * t);
+
+		if(((uint32_t)t % REPLAY_HISS_EVERY) < REPLAY_HISS_LENGTH &&
+				REPLAY_HISS_HZ < 0.45f * (float)sample_rate)
+			s += 0.05f * replay_noise() * sinf(2.0f * PI * REPLAY_HISS_HZ * t);
+
+		s += 0.002f * replay_noise();
+
+		x[i] = (int16_t)(s * 32767.0f);
+	}
+}
+
+/**
+ * 	@fn replay_ns()
+ *  @brief host monotonic clock
+ *
+ *  @param
+ *  @return
+ */
+static uint64_t replay_ns(void)
+{
+	struct timespec now;
+
+	clock_gettime(CLOCK_MONOTONIC, &now);
+	return((uint64_t)now.tv_sec * 1000000000ULL + (uint64_t)now.tv_nsec);
+}
+
+/**
+ * 	@fn replay_us()
+ *  @brief DWT cycles of the host counter to us
+ *
+ *  @param
+ *  @return
+ */
+static double replay_us(uint32_t cycles)
+{
+	return((double)cycles / (double)(SystemCoreClock / 1000000));
+}
+
+/**
+ * 	@fn replay_golden()
+ *  @brief compares a report line against the next golden one, values
+ *  are compared as numbers, anything else as text
+ *
+ *  @param
+ *  @return
+ */
+static void replay_golden(const char *line)
+{
+	char golden[REPLAY_LINE_LEN];
+	const char *a = line;
+	const char *b = golden;
+	char *end_a;
+	char *end_b;
+	double va;
+	double vb;
+	double err;
+	uint32_t field = 0;
+
+	if(golden_csv == NULL)
+		return;
+
+	golden_rows++;
+	if(fgets(golden, sizeof(golden), golden_csv) == NULL) {
+		if(golden_fails++ == 0)
+			fprintf(stderr, "golden: ends before row %u\n", golden_rows);
+		return;
+	}
+
+	while(*a && *a != '\n' && *b && *b != '\n') {
+		va = strtod(a, &end_a);
+		vb = strtod(b, &end_b);
+
+		if(end_a != a && end_b != b) {
+			err = fabs(va - vb) / (1.0 + fabs(vb));
+			if(err > golden_worst)
+				golden_worst = err;
+		} else {
+			end_a = strchr(a, ',');
+			end_b = strchr(b, ',');
+			end_a = (end_a) ? end_a : (char *)a + strcspn(a, "\n");
+			end_b = (end_b) ? end_b : (char *)b + strcspn(b, "\n");
+			err = (end_a - a != end_b - b || memcmp(a, b, end_a - a)) ? INFINITY : 0.0;
+		}
+
+		if(err > tolerance && golden_fails++ < 10) {
+			fprintf(stderr, "golden: row %u field %u is %.*s, was %.*s\n", golden_rows, field,
+					(int)(end_a - a), a, (int)(end_b - b), b);
+		}
+
+		a = end_a + (*end_a == ',');
+		b = end_b + (*end_b == ',');
+		field++;
+	}
+
+	if((*a && *a != '\n') != (*b && *b != '\n') && golden_fails++ < 10)
+		fprintf(stderr, "golden: row %u has another number of fields\n", golden_rows);
+}
+
+/**
+ * 	@fn replay_magnitude()
+ *  @brief magnitude of a bin of a published spectrum
+ *
+ *  @param
+ *  @return
+ */
+static double replay_magnitude(const bee_spectra_t *spectra, uint32_t bin)
+{
+#if DSP_LOG_SPECTRUM
+	return(pow(10.0, (double)spectra->level_cdb[bin] / 2000.0));
+#else
+	return((double)spectra->raw[bin]);
+#endif
+}
+
+/**
+ * 	@fn replay_spectrum()
+ *  @brief writes a reported spectrum and compares it against the next one
+ *  of the reference, the error of a bin is taken relative to the peak of
+ *  the reference spectrum
+ *
+ *  @param
+ *  @return
+ */
+static void replay_spectrum(const bee_spectra_t *spectra, uint32_t ch)
+{
+	double ref[DSP_SPECTRAL_BINS];
+	double peak = 0.0;
+	double err;
+	uint32_t report;
+	uint32_t channel;
+
+	if(spectra_csv) {
+		fprintf(spectra_csv, "%u,%u", reports, ch);
+		for(uint32_t i = 0; i < spectra->spectral_points; i++)
+			fprintf(spectra_csv, ",%.6g", replay_magnitude(spectra, i));
+		fputc('\n', spectra_csv);
+	}
+
+	if(reference_csv == NULL || reference_short)
+		return;
+
+	if(fscanf(reference_csv, "%u,%u", &report, &channel) != 2 || report != reports ||
+			channel != ch) {
+		reference_short = true;
+		return;
+	}
+
+	for(uint32_t i = 0; i < spectra->spectral_points; i++) {
+		if(fscanf(reference_csv, ",%lf", &ref[i]) != 1) {
+			reference_short = true;
+			return;
+		}
+
+		if(ref[i] > peak)
+			peak = ref[i];
+	}
+
+	for(uint32_t i = 0; i < spectra->spectral_points; i++) {
+		err = replay_magnitude(spectra, i) - ref[i];
+		reference_signal += ref[i] * ref[i];
+		reference_noise += err * err;
+
+		if(peak > 0.0 && fabs(err) / peak > reference_worst)
+			reference_worst = fabs(err) / peak;
+	}
+
+	reference_rows++;
+}
+
+/**
+ * 	@fn replay_write()
+ *  @brief writes a report line and checks it against the golden one
+ *
+ *  @param
+ *  @return
+ */
+static void replay_write(const char *line)
+{
+	fputs(line, reports_csv);
+	replay_golden(line);
+}
+
+/**
+ * 	@fn replay_header()
+ *  @brief columns of the report csv
+ *
+ *  @param
+ *  @return
+ */
+static void replay_header(void)
+{
+	char line[REPLAY_LINE_LEN];
+	int len;
+
+	len = snprintf(line, sizeof(line), "report,channel,time_s,stale,rms,peak,aggro,"
+			"total_energy,centroid_hz,rolloff_hz,flatness,flux");
+	for(uint32_t b = 0; b < FEATURES_MAX_BANDS; b++)
+		len += snprintf(line + len, sizeof(line) - len, ",band%u_energy,band%u_ratio,"
+				"band%u_peak_hz", b, b, b);
+	for(uint32_t c = 0; c < MFCC_COEFFS; c++)
+		len += snprintf(line + len, sizeof(line) - len, ",mfcc%u", c);
+	snprintf(line + len, sizeof(line) - len, ",state,confidence,f0_hz,pitch_confidence,"
+			"snr_db,spectrum_sum\n");
+
+	replay_write(line);
+
+	if(timing_csv) {
+		fprintf(timing_csv, "frame,time_s,dispatches,dsp_us");
+		for(uint32_t ch = 0; ch < AUDIO_CHANNELS; ch++)
+			fprintf(timing_csv, ",channel%u_us", ch);
+		fprintf(timing_csv, ",pitch_us,report,features_us,classifier_us\n");
+	}
+}
+
+/**
+ * 	@fn replay_report()
+ *  @brief writes the report of every channel
+ *
+ *  @param
+ *  @return
+ */
+static void replay_report(void)
+{
+	static bee_spectra_t spectra;
+	char line[REPLAY_LINE_LEN];
+	bee_features_t features;
+	bee_mel_t mel;
+	bee_hive_result_t hive;
+	bee_pitch_result_t pitch;
+	bee_noise_report_t noise;
+	double sum = 0.0;
+	int len;
+
+	for(uint32_t ch = 0; ch < AUDIO_CHANNELS; ch++) {
+		bee_dsp_get_spectra(ch, &spectra);
+		bee_dsp_get_features(ch, &features);
+		bee_dsp_get_mel(ch, &mel);
+		bee_dsp_get_hive_state(ch, &hive);
+		bee_dsp_get_pitch(ch, &pitch);
+		bee_dsp_get_noise(ch, &noise);
+
+		for(uint32_t i = 0; i < spectra.spectral_points; i++) {
+#if DSP_LOG_SPECTRUM
+			sum += (double)spectra.level_cdb[i] / 100.0;
+#else
+			sum += spectra.raw[i];
+#endif
+		}
+
+		len = snprintf(line, sizeof(line), "%u,%u,%.6f,%u,%.6g,%.6g,%.6g,%.6g,%.6g,%.6g,%.6g,%.6g",
+				reports, ch, (double)spectra.sample_index / (double)rate, spectra.stale,
+				spectra.rms, spectra.peak, bee_dsp_get_channel_aggro_level(ch),
+				features.total_energy, features.shape.centroid_hz, features.shape.rolloff_hz,
+				features.shape.flatness, features.shape.flux);
+		for(uint32_t b = 0; b < FEATURES_MAX_BANDS; b++)
+			len += snprintf(line + len, sizeof(line) - len, ",%.6g,%.6g,%.6g",
+					features.band[b].energy, features.band[b].ratio, features.band[b].peak_hz);
+		for(uint32_t c = 0; c < MFCC_COEFFS; c++)
+			len += snprintf(line + len, sizeof(line) - len, ",%.6g", (mel.valid) ? mel.mfcc[c] : 0.0f);
+		snprintf(line + len, sizeof(line) - len, ",%d,%.6g,%.6g,%.6g,%.6g,%.6g\n",
+				(hive.valid) ? (int)hive.state : -1, hive.confidence,
+				(pitch.stale) ? 0.0f : pitch.f0_hz, (pitch.stale) ? 0.0f : pitch.confidence,
+				noise.snr_db, sum);
+
+		replay_write(line);
+		replay_spectrum(&spectra, ch);
+	}
+
+	reports++;
+}
+
+/**
+ * 	@fn replay_flush_timing()
+ *  @brief writes the timing of the last analyzed frame
+ *
+ *  @param
+ *  @return
+ */
+static void replay_flush_timing(void)
+{
+	if(!timing_open)
+		return;
+
+	timing_open = false;
+	if(timing_csv == NULL)
+		return;
+
+	fprintf(timing_csv, "%u,%.6f,%u,%.3f", timing.frame, (double)timing.frame *
+			(double)audio_get_profile()->frame_size / (double)rate, timing.dispatches,
+			(double)timing.dsp_ns / 1000.0);
+	for(uint32_t ch = 0; ch < AUDIO_CHANNELS; ch++)
+		fprintf(timing_csv, ",%.3f", replay_us(timing.channel_cycles[ch]));
+	fprintf(timing_csv, ",%.3f,%u", replay_us(timing.pitch_cycles), timing.report);
+
+	if(timing.report)
+		fprintf(timing_csv, ",%.3f,%.3f\n", replay_us(timing.features_cycles),
+				replay_us(timing.classifier_cycles));
+	else
+		fprintf(timing_csv, ",,\n");
+}
+
+/**
+ * 	@fn replay_dispatch()
+ *  @brief serves the pending events as the main loop does, the dsp time
+ *  of a frame is summed over its dispatches
+ *
+ *  @param
+ *  @return
+ */
+static void replay_dispatch(void)
+{
+	bee_dsp_stats_t stats;
+	system_event_t ev;
+	uint64_t start;
+	uint64_t spent;
+
+	while((ev = event_queue_get()) != k_noevent) {
+		/* a frame waiting for the analysis of another one starts later */
+		if(ev == k_dsp_incoming_audio_available && (!timing_open || timing.done)) {
+			replay_flush_timing();
+			memset(&timing, 0, sizeof(timing));
+			timing.frame = frames++;
+			timing_open = true;
+		}
+
+		audio_handler(ev);
+
+		start = replay_ns();
+		bee_dsp_handler(ev);
+		spent = replay_ns() - start;
+
+		bee_trigger_handler(ev);
+		bee_baseline_handler(ev);
+		bee_spectrogram_handler(ev);
+
+		if(ev == k_dsp_incoming_audio_available || ev == k_dsp_stage_continue) {
+			timing.dsp_ns += spent;
+			timing.dispatches++;
+			if(spent > dispatch_max_ns)
+				dispatch_max_ns = spent;
+		}
+
+		if(ev == k_dsp_endprocess && timing_open && !timing.done) {
+			bee_dsp_get_stats(&stats);
+			memcpy(timing.channel_cycles, stats.channel_cycles, sizeof(timing.channel_cycles));
+			timing.pitch_cycles = stats.pitch_cycles;
+			timing.done = true;
+
+			dsp_ns += timing.dsp_ns;
+			if(timing.dsp_ns > dsp_max_ns)
+				dsp_max_ns = timing.dsp_ns;
+		}
+
+		if(ev == k_aggresivity_available) {
+			bee_dsp_get_stats(&stats);
+			timing.report = true;
+			timing.features_cycles = stats.features_cycles;
+			timing.classifier_cycles = stats.classifier_cycles;
+			replay_report();
+		}
+	}
+}
+
+/**
+ * 	@fn replay_benchmark()
+ *  @brief times the spectrum against the tone banks at the replay rate
+ *
+ *  @param
+ *  @return
+ */
+static int replay_benchmark(void)
+{
+	bee_dsp_bench_t best;
+	bee_dsp_bench_t bench;
+
+	memset(&best, 0xFF, sizeof(best));
+
+	for(uint32_t run = 0; run < REPLAY_BENCH_RUNS; run++) {
+		if(bee_dsp_benchmark(&bench) != k_bee_ret_ok) {
+			fprintf(stderr, "benchmark: dsp busy or not started\n");
+			return(1);
+		}
+
+		if(bench.spectrum_cycles < best.spectrum_cycles)
+			best.spectrum_cycles = bench.spectrum_cycles;
+		for(uint32_t set = 0; set < DSP_BENCH_TONE_SETS; set++) {
+			if(bench.tone_cycles[set] < best.tone_cycles[set])
+				best.tone_cycles[set] = bench.tone_cycles[set];
+		}
+	}
+
+	fprintf(stderr, "benchmark host estimate, host time scaled to node cycles, at %u Hz, "
+			"%u samples, spectrum %u cycles\n",
+			bee_dsp_get_sample_rate(), bench.samples, best.spectrum_cycles);
+	for(uint32_t set = 0; set < DSP_BENCH_TONE_SETS; set++) {
+		fprintf(stderr, "%2u tones %u cycles, %.2f of the spectrum\n", bench.tones[set],
+				best.tone_cycles[set], (double)best.tone_cycles[set] /
+				(double)((best.spectrum_cycles) ? best.spectrum_cycles : 1));
+	}
+
+	return(0);
+}
+
+/**
+ * 	@fn replay_run()
+ *  @brief starts the capture at the rate of the samples and converts them
+ *  block by block, the last partial block is dropped
+ *
+ *  @param
+ *  @return
+ */
+static int replay_run(const int16_t *pcm, uint32_t n, uint32_t channels)
+{
+	char extra[REPLAY_LINE_LEN];
+	audio_stats_t audio;
+	bee_dsp_stats_t stats;
+	uint32_t block;
+	uint32_t id;
+	uint64_t start;
+	double seconds;
+
+	for(id = 0; id < k_audio_max_profiles; id++) {
+		if(audio_set_profile((audio_profile_id_t)id) == k_bee_ret_ok &&
+				audio_get_profile()->sample_rate == rate)
+			break;
+	}
+
+	if(id == k_audio_max_profiles) {
+		fprintf(stderr, "no capture profile at %u Hz\n", rate);
+		return(1);
+	}
+
+	replay_header();
+	audio_start_capture();
+	replay_dispatch();
+
+	start = replay_ns();
+	block = host_bsp_block_size();
+	for(uint32_t i = 0; i + block <= n; i += block) {
+		host_bsp_push(&pcm[i * channels], channels);
+		replay_dispatch();
+	}
+
+	audio_stop_capture();
+	replay_dispatch();
+	replay_flush_timing();
+
+	seconds = (double)(replay_ns() - start) / 1e9;
+	audio_get_stats(&audio);
+	fprintf(stderr, "%u Hz, %u channels, %.1f s replayed in %.2f s, %u frames, %u overruns, "
+			"%u reports, host dsp %.1f us per frame, %.1f us worst, %.1f us longest dispatch\n",
+			rate, channels, (double)n / (double)rate, seconds, frames, audio.overruns, reports,
+			(frames) ? (double)dsp_ns / frames / 1000.0 : 0.0, (double)dsp_max_ns / 1000.0,
+			(double)dispatch_max_ns / 1000.0);
+
+	bee_dsp_get_stats(&stats);
+	fprintf(stderr, "dsp ram %u bytes per channel, %u shared, fft tables %u bytes of flash, "
+			"%u less than the CMSIS init\n", stats.channel_bytes, stats.shared_bytes,
+			bee_fft_get_table_bytes(), bee_fft_cmsis_table_bytes - bee_fft_get_table_bytes());
+
+	if(reference_csv) {
+		fprintf(stderr, "spectra: %u compared%s, snr %.1f dB, worst bin error %.1f dB under "
+				"the peak\n", reference_rows, (reference_short) ? ", reference ends early" : "",
+				10.0 * log10(reference_signal / ((reference_noise > 0.0) ? reference_noise : 1e-300)),
+				-20.0 * log10((reference_worst > 0.0) ? reference_worst : 1e-15));
+	}
+
+	if(golden_csv == NULL)
+		return(0);
+
+	/* a shorter run leaves golden rows behind */
+	if(fgets(extra, sizeof(extra), golden_csv) != NULL && golden_fails++ == 0)
+		fprintf(stderr, "golden: has more than %u rows\n", golden_rows);
+
+	fprintf(stderr, "golden: %u rows, %u values off, worst relative error %.3g\n",
+			golden_rows, golden_fails, golden_worst);
+	return((golden_fails) ? 2 : 0);
+}
+
+int main(int argc, char **argv)
+{
+	const char *wav = NULL;
+	int16_t *pcm = NULL;
+	uint32_t channels = 1;
+	uint32_t seconds = REPLAY_SECONDS;
+	uint32_t budget = DSP_STAGE_BUDGET_US;
+	dsp_mode_t mode = k_dsp_mode_spectrum;
+	bee_dsp_gate_t gate = {
+		.enabled = true,
+		.min_rms = DSP_GATE_MIN_RMS,
+		.floor_ratio = DSP_GATE_FLOOR_RATIO,
+		.stable_ratio = DSP_GATE_STABLE_RATIO,
+		.max_skips = DSP_GATE_MAX_SKIPS,
+	};
+	bool benchmark = false;
+	uint32_t n;
+	int ret;
+
+	reports_csv = stdout;
+	rate = REPLAY_RATE;
+
+	for(int i = 1; i < argc; i++) {
+		if(!strcmp(argv[i], "-m") && i + 1 < argc) {
+			mode = (dsp_mode_t)atoi(argv[++i]);
+		} else if(!strcmp(argv[i], "-b") && i + 1 < argc) {
+			budget = atoi(argv[++i]);
+		} else if(!strcmp(argv[i], "-a")) {
+			gate.enabled = false;
+		} else if(!strcmp(argv[i], "-k")) {
+			benchmark = true;
+		} else if(!strcmp(argv[i], "-r") && i + 1 < argc) {
+			rate = atoi(argv[++i]);
+		} else if(!strcmp(argv[i], "-s") && i + 1 < argc) {
+			seconds = atoi(argv[++i]);
+		} else if(!strcmp(argv[i], "-o") && i + 1 < argc) {
+			reports_csv = fopen(argv[++i], "w");
+		} else if(!strcmp(argv[i], "-t") && i + 1 < argc) {
+			timing_csv = fopen(argv[++i], "w");
+		} else if(!strcmp(argv[i], "-g") && i + 1 < argc) {
+			golden_csv = fopen(argv[++i], "r");
+			if(golden_csv == NULL) {
+				fprintf(stderr, "cannot read %s\n", argv[i]);
+				return(1);
+			}
+		} else if(!strcmp(argv[i], "-e") && i + 1 < argc) {
+			tolerance = strtod(argv[++i], NULL);
+		} else if(!strcmp(argv[i], "-S") && i + 1 < argc) {
+			spectra_csv = fopen(argv[++i], "w");
+			if(spectra_csv == NULL) {
+				fprintf(stderr, "cannot write %s\n", argv[i]);
+				return(1);
+			}
+		} else if(!strcmp(argv[i], "-C") && i + 1 < argc) {
+			reference_csv = fopen(argv[++i], "r");
+			if(reference_csv == NULL) {
+				fprintf(stderr, "cannot read %s\n", argv[i]);
+				return(1);
+			}
+		} else if(argv[i][0] != '-' && wav == NULL) {
+			wav = argv[i];
+		} else {
+			fprintf(stderr, "usage: %s [-m mode] [-b budget_us] [-a] [-k] [-r rate] [-s seconds] "
+					"[-o reports.csv] [-t timing.csv] [-g golden.csv] [-e tolerance] "
+					"[-S spectra.csv] [-C spectra.csv] [file.wav]\n", argv[0]);
+			return(1);
+		}
+	}
+
+	if(reports_csv == NULL) {
+		fprintf(stderr, "cannot write the reports\n");
+		return(1);
+	}
+
+	if(wav) {
+		n = host_wav_read(wav, &pcm, &rate, &channels);
+		if(n == 0) {
+			fprintf(stderr, "%s: not a 16 bit PCM WAV file\n", wav);
+			return(1);
+		}
+	} else {
+		n = rate * seconds;
+		pcm = malloc(n * sizeof(int16_t));
+		if(pcm == NULL)
+			return(1);
+
+		replay_hive(pcm, n, rate);
+	}
+
+	/* boots as the node does */
+	audio_acq_init();
+	bee_classifier_init();
+	bee_dsp_init(audio_get_profile()->sample_rate);
+	bee_trigger_init();
+	bee_baseline_init();
+	bee_spectrogram_init();
+
+	if(bee_dsp_set_mode(mode) != k_bee_ret_ok || bee_dsp_set_budget(budget) != k_bee_ret_ok ||
+			bee_dsp_set_gate(&gate) != k_bee_ret_ok) {
+		fprintf(stderr, "invalid mode or budget\n");
+		free(pcm);
+		return(1);
+	}
+
+	ret = replay_run(pcm, n, channels);
+	if(ret == 0 && benchmark)
+		ret = replay_benchmark();
+
+	free(pcm);
+	if(reports_csv != stdout)
+		fclose(reports_csv);
+	if(timing_csv)
+		fclose(timing_csv);
+	if(golden_csv)
+		fclose(golden_csv);
+	if(spectra_csv)
+		fclose(spectra_csv);
+	if(reference_csv)
+		fclose(reference_csv);
+
+	return(ret);
+}
@@ -0,0 +1,64 @@
+/*
+ *  @file host_wav.c
+ *  @brief 16 bit PCM WAV reader shared by the host tools
+ */
+
+#include <stdio.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+#include "host_wav.h"
+
+
+/** public functions */
+
+uint32_t host_wav_read(const char *path, int16_t **out, uint32_t *rate, uint32_t *channels)
+{
+	uint8_t hdr[8];
+	uint8_t fmt[16];
+	uint32_t size;
+	uint32_t bits = 0;
+	uint32_t n = 0;
+	int16_t *data;
+	FILE *f = fopen(path, "rb");
+
+	if(f == NULL)
+		return(0);
+
+	*channels = 0;
+	if(fread(hdr, 1, 8, f) != 8 || memcmp(hdr, "RIFF", 4) ||
+			fread(hdr, 1, 4, f) != 4 || memcmp(hdr, "WAVE", 4))
+		goto host_wav_exit;
+
+	/* chunks are walked up to the samples */
+	while(fread(hdr, 1, 8, f) == 8) {
+		size = hdr[4] | (hdr[5] << 8) | (hdr[6] << 16) | ((uint32_t)hdr[7] << 24);
+
+		if(!memcmp(hdr, "fmt ", 4) && size >= sizeof(fmt)) {
+			if(fread(fmt, 1, sizeof(fmt), f) != sizeof(fmt))
+				break;
+
+			*channels = fmt[2] | (fmt[3] << 8);
+			*rate = fmt[4] | (fmt[5] << 8) | (fmt[6] << 16) | ((uint32_t)fmt[7] << 24);
+			bits = fmt[14] | (fmt[15] << 8);
+			fseek(f, (size - sizeof(fmt)) + (size & 1), SEEK_CUR);
+		} else if(!memcmp(hdr, "data", 4)) {
+			if(bits != 16 || *channels == 0 || (fmt[0] | (fmt[1] << 8)) != 1)
+				break;
+
+			data = malloc(size);
+			if(data == NULL)
+				break;
+
+			n = fread(data, 1, size, f) / (2 * *channels);
+			*out = data;
+			break;
+		} else {
+			fseek(f, size + (size & 1), SEEK_CUR);
+		}
+	}
+
+host_wav_exit:
+	fclose(f);
+	return(n);
+}
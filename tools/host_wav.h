@@ -0,0 +1,19 @@
+/*
+ *  @file host_wav.h
+ *  @brief 16 bit PCM WAV reader shared by the host tools
+ */
+
+#ifndef __HOST_WAV_H
+#define __HOST_WAV_H
+
+/**
+ * 	@fn host_wav_read()
+ *  @brief reads every channel of a 16 bit PCM WAV file, the samples are
+ *         left interleaved on a buffer the caller frees
+ *
+ *  @param
+ *  @return frames read, 0 on error
+ */
+uint32_t host_wav_read(const char *path, int16_t **out, uint32_t *rate, uint32_t *channels);
+
+#endif
@@ -0,0 +1,575 @@
+/*
+ *  @file noise_bench.c
+ *  @brief runs the firmware noise floor tracker and band features on a PC,
+ *  over a synthetic hive with weather coming in and over recorded WAV files,
+ *  the spectra are averaged into one second reports as the node does
+ *
+ *  build:
+ *  D=Drivers/CMSIS/DSP/Source
+ *  cc -O2 -DBEE_HOST_BUILD -DBEE_HOST_DSP -DARM_MATH_CM0 -include tools/host_cmsis.h \
+ *     -Isrc -IDrivers/CMSIS/Include -IDrivers/CMSIS/DSP/Include \
+ *     tools/noise_bench.c tools/host_cmsis.c tools/host_wav.c src/bee_noise.c src/bee_fft.c \
+ *     src/bee_features.c src/bee_fastlog.c \
+ *     $D/TransformFunctions/arm_cfft_f32.c $D/TransformFunctions/arm_cfft_radix8_f32.c \
+ *     $D/TransformFunctions/arm_rfft_fast_f32.c $D/TransformFunctions/arm_rfft_fast_init_f32.c \
+ *     $D/TransformFunctions/arm_rfft_init_q15.c $D/TransformFunctions/arm_rfft_init_q31.c \
+ *     $D/CommonTables/arm_common_tables.c $D/CommonTables/arm_const_structs.c \
+ *     $D/ComplexMathFunctions/arm_cmplx_mag_squared_f32.c -lm -o noise_bench
+ *
+ *  usage:
+ *  noise_bench [-m mode] [-r reports] [-b bias] [-o over] [-f floor] [-v] [-c]
+ *              [file.wav ...]
+ *
+ *  with no file the synthetic hive is run under synthetic rain and wind,
+ *  with -c each file is a rain or wind recording laid over the synthetic
+ *  hive at the rate of the file, without -c each file is tracked on its
+ *  own, first channel only, -v prints every report as csv
+ *
+ *  -c checks, in subtract mode, the band features and the aggro level rise
+ *  less under the weather than they do without the tracker, the hum of the
+ *  colony is kept and the hiss bursts stand out as much as before, exits
+ *  with 1 when they do not
+ */
+
+#include "lilbee.h"
+#include "host_wav.h"
+#include <stdio.h>
+
+
+/* synthetic hive, hum all along, hiss bursts and weather ramping in */
+#define BENCH_RATE			16000
+#define BENCH_SECONDS		300
+#define BENCH_HUM_HZ		250.0f
+#define BENCH_HISS_LOW_HZ	2600.0f
+#define BENCH_HISS_HIGH_HZ	3400.0f
+#define BENCH_HISS_TONES	17
+#define BENCH_HISS_EVERY	20
+#define BENCH_HISS_LENGTH	5
+#define BENCH_WEATHER_START	100
+#define BENCH_WEATHER_RAMP	30
+
+/* synthetic wind, low passed noise in gusts */
+#define BENCH_WIND_HZ		150.0f
+#define BENCH_GUST_SECONDS	7.0f
+
+/* settled windows of the summary, before the weather and once it is learnt */
+#define BENCH_QUIET_FROM	64
+#define BENCH_WET_FROM		200
+
+/* checked by -c, how far the weather moves the energy of a band and the
+ * aggro level once cleaned against how far it moves them raw, with a slack
+ * in parts of the raw dry energy for the bands it hardly touches, then in
+ * dB the hum level a cleaned report may lose and the hiss burst contrast
+ * it may lose against the raw one, wind gusts over the floor learnt in
+ * the lulls are left in so the bands are held to less
+ */
+#define BENCH_CHECK_MOVE			0.9f
+#define BENCH_CHECK_MOVE_SLACK		0.05f
+#define BENCH_CHECK_AGGRO_MOVE		0.75f
+#define BENCH_CHECK_HUM_LOSS		3.0f
+#define BENCH_CHECK_CONTRAST_LOSS	1.0f
+
+/* the default bands, hiss first as it drives the aggro level */
+#define BENCH_HISS			0
+#define BENCH_HUM			1
+
+/** internal types */
+typedef enum {
+	k_bench_rain = 0,
+	k_bench_wind,
+	k_bench_clip,
+}bench_weather_t;
+
+typedef struct bench_report {
+	float band_raw_db[FEATURES_MAX_BANDS];
+	float band_db[FEATURES_MAX_BANDS];
+	bee_noise_report_t noise;
+}bench_report_t;
+
+typedef struct bench_mean {
+	double sum;
+	uint32_t n;
+}bench_mean_t;
+
+/** internal variables */
+static bee_fft_t fft;
+static bee_noise_t tracker;
+static bee_noise_cfg_t cfg = {
+	NOISE_DEFAULT_MODE, NOISE_DEFAULT_REPORTS, NOISE_DEFAULT_BIAS,
+	NOISE_DEFAULT_OVER, NOISE_DEFAULT_FLOOR,
+};
+static bee_features_t features;
+static float window[DSP_FFT_POINTS];
+static float frame[DSP_FFT_POINTS];
+static float spectrum[DSP_FFT_POINTS];
+static float power[DSP_SPECTRAL_BINS];
+static float raw[DSP_SPECTRAL_BINS];
+static bool verbose = false;
+static bool checked = false;
+
+/** internal functions */
+
+/**
+ * 	@fn bench_noise()
+ *  @brief gaussian noise, box muller over rand()
+ *
+ *  @param
+ *  @return
+ */
+static float bench_noise(void)
+{
+	float u = ((float)rand() + 1.0f) / ((float)RAND_MAX + 2.0f);
+	float v = ((float)rand() + 1.0f) / ((float)RAND_MAX + 2.0f);
+
+	return(sqrtf(-2.0f * logf(u)) * cosf(2.0f * PI * v));
+}
+
+/**
+ * 	@fn bench_hive()
+ *  @brief steady harmonic hum, hiss bursts made of tones spread over the
+ *  hiss band and a weather ramping in over the microphone floor, white
+ *  rain, gusts of low passed wind or a recording looped
+ *
+ *  @param
+ *  @return
+ */
+static void bench_hive(int16_t *x, uint32_t n, uint32_t rate, bench_weather_t weather,
+		const int16_t *clip, uint32_t clip_len)
+{
+	const float hum[4] = { 0.1f, 0.05f, 0.03f, 0.02f };
+	const float a = expf(-2.0f * PI * BENCH_WIND_HZ / (float)rate);
+	const float wind_gain = sqrtf((1.0f + a) / (1.0f - a));
+	float phase[BENCH_HISS_TONES];
+	float wind = 0.0f;
+	float ramp;
+	float t;
+	float s;
+	uint32_t sec;
+
+	srand(BENCH_RATE);
+	for(uint32_t k = 0; k < BENCH_HISS_TONES; k++)
+		phase[k] = 2.0f * PI * (float)rand() / (float)RAND_MAX;
+
+	for(uint32_t i = 0; i < n; i++) {
+		t = (float)i / (float)rate;
+		sec = i / rate;
+
+		s = 0.0f;
+		for(uint32_t h = 0; h < 4; h++)
+			s += hum[h] * sinf(2.0f * PI * BENCH_HUM_HZ * (float)(h + 1) * t);
+
+		if(sec % BENCH_HISS_EVERY < BENCH_HISS_LENGTH) {
+			for(uint32_t k = 0; k < BENCH_HISS_TONES; k++) {
+				s += 0.01f * sinf(2.0f * PI * (BENCH_HISS_LOW_HZ + (BENCH_HISS_HIGH_HZ -
+						BENCH_HISS_LOW_HZ) * (float)k / (BENCH_HISS_TONES - 1)) * t + phase[k]);
+			}
+		}
+
+		/* -60 dBFS microphone floor */
+		s += 0.001f * bench_noise();
+
+		ramp = (t > BENCH_WEATHER_START) ?
+				fminf((t - BENCH_WEATHER_START) / BENCH_WEATHER_RAMP, 1.0f) : 0.0f;
+
+		switch(weather) {
+		case k_bench_rain:
+			/* up to -26 dBFS of white noise */
+			s += ramp * 0.05f * bench_noise();
+			break;
+
+		case k_bench_wind:
+			/* up to -20 dBFS of gusts under BENCH_WIND_HZ */
+			wind = a * wind + (1.0f - a) * bench_noise();
+			s += ramp * 0.1f * (0.6f + 0.4f * sinf(2.0f * PI * t / BENCH_GUST_SECONDS)) *
+					wind_gain * wind;
+			break;
+
+		case k_bench_clip:
+			/* the recording at its own level */
+			if(ramp > 0.0f)
+				s += ramp * (float)clip[(i - BENCH_WEATHER_START * rate) % clip_len] / 32768.0f;
+			break;
+		}
+
+		s *= 32767.0f;
+		if(s > 32767.0f)
+			s = 32767.0f;
+		if(s < -32768.0f)
+			s = -32768.0f;
+		x[i] = (int16_t)s;
+	}
+}
+
+/**
+ * 	@fn bench_db()
+ *  @brief power in dB
+ *
+ *  @param
+ *  @return
+ */
+static float bench_db(float p)
+{
+	return(10.0f * log10f(p + NOISE_POWER_FLOOR));
+}
+
+/**
+ * 	@fn bench_run()
+ *  @brief hann windowed frames at half overlap averaged into one second
+ *  reports, each report goes through the tracker and the band features
+ *  are taken before and after it, returns the number of reports written
+ *
+ *  @param
+ *  @return
+ */
+static uint32_t bench_run(const int16_t *x, uint32_t n, uint32_t rate, bench_report_t *out,
+		uint32_t max)
+{
+	const uint32_t hop = DSP_FFT_POINTS / 2;
+	uint32_t frames = 0;
+	uint32_t reports = 0;
+	uint32_t next = rate;
+
+	bee_noise_reset(&tracker);
+	bee_features_init(rate);
+	memset(power, 0, sizeof(power));
+
+	for(uint32_t i = 0; i + DSP_FFT_POINTS <= n && reports < max; i += hop) {
+		for(uint32_t k = 0; k < DSP_FFT_POINTS; k++)
+			frame[k] = (float)x[i + k] * (1.0f / 32768.0f) * window[k];
+
+		arm_rfft_fast_f32(&fft, frame, spectrum, 0);
+		arm_cmplx_mag_squared_f32(spectrum, spectrum, DSP_SPECTRAL_BINS);
+		for(uint32_t b = 0; b < DSP_SPECTRAL_BINS; b++)
+			power[b] += spectrum[b];
+		frames++;
+
+		if(i + hop < next)
+			continue;
+
+		for(uint32_t b = 0; b < DSP_SPECTRAL_BINS; b++)
+			power[b] /= (float)frames;
+		memcpy(raw, power, sizeof(raw));
+
+		/* the features as the node takes them, and without the tracker */
+		bee_features_compute(raw, NULL, &features);
+		for(uint32_t b = 0; b < FEATURES_MAX_BANDS; b++)
+			out[reports].band_raw_db[b] = bench_db(features.band[b].energy);
+
+		bee_noise_update(&tracker, &cfg, power, &out[reports].noise);
+		bee_features_compute(power, NULL, &features);
+		for(uint32_t b = 0; b < FEATURES_MAX_BANDS; b++)
+			out[reports].band_db[b] = bench_db(features.band[b].energy);
+
+		if(verbose) {
+			printf("%u,%.2f,%.2f,%.2f,%.2f,%.2f,%u\n", reports,
+					out[reports].band_raw_db[BENCH_HISS], out[reports].band_db[BENCH_HISS],
+					out[reports].band_raw_db[BENCH_HUM], out[reports].band_db[BENCH_HUM],
+					out[reports].noise.snr_db, out[reports].noise.ready);
+		}
+
+		reports++;
+		next += rate;
+		frames = 0;
+		memset(power, 0, sizeof(power));
+	}
+
+	return(reports);
+}
+
+/**
+ * 	@fn bench_add()
+ *  @brief adds a value to a mean
+ *
+ *  @param
+ *  @return
+ */
+static void bench_add(bench_mean_t *m, float v)
+{
+	m->sum += v;
+	m->n++;
+}
+
+/**
+ * 	@fn bench_get()
+ *  @brief gets a mean, 0 when empty
+ *
+ *  @param
+ *  @return
+ */
+static float bench_get(const bench_mean_t *m)
+{
+	return((m->n) ? (float)(m->sum / m->n) : 0.0f);
+}
+
+/**
+ * 	@fn bench_power()
+ *  @brief mean of levels in dB back to a power
+ *
+ *  @param
+ *  @return
+ */
+static float bench_power(const bench_mean_t *m)
+{
+	return(powf(10.0f, bench_get(m) / 10.0f));
+}
+
+/**
+ * 	@fn bench_fail()
+ *  @brief prints a check, returns 1 when the value is over the limit
+ *
+ *  @param
+ *  @return
+ */
+static int bench_fail(const char *what, float value, float limit, const char *unit)
+{
+	bool fail = (value > limit);
+
+	printf("check %-36s %7.2f%s, at most %5.2f: %s\n", what, value, unit, limit,
+			(fail) ? "FAIL" : "pass");
+	return((fail) ? 1 : 0);
+}
+
+/**
+ * 	@fn bench_weather()
+ *  @brief runs the hive under a weather, rise of each band under it and
+ *  contrast of the hiss bursts, raw and with the floor taken off, returns
+ *  1 when a check fails
+ *
+ *  @param
+ *  @return
+ */
+static int bench_weather(const char *name, bench_weather_t weather, uint32_t rate,
+		const int16_t *clip, uint32_t clip_len)
+{
+	/* [dry or wet][burst off or on][raw or cleaned] */
+	bench_mean_t band[FEATURES_MAX_BANDS][2][2][2];
+	bench_mean_t snr[2];
+	bench_report_t *reports;
+	bee_band_t table[FEATURES_MAX_BANDS];
+	char what[64];
+	float rise[2];
+	float move[2];
+	float contrast[2];
+	float loss;
+	int ret = 0;
+	int16_t *x;
+	uint32_t bands;
+	uint32_t phase;
+	uint32_t wet;
+	uint32_t on;
+	uint32_t n;
+
+	x = malloc(rate * BENCH_SECONDS * sizeof(int16_t));
+	reports = malloc(BENCH_SECONDS * sizeof(bench_report_t));
+	if(x == NULL || reports == NULL) {
+		free(x);
+		free(reports);
+		return(1);
+	}
+
+	bench_hive(x, rate * BENCH_SECONDS, rate, weather, clip, clip_len);
+	n = bench_run(x, rate * BENCH_SECONDS, rate, reports, BENCH_SECONDS);
+	bands = bee_features_get_bands(table);
+
+	memset(band, 0, sizeof(band));
+	memset(snr, 0, sizeof(snr));
+	for(uint32_t r = BENCH_QUIET_FROM; r < n; r++) {
+		if(r >= BENCH_WEATHER_START && r < BENCH_WET_FROM)
+			continue;
+
+		/* reports straddling a burst edge are left out */
+		phase = r % BENCH_HISS_EVERY;
+		if(phase == 0 || phase == BENCH_HISS_EVERY - 1 ||
+				(phase >= BENCH_HISS_LENGTH - 1 && phase <= BENCH_HISS_LENGTH))
+			continue;
+
+		wet = (r >= BENCH_WET_FROM);
+		on = (phase < BENCH_HISS_LENGTH);
+		for(uint32_t b = 0; b < bands; b++) {
+			bench_add(&band[b][wet][on][0], reports[r].band_raw_db[b]);
+			bench_add(&band[b][wet][on][1], reports[r].band_db[b]);
+		}
+		if(!on)
+			bench_add(&snr[wet], reports[r].noise.snr_db);
+	}
+
+	printf("%s at %u Hz, mode %u, %u reports per sub window, bias %.2f, over %.2f, floor %.2f\n",
+			name, rate, cfg.mode, cfg.reports, cfg.bias, cfg.over, cfg.floor);
+	printf("band      dry_db   wet_db  rise_db  cleaned_dry_db  cleaned_wet_db  cleaned_rise_db"
+			"  moved\n");
+	for(uint32_t b = 0; b < bands; b++) {
+		for(uint32_t c = 0; c < 2; c++) {
+			rise[c] = bench_get(&band[b][1][0][c]) - bench_get(&band[b][0][0][c]);
+			move[c] = fabsf(bench_power(&band[b][1][0][c]) - bench_power(&band[b][0][0][c]));
+		}
+
+		/* energy the weather moves once cleaned, in parts of the raw move */
+		printf("%-8s %7.2f  %7.2f  %7.2f  %14.2f  %14.2f  %15.2f  %5.2f\n", table[b].name,
+				bench_get(&band[b][0][0][0]), bench_get(&band[b][1][0][0]), rise[0],
+				bench_get(&band[b][0][0][1]), bench_get(&band[b][1][0][1]), rise[1],
+				(move[0] > 0.0f) ? move[1] / move[0] : 0.0f);
+	}
+
+	/* the aggro level is the rms of the first band */
+	for(uint32_t c = 0; c < 2; c++) {
+		move[c] = sqrtf(bench_power(&band[BENCH_HISS][1][0][c])) -
+				sqrtf(bench_power(&band[BENCH_HISS][0][0][c]));
+	}
+	printf("aggro level moved %.4f by the weather, %.4f cleaned, snr %.2f dB dry, %.2f dB wet\n",
+			move[0], move[1], bench_get(&snr[0]), bench_get(&snr[1]));
+
+	if(checked) {
+		/* the weather moves every band less once the floor is taken off */
+		for(uint32_t b = 0; b < bands; b++) {
+			for(uint32_t c = 0; c < 2; c++)
+				move[c] = fabsf(bench_power(&band[b][1][0][c]) - bench_power(&band[b][0][0][c]));
+
+			snprintf(what, sizeof(what), "%s %s cleaned move", name, table[b].name);
+			ret |= bench_fail(what, move[1] / (move[0] + BENCH_CHECK_MOVE_SLACK *
+					bench_power(&band[b][0][0][0])), BENCH_CHECK_MOVE, " of raw");
+		}
+
+		for(uint32_t c = 0; c < 2; c++) {
+			move[c] = fabsf(sqrtf(bench_power(&band[BENCH_HISS][1][0][c])) -
+					sqrtf(bench_power(&band[BENCH_HISS][0][0][c])));
+		}
+
+		snprintf(what, sizeof(what), "%s aggro level cleaned move", name);
+		ret |= bench_fail(what, move[1] / move[0], BENCH_CHECK_AGGRO_MOVE, " of raw");
+
+		for(wet = 0; wet < 2; wet++) {
+			/* the steady hum is colony signal, cleaning must leave it in place */
+			loss = bench_get(&band[BENCH_HUM][wet][0][0]) - bench_get(&band[BENCH_HUM][wet][0][1]);
+			snprintf(what, sizeof(what), "%s %s hum loss", name, (wet) ? "wet" : "dry");
+			ret |= bench_fail(what, loss, BENCH_CHECK_HUM_LOSS, " dB");
+
+			for(uint32_t c = 0; c < 2; c++) {
+				contrast[c] = bench_get(&band[BENCH_HISS][wet][1][c]) -
+						bench_get(&band[BENCH_HISS][wet][0][c]);
+			}
+
+			snprintf(what, sizeof(what), "%s %s burst contrast loss", name,
+					(wet) ? "wet" : "dry");
+			ret |= bench_fail(what, contrast[0] - contrast[1], BENCH_CHECK_CONTRAST_LOSS, " dB");
+		}
+	}
+
+	free(reports);
+	free(x);
+	return(ret);
+}
+
+/**
+ * 	@fn bench_file()
+ *  @brief tracks a recording on its own, first channel only
+ *
+ *  @param
+ *  @return
+ */
+static void bench_file(const char *name, int16_t *x, uint32_t n, uint32_t rate)
+{
+	bench_report_t *reports;
+	bench_mean_t snr;
+	uint32_t count;
+
+	reports = malloc((n / rate + 1) * sizeof(bench_report_t));
+	if(reports == NULL)
+		return;
+
+	count = bench_run(x, n, rate, reports, n / rate + 1);
+	memset(&snr, 0, sizeof(snr));
+	for(uint32_t r = 0; r < count; r++) {
+		if(reports[r].noise.ready)
+			bench_add(&snr, reports[r].noise.snr_db);
+	}
+
+	printf("%s: %u Hz, %u reports, mean snr %.2f dB once the floor is ready\n",
+			name, rate, count, bench_get(&snr));
+	free(reports);
+}
+
+int main(int argc, char **argv)
+{
+	int16_t *x;
+	uint32_t rate = 0;
+	uint32_t channels;
+	uint32_t n;
+	uint32_t files = 0;
+	int ret = 0;
+
+	for(int i = 1; i < argc; i++) {
+		if(!strcmp(argv[i], "-m") && i + 1 < argc) {
+			cfg.mode = (noise_mode_t)atoi(argv[++i]);
+		} else if(!strcmp(argv[i], "-r") && i + 1 < argc) {
+			cfg.reports = atoi(argv[++i]);
+		} else if(!strcmp(argv[i], "-b") && i + 1 < argc) {
+			cfg.bias = strtof(argv[++i], NULL);
+		} else if(!strcmp(argv[i], "-o") && i + 1 < argc) {
+			cfg.over = strtof(argv[++i], NULL);
+		} else if(!strcmp(argv[i], "-f") && i + 1 < argc) {
+			cfg.floor = strtof(argv[++i], NULL);
+		} else if(!strcmp(argv[i], "-v")) {
+			verbose = true;
+		} else if(!strcmp(argv[i], "-c")) {
+			checked = true;
+		} else if(argv[i][0] == '-') {
+			fprintf(stderr, "usage: %s [-m mode] [-r reports] [-b bias] [-o over] "
+					"[-f floor] [-v] [-c] [file.wav ...]\n", argv[0]);
+			return(1);
+		}
+	}
+
+	if(bee_noise_check(&cfg) != k_bee_ret_ok) {
+		fprintf(stderr, "invalid tracker setup\n");
+		return(1);
+	}
+
+	/* a floor only tracked leaves the features as they were */
+	if(checked && cfg.mode != k_noise_subtract) {
+		fprintf(stderr, "-c checks the subtract mode, -m %u\n", k_noise_subtract);
+		return(1);
+	}
+
+	if(bee_fft_init(&fft, DSP_FFT_POINTS) != k_bee_ret_ok)
+		return(1);
+
+	for(uint32_t k = 0; k < DSP_FFT_POINTS; k++)
+		window[k] = 0.5f - 0.5f * cosf(2.0f * PI * (float)k / (float)DSP_FFT_POINTS);
+
+	if(verbose)
+		printf("report,hiss_raw_db,hiss_db,hum_raw_db,hum_db,snr_db,ready\n");
+
+	for(int i = 1; i < argc; i++) {
+		if(argv[i][0] == '-') {
+			i += (!strcmp(argv[i], "-v") || !strcmp(argv[i], "-c")) ? 0 : 1;
+			continue;
+		}
+
+		files++;
+		x = NULL;
+		n = host_wav_read(argv[i], &x, &rate, &channels);
+		if(n == 0) {
+			fprintf(stderr, "%s: not a 16 bit PCM WAV file\n", argv[i]);
+			ret = 1;
+			continue;
+		}
+
+		/* first channel only */
+		for(uint32_t k = 0; k < n; k++)
+			x[k] = x[k * channels];
+
+		if(checked)
+			ret |= bench_weather(argv[i], k_bench_clip, rate, x, n);
+		else
+			bench_file(argv[i], x, n, rate);
+
+		free(x);
+	}
+
+	if(files == 0) {
+		ret |= bench_weather("rain", k_bench_rain, BENCH_RATE, NULL, 0);
+		ret |= bench_weather("wind", k_bench_wind, BENCH_RATE, NULL, 0);
+	}
+
+	return(ret);
+}
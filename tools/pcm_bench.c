@@ -0,0 +1,254 @@
+/*
+ *  @file pcm_bench.c
+ *  @brief runs the DFSDM to PCM kernel of the audio BSP on a PC against
+ *  the per sample loop it replaced, the loop also accumulates the block
+ *  levels the kernel reports, so both do the same work, outputs and levels
+ *  must match exactly, both are timed on every channel layout
+ *
+ *  times are host ns and run the C reference of PKHBT/SMLALD, they rank
+ *  the two on a PC only, the node cycles are the ones of
+ *  BSP_AUDIO_IN_GetProcessCycles() read on target
+ *
+ *  build:
+ *  cc -O2 -Isrc -Itools tools/pcm_bench.c -lm -o pcm_bench
+ *
+ *  usage:
+ *  pcm_bench [-r rate] [-n blocks]
+ *
+ *  exits with 1 on a mismatch
+ */
+
+#include <stdio.h>
+#include <stdint.h>
+#include <stdbool.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+#include <math.h>
+#include <time.h>
+#include "host_bsp.h"
+#include "../Drivers/BSP/SensorTile/SensorTile_audio_in_pcm.h"
+
+
+#define BENCH_MAX_CHANNELS	4
+#define BENCH_MAX_BLOCK		48
+#define BENCH_VOLUME		64
+#define BENCH_BLOCKS		200000
+
+/* full scale of the DFSDM output at the bench volume, the drive goes past
+ * it on one block out of BENCH_CLIP_EVERY so saturation is exercised
+ */
+#define BENCH_FULL_SCALE	(32768.0f * 512.0f)
+#define BENCH_CLIP_EVERY	16
+
+/** channel layouts the BSP converts to */
+typedef enum {
+	k_bench_interleaved = 0,
+	k_bench_planar,
+}bench_layout_t;
+
+/** internal variables */
+static int32_t rec_buff[BENCH_MAX_CHANNELS][BENCH_MAX_BLOCK];
+static uint16_t pcm_old[BENCH_MAX_CHANNELS * BENCH_MAX_BLOCK];
+static uint16_t pcm_new[BENCH_MAX_CHANNELS * BENCH_MAX_BLOCK];
+static HP_FilterState_TypeDef old_filters[BENCH_MAX_CHANNELS];
+static HP_FilterState_TypeDef new_filters[BENCH_MAX_CHANNELS];
+static SENSORTILE_AudioIn_LevelTypeDef old_levels[BENCH_MAX_CHANNELS];
+static SENSORTILE_AudioIn_LevelTypeDef levels[BENCH_MAX_CHANNELS];
+static uint64_t phase = 0;
+
+/** internal functions */
+
+/**
+ * 	@fn bench_now_ns()
+ *  @brief monotonic host clock
+ *
+ *  @param
+ *  @return
+ */
+static uint64_t bench_now_ns(void)
+{
+	struct timespec now;
+
+	clock_gettime(CLOCK_MONOTONIC, &now);
+	return((uint64_t)now.tv_sec * 1000000000ULL + (uint64_t)now.tv_nsec);
+}
+
+/**
+ * 	@fn bench_fill()
+ *  @brief fills the record buffers with a block of a tone per channel
+ *  riding on a DC offset, as the microphones deliver it
+ *
+ *  @param
+ *  @return
+ */
+static void bench_fill(uint32_t channels, uint32_t block, uint32_t rate, uint32_t index)
+{
+	float drive = (index % BENCH_CLIP_EVERY) ? 0.5f : 1.5f;
+	float t;
+
+	for(uint32_t ch = 0; ch < channels; ch++) {
+		for(uint32_t i = 0; i < block; i++) {
+			t = (float)(phase + i) / (float)rate;
+			rec_buff[ch][i] = (int32_t)(BENCH_FULL_SCALE * (0.05f + drive *
+					sinf(2.0f * (float)M_PI * (440.0f * (float)(ch + 1)) * t)));
+		}
+	}
+
+	phase += block;
+}
+
+/**
+ * 	@fn bench_old()
+ *  @brief the conversion loop of the BSP before the kernel, one sample of
+ *  one channel at a time, with the level of each sample accumulated as it
+ *  is written
+ *
+ *  @param
+ *  @return
+ */
+static void bench_old(uint32_t channels, uint32_t block, uint32_t stride)
+{
+	int32_t s;
+
+	for(uint32_t j = 0; j < channels; j++) {
+		old_levels[j].Energy = 0;
+		old_levels[j].Peak = 0;
+
+		for(uint32_t i = 0; i < block; i++) {
+			old_filters[j].Z = ((rec_buff[j][i] >> 8) * BENCH_VOLUME) >> 7;
+			old_filters[j].oldOut = (0xFC * (old_filters[j].oldOut + old_filters[j].Z -
+					old_filters[j].oldIn)) / 256;
+			old_filters[j].oldIn = old_filters[j].Z;
+
+			s = SaturaLH(old_filters[j].oldOut, -PCM_SAT_LIMIT, PCM_SAT_LIMIT);
+			pcm_old[(stride) ? j * stride + i : i * channels + j] = s;
+
+			old_levels[j].Energy += (uint64_t)(s * s);
+			if((uint32_t)abs(s) > old_levels[j].Peak)
+				old_levels[j].Peak = abs(s);
+		}
+	}
+}
+
+/**
+ * 	@fn bench_new()
+ *  @brief the kernel, split over the channels as DFSDMx_ProcessBlock() does
+ *
+ *  @param
+ *  @return
+ */
+static void bench_new(uint32_t channels, uint32_t block, uint32_t stride)
+{
+	if(stride) {
+		for(uint32_t j = 0; j < channels; j++)
+			PCM_HPFilterMono(rec_buff[j], pcm_new + j * stride, block, BENCH_VOLUME,
+					&new_filters[j], &levels[j]);
+	} else if(channels == 1) {
+		PCM_HPFilterMono(rec_buff[0], pcm_new, block, BENCH_VOLUME, &new_filters[0], &levels[0]);
+	} else {
+		for(uint32_t j = 0; j < channels; j += 2)
+			PCM_HPFilterPair(rec_buff[j], rec_buff[j + 1], pcm_new + j, channels, block,
+					BENCH_VOLUME, &new_filters[j], &levels[j]);
+	}
+}
+
+/**
+ * 	@fn bench_layout()
+ *  @brief checks and times both conversions over blocks blocks of one layout
+ *
+ *  @param
+ *  @return false on a mismatch
+ */
+static bool bench_layout(uint32_t channels, bench_layout_t layout, uint32_t rate, uint32_t blocks)
+{
+	uint32_t block = rate / 1000;
+	uint32_t stride = (layout == k_bench_planar) ? block : 0;
+	uint32_t samples = channels * block;
+	uint64_t old_ns = 0;
+	uint64_t new_ns = 0;
+	uint64_t clipped = 0;
+	uint64_t start;
+
+	memset(old_filters, 0, sizeof(old_filters));
+	memset(new_filters, 0, sizeof(new_filters));
+	phase = 0;
+
+	for(uint32_t b = 0; b < blocks; b++) {
+		bench_fill(channels, block, rate, b);
+
+		start = bench_now_ns();
+		bench_old(channels, block, stride);
+		old_ns += bench_now_ns() - start;
+
+		start = bench_now_ns();
+		bench_new(channels, block, stride);
+		new_ns += bench_now_ns() - start;
+
+		for(uint32_t i = 0; i < samples; i++) {
+			if(pcm_old[i] != pcm_new[i]) {
+				fprintf(stderr, "pcm: %u ch %s, block %u sample %u, old %d kernel %d\n",
+						channels, (stride) ? "planar" : "interleaved", b, i,
+						(int16_t)pcm_old[i], (int16_t)pcm_new[i]);
+				return(false);
+			}
+
+			if(abs((int16_t)pcm_new[i]) == PCM_SAT_LIMIT)
+				clipped++;
+		}
+
+		for(uint32_t j = 0; j < channels; j++) {
+			if(old_levels[j].Energy != levels[j].Energy || old_levels[j].Peak != levels[j].Peak) {
+				fprintf(stderr, "pcm: %u ch %s, block %u, level of channel %u is off\n",
+						channels, (stride) ? "planar" : "interleaved", b, j);
+				return(false);
+			}
+		}
+	}
+
+	printf("%u ch %-11s  old %6.2f host ns/sample  kernel %6.2f host ns/sample  x%.2f  "
+			"%lu clipped\n",
+			channels, (stride) ? "planar" : "interleaved",
+			(double)old_ns / ((double)blocks * samples), (double)new_ns / ((double)blocks * samples),
+			(double)old_ns / (double)((new_ns) ? new_ns : 1), (unsigned long)clipped);
+	return(true);
+}
+
+/** public functions */
+
+int main(int argc, char **argv)
+{
+	static const uint32_t channels[] = {1, 2, 4};
+	uint32_t rate = 48000;
+	uint32_t blocks = BENCH_BLOCKS;
+	int opt;
+
+	while((opt = getopt(argc, argv, "r:n:")) != -1) {
+		switch(opt) {
+		case 'r':
+			rate = strtoul(optarg, NULL, 10);
+			break;
+		case 'n':
+			blocks = strtoul(optarg, NULL, 10);
+			break;
+		default:
+			fprintf(stderr, "usage: %s [-r rate] [-n blocks]\n", argv[0]);
+			return(1);
+		}
+	}
+
+	if(rate < 1000 || rate / 1000 > BENCH_MAX_BLOCK || blocks == 0) {
+		fprintf(stderr, "pcm: rate up to %u Hz\n", BENCH_MAX_BLOCK * 1000);
+		return(1);
+	}
+
+	printf("%u Hz, %u samples per block, %u blocks\n", rate, rate / 1000, blocks);
+
+	for(uint32_t c = 0; c < sizeof(channels) / sizeof(channels[0]); c++) {
+		if(!bench_layout(channels[c], k_bench_interleaved, rate, blocks) ||
+				!bench_layout(channels[c], k_bench_planar, rate, blocks))
+			return(1);
+	}
+
+	return(0);
+}
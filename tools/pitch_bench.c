@@ -0,0 +1,280 @@
+/*
+ *  @file pitch_bench.c
+ *  @brief runs the firmware pitch tracker on a PC, over synthetic wing
+ *  beat tones with noise and over recorded WAV files, the same code as the
+ *  node is built against CMSIS-DSP for the host
+ *
+ *  build:
+ *  D=Drivers/CMSIS/DSP/Source
+ *  cc -O2 -DBEE_HOST_BUILD -DBEE_HOST_DSP -DARM_MATH_CM0 -include tools/host_cmsis.h \
+ *     -Isrc -IDrivers/CMSIS/Include -IDrivers/CMSIS/DSP/Include \
+ *     tools/pitch_bench.c tools/host_cmsis.c tools/host_wav.c src/bee_pitch.c src/bee_fft.c \
+ *     $D/TransformFunctions/arm_cfft_f32.c $D/TransformFunctions/arm_cfft_radix8_f32.c \
+ *     $D/TransformFunctions/arm_rfft_init_q15.c $D/TransformFunctions/arm_rfft_init_q31.c \
+ *     $D/CommonTables/arm_common_tables.c \
+ *     $D/CommonTables/arm_const_structs.c $D/FilteringFunctions/arm_fir_decimate_f32.c \
+ *     $D/FilteringFunctions/arm_fir_decimate_init_f32.c $D/BasicMathFunctions/arm_scale_f32.c \
+ *     $D/BasicMathFunctions/arm_dot_prod_f32.c -lm -o pitch_bench
+ *
+ *  usage:
+ *  pitch_bench [-r min_hz max_hz] [-t threshold] [-v] [file.wav ...]
+ *
+ *  with no file the synthetic sweep is run, each file is tracked on its
+ *  first channel, -v prints every frame as csv
+ */
+
+#include "lilbee.h"
+#include "host_wav.h"
+#include <stdio.h>
+#include <time.h>
+
+
+/* synthetic sweep, wing beat fundamentals over the capture rates */
+#define BENCH_RATES			{ 8000, 16000, 48000 }
+#define BENCH_F0_HZ			{ 120.0f, 190.0f, 250.0f, 330.0f, 450.0f, 600.0f, 850.0f }
+#define BENCH_SNR_DB		{ 30.0f, 10.0f, 0.0f }
+#define BENCH_SECONDS		2
+#define BENCH_BLOCK			256
+
+/* frames further than this from the truth count as gross errors */
+#define BENCH_GROSS_CENTS	50.0f
+
+/** internal variables */
+static bee_pitch_plan_t plan;
+static bee_pitch_t tracker;
+static int16_t samples[48000 * BENCH_SECONDS];
+static uint32_t min_hz = PITCH_DEFAULT_MIN_HZ;
+static uint32_t max_hz = PITCH_DEFAULT_MAX_HZ;
+static float threshold = PITCH_DEFAULT_THRESHOLD;
+static bool verbose = false;
+
+/** internal types */
+typedef struct bench_score {
+	uint32_t frames;
+	uint32_t periodic;
+	uint32_t gross;
+	double cents;
+	double ns;
+}bench_score_t;
+
+/** internal functions */
+
+/**
+ * 	@fn bench_noise()
+ *  @brief gaussian noise, box muller over rand()
+ *
+ *  @param
+ *  @return
+ */
+static float bench_noise(void)
+{
+	float u = ((float)rand() + 1.0f) / ((float)RAND_MAX + 2.0f);
+	float v = ((float)rand() + 1.0f) / ((float)RAND_MAX + 2.0f);
+
+	return(sqrtf(-2.0f * logf(u)) * cosf(2.0f * PI * v));
+}
+
+/**
+ * 	@fn bench_tone()
+ *  @brief wing beat like tone, a fundamental with decaying harmonics and
+ *  white noise at the given SNR
+ *
+ *  @param
+ *  @return
+ */
+static void bench_tone(int16_t *x, uint32_t n, uint32_t rate, float f0, float snr_db)
+{
+	const float amp[4] = { 1.0f, 0.6f, 0.35f, 0.2f };
+	float power = 0.0f;
+	float sigma;
+	float phase;
+	float s;
+
+	for(uint32_t h = 0; h < 4; h++)
+		power += 0.5f * amp[h] * amp[h];
+	sigma = sqrtf(power / powf(10.0f, snr_db / 10.0f));
+
+	for(uint32_t i = 0; i < n; i++) {
+		phase = 2.0f * PI * f0 * (float)i / (float)rate;
+
+		s = sigma * bench_noise();
+		for(uint32_t h = 0; h < 4; h++) {
+			if((float)(h + 1) * f0 < 0.45f * (float)rate)
+				s += amp[h] * sinf((float)(h + 1) * phase);
+		}
+
+		/* about -12 dBFS for the clean tone */
+		s *= 0.12f * 32767.0f;
+		if(s > 32767.0f)
+			s = 32767.0f;
+		if(s < -32768.0f)
+			s = -32768.0f;
+		x[i] = (int16_t)s;
+	}
+}
+
+/**
+ * 	@fn bench_run()
+ *  @brief feeds samples in capture sized blocks, scores the periodic
+ *  frames against truth_hz when it is not 0
+ *
+ *  @param
+ *  @return
+ */
+static void bench_run(const int16_t *x, uint32_t n, float truth_hz, bench_score_t *score)
+{
+	bee_pitch_frame_t est;
+	struct timespec t0;
+	struct timespec t1;
+	uint32_t used;
+	uint32_t block;
+	float cents;
+
+	memset(score, 0, sizeof(*score));
+	bee_pitch_reset(&tracker, &plan);
+
+	for(uint32_t i = 0; i < n; i += block) {
+		block = (n - i < BENCH_BLOCK) ? n - i : BENCH_BLOCK;
+
+		for(uint32_t done = 0; done < block; done += used) {
+			used = bee_pitch_feed(&tracker, &plan, &x[i + done], block - done);
+			if(!bee_pitch_frame_ready(&tracker))
+				continue;
+
+			clock_gettime(CLOCK_MONOTONIC, &t0);
+			bee_pitch_estimate(&tracker, &plan, &est);
+			clock_gettime(CLOCK_MONOTONIC, &t1);
+			score->ns += (t1.tv_sec - t0.tv_sec) * 1e9 + (t1.tv_nsec - t0.tv_nsec);
+			score->frames++;
+
+			if(verbose) {
+				printf("%.4f,%.2f,%.3f,%u\n", (double)(i + done + used) / (plan.rate_hz *
+						plan.decimation), est.f0_hz, est.confidence, est.periodic);
+			}
+
+			if(!est.periodic)
+				continue;
+
+			score->periodic++;
+			if(truth_hz > 0.0f) {
+				cents = fabsf(1200.0f * log2f(est.f0_hz / truth_hz));
+				if(cents > BENCH_GROSS_CENTS)
+					score->gross++;
+				else
+					score->cents += cents;
+			}
+		}
+	}
+}
+
+/**
+ * 	@fn bench_synthetic()
+ *  @brief tracker accuracy and cost over the synthetic sweep
+ *
+ *  @param
+ *  @return
+ */
+static int bench_synthetic(void)
+{
+	static const uint32_t rates[] = BENCH_RATES;
+	static const float f0s[] = BENCH_F0_HZ;
+	static const float snrs[] = BENCH_SNR_DB;
+	bench_score_t score;
+	uint32_t n;
+	uint32_t fine;
+
+	printf("rate  dec  f0_hz  snr_db  frames  periodic%%  gross%%  mean_cents  ns/frame  fft_bin_hz\n");
+
+	for(uint32_t r = 0; r < sizeof(rates) / sizeof(rates[0]); r++) {
+		if(bee_pitch_plan(&plan, min_hz, max_hz, threshold, rates[r]) != k_bee_ret_ok) {
+			printf("%u: range %u-%u Hz does not fit\n", rates[r], min_hz, max_hz);
+			continue;
+		}
+
+		n = rates[r] * BENCH_SECONDS;
+		for(uint32_t f = 0; f < sizeof(f0s) / sizeof(f0s[0]); f++) {
+			if(f0s[f] < (float)min_hz || f0s[f] > (float)max_hz)
+				continue;
+
+			for(uint32_t s = 0; s < sizeof(snrs) / sizeof(snrs[0]); s++) {
+				srand(rates[r] + f * 31 + s);
+				bench_tone(samples, n, rates[r], f0s[f], snrs[s]);
+				bench_run(samples, n, f0s[f], &score);
+
+				fine = score.periodic - score.gross;
+				printf("%5u %4u %6.0f %7.0f %7u %10.1f %7.1f %11.2f %9.0f %11.2f\n",
+						rates[r], plan.decimation, f0s[f], snrs[s], score.frames,
+						(score.frames) ? 100.0 * score.periodic / score.frames : 0.0,
+						(score.periodic) ? 100.0 * score.gross / score.periodic : 0.0,
+						(fine) ? score.cents / fine : 0.0,
+						(score.frames) ? score.ns / score.frames : 0.0,
+						(float)rates[r] / (float)FFT_POINTS);
+			}
+		}
+	}
+
+	return(0);
+}
+
+int main(int argc, char **argv)
+{
+	bench_score_t score;
+	int16_t *x;
+	uint32_t rate;
+	uint32_t channels;
+	uint32_t n;
+	uint32_t files = 0;
+
+	for(int i = 1; i < argc; i++) {
+		if(!strcmp(argv[i], "-r") && i + 2 < argc) {
+			min_hz = atoi(argv[++i]);
+			max_hz = atoi(argv[++i]);
+		} else if(!strcmp(argv[i], "-t") && i + 1 < argc) {
+			threshold = strtof(argv[++i], NULL);
+		} else if(!strcmp(argv[i], "-v")) {
+			verbose = true;
+		} else if(argv[i][0] == '-') {
+			fprintf(stderr, "usage: %s [-r min_hz max_hz] [-t threshold] [-v] "
+					"[file.wav ...]\n", argv[0]);
+			return(1);
+		}
+	}
+
+	for(int i = 1; i < argc; i++) {
+		if(argv[i][0] == '-') {
+			i += (!strcmp(argv[i], "-r")) ? 2 : (!strcmp(argv[i], "-t")) ? 1 : 0;
+			continue;
+		}
+
+		files++;
+		x = NULL;
+		n = host_wav_read(argv[i], &x, &rate, &channels);
+		if(n == 0) {
+			fprintf(stderr, "%s: not a 16 bit PCM WAV file\n", argv[i]);
+			continue;
+		}
+
+		/* tracked on the first channel */
+		for(uint32_t k = 0; k < n; k++)
+			x[k] = x[k * channels];
+
+		if(bee_pitch_plan(&plan, min_hz, max_hz, threshold, rate) != k_bee_ret_ok) {
+			fprintf(stderr, "%s: range %u-%u Hz does not fit %u Hz\n", argv[i],
+					min_hz, max_hz, rate);
+			free(x);
+			continue;
+		}
+
+		if(verbose)
+			printf("time_s,f0_hz,confidence,periodic\n");
+
+		bench_run(x, n, 0.0f, &score);
+		printf("%s: %u Hz, decimation %u, %u frames, %.1f%% periodic, %.0f ns per frame\n",
+				argv[i], rate, plan.decimation, score.frames,
+				(score.frames) ? 100.0 * score.periodic / score.frames : 0.0,
+				(score.frames) ? score.ns / score.frames : 0.0);
+		free(x);
+	}
+
+	return((files) ? 0 : bench_synthetic());
+}
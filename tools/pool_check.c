@@ -0,0 +1,467 @@
+/*
+ *  @file pool_check.c
+ *  @brief checks the capture frame pool on a PC, the DMA callbacks are run
+ *  by the BSP stand in as the IRQ would, between and while the frames are
+ *  held by a consumer, ownership, stamps, overruns and profile switches
+ *  are checked, then the callbacks run from a timer signal preempting the
+ *  consumer anywhere, as the DMA IRQ does, while it takes, checks, holds
+ *  and releases frames
+ *
+ *  build:
+ *  D=Drivers/CMSIS/DSP/Source
+ *  cc -O2 -DBEE_HOST_BUILD -DBEE_HOST_PIPELINE -DHOST_IRQ_SIGNAL=SIGALRM -DARM_MATH_CM0 \
+ *     -include tools/host_cmsis.h \
+ *     -Isrc -Itools -IDrivers/CMSIS/Include -IDrivers/CMSIS/DSP/Include \
+ *     tools/pool_check.c tools/host_bsp.c tools/host_cmsis.c \
+ *     src/event_queue.c src/bee_audio_acquisition.c src/bee_dsp.c src/bee_fastlog.c \
+ *     src/bee_fft.c src/bee_fft_tables.c src/bee_stft.c src/bee_goertzel.c src/bee_zoom.c \
+ *     src/bee_pitch.c src/bee_psd.c src/bee_noise.c src/bee_features.c src/bee_mel.c \
+ *     src/bee_mel_tables.c src/bee_classifier.c src/bee_model_default.c \
+ *     src/bee_trigger.c src/bee_baseline.c src/bee_spectrogram.c \
+ *     $(find $D -name '*.c') -lm -o pool_check
+ *
+ *  usage:
+ *  pool_check
+ *
+ *  exits with 1 on the first failed check
+ */
+
+#include "lilbee.h"
+#include <stdio.h>
+#include <sys/time.h>
+
+#ifndef HOST_IRQ_SIGNAL
+#error "pool_check runs the DMA callbacks from a signal, build it with HOST_IRQ_SIGNAL=SIGALRM"
+#endif
+
+
+/* frames alternate a loud tone and a quiet one, so the plane of a frame
+ * tells which part of the stream it holds
+ */
+#define CHECK_PROFILE		k_audio_profile_16k
+#define CHECK_SWITCH		k_audio_profile_32k
+#define CHECK_TONE_HZ		1000.0f
+#define CHECK_LOUD			8000.0f
+#define CHECK_QUIET			50.0f
+
+/* samples the DC removal of the BSP kernel takes to settle after a level
+ * step, the level of a plane is checked past them
+ */
+#define CHECK_SETTLE		64
+
+/* frames captured while the consumer keeps up, then while it holds one */
+#define CHECK_KEEP_UP		12
+#define CHECK_HELD			(AUDIO_FRAME_RING_LEN + 3)
+
+/* frames taken while the IRQ preempts the consumer, one in CHECK_ASYNC_HOLD
+ * is held past the pool length, the IRQ fires every CHECK_IRQ_US
+ */
+#define CHECK_ASYNC_FRAMES	600
+#define CHECK_ASYNC_HOLD	8
+#define CHECK_IRQ_US		20
+
+/** internal variables */
+static uint16_t held_copy[AUDIO_CHANNELS * AUDIO_FRAME_SIZE];
+static volatile uint64_t pushed = 0;
+static volatile uint32_t irqs = 0;
+static uint32_t checks = 0;
+static uint32_t frame_size = 0;
+
+/** internal functions */
+
+/**
+ * 	@fn check()
+ *  @brief counts a check, stops the run on a failed one
+ *
+ *  @param
+ *  @return
+ */
+static void check(bool ok, const char *what)
+{
+	checks++;
+	if(ok)
+		return;
+
+	fprintf(stderr, "pool: check %u failed, %s\n", checks, what);
+	exit(1);
+}
+
+/**
+ * 	@fn check_push()
+ *  @brief converts one block on every channel as the DMA IRQ does
+ *
+ *  @param
+ *  @return
+ */
+static void check_push(void)
+{
+	static int16_t pcm[AUDIO_BLOCK_SIZE * AUDIO_CHANNELS];
+	uint32_t block = host_bsp_block_size();
+	uint32_t rate = audio_get_profile()->sample_rate;
+	uint64_t n;
+	float amp;
+
+	for(uint32_t i = 0; i < block; i++) {
+		n = pushed + i;
+		amp = ((n / frame_size) & 1) ? CHECK_LOUD : CHECK_QUIET;
+
+		for(uint32_t ch = 0; ch < AUDIO_CHANNELS; ch++)
+			pcm[i * AUDIO_CHANNELS + ch] = (int16_t)(amp * sinf(2.0f * PI * CHECK_TONE_HZ *
+					(float)n / (float)rate));
+	}
+
+	host_bsp_push(pcm, AUDIO_CHANNELS);
+	pushed += block;
+}
+
+/**
+ * 	@fn check_irq()
+ *  @brief DMA IRQ of the asynchronous run, preempts the consumer anywhere
+ *  it has not masked it
+ *
+ *  @param
+ *  @return
+ */
+static void check_irq(int sig)
+{
+	(void)sig;
+
+	check_push();
+	irqs++;
+}
+
+/**
+ * 	@fn check_irq_timer()
+ *  @brief starts the IRQ timer, or stops it with period_us 0
+ *
+ *  @param
+ *  @return
+ */
+static void check_irq_timer(uint32_t period_us)
+{
+	struct itimerval timer;
+	struct sigaction action;
+
+	if(period_us) {
+		memset(&action, 0, sizeof(action));
+		action.sa_handler = check_irq;
+		sigemptyset(&action.sa_mask);
+		sigaction(HOST_IRQ_SIGNAL, &action, NULL);
+	}
+
+	timer.it_interval.tv_sec = 0;
+	timer.it_interval.tv_usec = period_us;
+	timer.it_value = timer.it_interval;
+	setitimer(ITIMER_REAL, &timer, NULL);
+}
+
+/**
+ * 	@fn check_frames()
+ *  @brief pushes the blocks of frames frames
+ *
+ *  @param
+ *  @return
+ */
+static void check_frames(uint32_t frames)
+{
+	for(uint32_t i = 0; i < frames * frame_size / host_bsp_block_size(); i++)
+		check_push();
+}
+
+/**
+ * 	@fn check_events()
+ *  @brief serves the capture events, returns the frames announced
+ *
+ *  @param
+ *  @return
+ */
+static uint32_t check_events(void)
+{
+	system_event_t ev;
+	uint32_t ret = 0;
+
+	while((ev = event_queue_get()) != k_noevent) {
+		audio_handler(ev);
+		if(ev == k_dsp_incoming_audio_available)
+			ret++;
+	}
+
+	return(ret);
+}
+
+/**
+ * 	@fn check_frame()
+ *  @brief checks a frame taken from the pool against the stream, its
+ *  planes hold the samples of its own place in the stream and its level
+ *  was accumulated over them
+ *
+ *  @param
+ *  @return
+ */
+static void check_frame(audio_frame_t *frame, uint64_t sample_index)
+{
+	const int16_t *plane;
+	uint64_t energy;
+	uint64_t tail;
+	float rms;
+	bool loud = (sample_index / frame_size) & 1;
+
+	check(frame->state == k_audio_frame_processing, "taken frame is not owned");
+	check(frame->size == frame_size, "frame size is not the profile one");
+	check(frame->channels == AUDIO_CHANNELS, "frame channels changed");
+	check(frame->sample_index == sample_index, "frame is not the next of the stream");
+
+	for(uint32_t ch = 0; ch < AUDIO_CHANNELS; ch++) {
+		plane = (const int16_t *)audio_frame_channel(frame, ch);
+		check(plane == (const int16_t *)&frame->audio_buffer[ch * frame->size],
+				"channel plane is off the frame buffer");
+
+		energy = 0;
+		tail = 0;
+		for(uint32_t i = 0; i < frame->size; i++) {
+			energy += (uint64_t)((int64_t)plane[i] * plane[i]);
+			if(i >= CHECK_SETTLE)
+				tail += (uint64_t)((int64_t)plane[i] * plane[i]);
+		}
+
+		check(energy == frame->energy[ch], "frame level is not the one of its samples");
+
+		rms = sqrtf((float)tail / (float)(frame->size - CHECK_SETTLE));
+		check((loud) ? rms > 0.5f * CHECK_LOUD / (float)M_SQRT2 :
+				rms < 2.0f * CHECK_QUIET, "plane holds samples of another frame");
+	}
+
+	check(audio_frame_channel(frame, AUDIO_CHANNELS) == NULL, "plane past the channels");
+}
+
+/** public functions */
+
+int main(void)
+{
+	audio_stats_t stats;
+	audio_frame_t *frame;
+	audio_frame_t *held;
+	uint64_t next_index = 0;
+	uint64_t start;
+	uint32_t next_sequence = 0;
+	uint32_t dropped;
+	uint32_t taken;
+	uint32_t captured;
+	uint32_t overruns;
+	uint32_t announced;
+	uint32_t gaps;
+
+	event_queue_init();
+	bee_trigger_init();
+	audio_acq_init();
+	check(audio_set_profile(CHECK_PROFILE) == k_bee_ret_ok, "profile not taken");
+	frame_size = audio_get_profile()->frame_size;
+
+	audio_start_capture();
+	check_events();
+	check(audio_get_current_frame() == NULL, "frame ready before any block");
+
+	/* consumer keeps up, every frame comes once, in order, with no gap */
+	for(uint32_t f = 0; f < CHECK_KEEP_UP; f++) {
+		check_frames(1);
+		check(check_events() == 1, "frame not announced once");
+
+		frame = audio_get_current_frame();
+		check(frame != NULL, "announced frame not ready");
+		check_frame(frame, next_index);
+		check(frame->sequence == next_sequence, "sequence skipped without overrun");
+		check(frame->flags == 0, "gap flagged without overrun");
+		check(audio_get_current_frame() == NULL, "frame handed out twice");
+
+		audio_release_frame(frame);
+		check(frame->state == k_audio_frame_free, "released frame not free");
+		next_index += frame_size;
+		next_sequence++;
+	}
+
+	audio_get_stats(&stats);
+	check(stats.captured_frames == CHECK_KEEP_UP && stats.overruns == 0,
+			"counters off while keeping up");
+
+	/* the consumer holds a frame while the IRQ keeps converting, the held
+	 * frame is never written and the pool refills its last free frame
+	 */
+	check_frames(1);
+	check_events();
+	held = audio_get_current_frame();
+	check(held != NULL, "frame to hold not ready");
+	check_frame(held, next_index);
+	memcpy(held_copy, held->audio_buffer, AUDIO_CHANNELS * held->size * sizeof(uint16_t));
+	next_index += frame_size;
+	next_sequence++;
+
+	check_frames(CHECK_HELD);
+	taken = check_events();
+	check(!memcmp(held_copy, held->audio_buffer, AUDIO_CHANNELS * held->size * sizeof(uint16_t)),
+			"held frame written by the IRQ");
+	check(held->state == k_audio_frame_processing, "held frame taken back");
+
+	audio_get_stats(&stats);
+	check(taken == AUDIO_FRAME_RING_LEN - 2, "pool did not fill up to the held frame");
+	check(stats.pending_frames == taken, "ready frames not counted");
+	check(stats.overruns == CHECK_HELD - taken, "overruns not counted on refills");
+
+	/* the held frame still comes first, the ready ones follow in order */
+	check(audio_get_current_frame() == NULL, "frame handed out past the held one");
+	audio_release_frame(held);
+
+	for(uint32_t f = 0; f < taken; f++) {
+		frame = audio_get_current_frame();
+		check(frame != NULL, "ready frame lost");
+		check_frame(frame, next_index);
+		check(frame->sequence == next_sequence, "ready frames out of order");
+		check(frame->flags == 0, "ready frame flagged");
+		audio_release_frame(frame);
+		next_index += frame_size;
+		next_sequence++;
+	}
+
+	/* the refilled frame holds the newest samples, flagged after the hole */
+	check_frames(1);
+	check_events();
+	dropped = stats.overruns;
+	frame = audio_get_current_frame();
+	check(frame != NULL, "refilled frame not ready");
+	check_frame(frame, next_index + (uint64_t)dropped * frame_size);
+	check(frame->sequence == next_sequence + dropped, "sequence has no hole for the refills");
+	check(frame->flags & AUDIO_FRAME_GAP, "refilled frame not flagged");
+	audio_release_frame(frame);
+
+	/* releasing twice or a frame not owned does nothing */
+	audio_release_frame(frame);
+	audio_release_frame(NULL);
+	check(audio_get_current_frame() == NULL, "released frame handed out again");
+
+	/* a restart flags the first frame and keeps the counters running */
+	audio_stop_capture();
+	check_events();
+	audio_start_capture();
+	check_events();
+	next_index = pushed;
+	check_frames(1);
+	check_events();
+	frame = audio_get_current_frame();
+	check(frame != NULL, "frame after restart not ready");
+	check(frame->sample_index == next_index, "restart lost the sample count");
+	check(frame->flags & AUDIO_FRAME_GAP, "restart not flagged");
+	audio_release_frame(frame);
+
+	/* a profile switch waits for the frame the dsp holds, the pool is
+	 * restarted on the new profile once the frame is released
+	 */
+	check_frames(1);
+	check_events();
+	held = audio_get_current_frame();
+	check(held != NULL, "frame to hold before the switch not ready");
+	memcpy(held_copy, held->audio_buffer, AUDIO_CHANNELS * held->size * sizeof(uint16_t));
+
+	check(audio_set_profile(CHECK_SWITCH) == k_bee_ret_ok, "switch not taken");
+	check_events();
+	check(audio_get_profile_id() == CHECK_SWITCH, "pending switch not reported");
+	check(audio_get_profile()->frame_size == frame_size, "profile switched under the held frame");
+	check(host_bsp_block_size() == 0, "capture not stopped for the switch");
+	check(held->state == k_audio_frame_processing, "held frame taken back by the switch");
+	check(!memcmp(held_copy, held->audio_buffer, AUDIO_CHANNELS * held->size * sizeof(uint16_t)),
+			"held frame written by the switch");
+
+	audio_release_frame(held);
+	event_queue_put(k_dsp_endprocess);
+	check_events();
+	check(audio_get_profile_id() == CHECK_SWITCH &&
+			host_bsp_block_size() == audio_get_profile()->sample_rate / AUDIO_WINDOW_LEN,
+			"switch not run on the release");
+
+	frame_size = audio_get_profile()->frame_size;
+	next_index = pushed;
+	check_frames(1);
+	check_events();
+	frame = audio_get_current_frame();
+	check(frame != NULL, "frame after the switch not ready");
+	check(frame->size == frame_size && frame->sample_index == next_index,
+			"frame after the switch not on the new profile");
+	audio_release_frame(frame);
+
+	/* with nothing held the switch runs at once */
+	check(audio_set_profile(CHECK_PROFILE) == k_bee_ret_ok, "switch back not taken");
+	check_events();
+	check(audio_get_profile()->frame_size != frame_size && host_bsp_block_size() != 0,
+			"switch with no frame held deferred");
+	frame_size = audio_get_profile()->frame_size;
+
+	check_frames(1);
+	check_events();
+	frame = audio_get_current_frame();
+	check(frame != NULL && (frame->flags & AUDIO_FRAME_GAP), "restart of the switch back not flagged");
+	next_sequence = frame->sequence + 1;
+	audio_release_frame(frame);
+
+	/* the IRQ now preempts the consumer anywhere, frames still come in
+	 * order, whole and announced once, a hole in the stream is always
+	 * flagged and held frames are never written
+	 */
+	audio_get_stats(&stats);
+	captured = stats.captured_frames;
+	overruns = stats.overruns;
+	start = pushed;
+	next_index = start;
+	announced = 0;
+	taken = 0;
+	gaps = 0;
+
+	check_irq_timer(CHECK_IRQ_US);
+
+	while(taken < CHECK_ASYNC_FRAMES) {
+		announced += check_events();
+		frame = audio_get_current_frame();
+		if(frame == NULL)
+			continue;
+
+		if(frame->flags & AUDIO_FRAME_GAP) {
+			check(frame->sample_index > next_index &&
+					(frame->sample_index - next_index) % frame_size == 0,
+					"flagged frame is not past a hole of whole frames");
+			dropped = (uint32_t)((frame->sample_index - next_index) / frame_size);
+			check(frame->sequence == next_sequence + dropped, "sequence does not match the hole");
+			gaps++;
+		} else {
+			check(frame->sample_index == next_index, "hole in the stream not flagged");
+			check(frame->sequence == next_sequence, "sequence skipped without a hole");
+		}
+		check_frame(frame, frame->sample_index);
+
+		/* hold one past the pool length so the IRQ refills around it */
+		if(taken % CHECK_ASYNC_HOLD == CHECK_ASYNC_HOLD - 1) {
+			memcpy(held_copy, frame->audio_buffer, AUDIO_CHANNELS * frame->size * sizeof(uint16_t));
+			for(uint64_t until = pushed + (AUDIO_FRAME_RING_LEN + 1) * frame_size; pushed < until;)
+				;
+			check(!memcmp(held_copy, frame->audio_buffer,
+					AUDIO_CHANNELS * frame->size * sizeof(uint16_t)),
+					"held frame written by the preempting IRQ");
+			check(frame->state == k_audio_frame_processing, "held frame taken back by the IRQ");
+		}
+
+		next_index = frame->sample_index + frame_size;
+		next_sequence = frame->sequence + 1;
+		audio_release_frame(frame);
+		taken++;
+	}
+
+	check_irq_timer(0);
+	announced += check_events();
+
+	audio_get_stats(&stats);
+	check(gaps > 0, "holding past the pool made no hole");
+	check(announced == stats.captured_frames - captured, "frames announced and captured differ");
+	check((stats.captured_frames - captured) + (stats.overruns - overruns) ==
+			(pushed - start) / frame_size, "frames converted lost from the counters");
+
+	printf("pool: %u checks passed, %u channels, %u frames of %u samples, "
+			"%u irqs preempting %u frames, %u holes\n", checks, AUDIO_CHANNELS,
+			AUDIO_FRAME_RING_LEN, frame_size, irqs, taken, gaps);
+	return(0);
+}